@@ -0,0 +1,135 @@
+/*
+ *  Archive timing (archive-timing):
+ *  Timing of the XML and binary serialization of populations with Open BEAGLE
+ *
+ *  Copyright (C) 2003-2006 by Christian Gagne and Marc Parizeau
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   ArchiveTimingMain.cpp
+ *  \brief  Compare the XML and binary serialization times of a population.
+ *  $Revision: $
+ *  $Date: $
+ *
+ *  Usage: archive-timing [individuals [floats [repetitions]]]
+ *
+ *  A population of individuals made of a float vector and a simple fitness is written
+ *  and read back, with the XML format and with the binary archive, as done by the HPC
+ *  transport. The size of the messages and the mean time of each operation are printed.
+ */
+
+#include "Beagle/EC.hpp"
+#include "Beagle/FltVec.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std;
+using namespace Beagle;
+
+
+/*!
+ *  \brief Main routine of the archive timing program.
+ *  \param argc Number of arguments on the command-line.
+ *  \param argv Arguments on the command-line.
+ *  \return Return value of the program.
+ */
+int main(int argc, char** argv)
+{
+	try {
+		const unsigned int lNbIndividuals = (argc > 1) ? str2uint(argv[1]) : 10000;
+		const unsigned int lNbFloats = (argc > 2) ? str2uint(argv[2]) : 100;
+		const unsigned int lNbRepetitions = (argc > 3) ? str2uint(argv[3]) : 5;
+
+		// Build the system and the population
+		System::Handle lSystem = new System;
+		lSystem->addPackage(new FltVec::Package(lNbFloats));
+		lSystem->replaceComponentsByConcepts();
+		lSystem->registerComponentParams();
+		UInt::Handle(castHandleT<UInt>(lSystem->getRegister()["lg.console.level"]))->getWrappedValue() = Logger::eNothing;
+		String::Handle(castHandleT<String>(lSystem->getRegister()["lg.file.name"]))->getWrappedValue() = "";
+		lSystem->initComponents();
+		Context::Handle lContext = new Context;
+		lContext->setSystemHandle(lSystem);
+		Randomizer& lRandomizer = lSystem->getRandomizer();
+		Deme::Handle lDeme = new Deme;
+		for(unsigned int i=0; i<lNbIndividuals; ++i) {
+			FltVec::FloatVector::Handle lVector = new FltVec::FloatVector(lNbFloats);
+			for(unsigned int j=0; j<lNbFloats; ++j) (*lVector)[j] = lRandomizer.rollGaussian();
+			Individual::Handle lIndividual = new Individual;
+			lIndividual->push_back(lVector);
+			lIndividual->setFitness(new EC::FitnessSimple(lRandomizer.rollUniform()));
+			lDeme->push_back(lIndividual);
+		}
+
+		PACC::Timer lTimer;
+		double lXMLWrite = 0.0, lXMLRead = 0.0, lBinaryWrite = 0.0, lBinaryRead = 0.0;
+		std::string lXMLMessage, lBinaryMessage;
+		Deme::Handle lRead = new Deme;
+		for(unsigned int r=0; r<lNbRepetitions; ++r) {
+			// XML
+			lTimer.reset();
+			std::ostringstream lOutStream;
+			PACC::XML::Streamer lStreamer(lOutStream);
+			lDeme->writePopulation(lStreamer, false);
+			lXMLMessage = lOutStream.str();
+			lXMLWrite += lTimer.getValue();
+			lTimer.reset();
+			std::istringstream lInStream(lXMLMessage);
+			PACC::XML::Document lDocument(lInStream);
+			lRead->readPopulation(lDocument.getFirstRoot(), *lContext);
+			lXMLRead += lTimer.getValue();
+
+			// Binary
+			lTimer.reset();
+			BinaryOutArchive lOutArchive;
+			lOutArchive.writeHeader();
+			lDeme->writePopulationBinary(lOutArchive);
+			lBinaryMessage = lOutArchive.getBuffer();
+			lBinaryWrite += lTimer.getValue();
+			lTimer.reset();
+			BinaryInArchive lInArchive(lBinaryMessage);
+			lInArchive.readHeader();
+			lRead->readPopulationBinary(lInArchive, *lContext);
+			lBinaryRead += lTimer.getValue();
+		}
+
+		cout << lNbIndividuals << " individuals of " << lNbFloats << " floats, ";
+		cout << lNbRepetitions << " repetitions" << endl;
+		cout << "format  bytes       write (s)   read (s)" << endl;
+		cout << "XML     " << lXMLMessage.size() << "  " << (lXMLWrite / lNbRepetitions);
+		cout << "  " << (lXMLRead / lNbRepetitions) << endl;
+		cout << "binary  " << lBinaryMessage.size() << "  " << (lBinaryWrite / lNbRepetitions);
+		cout << "  " << (lBinaryRead / lNbRepetitions) << endl;
+	} catch(Exception& inException) {
+		inException.terminate(cerr);
+	} catch(std::exception& inException) {
+		cerr << "Standard exception caught:" << endl << flush;
+		cerr << inException.what() << endl << flush;
+		return 1;
+	}
+	return 0;
+}
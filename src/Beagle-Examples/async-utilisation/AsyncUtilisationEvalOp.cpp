@@ -0,0 +1,99 @@
+/*
+ *  Evaluators utilisation (async-utilisation):
+ *  Utilisation of heterogeneous HPC evaluators by the asynchronous steady-state algorithm
+ *
+ *  Copyright (C) 2003-2006 by Christian Gagne and Marc Parizeau
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   AsyncUtilisationEvalOp.cpp
+ *  \brief  Implementation of the class AsyncUtilisationEvalOp.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/EC.hpp"
+#include "Beagle/BitStr.hpp"
+#include "Beagle/HPC.hpp"
+#include "AsyncUtilisationEvalOp.hpp"
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Construct the individual evaluation operator of the evaluators utilisation example.
+ */
+AsyncUtilisationEvalOp::AsyncUtilisationEvalOp() :
+		EvaluationOp("AsyncUtilisationEvalOp"),
+		mRank(1)
+{ }
+
+
+/*!
+ *  \brief Register the parameters of the evaluation operator.
+ *  \param ioSystem Evolutionary system.
+ */
+void AsyncUtilisationEvalOp::registerParams(System& ioSystem)
+{
+	EvaluationOp::registerParams(ioSystem);
+	Register::Description lDescription(
+	    "Evaluation time of an individual",
+	    "Double",
+	    "0.001",
+	    "Time, in seconds, taken to evaluate an individual by the node of MPI rank 1. The node of rank r takes r times longer."
+	);
+	mCost = castHandleT<Double>(
+	            ioSystem.getRegister().insertEntry("au.eval.cost", new Double(0.001), lDescription));
+}
+
+
+/*!
+ *  \brief Initialize the evaluation operator, getting the MPI rank of the node.
+ *  \param ioSystem Evolutionary system.
+ */
+void AsyncUtilisationEvalOp::init(System& ioSystem)
+{
+	EvaluationOp::init(ioSystem);
+	HPC::MPICommunication::Handle lComm =
+	    castHandleT<HPC::MPICommunication>(ioSystem.getComponent("MPICommunication"));
+	if(lComm == NULL) {
+		throw Beagle_RunTimeExceptionM("MPI communication component should be added to system!");
+	}
+	mRank = lComm->getNodeRank()->getWrappedValue();
+}
+
+
+/*!
+ *  \brief Evaluate the fitness of the given individual, taking a time proportional to the node rank.
+ *  \param inIndividual Current individual to evaluate.
+ *  \param ioContext Evolutionary context.
+ *  \return Handle to the fitness value of the individual.
+ */
+Fitness::Handle AsyncUtilisationEvalOp::evaluate(Individual& inIndividual, Context& ioContext)
+{
+	Beagle_AssertM(inIndividual.size() == 1);
+	BitStr::BitString::Handle lBitString = castHandleT<BitStr::BitString>(inIndividual[0]);
+	PACC::Threading::Thread::sleep(mCost->getWrappedValue() * mRank);
+	return new EC::FitnessSimple(float(lBitString->count()));
+}
@@ -0,0 +1,93 @@
+/*
+ *  Evaluators utilisation (async-utilisation):
+ *  Utilisation of heterogeneous HPC evaluators by the asynchronous steady-state algorithm
+ *
+ *  Copyright (C) 2003-2006 by Christian Gagne and Marc Parizeau
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   AsyncUtilisationEvalOp.hpp
+ *  \brief  Definition of the type AsyncUtilisationEvalOp.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+/*!
+ *  \defgroup AsyncUtilisation Evaluators Utilisation Example
+ *  \brief Evaluators utilisation (async-utilisation): utilisation of heterogeneous HPC
+ *    evaluators by the asynchronous steady-state algorithm of Open BEAGLE.
+ *
+ *  \par Objective
+ *  Find a bit string filled with ones, with evaluators of different speeds.
+ *
+ *  \par Representation
+ *  Bit strings made of N bits.
+ *
+ *  \par Fitness
+ *  Number of ones in the bit string. The evaluator of MPI rank r takes r times the time
+ *  given by parameter au.eval.cost to evaluate an individual.
+ *
+ */
+
+#ifndef AsyncUtilisationEvalOp_hpp
+#define AsyncUtilisationEvalOp_hpp
+
+#include "Beagle/EC.hpp"
+
+
+/*!
+ *  \class AsyncUtilisationEvalOp AsyncUtilisationEvalOp.hpp "AsyncUtilisationEvalOp.hpp"
+ *  \brief OneMax evaluation operator, slowed down in proportion to the MPI rank of the node.
+ *  \ingroup AsyncUtilisation
+ */
+class AsyncUtilisationEvalOp : public Beagle::EvaluationOp
+{
+
+public:
+
+	//! AsyncUtilisationEvalOp allocator type.
+	typedef Beagle::AllocatorT<AsyncUtilisationEvalOp,Beagle::EvaluationOp::Alloc>
+	Alloc;
+	//!< AsyncUtilisationEvalOp handle type.
+	typedef Beagle::PointerT<AsyncUtilisationEvalOp,Beagle::EvaluationOp::Handle>
+	Handle;
+	//!< AsyncUtilisationEvalOp bag type.
+	typedef Beagle::ContainerT<AsyncUtilisationEvalOp,Beagle::EvaluationOp::Bag>
+	Bag;
+
+	explicit AsyncUtilisationEvalOp();
+
+	virtual void registerParams(Beagle::System& ioSystem);
+	virtual void init(Beagle::System& ioSystem);
+	virtual Beagle::Fitness::Handle evaluate(Beagle::Individual& inIndividual,
+	        Beagle::Context& ioContext);
+
+protected:
+
+	Beagle::Double::Handle mCost;   //!< Evaluation time of an individual by the node of rank 1.
+	unsigned int           mRank;   //!< MPI rank of the node.
+
+};
+
+#endif // AsyncUtilisationEvalOp_hpp
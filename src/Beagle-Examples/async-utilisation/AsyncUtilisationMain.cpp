@@ -0,0 +1,97 @@
+/*
+ *  Evaluators utilisation (async-utilisation):
+ *  Utilisation of heterogeneous HPC evaluators by the asynchronous steady-state algorithm
+ *
+ *  Copyright (C) 2003-2006 by Christian Gagne and Marc Parizeau
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   AsyncUtilisationMain.cpp
+ *  \brief  Measure the utilisation of heterogeneous evaluators by HPC::AsyncSteadyStateOp.
+ *  $Revision: $
+ *  $Date: $
+ *
+ *  Usage: mpirun -np <nodes> async-utilisation [-OB<parameters>]
+ *
+ *  The OneMax problem is solved with HPC::AlgoAsynchronous, the evaluators pulling their
+ *  offsprings by chunks of hpc.distribute.chunksize individuals. The evaluator of MPI
+ *  rank r takes r times au.eval.cost seconds to evaluate an individual, so that the
+ *  evaluators have different speeds. At each generation, the evolvers log, at the info
+ *  level, the utilisation of their evaluators measured by HPC::AsyncSteadyStateOp, that
+ *  is the ratio of the time the evaluators spent with a chunk to the duration of the
+ *  generation, barrier included.
+ */
+
+#include "Beagle/EC.hpp"
+#include "Beagle/BitStr.hpp"
+#include "Beagle/HPC.hpp"
+#include "AsyncUtilisationEvalOp.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+using namespace Beagle;
+
+
+/*!
+ *  \brief Main routine of the evaluators utilisation example.
+ *  \param argc Number of arguments on the command-line.
+ *  \param argv Arguments on the command-line.
+ *  \return Return value of the program.
+ *  \ingroup AsyncUtilisation
+ */
+int main(int argc, char** argv)
+{
+	try {
+		// Build the system
+		System::Handle lSystem = new System;
+		// Install the bit string and HPC packages
+		lSystem->addPackage(new BitStr::Package(64));
+		lSystem->addPackage(new HPC::PackageBase);
+		// Add evaluation operator allocator
+		lSystem->setEvaluationOp("AsyncUtilisationEvalOp", new AsyncUtilisationEvalOp::Alloc);
+		// Set the asynchronous steady-state algorithm
+		lSystem->getFactory().setConcept("Algorithm", "HPC-AlgoAsynchronous");
+		// Initialize the evolver
+		Evolver::Handle lEvolver = new Evolver;
+		lEvolver->initialize(lSystem, argc, argv);
+		// Create population
+		Vivarium::Handle lVivarium = new Vivarium;
+		// Launch evolution
+		lEvolver->evolve(lVivarium, lSystem);
+	} catch(Beagle::Exception& inException) {
+		inException.terminate(cerr);
+	} catch(std::exception& inException) {
+		cerr << "Standard exception caught:" << endl << flush;
+		cerr << inException.what() << endl << flush;
+		return 1;
+	} catch(MPI::Exception& inException){
+		cerr << inException.Get_error_string() << endl << flush;
+		MPI::COMM_WORLD.Abort(1);
+		return 1;
+	}
+	return 0;
+}
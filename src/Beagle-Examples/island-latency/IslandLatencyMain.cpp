@@ -0,0 +1,163 @@
+/*
+ *  Island latency (island-latency):
+ *  Timing of the migrations between islands connected by TCP/IP on localhost
+ *
+ *  Copyright (C) 2003-2006 by Christian Gagne and Marc Parizeau
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   IslandLatencyMain.cpp
+ *  \brief  Measure the latency of the migrations between TCP/IP islands on localhost.
+ *  $Revision: $
+ *  $Date: $
+ *
+ *  Usage: island-latency [islands [migrants [floats [rounds [port]]]]]
+ *
+ *  Each island has its own CommunicationsTCPIP component, listening on its own port of
+ *  localhost, and knows the next island of a ring.  A message made of migrants serialized
+ *  as by TransportSendOp is passed around the ring: each island forwards it to the next
+ *  one as soon as it receives it.  The time of the first round, which opens the
+ *  connections, and the mean time of a hop over the following rounds, on the connections
+ *  kept open, are printed.
+ */
+
+#include "Beagle/EC.hpp"
+#include "Beagle/FltVec.hpp"
+#include "Beagle/Island.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+using namespace Beagle;
+
+#ifdef BEAGLE_HAVE_SYS_SOCKET_H
+
+/*!
+ *  \brief Wait until an island received the message of the ring.
+ *  \param ioComms Communications component of the island.
+ *  \param outMessage Message received.
+ *  \param ioContext Evolutionary context.
+ */
+static void waitMigration(Distrib::Island::Communications& ioComms,
+                          std::string& outMessage,
+                          Context& ioContext)
+{
+	for(;;) {
+		ioComms.getMessages(ioContext);
+		if(ioComms.getNextMessage("migration", outMessage, ioContext)) return;
+		PACC::Threading::Thread::sleep(1.0e-5);
+	}
+}
+
+#endif // BEAGLE_HAVE_SYS_SOCKET_H
+
+
+/*!
+ *  \brief Main routine of the island latency program.
+ *  \param argc Number of arguments on the command-line.
+ *  \param argv Arguments on the command-line.
+ *  \return Return value of the program.
+ */
+int main(int argc, char** argv)
+{
+#ifdef BEAGLE_HAVE_SYS_SOCKET_H
+	try {
+		const unsigned int lNbIslands = (argc > 1) ? str2uint(argv[1]) : 4;
+		const unsigned int lNbMigrants = (argc > 2) ? str2uint(argv[2]) : 10;
+		const unsigned int lNbFloats = (argc > 3) ? str2uint(argv[3]) : 100;
+		const unsigned int lNbRounds = (argc > 4) ? str2uint(argv[4]) : 100;
+		const unsigned int lBasePort = (argc > 5) ? str2uint(argv[5]) : 4500;
+		if((lNbIslands < 2) || (lNbRounds < 2)) {
+			cerr << "At least 2 islands and 2 rounds are needed" << endl;
+			return 1;
+		}
+
+		// Build the system and the migrants
+		System::Handle lSystem = new System;
+		lSystem->addPackage(new FltVec::Package(lNbFloats));
+		lSystem->replaceComponentsByConcepts();
+		lSystem->registerComponentParams();
+		UInt::Handle(castHandleT<UInt>(lSystem->getRegister()["lg.console.level"]))->getWrappedValue() = Logger::eNothing;
+		String::Handle(castHandleT<String>(lSystem->getRegister()["lg.file.name"]))->getWrappedValue() = "";
+		lSystem->initComponents();
+		Context::Handle lContext = new Context;
+		lContext->setSystemHandle(lSystem);
+		Randomizer& lRandomizer = lSystem->getRandomizer();
+		Individual::Bag lMigrants;
+		for(unsigned int i=0; i<lNbMigrants; ++i) {
+			FltVec::FloatVector::Handle lVector = new FltVec::FloatVector(lNbFloats);
+			for(unsigned int j=0; j<lNbFloats; ++j) (*lVector)[j] = lRandomizer.rollGaussian();
+			Individual::Handle lIndividual = new Individual;
+			lIndividual->push_back(lVector);
+			lIndividual->setFitness(new EC::FitnessSimple(lRandomizer.rollUniform()));
+			lMigrants.push_back(lIndividual);
+		}
+		std::string lMessage = lMigrants.serialize();
+
+		// Build the islands, each one knowing the next one of the ring
+		std::vector<Distrib::Island::CommunicationsTCPIP::Handle> lIslands;
+		for(unsigned int i=0; i<lNbIslands; ++i) {
+			lIslands.push_back(new Distrib::Island::CommunicationsTCPIP(lBasePort+i));
+			lIslands[i]->addAddress("next", PACC::Socket::Address(lBasePort+((i+1)%lNbIslands), "127.0.0.1"));
+			lIslands[i]->init(*lSystem);
+		}
+
+		// Pass the migrants around the ring
+		PACC::Timer lTimer;
+		double lFirstRound = 0.0;
+		std::string lReceived;
+		for(unsigned int r=0; r<lNbRounds; ++r) {
+			if(r == 1) lTimer.reset();
+			for(unsigned int i=0; i<lNbIslands; ++i) {
+				lIslands[i]->sendMessage("next", "migration", lMessage, *lContext);
+				waitMigration(*lIslands[(i+1)%lNbIslands], lReceived, *lContext);
+				if(lReceived != lMessage) {
+					cerr << "Message corrupted between islands " << i << " and " << ((i+1)%lNbIslands) << endl;
+					return 1;
+				}
+			}
+			if(r == 0) lFirstRound = lTimer.getValue();
+		}
+		const double lHop = lTimer.getValue() / ((lNbRounds-1) * lNbIslands);
+
+		cout << lNbIslands << " islands, " << lNbMigrants << " migrants of " << lNbFloats;
+		cout << " floats (" << lMessage.size() << " bytes), " << lNbRounds << " rounds" << endl;
+		cout << "first round (connecting): " << lFirstRound << " s" << endl;
+		cout << "mean hop (connections kept open): " << lHop << " s" << endl;
+	} catch(Exception& inException) {
+		inException.terminate(cerr);
+	} catch(std::exception& inException) {
+		cerr << "Standard exception caught:" << endl << flush;
+		cerr << inException.what() << endl << flush;
+		return 1;
+	}
+	return 0;
+#else // BEAGLE_HAVE_SYS_SOCKET_H
+	cerr << "The TCP/IP communications of the islands are not available on this platform" << endl;
+	return 1;
+#endif // BEAGLE_HAVE_SYS_SOCKET_H
+}
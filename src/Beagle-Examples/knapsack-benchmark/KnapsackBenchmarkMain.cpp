@@ -0,0 +1,140 @@
+/*
+ *  Knapsack benchmark (knapsack-benchmark):
+ *  Hypervolume of the fronts of the multiobjective knapsack with NSGA2, NPGA2 and SMS-EMOA
+ *
+ *  Copyright (C) 2003-2006 by Christian Gagne and Marc Parizeau
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   KnapsackBenchmarkMain.cpp
+ *  \brief  Compare the knapsack fronts of NSGA2, NPGA2 and SMS-EMOA by their hypervolume.
+ *  $Revision: $
+ *  $Date: $
+ *
+ *  Usage: knapsack-benchmark [runs [configuration directory]]
+ *
+ *  The knapsack example is run with the configuration files knapsack-nsga2.conf,
+ *  knapsack-npga2.conf and knapsack-smsemoa.conf, once for each random seed from 1 to the
+ *  number of runs, so that the three algorithms solve the same problems. After each run,
+ *  the exact hypervolume of the final population is computed from reference point (0,0),
+ *  and the mean and standard deviation of the hypervolumes and run times of each algorithm
+ *  are printed.
+ */
+
+#include "Beagle/EC.hpp"
+#include "Beagle/BitStr.hpp"
+#include "Beagle/EMO.hpp"
+#include "../knapsack/KnapsackEvalOp.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+using namespace Beagle;
+
+
+/*!
+ *  \brief Run the knapsack problem once.
+ *  \param inConfiguration Name of the configuration file.
+ *  \param inSeed Random seed of the run.
+ *  \param outTime Time of the run, in seconds.
+ *  \return Hypervolume of the final population, from reference point (0,0).
+ */
+static double runKnapsack(const std::string& inConfiguration, unsigned int inSeed, double& outTime)
+{
+	// The configuration is given on the command-line, as to the knapsack example.
+	std::vector<std::string> lArguments;
+	lArguments.push_back("knapsack-benchmark");
+	lArguments.push_back("-OBconf="+inConfiguration);
+	lArguments.push_back("-OBec.rand.seed="+uint2str(inSeed)+",lg.console.level=0,lg.file.level=0,"+
+	                     "ms.write.prefix=knapsack-benchmark");
+	std::vector<char*> lArgv;
+	for(unsigned int i=0; i<lArguments.size(); ++i) lArgv.push_back(&lArguments[i][0]);
+
+	PACC::Timer lTimer;
+	System::Handle lSystem = new System;
+	lSystem->addPackage(new BitStr::Package(24));
+	lSystem->addPackage(new EMO::PackageMultiObj);
+	lSystem->setEvaluationOp("KnapsackEvalOp", new KnapsackEvalOp::Alloc);
+	Evolver::Handle lEvolver = new Evolver;
+	lEvolver->initialize(lSystem, lArgv.size(), &lArgv[0]);
+	Vivarium::Handle lVivarium = new Vivarium;
+	lEvolver->evolve(lVivarium, lSystem);
+	outTime = lTimer.getValue();
+
+	// Dominated individuals do not change the hypervolume of the population.
+	std::vector<double> lObjectives, lDemeObjectives;
+	unsigned int lNbObjectives = 0;
+	for(unsigned int i=0; i<lVivarium->size(); ++i) {
+		if(EMO::NondominatedSorting::extractObjectives(lDemeObjectives, lNbObjectives, *(*lVivarium)[i]) == false) {
+			throw Beagle_RunTimeExceptionM("The final population has invalid or non multiobjective fitnesses!");
+		}
+		lObjectives.insert(lObjectives.end(), lDemeObjectives.begin(), lDemeObjectives.end());
+	}
+	return EMO::Hypervolume::compute(lObjectives, lNbObjectives, std::vector<double>(lNbObjectives, 0.0));
+}
+
+
+/*!
+ *  \brief Main routine of the knapsack benchmark.
+ *  \param argc Number of arguments on the command-line.
+ *  \param argv Arguments on the command-line.
+ *  \return Return value of the program.
+ */
+int main(int argc, char** argv)
+{
+	try {
+		const unsigned int lNbRuns = (argc > 1) ? str2uint(argv[1]) : 10;
+		const std::string lDirectory = (argc > 2) ? (std::string(argv[2])+"/") : std::string("");
+		const char* lAlgorithms[] = {"nsga2", "npga2", "smsemoa"};
+
+		cout << lNbRuns << " runs of each algorithm, hypervolume from reference point (0,0)" << endl;
+		cout << "algorithm  hypervolume (mean, std dev)  time (s, mean)" << endl;
+		for(unsigned int a=0; a<3; ++a) {
+			double lSum = 0.0, lSumSquares = 0.0, lSumTimes = 0.0;
+			for(unsigned int r=1; r<=lNbRuns; ++r) {
+				double lTime = 0.0;
+				const double lVolume =
+				    runKnapsack(lDirectory+"knapsack-"+lAlgorithms[a]+".conf", r, lTime);
+				lSum += lVolume;
+				lSumSquares += lVolume * lVolume;
+				lSumTimes += lTime;
+			}
+			const double lMean = lSum / lNbRuns;
+			const double lVariance = (lNbRuns > 1) ? ((lSumSquares - (lNbRuns * lMean * lMean)) / (lNbRuns-1)) : 0.0;
+			cout << lAlgorithms[a] << "  " << lMean << "  " << std::sqrt(std::max(lVariance, 0.0));
+			cout << "  " << (lSumTimes / lNbRuns) << endl;
+		}
+	} catch(Exception& inException) {
+		inException.terminate(cerr);
+	} catch(std::exception& inException) {
+		cerr << "Standard exception caught:" << endl << flush;
+		cerr << inException.what() << endl << flush;
+		return 1;
+	}
+	return 0;
+}
@@ -67,11 +67,9 @@ Fitness::Handle KnapsackEvalOp::evaluate(Individual& inIndividual, Context& ioCo
 	BitStr::BitString::Handle lBitString = castHandleT<BitStr::BitString>(inIndividual[0]);
 	float lValue  = 0.0;
 	float lWeight = 0.0;
-	for(unsigned int i=0; i<lBitString->size(); ++i) {
-		if((*lBitString)[i]) {
-			lValue  += (*mObjectValues)[i];
-			lWeight += (*mObjectWeights)[i];
-		}
+	for(unsigned int i=lBitString->findNextSet(0); i<lBitString->size(); i=lBitString->findNextSet(i+1)) {
+		lValue  += (*mObjectValues)[i];
+		lWeight += (*mObjectWeights)[i];
 	}
 	EMO::FitnessMultiObj::Handle lFitness = new EMO::FitnessMultiObj(2);
 	(*lFitness)[0] = lValue;
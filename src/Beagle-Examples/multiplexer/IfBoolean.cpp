@@ -64,5 +64,13 @@ void IfBoolean::execute(GP::Datum& outDatum, GP::Context& ioContext)
 }
 
 
-
-
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the IfBoolean primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool IfBoolean::getInstruction(GP::Instruction& outInstruction) const
+{
+	outInstruction.mOpcode = GP::Instruction::eIfBool;
+	return true;
+}
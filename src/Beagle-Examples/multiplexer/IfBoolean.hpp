@@ -65,6 +65,7 @@ public:
 	{ }
 
 	virtual void execute(Beagle::GP::Datum& outDatum, Beagle::GP::Context& ioContext);
+	virtual bool getInstruction(Beagle::GP::Instruction& outInstruction) const;
 
 };
 
@@ -80,6 +80,15 @@ void MultiplexerEvalOp::init(System& ioSystem)
 		if(mInputs[i][2]) lIndexOutput += 4;
 		mOutputs[i] = mInputs[i][lIndexOutput];
 	}
+
+	// Set the test tables as columns of fitness cases, to evaluate trees in batch
+	const char* lInputNames[11] = {"A0","A1","A2","D0","D1","D2","D3","D4","D5","D6","D7"};
+	mFitnessCases.resize(2048);
+	for(unsigned int j=0; j<11; ++j) {
+		std::vector<bool> lColumn(2048);
+		for(unsigned int i=0; i<2048; ++i) lColumn[i] = mInputs[i][j].getWrappedValue();
+		mFitnessCases.setColumn(lInputNames[j], lColumn);
+	}
 }
 
 
@@ -91,22 +100,11 @@ void MultiplexerEvalOp::init(System& ioSystem)
  */
 Fitness::Handle MultiplexerEvalOp::evaluate(GP::Individual& inIndividual, GP::Context& ioContext)
 {
+	std::vector<bool> lResults;
+	runBatch(lResults, inIndividual, ioContext, mFitnessCases);
 	unsigned int lNbGood = 0;
 	for(unsigned int i=0; i<2048; ++i) {
-		setValue("A0", mInputs[i][0], ioContext);
-		setValue("A1", mInputs[i][1], ioContext);
-		setValue("A2", mInputs[i][2], ioContext);
-		setValue("D0", mInputs[i][3], ioContext);
-		setValue("D1", mInputs[i][4], ioContext);
-		setValue("D2", mInputs[i][5], ioContext);
-		setValue("D3", mInputs[i][6], ioContext);
-		setValue("D4", mInputs[i][7], ioContext);
-		setValue("D5", mInputs[i][8], ioContext);
-		setValue("D6", mInputs[i][9], ioContext);
-		setValue("D7", mInputs[i][10], ioContext);
-		Bool lResult;
-		inIndividual.run(lResult, ioContext);
-		if(lResult.getWrappedValue() == mOutputs[i].getWrappedValue()) ++lNbGood;
+		if(lResults[i] == mOutputs[i].getWrappedValue()) ++lNbGood;
 	}
 	double lFitness = double(lNbGood) / 2048.;
 	return new EC::FitnessSimple(lFitness);
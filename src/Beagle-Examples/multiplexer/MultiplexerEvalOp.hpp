@@ -105,6 +105,7 @@ protected:
 
 	std::vector< std::vector<Beagle::Bool> > mInputs;
 	std::vector<Beagle::Bool>                mOutputs;
+	Beagle::GP::FitnessCases                 mFitnessCases;
 
 };
 
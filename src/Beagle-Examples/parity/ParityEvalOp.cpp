@@ -83,6 +83,7 @@ void ParityEvalOp::init(System& ioSystem)
 		}
 		mOutputs[i] = lParity;
 	}
+	mArguments.bind("IN", ParityFanInM, ioSystem);
 }
 
 
@@ -97,9 +98,7 @@ Fitness::Handle ParityEvalOp::evaluate(GP::Individual& inIndividual, GP::Context
 	unsigned int lGood = 0;
 	for(unsigned int i=0; i<ParitySizeM; i++) {
 		for(unsigned int j=0; j<ParityFanInM; j++) {
-			std::string lName = "IN";
-			lName += uint2str(j);
-			setValue(lName, mInputs[i][j], ioContext);
+			mArguments.setValue(j, mInputs[i][j].getWrappedValue(), ioContext);
 		}
 		Bool lResult;
 		inIndividual.run(lResult, ioContext);
@@ -110,6 +110,7 @@ public:
 protected:
 	std::vector< std::vector<Beagle::Bool> > mInputs;
 	std::vector<Beagle::Bool>                mOutputs;
+	Beagle::GP::ArgumentBindings             mArguments;
 
 };
 
@@ -139,6 +139,9 @@ void ParityFastEvalOp::init(System& ioSystem)
 		mOutputs[j] = lOutput;
 	}
 
+	// Resolve input terminals once, they are set by index during evaluation
+	mArguments.bind("IN", ParitySizeM, ioSystem);
+
 	// Display outputs
 	/*
 	std::cerr << "OUT\n";
@@ -162,9 +165,7 @@ Fitness::Handle ParityFastEvalOp::evaluate(GP::Individual& inIndividual, GP::Con
 	for (unsigned int j=0; j<mNumInts; ++j) {
 		// Set inputs
 		for(unsigned int i=0; i<ParitySizeM; i++) {
-			std::string lName = "IN";
-			lName += uint2str(i);
-			setValue(lName, mInputs[i][j], ioContext);
+			mArguments.setValue(i, mInputs[i][j].getWrappedValue(), ioContext);
 		}
 
 		// Evaluate individual
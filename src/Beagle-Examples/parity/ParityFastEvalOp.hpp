@@ -119,6 +119,7 @@ protected:
 	std::vector<Beagle::Int>                mOutputs;
 	unsigned int                            mNumInts;
 	unsigned int                            mParityRows;
+	Beagle::GP::ArgumentBindings            mArguments;
 
 };
 
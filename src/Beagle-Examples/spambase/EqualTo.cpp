@@ -94,5 +94,13 @@ void EqualTo::execute(GP::Datum& outDatum, GP::Context& ioContext)
 }
 
 
-
-
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the EqualTo primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool EqualTo::getInstruction(GP::Instruction& outInstruction) const
+{
+	outInstruction.mOpcode = GP::Instruction::eEqualDouble;
+	return true;
+}
@@ -75,6 +75,7 @@ public:
 #endif // BEAGLE_HAVE_RTTI
 
 	virtual void                  execute(Beagle::GP::Datum& outDatum, Beagle::GP::Context& ioContext);
+	virtual bool                  getInstruction(Beagle::GP::Instruction& outInstruction) const;
 
 };
 
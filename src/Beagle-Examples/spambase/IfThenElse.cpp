@@ -95,5 +95,13 @@ void IfThenElse::execute(GP::Datum& outDatum, GP::Context& ioContext)
 }
 
 
-
-
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the IfThenElse primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool IfThenElse::getInstruction(GP::Instruction& outInstruction) const
+{
+	outInstruction.mOpcode = GP::Instruction::eIfDouble;
+	return true;
+}
@@ -95,5 +95,13 @@ void LessThan::execute(GP::Datum& outDatum, GP::Context& ioContext)
 }
 
 
-
-
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the LessThan primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool LessThan::getInstruction(GP::Instruction& outInstruction) const
+{
+	outInstruction.mOpcode = GP::Instruction::eLessDouble;
+	return true;
+}
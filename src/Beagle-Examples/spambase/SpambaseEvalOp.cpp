@@ -76,19 +76,25 @@ Fitness::Handle SpambaseEvalOp::evaluate(GP::Individual& inIndividual, GP::Conte
 		lSubSet.resize(Spambase_TestSize);
 	}
 
+	// Set sampled test cases as columns of fitness cases
+	const unsigned int lNbInputs = lDataSet->getNumberColumns();
+	GP::FitnessCases lFitnessCases(Spambase_TestSize);
+	std::vector<double> lColumn(Spambase_TestSize);
+	for(unsigned int j=0; j<lNbInputs; ++j) {
+		const double* lValues = lDataSet->getColumn(j);
+		for(unsigned int i=0; i<Spambase_TestSize; ++i) lColumn[i] = lValues[lSubSet[i]];
+		std::ostringstream lOSS;
+		lOSS << "IN" << j;
+		lFitnessCases.setColumn(lOSS.str(), lColumn);
+	}
+
 	// Evaluate sampled test cases
+	std::vector<bool> lResults;
+	runBatch(lResults, inIndividual, ioContext, lFitnessCases);
 	unsigned int lCorrectCount = 0;
 	for(unsigned int i=0; i<Spambase_TestSize; ++i) {
-		const bool lPositiveID = ((*lDataSet)[lSubSet[i]].first == 1);
-		const Beagle::Vector& lData = (*lDataSet)[lSubSet[i]].second;
-		for(unsigned int j=0; j<lData.size(); ++j) {
-			std::ostringstream lOSS;
-			lOSS << "IN" << j;
-			setValue(lOSS.str(), Double(lData[j]), ioContext);
-		}
-		Bool lResult;
-		inIndividual.run(lResult, ioContext);
-		if(lResult.getWrappedValue() == lPositiveID) ++lCorrectCount;
+		const bool lPositiveID = (lDataSet->getLabel(lSubSet[i]) == 1);
+		if(lResults[i] == lPositiveID) ++lCorrectCount;
 	}
 	double lFitness = double(lCorrectCount) / Spambase_TestSize;
 	return new EC::FitnessSimple(lFitness);
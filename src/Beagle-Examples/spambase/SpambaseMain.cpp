@@ -145,12 +145,7 @@ int main(int argc, char *argv[])
 		
 		// Read and add classification data set of spambase data
 		DataSetClassification::Handle lDataSet = new DataSetClassification("DataSet");
-		std::ifstream lIFS("spambase.data");
-		if(!lIFS) {
-			throw Beagle_RunTimeExceptionM("Could not open spambase data file 'spambase.data'!");;
-		}
-		lDataSet->readCSV(lIFS);
-		lIFS.close();
+		lDataSet->readCSV(std::string("spambase.data"));
 		lSystem->addComponent(lDataSet);
 
 		// Set fitness evaluation operator
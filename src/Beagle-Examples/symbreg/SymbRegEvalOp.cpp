@@ -58,15 +58,11 @@ SymbRegEvalOp::SymbRegEvalOp() :
  */
 Fitness::Handle SymbRegEvalOp::evaluate(GP::Individual& inIndividual, GP::Context& ioContext)
 {
+	std::vector<double> lResults;
+	runBatch(lResults, inIndividual, ioContext, mFitnessCases);
 	double lSquareError = 0.;
 	for(unsigned int i=0; i<mDataSet->size(); i++) {
-		Beagle_AssertM((*mDataSet)[i].second.size() == 1);
-		const Double lX((*mDataSet)[i].second[0]);
-		setValue("X", lX, ioContext);
-		const Double lY((*mDataSet)[i].first);
-		Double lResult;
-		inIndividual.run(lResult, ioContext);
-		const double lError = lY-lResult;
+		const double lError = mDataSet->getTarget(i) - lResults[i];
 		lSquareError += (lError*lError);
 	}
 	const double lMSE  = lSquareError / mDataSet->size();
@@ -92,13 +88,17 @@ void SymbRegEvalOp::init(System& ioSystem)
 
 	// If data set is empty, initialize it with random samples of quartic polynomial
 	if(mDataSet->size() == 0) {
-		mDataSet->resize(20);
+		mDataSet->resize(20, 1);
 		for(unsigned int i=0; i<mDataSet->size(); i++) {
 			const double lX = ioSystem.getRandomizer().rollUniform(-1., 1.);
 			const double lY = lX*(lX*(lX*(lX+1.)+1.)+1.);
-			(*mDataSet)[i].first = lY;
-			(*mDataSet)[i].second.resize(1);
-			(*mDataSet)[i].second[0] = lX;
+			mDataSet->getTarget(i) = lY;
+			mDataSet->getValue(i,0) = lX;
 		}
 	}
+
+	// Set the sampled values of X as a column of fitness cases, to evaluate trees in batch
+	Beagle_AssertM(mDataSet->getNumberColumns() == 1);
+	mFitnessCases.resize(mDataSet->size());
+	mFitnessCases.setColumn("X", mDataSet->getColumn(0), mDataSet->size());
 }
@@ -109,7 +109,8 @@ public:
 
 protected:
 
-	Beagle::DataSetRegression::Handle mDataSet;  //!< Set of sampled data.
+	Beagle::DataSetRegression::Handle mDataSet;       //!< Set of sampled data.
+	Beagle::GP::FitnessCases          mFitnessCases;  //!< Sampled data, as GP fitness cases.
 
 };
 
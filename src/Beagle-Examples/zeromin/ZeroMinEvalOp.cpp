@@ -61,9 +61,6 @@ Fitness::Handle ZeroMinEvalOp::evaluate(Individual& inIndividual, Context& ioCon
 {
 	Beagle_AssertM(inIndividual.size() == 1);
 	BitStr::BitString::Handle lBitString = castHandleT<BitStr::BitString>(inIndividual[0]);
-	unsigned int lCount = 0;
-	for(unsigned int i=0; i<lBitString->size(); ++i) {
-		if((*lBitString)[i] == true) ++lCount;
-	}
+	const unsigned int lCount = lBitString->count();
 	return new EC::FitnessSimpleMin(float(lCount));
 }
@@ -0,0 +1,377 @@
+/*
+ *  Binary archive round-trip test (archive-roundtrip):
+ *  Regression test of the binary archive of Open BEAGLE
+ *
+ *  Copyright (C) 2003-2006 by Christian Gagne and Marc Parizeau
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   ArchiveRoundTripTest.cpp
+ *  \brief  Check that individuals, fitnesses and populations survive a binary round-trip.
+ *  $Revision: $
+ *  $Date: $
+ *
+ *  Objects are written in a BinaryOutArchive, read back from a BinaryInArchive, and the
+ *  XML serialization of the object read is compared with the one of the original object.
+ *  Both single-objective (FitnessSimple) and multiobjective (FitnessMultiObj) fitnesses
+ *  are checked, valid and invalid, as well as individuals without fitness.  Individuals
+ *  are made of a bit string, a float vector, an integer vector and a SA-ES pair vector.
+ *  GP individuals are checked in a GP system, with a Koza's fitness and a main tree
+ *  calling an ADF on ephemeral constants, the ADF using its arguments.
+ */
+
+#include "Beagle/EC.hpp"
+#include "Beagle/EMO.hpp"
+#include "Beagle/BitStr.hpp"
+#include "Beagle/FltVec.hpp"
+#include "Beagle/IntVec.hpp"
+#include "Beagle/SAES.hpp"
+#include "Beagle/GP.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+using namespace Beagle;
+
+static unsigned int gNbFailures = 0;   //!< Number of failed checks.
+
+
+/*!
+ *  \brief Report the result of a check.
+ *  \param inName Name of the check.
+ *  \param inOk Whether the check passed.
+ */
+static void report(const std::string& inName, bool inOk)
+{
+	cout << (inOk ? "ok     " : "FAILED ") << inName << endl;
+	if(inOk == false) ++gNbFailures;
+}
+
+
+/*!
+ *  \brief Initialize a system, without logging.
+ *  \param ioSystem System to initialize, with its packages added.
+ */
+static void initSystem(System& ioSystem)
+{
+	ioSystem.replaceComponentsByConcepts();
+	ioSystem.registerComponentParams();
+	UInt::Handle(castHandleT<UInt>(ioSystem.getRegister()["lg.console.level"]))->getWrappedValue() = Logger::eNothing;
+	String::Handle(castHandleT<String>(ioSystem.getRegister()["lg.file.name"]))->getWrappedValue() = "";
+	ioSystem.initComponents();
+}
+
+
+/*!
+ *  \brief Build a quiet system, with the vector and multiobjective packages.
+ *  \return Handle to the system built.
+ */
+static System::Handle buildSystem()
+{
+	System::Handle lSystem = new System;
+	lSystem->addPackage(new BitStr::Package(100));
+	lSystem->addPackage(new FltVec::Package(10));
+	lSystem->addPackage(new IntVec::Package(10));
+	lSystem->addPackage(new SAES::Package(10));
+	lSystem->addPackage(new EMO::PackageMultiObj);
+	initSystem(*lSystem);
+	return lSystem;
+}
+
+
+/*!
+ *  \brief Build an individual with random bit string, float, integer and pair vectors.
+ *  \param ioSystem Evolutionary system.
+ *  \param inFitness Fitness of the individual, possibly NULL.
+ *  \return Handle to the individual built.
+ */
+static Individual::Handle buildIndividual(System& ioSystem, Fitness::Handle inFitness)
+{
+	Randomizer& lRandomizer = ioSystem.getRandomizer();
+	Individual::Handle lIndividual = new Individual;
+	BitStr::BitString::Handle lBS = new BitStr::BitString(100);
+	for(unsigned int i=0; i<lBS->size(); ++i) (*lBS)[i] = (lRandomizer.rollUniform() < 0.5);
+	lIndividual->push_back(lBS);
+	FltVec::FloatVector::Handle lFV = new FltVec::FloatVector(10);
+	for(unsigned int i=0; i<lFV->size(); ++i) (*lFV)[i] = lRandomizer.rollGaussian(0.0, 100.0);
+	lIndividual->push_back(lFV);
+	IntVec::IntegerVector::Handle lIV = new IntVec::IntegerVector(10);
+	for(unsigned int i=0; i<lIV->size(); ++i) (*lIV)[i] = int(lRandomizer.rollInteger(0, 2000)) - 1000;
+	lIndividual->push_back(lIV);
+	SAES::PairVector::Handle lPV = new SAES::PairVector(10);
+	for(unsigned int i=0; i<lPV->size(); ++i) {
+		(*lPV)[i] = SAES::Pair(lRandomizer.rollGaussian(0.0, 100.0), lRandomizer.rollUniform(0.01, 2.0));
+	}
+	lIndividual->push_back(lPV);
+	lIndividual->setFitness(inFitness);
+	return lIndividual;
+}
+
+
+/*!
+ *  \brief Check the round-trip of a fitness, alone and as the fitness of an individual.
+ *  \param inName Name of the check.
+ *  \param inFitness Fitness to check.
+ *  \param inEmpty Empty fitness of the same type, into which the fitness is read.
+ *  \param ioContext Evolutionary context.
+ */
+static void checkFitness(const std::string& inName,
+                         Fitness::Handle inFitness,
+                         Fitness::Handle inEmpty,
+                         Context& ioContext)
+{
+	BinaryOutArchive lOutArchive;
+	lOutArchive.writeHeader();
+	inFitness->writeBinary(lOutArchive);
+	BinaryInArchive lInArchive(lOutArchive.getBuffer());
+	lInArchive.readHeader();
+	inEmpty->readBinary(lInArchive, ioContext);
+	report(inName+" fitness", lInArchive.isEnd() && (inEmpty->serialize() == inFitness->serialize()));
+
+	Individual::Handle lIndividual = buildIndividual(ioContext.getSystem(), inFitness);
+	lOutArchive.clear();
+	lOutArchive.writeHeader();
+	lIndividual->writeBinary(lOutArchive);
+	BinaryInArchive lIndivArchive(lOutArchive.getBuffer());
+	lIndivArchive.readHeader();
+	Individual::Handle lRead = new Individual;
+	lRead->readBinary(lIndivArchive, ioContext);
+	report(inName+" individual", lIndivArchive.isEnd() && (lRead->serialize() == lIndividual->serialize()));
+}
+
+
+/*!
+ *  \brief Check the round-trip of a population.
+ *  \param inName Name of the check.
+ *  \param inDeme Deme of the population to check.
+ *  \param ioContext Evolutionary context.
+ */
+static void checkPopulation(const std::string& inName, const Deme& inDeme, Context& ioContext)
+{
+	BinaryOutArchive lOutArchive;
+	lOutArchive.writeHeader();
+	inDeme.writePopulationBinary(lOutArchive);
+	BinaryInArchive lInArchive(lOutArchive.getBuffer());
+	lInArchive.readHeader();
+	Deme::Handle lRead = new Deme;
+	lRead->readPopulationBinary(lInArchive, ioContext);
+	bool lOk = lInArchive.isEnd() && (lRead->size() == inDeme.size());
+	for(unsigned int i=0; lOk && (i<inDeme.size()); ++i) {
+		lOk = ((*lRead)[i]->serialize() == inDeme[i]->serialize());
+	}
+	report(inName+" population", lOk);
+}
+
+
+/*!
+ *  \brief Build a quiet GP system, with a primitive set having ephemeral constants, ADFs
+ *    and arguments.
+ *  \return Handle to the system built.
+ */
+static System::Handle buildGPSystem()
+{
+	GP::PrimitiveSet::Handle lSet = new GP::PrimitiveSet;
+	lSet->insert(new GP::Add);
+	lSet->insert(new GP::Multiply);
+	lSet->insert(new GP::TokenT<Double>("X"));
+	lSet->insert(new GP::EphemeralDouble);
+	lSet->insert(new GP::ADF);
+	lSet->insert(new GP::ArgumentT<Double>);
+	System::Handle lSystem = new System;
+	lSystem->addPackage(new GP::PackageBase(lSet));
+	initSystem(*lSystem);
+	return lSystem;
+}
+
+
+/*!
+ *  \brief Build a GP individual of two trees, the main tree calling the second one as an ADF.
+ *  \param ioSystem Evolutionary system, built by buildGPSystem.
+ *  \param inFitness Fitness of the individual, possibly NULL.
+ *  \return Handle to the individual built.
+ *
+ *  The main tree is (ADD (ADF X E) (ADF E E)), with three ephemeral constants, and the ADF
+ *  is (ADD ARG0 (MUL ARG1 E)).  The same ADF instance is used twice in the main tree.
+ */
+static GP::Individual::Handle buildGPIndividual(System& ioSystem, Fitness::Handle inFitness)
+{
+	Randomizer& lRandomizer = ioSystem.getRandomizer();
+	GP::PrimitiveSuperSet::Handle lSuperSet =
+	    castHandleT<GP::PrimitiveSuperSet>(ioSystem.getComponent("GP-PrimitiveSuperSet"));
+	GP::PrimitiveSet& lSet = *(*lSuperSet)[0];
+	GP::Argument::Handle lArgument = castHandleT<GP::Argument>(lSet.getPrimitiveByName("ARG"));
+
+	GP::Tree::Handle lMain = new GP::Tree(0, 0, 0);
+	GP::Primitive::Handle lADF = new GP::ADF(1, 2);
+	lMain->push_back(GP::Node(lSet.getPrimitiveByName("ADD"), 0));
+	lMain->push_back(GP::Node(lADF, 0));
+	lMain->push_back(GP::Node(lSet.getPrimitiveByName("X"), 0));
+	lMain->push_back(GP::Node(new GP::EphemeralDouble(new Double(lRandomizer.rollGaussian())), 0));
+	lMain->push_back(GP::Node(lADF, 0));
+	lMain->push_back(GP::Node(new GP::EphemeralDouble(new Double(lRandomizer.rollGaussian())), 0));
+	lMain->push_back(GP::Node(new GP::EphemeralDouble(new Double(lRandomizer.rollGaussian())), 0));
+	lMain->fixSubTreeSize(0);
+
+	GP::Tree::Handle lCalled = new GP::Tree(0, 0, 2);
+	lCalled->push_back(GP::Node(lSet.getPrimitiveByName("ADD"), 0));
+	lCalled->push_back(GP::Node(lArgument->generateArgument(0), 0));
+	lCalled->push_back(GP::Node(lSet.getPrimitiveByName("MUL"), 0));
+	lCalled->push_back(GP::Node(lArgument->generateArgument(1), 0));
+	lCalled->push_back(GP::Node(new GP::EphemeralDouble(new Double(lRandomizer.rollGaussian())), 0));
+	lCalled->fixSubTreeSize(0);
+
+	GP::Individual::Handle lIndividual = new GP::Individual;
+	lIndividual->push_back(lMain);
+	lIndividual->push_back(lCalled);
+	lIndividual->setFitness(inFitness);
+	return lIndividual;
+}
+
+
+/*!
+ *  \brief Check the round-trip of GP individuals, alone and in a population.
+ *  \param ioContext GP evolutionary context, in a system built by buildGPSystem.
+ */
+static void checkGP(GP::Context& ioContext)
+{
+	System& lSystem = ioContext.getSystem();
+	Randomizer& lRandomizer = lSystem.getRandomizer();
+
+	// Koza's fitness, valid and invalid.
+	Fitness::Handle lKoza = new GP::FitnessKoza(0.25f, 0.5f, 1.0f, 2.0f, 7);
+	BinaryOutArchive lOutArchive;
+	lOutArchive.writeHeader();
+	lKoza->writeBinary(lOutArchive);
+	lKoza->setInvalid();
+	lKoza->writeBinary(lOutArchive);
+	BinaryInArchive lInArchive(lOutArchive.getBuffer());
+	lInArchive.readHeader();
+	Fitness::Handle lReadValid = new GP::FitnessKoza;
+	lReadValid->readBinary(lInArchive, ioContext);
+	Fitness::Handle lReadInvalid = new GP::FitnessKoza;
+	lReadInvalid->readBinary(lInArchive, ioContext);
+	report("Koza fitness", lInArchive.isEnd() && lReadValid->isValid() &&
+	       (lReadValid->serialize() == GP::FitnessKoza(0.25f, 0.5f, 1.0f, 2.0f, 7).serialize()) &&
+	       (lReadInvalid->serialize() == lKoza->serialize()));
+
+	// GP individual, read with itself as individual of the context.
+	GP::Individual::Handle lIndividual = buildGPIndividual(lSystem, new GP::FitnessKoza(0.75f, 0.5f, 1.0f, 3.0f, 2));
+	lOutArchive.clear();
+	lOutArchive.writeHeader();
+	lIndividual->writeBinary(lOutArchive);
+	BinaryInArchive lIndivArchive(lOutArchive.getBuffer());
+	lIndivArchive.readHeader();
+	GP::Individual::Handle lRead = new GP::Individual;
+	ioContext.setIndividualHandle(lRead);
+	lRead->readBinary(lIndivArchive, ioContext);
+	bool lOk = lIndivArchive.isEnd() && (lRead->size() == 2) && (lRead->serialize() == lIndividual->serialize());
+	if(lOk) {
+		const GP::Tree& lMain = *(*lRead)[0];
+		const GP::Invoker& lADF = castObjectT<const GP::Invoker&>(*lMain[1].mPrimitive);
+		lOk = (lADF.getIndex() == 1) && (lADF.getNumberArguments() == 2) && (lMain[0].mSubTreeSize == 7) &&
+		      ((*lRead)[1]->getNumberArguments() == 2);
+	}
+	report("GP individual", lOk);
+
+	// GP population.
+	Deme::Handle lDeme = new Deme;
+	for(unsigned int i=0; i<20; ++i) {
+		lDeme->push_back(buildGPIndividual(lSystem, new GP::FitnessKoza(float(lRandomizer.rollUniform()), 0.5f, 1.0f, 2.0f, i)));
+	}
+	checkPopulation("GP", *lDeme, ioContext);
+}
+
+
+/*!
+ *  \brief Main routine of the binary archive round-trip test.
+ *  \param argc Number of arguments on the command-line.
+ *  \param argv Arguments on the command-line.
+ *  \return 0 if all the checks passed, 1 if not.
+ */
+int main(int argc, char** argv)
+{
+	try {
+		System::Handle lSystem = buildSystem();
+		Context::Handle lContext = new Context;
+		lContext->setSystemHandle(lSystem);
+
+		// Single-objective fitness, valid and invalid.
+		checkFitness("single-objective", new EC::FitnessSimple(-12.375e-3), new EC::FitnessSimple, *lContext);
+		Fitness::Handle lInvalidSimple = new EC::FitnessSimple(1.0);
+		lInvalidSimple->setInvalid();
+		checkFitness("invalid single-objective", lInvalidSimple, new EC::FitnessSimple, *lContext);
+
+		// Multiobjective fitness, valid and invalid.
+		std::vector<double> lObjectives;
+		lObjectives.push_back(3.25);
+		lObjectives.push_back(-1.0e10);
+		lObjectives.push_back(0.1);
+		checkFitness("multiobjective", new EMO::FitnessMultiObj(lObjectives), new EMO::FitnessMultiObj, *lContext);
+		Fitness::Handle lInvalidMulti = new EMO::FitnessMultiObj(lObjectives);
+		lInvalidMulti->setInvalid();
+		checkFitness("invalid multiobjective", lInvalidMulti, new EMO::FitnessMultiObj, *lContext);
+
+		// Individual without fitness.
+		Individual::Handle lIndividual = buildIndividual(*lSystem, NULL);
+		BinaryOutArchive lOutArchive;
+		lOutArchive.writeHeader();
+		lIndividual->writeBinary(lOutArchive);
+		BinaryInArchive lInArchive(lOutArchive.getBuffer());
+		lInArchive.readHeader();
+		Individual::Handle lRead = new Individual;
+		lRead->readBinary(lInArchive, *lContext);
+		report("individual without fitness", lInArchive.isEnd() && (lRead->getFitness() == NULL) &&
+		       (lRead->serialize() == lIndividual->serialize()));
+
+		// Populations, single-objective and multiobjective.
+		Deme::Handle lSimpleDeme = new Deme;
+		Deme::Handle lMultiDeme = new Deme;
+		Randomizer& lRandomizer = lSystem->getRandomizer();
+		for(unsigned int i=0; i<50; ++i) {
+			lSimpleDeme->push_back(buildIndividual(*lSystem, new EC::FitnessSimple(lRandomizer.rollUniform())));
+			std::vector<double> lValues(2);
+			lValues[0] = lRandomizer.rollUniform();
+			lValues[1] = lRandomizer.rollGaussian();
+			lMultiDeme->push_back(buildIndividual(*lSystem, new EMO::FitnessMultiObj(lValues)));
+		}
+		checkPopulation("single-objective", *lSimpleDeme, *lContext);
+		checkPopulation("multiobjective", *lMultiDeme, *lContext);
+
+		// GP individuals and populations, with Koza's fitnesses.
+		System::Handle lGPSystem = buildGPSystem();
+		GP::Context::Handle lGPContext = new GP::Context;
+		lGPContext->setSystemHandle(lGPSystem);
+		checkGP(*lGPContext);
+
+		return (gNbFailures == 0) ? 0 : 1;
+	} catch(Exception& inException) {
+		inException.terminate(cerr);
+	} catch(std::exception& inException) {
+		cerr << "Standard exception caught:" << endl << flush;
+		cerr << inException.what() << endl << flush;
+	}
+	return 1;
+}
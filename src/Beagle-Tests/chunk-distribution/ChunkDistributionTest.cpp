@@ -0,0 +1,327 @@
+/*
+ *  Chunk distribution test (chunk-distribution):
+ *  Regression test of the pull-based distribution of individuals to the HPC evaluators
+ *
+ *  Copyright (C) 2003-2006 by Christian Gagne and Marc Parizeau
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   ChunkDistributionTest.cpp
+ *  \brief  Check the chunk assignment, sizing and termination of HPC::ProcessingBuffer.
+ *  $Revision: $
+ *  $Date: $
+ *
+ *  The chunk bookkeeping of the processing buffer is checked directly, with a simulated
+ *  clock. The pull protocol itself is run over a loopback transport standing for the MPI
+ *  evaluators, each evaluating its individuals at its own speed: every individual must be
+ *  evaluated exactly once, and every evaluator must end its generation with exactly one
+ *  empty chunk, including when there are fewer individuals than evaluators.
+ */
+
+#include "Beagle/Core.hpp"
+#include "Beagle/HPC/ProcessingBuffer.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+using namespace Beagle;
+
+static unsigned int gNbFailures = 0;   //!< Number of failed checks.
+
+
+/*!
+ *  \brief Report the result of a check.
+ *  \param inName Name of the check.
+ *  \param inOk Whether the check passed.
+ */
+static void report(const std::string& inName, bool inOk)
+{
+	cout << (inOk ? "ok     " : "FAILED ") << inName << endl;
+	if(inOk == false) ++gNbFailures;
+}
+
+
+/*!
+ *  \brief Processing buffer whose latencies are measured on a simulated clock.
+ */
+class SimulatedBuffer : public HPC::ProcessingBuffer {
+public:
+	SimulatedBuffer() : mClock(0.0) { }
+
+	//! Fill the buffer with new individuals.
+	void fill(unsigned int inNbIndividuals)
+	{
+		clear();
+		for(unsigned int i=0; i<inNbIndividuals; ++i) push_back(new Individual, i);
+	}
+
+	double mClock;   //!< Current simulated time.
+
+protected:
+	virtual double getTime() const
+	{
+		return mClock;
+	}
+};
+
+
+/*!
+ *  \brief Loopback transport, evaluating the chunks sent in simulated time.
+ *
+ *  Evaluator i takes inCosts[i] seconds per individual. The transport records every
+ *  message, and flags the protocol errors it sees.
+ */
+class LoopbackTransport {
+public:
+	LoopbackTransport(SimulatedBuffer& ioBuffer, const std::vector<double>& inCosts) :
+		mBuffer(ioBuffer),
+		mCosts(inCosts),
+		mFirst(inCosts.size(), 0),
+		mCount(inCosts.size(), 0),
+		mEnd(inCosts.size(), 0.0),
+		mPosted(inCosts.size(), false),
+		mEnded(inCosts.size(), false),
+		mNbEvaluated(inCosts.size(), 0),
+		mEvaluations(ioBuffer.size(), 0),
+		mError(false)
+	{ }
+
+	void sendChunk(unsigned int inEvaluator, unsigned int inFirst, unsigned int inCount)
+	{
+		if(mEnded[inEvaluator] || mPosted[inEvaluator]) mError = true;
+		mFirst[inEvaluator] = inFirst;
+		mCount[inEvaluator] = inCount;
+		mEnd[inEvaluator] = mBuffer.mClock + inCount*mCosts[inEvaluator];
+		if(inCount == 0) mEnded[inEvaluator] = true;
+	}
+
+	void receiveChunk(unsigned int inEvaluator)
+	{
+		if(mEnded[inEvaluator] || mPosted[inEvaluator]) mError = true;
+		mPosted[inEvaluator] = true;
+	}
+
+	unsigned int waitChunk()
+	{
+		unsigned int lEvaluator = mCosts.size();
+		for(unsigned int i=0; i<mCosts.size(); ++i) {
+			if(mPosted[i] && ((lEvaluator == mCosts.size()) || (mEnd[i] < mEnd[lEvaluator]))) lEvaluator = i;
+		}
+		if(lEvaluator == mCosts.size()) throw std::runtime_error("waitChunk called without any reception started");
+		mPosted[lEvaluator] = false;
+		mBuffer.mClock = mEnd[lEvaluator];
+		return lEvaluator;
+	}
+
+	void readChunk(unsigned int inEvaluator)
+	{
+		if(mBuffer.getChunkFirst(inEvaluator) != mFirst[inEvaluator]) mError = true;
+		for(unsigned int i=0; i<mCount[inEvaluator]; ++i) ++mEvaluations[mFirst[inEvaluator]+i];
+		mNbEvaluated[inEvaluator] += mCount[inEvaluator];
+	}
+
+	//! Return whether the generation ended correctly.
+	bool isComplete() const
+	{
+		if(mError) return false;
+		for(unsigned int i=0; i<mCosts.size(); ++i) {
+			if((mEnded[i] == false) || mPosted[i]) return false;
+		}
+		for(unsigned int i=0; i<mEvaluations.size(); ++i) {
+			if(mEvaluations[i] != 1) return false;
+		}
+		return true;
+	}
+
+	SimulatedBuffer&          mBuffer;
+	std::vector<double>       mCosts;        //!< Evaluation time per individual of each evaluator.
+	std::vector<unsigned int> mFirst;        //!< First individual of the last chunk of each evaluator.
+	std::vector<unsigned int> mCount;        //!< Size of the last chunk of each evaluator.
+	std::vector<double>       mEnd;          //!< Time at which each evaluator completes its chunk.
+	std::vector<bool>         mPosted;       //!< Whether a reception is started for each evaluator.
+	std::vector<bool>         mEnded;        //!< Whether each evaluator received its empty chunk.
+	std::vector<unsigned int> mNbEvaluated;  //!< Number of individuals evaluated by each evaluator.
+	std::vector<unsigned int> mEvaluations;  //!< Number of evaluations of each individual.
+	bool                      mError;        //!< Whether a protocol error was seen.
+};
+
+
+/*!
+ *  \brief Check ProcessingBuffer::assignChunk.
+ */
+static void checkAssignChunk()
+{
+	SimulatedBuffer lBuffer;
+	lBuffer.fill(10);
+	bool lOk = (lBuffer.assignChunk(0, 4) == 4) && (lBuffer.getChunkFirst(0) == 0);
+	lOk = lOk && (lBuffer.assignChunk(2, 4) == 4) && (lBuffer.getChunkFirst(2) == 4);
+	lOk = lOk && (lBuffer.assignChunk(1, 4) == 2) && (lBuffer.getChunkFirst(1) == 8);
+	lOk = lOk && (lBuffer.getNbRemaining() == 0) && (lBuffer.assignChunk(0, 4) == 0);
+	lOk = lOk && (lBuffer.getChunkCount(0) == 0) && (lBuffer.getChunkCount(2) == 4);
+	lOk = lOk && (lBuffer.getChunkCount(7) == 0);
+	lBuffer.fill(3);
+	lOk = lOk && (lBuffer.getNbRemaining() == 3) && (lBuffer.getChunkCount(2) == 0);
+	lOk = lOk && (lBuffer.assignChunk(0, 4) == 3);
+	report("assignChunk", lOk);
+}
+
+
+/*!
+ *  \brief Check ProcessingBuffer::computeChunkSize.
+ */
+static void checkComputeChunkSize()
+{
+	SimulatedBuffer lBuffer;
+	lBuffer.fill(100);
+	// Fixed-size chunks
+	bool lOk = (lBuffer.computeChunkSize(16, 0.0, 4) == 16) && (lBuffer.computeChunkSize(500, 0.0, 4) == 500);
+	// Adaptive chunks, before any latency is measured, capped by the fair share
+	lOk = lOk && (lBuffer.computeChunkSize(16, 1.0, 4) == 16) && (lBuffer.computeChunkSize(16, 1.0, 8) == 13);
+	// Adaptive chunks, sized from the latency
+	lBuffer.assignChunk(0, 10);
+	lBuffer.mClock = 0.5;
+	lBuffer.updateLatency(0);
+	lOk = lOk && (lBuffer.computeChunkSize(16, 1.0, 4) == 20) && (lBuffer.computeChunkSize(16, 0.01, 4) == 1);
+	lOk = lOk && (lBuffer.computeChunkSize(16, 100.0, 4) == 23);
+	// Nothing left
+	lBuffer.assignChunk(1, 90);
+	lOk = lOk && (lBuffer.computeChunkSize(16, 1.0, 4) == 1) && (lBuffer.assignChunk(2, 1) == 0);
+	report("computeChunkSize", lOk);
+}
+
+
+/*!
+ *  \brief Check ProcessingBuffer::updateLatency.
+ */
+static void checkUpdateLatency()
+{
+	SimulatedBuffer lBuffer;
+	lBuffer.fill(20);
+	bool lOk = (lBuffer.getLatency() == 0.0);
+	lBuffer.assignChunk(0, 4);
+	lBuffer.mClock = 2.0;
+	lBuffer.updateLatency(0);
+	lOk = lOk && (std::fabs(lBuffer.getLatency() - 0.5) < 1e-12);
+	lBuffer.assignChunk(0, 2);
+	lBuffer.mClock = 4.0;
+	lBuffer.updateLatency(0);
+	lOk = lOk && (std::fabs(lBuffer.getLatency() - 0.625) < 1e-12);
+	// Empty chunks and unknown evaluators leave the latency unchanged
+	lBuffer.updateLatency(5);
+	lBuffer.assignChunk(1, 0);
+	lBuffer.mClock = 10.0;
+	lBuffer.updateLatency(1);
+	lOk = lOk && (std::fabs(lBuffer.getLatency() - 0.625) < 1e-12);
+	// The latency is kept from one generation to the next
+	lBuffer.fill(5);
+	lOk = lOk && (std::fabs(lBuffer.getLatency() - 0.625) < 1e-12);
+	report("updateLatency", lOk);
+}
+
+
+/*!
+ *  \brief Run generations of the pull protocol over the loopback transport.
+ *  \param inName Name of the check.
+ *  \param inNbIndividuals Number of individuals to evaluate at each generation.
+ *  \param inCosts Evaluation time per individual of each evaluator.
+ *  \param inChunkSize Fixed chunk size, used as initial size for adaptive chunks.
+ *  \param inChunkTime Targeted evaluation time of a chunk, 0 for fixed-size chunks.
+ *  \param outNbEvaluated Number of individuals evaluated by each evaluator at the last generation.
+ *  \param outMakespan Duration of the last generation.
+ */
+static void checkPull(const std::string& inName,
+                      unsigned int inNbIndividuals,
+                      const std::vector<double>& inCosts,
+                      unsigned int inChunkSize,
+                      double inChunkTime,
+                      std::vector<unsigned int>& outNbEvaluated,
+                      double& outMakespan)
+{
+	SimulatedBuffer lBuffer;
+	bool lOk = true;
+	for(unsigned int g=0; g<3; ++g) {
+		lBuffer.fill(inNbIndividuals);
+		const double lStart = lBuffer.mClock;
+		LoopbackTransport lTransport(lBuffer, inCosts);
+		lBuffer.sendFirstChunks(lTransport, inChunkSize, inChunkTime, inCosts.size());
+		lBuffer.pullChunks(lTransport, inChunkSize, inChunkTime, inCosts.size());
+		lOk = lOk && lTransport.isComplete() && (lBuffer.getNbRemaining() == 0);
+		outNbEvaluated = lTransport.mNbEvaluated;
+		outMakespan = lBuffer.mClock - lStart;
+	}
+	report(inName, lOk);
+}
+
+
+/*!
+ *  \brief Main routine of the chunk distribution test.
+ *  \param argc Number of arguments on the command-line.
+ *  \param argv Arguments on the command-line.
+ *  \return 0 if all the checks passed, 1 if not.
+ */
+int main(int argc, char** argv)
+{
+	try {
+		checkAssignChunk();
+		checkComputeChunkSize();
+		checkUpdateLatency();
+
+		std::vector<unsigned int> lNbEvaluated;
+		double lMakespan = 0.0;
+		checkPull("pull with even evaluators", 100, std::vector<double>(4, 1.0), 5, 0.0, lNbEvaluated, lMakespan);
+		report("even evaluators share the work", (lNbEvaluated[0] == 25) && (lMakespan == 25.0));
+
+		// Evaluators 4 and 8 times slower than the first one
+		std::vector<double> lCosts(3, 1.0);
+		lCosts[1] = 4.0;
+		lCosts[2] = 8.0;
+		checkPull("pull with uneven evaluators", 130, lCosts, 2, 0.0, lNbEvaluated, lMakespan);
+		report("uneven evaluators, work follows speed",
+		       (lNbEvaluated[0] > lNbEvaluated[1]) && (lNbEvaluated[1] > lNbEvaluated[2]));
+		// 130 individuals at the combined speed of 1+1/4+1/8 individual per second take
+		// about 94.5 seconds, at most one chunk of the slowest evaluator is wasted
+		report("uneven evaluators, makespan", lMakespan <= (130.0/1.375 + 2*8.0));
+		checkPull("pull with uneven evaluators, adaptive chunks", 1000, lCosts, 2, 20.0, lNbEvaluated, lMakespan);
+		report("uneven evaluators, adaptive makespan", lMakespan <= (1000.0/1.375 + 20.0*8.0));
+
+		checkPull("pull with fewer individuals than evaluators", 3, std::vector<double>(5, 1.0), 2, 0.0, lNbEvaluated, lMakespan);
+		report("fewer individuals than evaluators, one chunk each",
+		       (lNbEvaluated[0] == 2) && (lNbEvaluated[1] == 1) && (lNbEvaluated[4] == 0));
+		checkPull("pull with fewer individuals than evaluators, adaptive chunks", 3, std::vector<double>(5, 1.0),
+		          16, 1.0, lNbEvaluated, lMakespan);
+		checkPull("pull without individuals", 0, std::vector<double>(3, 1.0), 4, 0.0, lNbEvaluated, lMakespan);
+
+		return (gNbFailures == 0) ? 0 : 1;
+	} catch(Exception& inException) {
+		inException.terminate(cerr);
+	} catch(std::exception& inException) {
+		cerr << "Standard exception caught:" << endl << flush;
+		cerr << inException.what() << endl << flush;
+	}
+	return 1;
+}
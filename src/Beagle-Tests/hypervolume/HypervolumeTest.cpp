@@ -0,0 +1,293 @@
+/*
+ *  Hypervolume test (hypervolume):
+ *  Regression test of the hypervolume engine of Open BEAGLE
+ *
+ *  Copyright (C) 2003-2006 by Christian Gagne and Marc Parizeau
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   HypervolumeTest.cpp
+ *  \brief  Check the hypervolume engine against a brute-force union of boxes.
+ *  $Revision: $
+ *  $Date: $
+ *
+ *  The brute-force hypervolume splits the space into the cells of the grid made of the
+ *  coordinates of the points and of the reference point, and sums the volume of the cells
+ *  dominated by a point. On small random sets in 2 to 4 objectives, it is compared with:
+ *  - the exact hypervolume (WFG slicing, and the sweep with two objectives);
+ *  - the exact contributions, as the hypervolume lost when removing each point;
+ *  - the contributions updated after each removal of the point of smallest contribution,
+ *    as done by SMS-EMOA;
+ *  - the Monte-Carlo estimates of the hypervolume and contributions, within five standard
+ *    deviations.
+ *  Sets with continuous values, with ties and duplicates, with dominated points, and with
+ *  points not better than the reference point on some objectives are checked.
+ */
+
+#include "Beagle/EC.hpp"
+#include "Beagle/EMO.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+using namespace Beagle;
+
+static unsigned int gNbFailures = 0;         //!< Number of failed checks.
+static const unsigned int gNbSamples = 200000;  //!< Number of samples of the estimates.
+
+
+/*!
+ *  \brief Report the result of a check.
+ *  \param inName Name of the check.
+ *  \param inOk Whether the check passed.
+ */
+static void report(const std::string& inName, bool inOk)
+{
+	cout << (inOk ? "ok     " : "FAILED ") << inName << endl;
+	if(inOk == false) ++gNbFailures;
+}
+
+
+/*!
+ *  \brief Test whether two volumes are equal, up to rounding errors.
+ *  \param inLeft First volume.
+ *  \param inRight Second volume.
+ *  \return True if the volumes are equal, false if not.
+ */
+static bool isEqual(double inLeft, double inRight)
+{
+	return std::fabs(inLeft - inRight) <= (1.0e-9 * std::max(1.0, std::fabs(inRight)));
+}
+
+
+/*!
+ *  \brief Compute the hypervolume of a set of points by summing the dominated grid cells.
+ *  \param inPoints Points, one row per point, all objectives being maximized.
+ *  \param inNbObjectives Number of objectives of the points.
+ *  \param inReference Reference point.
+ *  \param inRemoved Flags of the points ignored.
+ *  \return Hypervolume of the points.
+ */
+static double computeBruteForce(const std::vector<double>& inPoints,
+                                unsigned int inNbObjectives,
+                                const std::vector<double>& inReference,
+                                const std::vector<bool>& inRemoved)
+{
+	const unsigned int lNbPoints = inPoints.size() / inNbObjectives;
+	std::vector< std::vector<double> > lGrid(inNbObjectives);
+	for(unsigned int k=0; k<inNbObjectives; ++k) {
+		lGrid[k].push_back(inReference[k]);
+		for(unsigned int i=0; i<lNbPoints; ++i) {
+			if(inPoints[i*inNbObjectives+k] > inReference[k]) lGrid[k].push_back(inPoints[i*inNbObjectives+k]);
+		}
+		std::sort(lGrid[k].begin(), lGrid[k].end());
+		lGrid[k].erase(std::unique(lGrid[k].begin(), lGrid[k].end()), lGrid[k].end());
+		if(lGrid[k].size() < 2) return 0.0;
+	}
+
+	// Visit every cell, given by the index of its lower corner in each dimension.
+	double lVolume = 0.0;
+	std::vector<unsigned int> lCell(inNbObjectives, 0);
+	for(;;) {
+		bool lDominated = false;
+		for(unsigned int i=0; (i<lNbPoints) && !lDominated; ++i) {
+			if(inRemoved[i]) continue;
+			unsigned int k=0;
+			while((k<inNbObjectives) && (lGrid[k][lCell[k]+1] <= inPoints[i*inNbObjectives+k])) ++k;
+			lDominated = (k == inNbObjectives);
+		}
+		if(lDominated) {
+			double lCellVolume = 1.0;
+			for(unsigned int k=0; k<inNbObjectives; ++k) {
+				lCellVolume *= (lGrid[k][lCell[k]+1] - lGrid[k][lCell[k]]);
+			}
+			lVolume += lCellVolume;
+		}
+		unsigned int k=0;
+		while((k<inNbObjectives) && (++lCell[k] == (lGrid[k].size()-1))) lCell[k++] = 0;
+		if(k == inNbObjectives) break;
+	}
+	return lVolume;
+}
+
+
+/*!
+ *  \brief Compute the exclusive contributions of the remaining points by brute force.
+ *  \param outContributions Contribution of each point, null for the removed points.
+ *  \param inPoints Points, one row per point, all objectives being maximized.
+ *  \param inNbObjectives Number of objectives of the points.
+ *  \param inReference Reference point.
+ *  \param inRemoved Flags of the points removed.
+ */
+static void computeContributionsBruteForce(std::vector<double>& outContributions,
+        const std::vector<double>& inPoints,
+        unsigned int inNbObjectives,
+        const std::vector<double>& inReference,
+        const std::vector<bool>& inRemoved)
+{
+	const unsigned int lNbPoints = inPoints.size() / inNbObjectives;
+	const double lVolume = computeBruteForce(inPoints, inNbObjectives, inReference, inRemoved);
+	outContributions.assign(lNbPoints, 0.0);
+	std::vector<bool> lRemoved(inRemoved);
+	for(unsigned int i=0; i<lNbPoints; ++i) {
+		if(inRemoved[i]) continue;
+		lRemoved[i] = true;
+		outContributions[i] = lVolume - computeBruteForce(inPoints, inNbObjectives, inReference, lRemoved);
+		lRemoved[i] = false;
+	}
+}
+
+
+/*!
+ *  \brief Test whether an estimate is within five standard deviations of the exact value.
+ *  \param inEstimate Estimated volume.
+ *  \param inExact Exact volume.
+ *  \param inBoundingVolume Volume of the box sampled.
+ *  \return True if the estimate is consistent with the exact value, false if not.
+ */
+static bool isConsistent(double inEstimate, double inExact, double inBoundingVolume)
+{
+	if(inBoundingVolume <= 0.0) return (inEstimate == 0.0);
+	const double lProba = std::min(1.0, inExact / inBoundingVolume);
+	const double lSigma = inBoundingVolume * std::sqrt(lProba * (1.0-lProba) / gNbSamples);
+	return std::fabs(inEstimate - inExact) <= ((5.0 * lSigma) + (1.0e-12 * inBoundingVolume));
+}
+
+
+/*!
+ *  \brief Check the hypervolume engine on a set of points.
+ *  \param inName Name of the check.
+ *  \param inPoints Points, one row per point, all objectives being maximized.
+ *  \param inNbObjectives Number of objectives of the points.
+ *  \param inReference Reference point.
+ *  \param ioStream Random stream used by the estimates.
+ */
+static void checkSet(const std::string& inName,
+                     const std::vector<double>& inPoints,
+                     unsigned int inNbObjectives,
+                     const std::vector<double>& inReference,
+                     RandomStream& ioStream)
+{
+	const unsigned int lNbPoints = inPoints.size() / inNbObjectives;
+	std::vector<bool> lRemoved(lNbPoints, false);
+
+	// Exact hypervolume and contributions.
+	const double lExpected = computeBruteForce(inPoints, inNbObjectives, inReference, lRemoved);
+	report(inName+" hypervolume", isEqual(EMO::Hypervolume::compute(inPoints, inNbObjectives, inReference), lExpected));
+	std::vector<double> lContributions, lExpectedContributions;
+	EMO::Hypervolume::computeContributions(lContributions, inPoints, inNbObjectives, inReference);
+	computeContributionsBruteForce(lExpectedContributions, inPoints, inNbObjectives, inReference, lRemoved);
+	bool lOk = (lContributions.size() == lNbPoints);
+	for(unsigned int i=0; lOk && (i<lNbPoints); ++i) lOk = isEqual(lContributions[i], lExpectedContributions[i]);
+	report(inName+" contributions", lOk);
+
+	// Contributions updated while removing the point of smallest contribution.
+	lOk = (lContributions.size() == lNbPoints);
+	for(unsigned int r=1; lOk && (r<lNbPoints); ++r) {
+		unsigned int lWorst = lNbPoints;
+		for(unsigned int i=0; i<lNbPoints; ++i) {
+			if(lRemoved[i]) continue;
+			if((lWorst == lNbPoints) || (lContributions[i] < lContributions[lWorst])) lWorst = i;
+		}
+		lRemoved[lWorst] = true;
+		EMO::Hypervolume::updateContributions(lContributions, inPoints, inNbObjectives, inReference, lRemoved, lWorst);
+		computeContributionsBruteForce(lExpectedContributions, inPoints, inNbObjectives, inReference, lRemoved);
+		for(unsigned int i=0; lOk && (i<lNbPoints); ++i) {
+			if(lRemoved[i] == false) lOk = isEqual(lContributions[i], lExpectedContributions[i]);
+		}
+	}
+	report(inName+" updated contributions", lOk);
+
+	// Monte-Carlo estimates, sampling the box bounding the clipped points.
+	double lBoundingVolume = 1.0;
+	for(unsigned int k=0; k<inNbObjectives; ++k) {
+		double lUpper = 0.0;
+		for(unsigned int i=0; i<lNbPoints; ++i) {
+			lUpper = std::max(lUpper, inPoints[i*inNbObjectives+k] - inReference[k]);
+		}
+		lBoundingVolume *= lUpper;
+	}
+	const double lEstimate = EMO::Hypervolume::estimate(inPoints, inNbObjectives, inReference, gNbSamples, ioStream);
+	report(inName+" estimated hypervolume", isConsistent(lEstimate, lExpected, lBoundingVolume));
+	std::fill(lRemoved.begin(), lRemoved.end(), false);
+	computeContributionsBruteForce(lExpectedContributions, inPoints, inNbObjectives, inReference, lRemoved);
+	EMO::Hypervolume::estimateContributions(lContributions, inPoints, inNbObjectives, inReference, gNbSamples, ioStream);
+	lOk = (lContributions.size() == lNbPoints);
+	for(unsigned int i=0; lOk && (i<lNbPoints); ++i) {
+		lOk = isConsistent(lContributions[i], lExpectedContributions[i], lBoundingVolume);
+	}
+	report(inName+" estimated contributions", lOk);
+}
+
+
+/*!
+ *  \brief Main routine of the hypervolume test.
+ *  \param argc Number of arguments on the command-line.
+ *  \param argv Arguments on the command-line.
+ *  \return 0 if all the checks passed, 1 if not.
+ */
+int main(int argc, char** argv)
+{
+	try {
+		RandomStream lStream(20120101);
+		for(unsigned int lM=2; lM<=4; ++lM) {
+			const std::vector<double> lReference(lM, 0.2);
+			for(unsigned int lN=1; lN<=10; lN+=3) {
+				const std::string lName = uint2str(lN)+" points, "+uint2str(lM)+" objectives,";
+				std::vector<double> lPoints(lN*lM);
+
+				// Uniform points, some being dominated or worse than the reference point.
+				for(unsigned int i=0; i<lPoints.size(); ++i) lPoints[i] = lStream.rollUniform();
+				checkSet("uniform, "+lName, lPoints, lM, lReference, lStream);
+
+				// Mutually non-dominated points, on the positive part of the unit sphere.
+				for(unsigned int i=0; i<lN; ++i) {
+					double lNorm = 0.0;
+					for(unsigned int k=0; k<lM; ++k) {
+						lPoints[i*lM+k] = std::fabs(lStream.rollGaussian()) + 1.0e-3;
+						lNorm += lPoints[i*lM+k] * lPoints[i*lM+k];
+					}
+					for(unsigned int k=0; k<lM; ++k) lPoints[i*lM+k] /= std::sqrt(lNorm);
+				}
+				checkSet("front, "+lName, lPoints, lM, lReference, lStream);
+
+				// Few distinct values, giving ties, duplicates and points on the reference point.
+				for(unsigned int i=0; i<lPoints.size(); ++i) lPoints[i] = 0.2 * double(lStream.rollInteger(1, 4));
+				checkSet("tied, "+lName, lPoints, lM, lReference, lStream);
+			}
+		}
+		return (gNbFailures == 0) ? 0 : 1;
+	} catch(Exception& inException) {
+		inException.terminate(cerr);
+	} catch(std::exception& inException) {
+		cerr << "Standard exception caught:" << endl << flush;
+		cerr << inException.what() << endl << flush;
+	}
+	return 1;
+}
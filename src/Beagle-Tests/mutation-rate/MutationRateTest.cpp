@@ -0,0 +1,222 @@
+/*
+ *  Mutation rate test (mutation-rate):
+ *  Regression test of the per-gene mutation rates of Open BEAGLE
+ *
+ *  Copyright (C) 2003-2006 by Christian Gagne and Marc Parizeau
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   MutationRateTest.cpp
+ *  \brief  Check that the observed per-gene mutation rates match the configured ones.
+ *  $Revision: $
+ *  $Date: $
+ *
+ *  The bit flip, integer uniform and Gaussian mutation operators skip from one mutated
+ *  gene to the next with geometric draws. This test mutates long vectors many times and
+ *  checks that the fraction of genes modified stays within five standard deviations of
+ *  the expected rate, and that the probabilities 0 and 1 modify no gene and every gene.
+ */
+
+#include "Beagle/EC.hpp"
+#include "Beagle/BitStr.hpp"
+#include "Beagle/IntVec.hpp"
+#include "Beagle/FltVec.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+using namespace Beagle;
+
+static const unsigned int gNbGenes = 1000;   //!< Number of genes of the mutated vectors.
+static const unsigned int gNbTrials = 200;   //!< Number of mutations of each check.
+static const int          gIntRange = 10;    //!< Number of values an integer can take.
+
+
+/*!
+ *  \brief Return a parameter of the register, for modification.
+ *  \param ioSystem System of the register.
+ *  \param inTag Tag of the parameter.
+ *  \return Handle to the parameter.
+ */
+template <class T>
+static typename T::Handle getParameter(System& ioSystem, const std::string& inTag)
+{
+	return castHandleT<T>(ioSystem.getRegister()[inTag]);
+}
+
+
+/*!
+ *  \brief Build a quiet system, with the given package installed.
+ *  \param inPackage Package to install.
+ *  \return Handle to the system built.
+ */
+static System::Handle buildSystem(PackageAbstract::Handle inPackage)
+{
+	System::Handle lSystem = new System;
+	lSystem->addPackage(inPackage);
+	lSystem->replaceComponentsByConcepts();
+	lSystem->registerComponentParams();
+	getParameter<UInt>(*lSystem, "lg.console.level")->getWrappedValue() = Logger::eNothing;
+	getParameter<String>(*lSystem, "lg.file.name")->getWrappedValue() = "";
+	return lSystem;
+}
+
+
+/*!
+ *  \brief Compare an observed mutation count with the expected one.
+ *  \param inName Name of the check.
+ *  \param inCount Number of genes modified.
+ *  \param inProba Expected probability that a gene is modified.
+ *  \return True if the count is consistent with the probability, false if not.
+ */
+static bool checkCount(const std::string& inName, unsigned long inCount, double inProba)
+{
+	const double lNbDraws = double(gNbGenes) * gNbTrials;
+	const double lExpected = lNbDraws * inProba;
+	const double lTolerance = 5.0 * std::sqrt(lNbDraws * inProba * (1.0-inProba));
+	const bool lOk = (std::fabs(double(inCount) - lExpected) <= lTolerance);
+	cout << (lOk ? "ok     " : "FAILED ") << inName << ": " << inCount << " genes modified, ";
+	cout << lExpected << " expected" << endl;
+	return lOk;
+}
+
+
+/*!
+ *  \brief Check the rate of the bit flip mutation.
+ *  \param inProba Bit flip probability.
+ *  \return True if the check passed, false if not.
+ */
+static bool checkFlipBit(double inProba)
+{
+	System::Handle lSystem = buildSystem(new BitStr::Package(gNbGenes));
+	BitStr::MutationFlipBitOp::Handle lOp = new BitStr::MutationFlipBitOp;
+	lOp->registerParams(*lSystem);
+	getParameter<Float>(*lSystem, "bitstr.mutflip.bitpb")->getWrappedValue() = inProba;
+	lSystem->initComponents();
+	lOp->init(*lSystem);
+
+	Context::Handle lContext = new Context;
+	lContext->setSystemHandle(lSystem);
+	unsigned long lCount = 0;
+	for(unsigned int i=0; i<gNbTrials; ++i) {
+		Individual::Handle lIndividual = new Individual;
+		lIndividual->push_back(new BitStr::BitString(gNbGenes, false));
+		lOp->mutate(*lIndividual, *lContext);
+		const BitStr::BitString& lBS = castObjectT<const BitStr::BitString&>(*(*lIndividual)[0]);
+		for(unsigned int j=0; j<lBS.size(); ++j) if(lBS[j]) ++lCount;
+	}
+	return checkCount("BitStr-MutationFlipBitOp p="+dbl2str(inProba), lCount, inProba);
+}
+
+
+/*!
+ *  \brief Check the rate of the integer uniform mutation.
+ *  \param inProba Integer mutation probability.
+ *  \return True if the check passed, false if not.
+ *
+ *  A mutated integer keeps its value with probability 1/gIntRange, which is accounted
+ *  for in the expected rate.
+ */
+static bool checkUniformInt(double inProba)
+{
+	System::Handle lSystem = buildSystem(new IntVec::Package(gNbGenes));
+	IntVec::MutationUniformOp::Handle lOp = new IntVec::MutationUniformOp;
+	lOp->registerParams(*lSystem);
+	getParameter<Double>(*lSystem, "intvec.mutunif.intpb")->getWrappedValue() = inProba;
+	getParameter<IntArray>(*lSystem, "ga.int.minvalue")->front() = 0;
+	getParameter<IntArray>(*lSystem, "ga.int.maxvalue")->front() = gIntRange-1;
+	lSystem->initComponents();
+	lOp->init(*lSystem);
+
+	Context::Handle lContext = new Context;
+	lContext->setSystemHandle(lSystem);
+	unsigned long lCount = 0;
+	for(unsigned int i=0; i<gNbTrials; ++i) {
+		Individual::Handle lIndividual = new Individual;
+		lIndividual->push_back(new IntVec::IntegerVector(gNbGenes, 0));
+		lOp->mutate(*lIndividual, *lContext);
+		const IntVec::IntegerVector& lIV = castObjectT<const IntVec::IntegerVector&>(*(*lIndividual)[0]);
+		for(unsigned int j=0; j<lIV.size(); ++j) if(lIV[j] != 0) ++lCount;
+	}
+	const double lChangeProba = inProba * (1.0 - (1.0 / gIntRange));
+	return checkCount("IntVec-MutationUniformOp p="+dbl2str(inProba), lCount, lChangeProba);
+}
+
+
+/*!
+ *  \brief Check the rate of the Gaussian mutation.
+ *  \param inProba Float mutation probability.
+ *  \return True if the check passed, false if not.
+ */
+static bool checkGaussian(double inProba)
+{
+	System::Handle lSystem = buildSystem(new FltVec::Package(gNbGenes));
+	FltVec::MutationGaussianOp::Handle lOp = new FltVec::MutationGaussianOp;
+	lOp->registerParams(*lSystem);
+	getParameter<Float>(*lSystem, "fltvec.mutgauss.floatpb")->getWrappedValue() = inProba;
+	lSystem->initComponents();
+	lOp->init(*lSystem);
+
+	Context::Handle lContext = new Context;
+	lContext->setSystemHandle(lSystem);
+	unsigned long lCount = 0;
+	for(unsigned int i=0; i<gNbTrials; ++i) {
+		Individual::Handle lIndividual = new Individual;
+		lIndividual->push_back(new FltVec::FloatVector(gNbGenes, 0.0));
+		lOp->mutate(*lIndividual, *lContext);
+		const FltVec::FloatVector& lFV = castObjectT<const FltVec::FloatVector&>(*(*lIndividual)[0]);
+		for(unsigned int j=0; j<lFV.size(); ++j) if(lFV[j] != 0.0) ++lCount;
+	}
+	return checkCount("FltVec-MutationGaussianOp p="+dbl2str(inProba), lCount, inProba);
+}
+
+
+/*!
+ *  \brief Main routine of the mutation rate test.
+ *  \param argc Number of arguments on the command-line.
+ *  \param argv Arguments on the command-line.
+ *  \return 0 if all the checks passed, 1 if not.
+ */
+int main(int argc, char** argv)
+{
+	try {
+		const double lProbas[] = {0.0, 0.001, 0.01, 0.1, 0.5, 1.0};
+		bool lOk = true;
+		for(unsigned int i=0; i<(sizeof(lProbas)/sizeof(double)); ++i) {
+			lOk = checkFlipBit(lProbas[i]) && lOk;
+			lOk = checkUniformInt(lProbas[i]) && lOk;
+			lOk = checkGaussian(lProbas[i]) && lOk;
+		}
+		return lOk ? 0 : 1;
+	} catch(Exception& inException) {
+		inException.terminate(cerr);
+	} catch(std::exception& inException) {
+		cerr << "Standard exception caught:" << endl << flush;
+		cerr << inException.what() << endl << flush;
+	}
+	return 1;
+}
@@ -0,0 +1,282 @@
+/*
+ *  Non-dominated sorting test (nondominated-sorting):
+ *  Regression test of the non-dominated sorting engine of Open BEAGLE
+ *
+ *  Copyright (C) 2003-2006 by Christian Gagne and Marc Parizeau
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   NondominatedSortingTest.cpp
+ *  \brief  Check the Pareto ranks of the non-dominated sorting engine against a naive sort.
+ *  $Revision: $
+ *  $Date: $
+ *
+ *  The ranks computed by the divide-and-conquer and efficient algorithms are compared with
+ *  those of a naive O(MN^2) sort, which peels the fronts one at a time, on random points
+ *  in 2 to 5 objectives. Points with continuous values, with few distinct values (many
+ *  ties), with duplicates, totally ordered and mutually non-dominated are checked. The
+ *  fronts returned for individuals, with maximized and minimized fitnesses and with every
+ *  algorithm, including the pairwise one, are checked the same way.
+ */
+
+#include "Beagle/EC.hpp"
+#include "Beagle/EMO.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+using namespace Beagle;
+
+static unsigned int gNbFailures = 0;   //!< Number of failed checks.
+
+
+/*!
+ *  \brief Report the result of a check.
+ *  \param inName Name of the check.
+ *  \param inOk Whether the check passed.
+ */
+static void report(const std::string& inName, bool inOk)
+{
+	cout << (inOk ? "ok     " : "FAILED ") << inName << endl;
+	if(inOk == false) ++gNbFailures;
+}
+
+
+/*!
+ *  \brief Compute the Pareto ranks of points by peeling the fronts one at a time.
+ *  \param outRanks Pareto rank of each point, 0 being the first front.
+ *  \param inObjectives Objective matrix, one row per point, larger values being better.
+ *  \param inNbObjectives Number of objectives (columns) of the matrix.
+ */
+static void rankNaive(std::vector<unsigned int>& outRanks,
+                      const std::vector<double>& inObjectives,
+                      unsigned int inNbObjectives)
+{
+	const unsigned int lNbPoints = inObjectives.size() / inNbObjectives;
+	const unsigned int lUnranked = (unsigned int)-1;
+	outRanks.assign(lNbPoints, lUnranked);
+	unsigned int lNbRanked = 0;
+	for(unsigned int lRank=0; lNbRanked<lNbPoints; ++lRank) {
+		std::vector<unsigned int> lFront;
+		for(unsigned int i=0; i<lNbPoints; ++i) {
+			if(outRanks[i] != lUnranked) continue;
+			bool lDominated = false;
+			for(unsigned int j=0; (j<lNbPoints) && !lDominated; ++j) {
+				if((j == i) || (outRanks[j] != lUnranked)) continue;
+				bool lNotWorse = true;
+				bool lBetter = false;
+				for(unsigned int k=0; k<inNbObjectives; ++k) {
+					const double lJ = inObjectives[j*inNbObjectives+k];
+					const double lI = inObjectives[i*inNbObjectives+k];
+					if(lJ < lI) lNotWorse = false;
+					else if(lJ > lI) lBetter = true;
+				}
+				lDominated = lNotWorse && lBetter;
+			}
+			if(lDominated == false) lFront.push_back(i);
+		}
+		for(unsigned int i=0; i<lFront.size(); ++i) outRanks[lFront[i]] = lRank;
+		lNbRanked += lFront.size();
+	}
+}
+
+
+/*!
+ *  \brief Check the ranks of the matrix algorithms against the naive sort.
+ *  \param inName Name of the check.
+ *  \param inObjectives Objective matrix, one row per point.
+ *  \param inNbObjectives Number of objectives (columns) of the matrix.
+ */
+static void checkRanks(const std::string& inName,
+                       const std::vector<double>& inObjectives,
+                       unsigned int inNbObjectives)
+{
+	std::vector<unsigned int> lExpected, lDC, lENS;
+	rankNaive(lExpected, inObjectives, inNbObjectives);
+	EMO::NondominatedSorting::rankObjectives(lDC, inObjectives, inNbObjectives,
+	        EMO::NondominatedSorting::eDivideConquer);
+	EMO::NondominatedSorting::rankObjectives(lENS, inObjectives, inNbObjectives,
+	        EMO::NondominatedSorting::eEfficient);
+	report(inName+" (dc)", lDC == lExpected);
+	report(inName+" (ens)", lENS == lExpected);
+}
+
+
+/*!
+ *  \brief Draw random points.
+ *  \param outObjectives Objective matrix drawn, one row per point.
+ *  \param inNbPoints Number of points.
+ *  \param inNbObjectives Number of objectives.
+ *  \param inNbValues Number of distinct values of each objective, 0 for continuous values.
+ *  \param ioRandomizer Randomizer used.
+ */
+static void drawPoints(std::vector<double>& outObjectives,
+                       unsigned int inNbPoints,
+                       unsigned int inNbObjectives,
+                       unsigned int inNbValues,
+                       Randomizer& ioRandomizer)
+{
+	outObjectives.resize(inNbPoints * inNbObjectives);
+	for(unsigned int i=0; i<outObjectives.size(); ++i) {
+		if(inNbValues == 0) outObjectives[i] = ioRandomizer.rollUniform(-1.0, 1.0);
+		else outObjectives[i] = double(ioRandomizer.rollInteger(0, inNbValues-1));
+	}
+}
+
+
+/*!
+ *  \brief Check the fronts of individuals, for every algorithm.
+ *  \param inName Name of the check.
+ *  \param inObjectives Objective matrix, one row per individual.
+ *  \param inNbObjectives Number of objectives (columns) of the matrix.
+ *  \param inMinimize Whether the fitnesses are minimized.
+ */
+static void checkFronts(const std::string& inName,
+                        const std::vector<double>& inObjectives,
+                        unsigned int inNbObjectives,
+                        bool inMinimize)
+{
+	// The fitnesses are built so that the matrix holds their maximized objectives.
+	const unsigned int lNbPoints = inObjectives.size() / inNbObjectives;
+	Individual::Bag lPool;
+	for(unsigned int i=0; i<lNbPoints; ++i) {
+		std::vector<double> lValues(inNbObjectives);
+		for(unsigned int k=0; k<inNbObjectives; ++k) {
+			lValues[k] = inMinimize ? -inObjectives[i*inNbObjectives+k] : inObjectives[i*inNbObjectives+k];
+		}
+		Individual::Handle lIndividual = new Individual;
+		if(inMinimize) lIndividual->setFitness(new EMO::FitnessMultiObjMin(lValues));
+		else lIndividual->setFitness(new EMO::FitnessMultiObj(lValues));
+		lPool.push_back(lIndividual);
+	}
+	std::vector<unsigned int> lExpected;
+	rankNaive(lExpected, inObjectives, inNbObjectives);
+
+	const char* lNames[] = {"dc", "ens", "pairwise"};
+	const EMO::NondominatedSorting::Algorithm lAlgorithms[] = {
+	    EMO::NondominatedSorting::eDivideConquer,
+	    EMO::NondominatedSorting::eEfficient,
+	    EMO::NondominatedSorting::ePairwise
+	};
+	for(unsigned int a=0; a<3; ++a) {
+		// Complete sort: every individual is in the front of its rank.
+		EMO::NondominatedSorting::Fronts lFronts;
+		EMO::NondominatedSorting::sort(lFronts, lNbPoints, lPool, lAlgorithms[a]);
+		std::vector<unsigned int> lRanks(lNbPoints, (unsigned int)-1);
+		unsigned int lNbSorted = 0;
+		for(unsigned int f=0; f<lFronts.size(); ++f) {
+			for(unsigned int i=0; i<lFronts[f].size(); ++i) lRanks[lFronts[f][i]] = f;
+			lNbSorted += lFronts[f].size();
+		}
+		report(inName+" fronts ("+lNames[a]+")", (lNbSorted == lNbPoints) && (lRanks == lExpected));
+
+		// Partial sort: the fronts returned are the first ones, up to half of the individuals.
+		const unsigned int lSortStop = (lNbPoints+1) / 2;
+		EMO::NondominatedSorting::sort(lFronts, lSortStop, lPool, lAlgorithms[a]);
+		bool lOk = true;
+		lNbSorted = 0;
+		for(unsigned int f=0; f<lFronts.size(); ++f) {
+			for(unsigned int i=0; i<lFronts[f].size(); ++i) lOk = lOk && (lExpected[lFronts[f][i]] == f);
+			if(lNbSorted >= lSortStop) lOk = false;
+			lNbSorted += lFronts[f].size();
+		}
+		unsigned int lNbExpected = 0;
+		for(unsigned int i=0; i<lNbPoints; ++i) if(lExpected[i] < lFronts.size()) ++lNbExpected;
+		report(inName+" partial fronts ("+lNames[a]+")",
+		       lOk && (lNbSorted >= lSortStop) && (lNbSorted == lNbExpected));
+	}
+}
+
+
+/*!
+ *  \brief Main routine of the non-dominated sorting test.
+ *  \param argc Number of arguments on the command-line.
+ *  \param argv Arguments on the command-line.
+ *  \return 0 if all the checks passed, 1 if not.
+ */
+int main(int argc, char** argv)
+{
+	try {
+		Randomizer::Handle lRandomizer = new Randomizer(20130706);
+		std::vector<double> lObjectives;
+
+		// Random points, with continuous values and with many ties.
+		const unsigned int lSizes[] = {1, 2, 7, 50, 300};
+		for(unsigned int lM=2; lM<=5; ++lM) {
+			for(unsigned int s=0; s<(sizeof(lSizes)/sizeof(unsigned int)); ++s) {
+				const std::string lName = uint2str(lSizes[s])+" points, "+uint2str(lM)+" objectives";
+				drawPoints(lObjectives, lSizes[s], lM, 0, *lRandomizer);
+				checkRanks("continuous, "+lName, lObjectives, lM);
+				drawPoints(lObjectives, lSizes[s], lM, 3, *lRandomizer);
+				checkRanks("tied, "+lName, lObjectives, lM);
+			}
+		}
+
+		// Duplicated points, including a population made of copies of a single point.
+		for(unsigned int lM=2; lM<=4; ++lM) {
+			drawPoints(lObjectives, 20, lM, 0, *lRandomizer);
+			std::vector<double> lCopies;
+			for(unsigned int i=0; i<100; ++i) {
+				const unsigned int lRow = lRandomizer->rollInteger(0, 19);
+				lCopies.insert(lCopies.end(), lObjectives.begin()+(lRow*lM), lObjectives.begin()+((lRow+1)*lM));
+			}
+			checkRanks("duplicates, "+uint2str(lM)+" objectives", lCopies, lM);
+			std::vector<double> lSingle;
+			for(unsigned int i=0; i<50; ++i) lSingle.insert(lSingle.end(), lObjectives.begin(), lObjectives.begin()+lM);
+			checkRanks("single point copied, "+uint2str(lM)+" objectives", lSingle, lM);
+		}
+
+		// Totally ordered points (one front per point) and mutually non-dominated points.
+		for(unsigned int lM=2; lM<=4; ++lM) {
+			std::vector<double> lChain, lAntichain;
+			for(unsigned int i=0; i<100; ++i) {
+				for(unsigned int k=0; k<lM; ++k) lChain.push_back(double(i) + ((k == 0) ? 0.0 : 0.5*k));
+				lAntichain.push_back(double(i));
+				lAntichain.push_back(double(99-i));
+				for(unsigned int k=2; k<lM; ++k) lAntichain.push_back(lRandomizer->rollUniform());
+			}
+			checkRanks("chain, "+uint2str(lM)+" objectives", lChain, lM);
+			checkRanks("antichain, "+uint2str(lM)+" objectives", lAntichain, lM);
+		}
+
+		// Fronts of individuals, with maximized and minimized fitnesses.
+		for(unsigned int lM=2; lM<=4; ++lM) {
+			drawPoints(lObjectives, 60, lM, 4, *lRandomizer);
+			checkFronts("maximized, "+uint2str(lM)+" objectives", lObjectives, lM, false);
+			drawPoints(lObjectives, 60, lM, 0, *lRandomizer);
+			checkFronts("minimized, "+uint2str(lM)+" objectives", lObjectives, lM, true);
+		}
+
+		return (gNbFailures == 0) ? 0 : 1;
+	} catch(Exception& inException) {
+		inException.terminate(cerr);
+	} catch(std::exception& inException) {
+		cerr << "Standard exception caught:" << endl << flush;
+		cerr << inException.what() << endl << flush;
+	}
+	return 1;
+}
@@ -42,109 +42,68 @@
 using namespace Beagle;
 
 
+const unsigned int BitStr::BitString::WordBits;
+
+
 /*!
  *  \brief Construct a bit string genotype.
  *  \param inSize Size of the bit string.
  *  \param inModel Default values of the bits.
  */
 BitStr::BitString::BitString(unsigned int inSize, bool inModel) :
-		std::vector<bool>(inSize, inModel)
-{ }
+		mSize(0)
+{
+	resize(inSize, inModel);
+}
 
 
 /*!
- *  \brief Convert a binary bit string to a floating-point vector with keys.
- *  \param inKeys Decoding keys.
- *  \param inBitString Binary bit string to decode.
- *  \param outVector Floating-point number vector resulting from decoding.
+ *  \brief Copy bitstring into current.
+ *  \param inOriginal Bitstring to copy.
+ *  \param ioSystem Evolutionary system to use for making the copy.
  */
-void BitStr::BitString::convertBin2Dec(const BitStr::BitString::DecodingKeyVector& inKeys,
-                                       const std::vector<bool>& inBitString,
-                                       std::vector<double>& outVector)
+void BitStr::BitString::copy(const Member& inOriginal, System& ioSystem)
 {
 	Beagle_StackTraceBeginM();
-#ifdef BEAGLE_HAVE_LONG_LONG
-	typedef unsigned long long EncodingType;
-#else // BEAGLE_HAVE_LONG_LONG
-	typedef unsigned long EncodingType;
-#endif // BEAGLE_HAVE_LONG_LONG
-
-#ifndef BEAGLE_NDEBUG
-	for(unsigned int i=0; i<inKeys.size(); i++) {
-		if(inKeys[i].mLowerBound >= inKeys[i].mUpperBound) {
-			std::ostringstream lOSS;
-			lOSS << "In BitStr::BitString::convertBin2Dec(): ";
-			lOSS <<  "the lower bound value of the " <<  uint2ordinal(i+1);
-			lOSS <<  " key (" <<  inKeys[i].mLowerBound;
-			lOSS <<  ") is bigger or equal to the associated upper bound (";
-			lOSS <<  inKeys[i].mUpperBound <<  ")!";
-			throw Beagle_RunTimeExceptionM(lOSS.str());
-		}
-		if((inKeys[i].mEncoding < 1) || (inKeys[i].mEncoding >= 8*sizeof(EncodingType))) {
-			std::ostringstream lOSS;
-			lOSS <<  "In BitStr::BitString::convertBin2Dec(): the ";
-			lOSS <<  uint2ordinal(i+1) << " encoding value (" << inKeys[i].mEncoding;
-			lOSS <<  ") is not in the valid interval (which is [1,";
-			lOSS <<  (8*sizeof(EncodingType))-1 << "])!";
-			throw Beagle_RunTimeExceptionM(lOSS.str());
-		}
-	}
-#endif // BEAGLE_NDEBUG
-
-	outVector.resize(inKeys.size());
-	std::vector<bool>::const_iterator lBit = inBitString.begin();
-	for(unsigned int j=0; j<inKeys.size(); j++) {
-		EncodingType lGene=0;
-		for(unsigned int k=0; k<inKeys[j].mEncoding; ++k) {
-			lGene <<= 1;
-			lGene |= ((*lBit++) ? 1 : 0);
-		}
-		EncodingType lDiv = ~0;
-		lDiv <<= inKeys[j].mEncoding;
-		lDiv = ~lDiv;
-		double lTempVal = double(lGene) / double(lDiv);
-		outVector[j] =
-		    inKeys[j].mLowerBound + (lTempVal * (inKeys[j].mUpperBound - inKeys[j].mLowerBound));
-	}
+	const BitStr::BitString& lOriginal = castObjectT<const BitStr::BitString&>(inOriginal);
+	(*this) = lOriginal;
 	Beagle_StackTraceEndM();
 }
 
 
 /*!
- *  \brief Convert a gray-coded bit string to a binary bit string with keys.
- *  \param inKeys Decoding keys.
- *  \param inGrayBitString Gray-coded bit string to decode.
- *  \param outBinBitString Binary bit string resulting from decoding.
+ *  \brief Count the number of set bits in the string.
+ *  \return Number of bits equal to one.
  */
-void BitStr::BitString::convertGray2Bin(const BitStr::BitString::DecodingKeyVector& inKeys,
-                                        const std::vector<bool>& inGrayBitString,
-                                        std::vector<bool>& outBinBitString)
+unsigned int BitStr::BitString::count() const
 {
 	Beagle_StackTraceBeginM();
-	outBinBitString.resize(inGrayBitString.size());
-	unsigned int lPosBS = 0;
-	for(unsigned int i=0; i<inKeys.size(); ++i) {
-		for(unsigned int j=0; j<inKeys[i].mEncoding; ++j) {
-			if(j==0) outBinBitString[lPosBS] = inGrayBitString[lPosBS];
-			else outBinBitString[lPosBS] =
-				    ((bool)inGrayBitString[lPosBS] != (bool)outBinBitString[lPosBS-1]);
-			++lPosBS;
-		}
-	}
+	unsigned int lCount = 0;
+	for(unsigned int i=0; i<mWords.size(); ++i) lCount += countBits(mWords[i]);
+	return lCount;
 	Beagle_StackTraceEndM();
 }
 
 
 /*!
- *  \brief Copy bitstring into current.
- *  \param inOriginal Bitstring to copy.
- *  \param ioSystem Evolutionary system to use for making the copy.
+ *  \brief Count the number of set bits in a word.
+ *  \param inWord Word to count the bits of.
+ *  \return Number of bits equal to one.
  */
-void BitStr::BitString::copy(const Member& inOriginal, System& ioSystem)
+unsigned int BitStr::BitString::countBits(Word inWord)
 {
 	Beagle_StackTraceBeginM();
-	const BitStr::BitString& lOriginal = castObjectT<const BitStr::BitString&>(inOriginal);
-	(*this) = lOriginal;
+#if defined(__GNUC__)
+#ifdef BEAGLE_HAVE_LONG_LONG
+	return __builtin_popcountll(inWord);
+#else // BEAGLE_HAVE_LONG_LONG
+	return __builtin_popcountl(inWord);
+#endif // BEAGLE_HAVE_LONG_LONG
+#else // defined(__GNUC__)
+	unsigned int lCount = 0;
+	for(; inWord!=0; ++lCount) inWord &= (inWord - 1);
+	return lCount;
+#endif // defined(__GNUC__)
 	Beagle_StackTraceEndM();
 }
 
@@ -158,22 +117,7 @@ void BitStr::BitString::decode(const BitStr::BitString::DecodingKeyVector& inKey
                                std::vector<double>& outVector) const
 {
 	Beagle_StackTraceBeginM();
-#ifndef BEAGLE_NDEBUG
-	unsigned int lNbBits = 0;
-	for(unsigned int i=0; i<inKeys.size(); i++) lNbBits += inKeys[i].mEncoding;
-	if(lNbBits != size()) {
-		std::ostringstream lOSS;
-		lOSS << "In BitStr::BitString::decode(): ";
-		lOSS <<  "The total number of bits specified by the encoding keys (";
-		lOSS <<  lNbBits;
-		lOSS <<  ") is different from the number of bits of the genotype string (";
-		lOSS <<  size();
-		lOSS <<  ") !";
-		throw Beagle_RunTimeExceptionM(lOSS.str());
-	}
-#endif // BEAGLE_NDEBUG
-
-	convertBin2Dec(inKeys, (*this), outVector);
+	decodeKeys(inKeys, outVector, false);
 	Beagle_StackTraceEndM();
 }
 
@@ -187,13 +131,53 @@ void BitStr::BitString::decodeGray(const BitStr::BitString::DecodingKeyVector& i
                                    std::vector<double>& outVector) const
 {
 	Beagle_StackTraceBeginM();
+	decodeKeys(inKeys, outVector, true);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Decode the bit string into a vector of floating-point numbers.
+ *  \param inKeys Decoding keys used to tranform the bit string.
+ *  \param outVector Vector of floating-point number containing the decoded values.
+ *  \param inGray Whether the values are gray-coded.
+ *
+ *  Each value is extracted from the packed words at once. Gray-coded values are converted
+ *  to binary with a parallel prefix XOR of the extracted bits.
+ */
+void BitStr::BitString::decodeKeys(const BitStr::BitString::DecodingKeyVector& inKeys,
+                                   std::vector<double>& outVector,
+                                   bool inGray) const
+{
+	Beagle_StackTraceBeginM();
+	// The encodings are always checked, as they set the width of the shifts below.
+	for(unsigned int i=0; i<inKeys.size(); i++) {
+		if((inKeys[i].mEncoding < 1) || (inKeys[i].mEncoding > WordBits)) {
+			std::ostringstream lOSS;
+			lOSS <<  "In BitStr::BitString::decodeKeys(): the ";
+			lOSS <<  uint2ordinal(i+1) << " encoding value (" << inKeys[i].mEncoding;
+			lOSS <<  ") is not in the valid interval (which is [1,";
+			lOSS <<  WordBits << "])!";
+			throw Beagle_RunTimeExceptionM(lOSS.str());
+		}
+	}
 #ifndef BEAGLE_NDEBUG
 	unsigned int lNbBits = 0;
-	for(unsigned int i=0; i<inKeys.size(); i++) lNbBits += inKeys[i].mEncoding;
-
+	for(unsigned int i=0; i<inKeys.size(); i++) {
+		if(inKeys[i].mLowerBound >= inKeys[i].mUpperBound) {
+			std::ostringstream lOSS;
+			lOSS << "In BitStr::BitString::decodeKeys(): ";
+			lOSS <<  "the lower bound value of the " <<  uint2ordinal(i+1);
+			lOSS <<  " key (" <<  inKeys[i].mLowerBound;
+			lOSS <<  ") is bigger or equal to the associated upper bound (";
+			lOSS <<  inKeys[i].mUpperBound <<  ")!";
+			throw Beagle_RunTimeExceptionM(lOSS.str());
+		}
+		lNbBits += inKeys[i].mEncoding;
+	}
 	if(lNbBits != size()) {
 		std::ostringstream lOSS;
-		lOSS << "In BitStr::BitString::decodeGray(): ";
+		lOSS << "In BitStr::BitString::decodeKeys(): ";
 		lOSS <<  "the total number of bits specified by the encoding keys (";
 		lOSS <<  lNbBits;
 		lOSS <<  ") is different from the number of bits of the genotype string (";
@@ -203,9 +187,61 @@ void BitStr::BitString::decodeGray(const BitStr::BitString::DecodingKeyVector& i
 	}
 #endif // BEAGLE_NDEBUG
 
-	std::vector<bool> lBinBitString;
-	convertGray2Bin(inKeys, (*this), lBinBitString);
-	convertBin2Dec(inKeys, lBinBitString, outVector);
+	outVector.resize(inKeys.size());
+	unsigned int lPosBS = 0;
+	for(unsigned int j=0; j<inKeys.size(); j++) {
+		Word lGene = extractBits(lPosBS, inKeys[j].mEncoding);
+		lPosBS += inKeys[j].mEncoding;
+		if(inGray) {
+			for(unsigned int lShift=1; lShift<WordBits; lShift<<=1) lGene ^= (lGene >> lShift);
+		}
+		const Word lDiv = (~Word(0)) >> (WordBits - inKeys[j].mEncoding);
+		double lTempVal = double(lGene) / double(lDiv);
+		outVector[j] =
+		    inKeys[j].mLowerBound + (lTempVal * (inKeys[j].mUpperBound - inKeys[j].mLowerBound));
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Extract consecutive bits of the string as an integer.
+ *  \param inIndex Index of the first (most significant) bit to extract.
+ *  \param inLength Number of bits to extract, in [1,WordBits].
+ *  \return Extracted bits, in the least significant bits of the returned word.
+ */
+BitStr::BitString::Word BitStr::BitString::extractBits(unsigned int inIndex, unsigned int inLength) const
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM((inLength >= 1) && (inLength <= WordBits));
+	Beagle_AssertM((inIndex + inLength) <= mSize);
+	const unsigned int lWord = inIndex / WordBits;
+	const unsigned int lOffset = inIndex % WordBits;
+	Word lValue = mWords[lWord] << lOffset;
+	if((lOffset + inLength) > WordBits) lValue |= (mWords[lWord+1] >> (WordBits - lOffset));
+	return lValue >> (WordBits - inLength);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Find the next set bit of the string.
+ *  \param inIndex Index from which the search starts (included).
+ *  \return Index of the next bit equal to one, or the size of the string if there is none.
+ */
+unsigned int BitStr::BitString::findNextSet(unsigned int inIndex) const
+{
+	Beagle_StackTraceBeginM();
+	if(inIndex >= mSize) return mSize;
+	unsigned int lWord = inIndex / WordBits;
+	Word lBits = mWords[lWord] & (~Word(0) >> (inIndex % WordBits));
+	while(lBits == 0) {
+		if(++lWord == mWords.size()) return mSize;
+		lBits = mWords[lWord];
+	}
+	unsigned int lIndex = lWord * WordBits;
+	for(Word lMask = Word(1) << (WordBits-1); (lBits & lMask) == 0; lMask >>= 1) ++lIndex;
+	return lIndex;
 	Beagle_StackTraceEndM();
 }
 
@@ -235,6 +271,28 @@ const std::string& BitStr::BitString::getType() const
 }
 
 
+/*!
+ *  \brief Resize the bit string.
+ *  \param inSize New size of the bit string.
+ *  \param inModel Value of the bits added, if the string is enlarged.
+ */
+void BitStr::BitString::resize(unsigned int inSize, bool inModel)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lOldSize = mSize;
+	const unsigned int lNbWords = (inSize + WordBits - 1) / WordBits;
+	mWords.resize(lNbWords, inModel ? ~Word(0) : Word(0));
+	mSize = inSize;
+	if(inModel && (inSize > lOldSize) && ((lOldSize % WordBits) != 0)) {
+		mWords[lOldSize / WordBits] |= (~Word(0) >> (lOldSize % WordBits));
+	}
+	if((mSize % WordBits) != 0) {
+		mWords.back() &= ~(~Word(0) >> (mSize % WordBits));
+	}
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Swap the gene at inI with the gene at inJ.
  *	\param inI is the index of the first gene to swap.
@@ -245,7 +303,72 @@ void BitStr::BitString::swap(unsigned int inI, unsigned int inJ)
 	Beagle_StackTraceBeginM();
 	Beagle_BoundCheckAssertM(inI, 0, size() -1);
 	Beagle_BoundCheckAssertM(inJ, 0, size() -1);
-	this->swap((*this)[inI], (*this)[inJ]);
+	const bool lTemp = (*this)[inI];
+	(*this)[inI] = (*this)[inJ];
+	(*this)[inJ] = lTemp;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Exchange bits with another bit string, according to masks.
+ *  \param ioOther Bit string to exchange bits with.
+ *  \param inMasks Masks of the bits to exchange, one per word.
+ *
+ *  The masks must not select bits beyond the size of any of the two strings.
+ */
+void BitStr::BitString::swapMasked(BitStr::BitString& ioOther, const std::vector<Word>& inMasks)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(inMasks.size() <= mWords.size());
+	Beagle_AssertM(inMasks.size() <= ioOther.mWords.size());
+	for(unsigned int i=0; i<inMasks.size(); ++i) {
+		const Word lDiff = (mWords[i] ^ ioOther.mWords[i]) & inMasks[i];
+		mWords[i] ^= lDiff;
+		ioOther.mWords[i] ^= lDiff;
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Exchange a range of bits with another bit string.
+ *  \param ioOther Bit string to exchange bits with.
+ *  \param inBegin Index of the first bit to exchange.
+ *  \param inEnd Index following the last bit to exchange.
+ */
+void BitStr::BitString::swapRange(BitStr::BitString& ioOther, unsigned int inBegin, unsigned int inEnd)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(inEnd <= mSize);
+	Beagle_AssertM(inEnd <= ioOther.mSize);
+	if(inBegin >= inEnd) return;
+	const unsigned int lFirstWord = inBegin / WordBits;
+	const unsigned int lLastWord = (inEnd - 1) / WordBits;
+	for(unsigned int i=lFirstWord; i<=lLastWord; ++i) {
+		Word lMask = ~Word(0);
+		if(i == lFirstWord) lMask &= (~Word(0) >> (inBegin % WordBits));
+		if((i == lLastWord) && ((inEnd % WordBits) != 0)) lMask &= ~(~Word(0) >> (inEnd % WordBits));
+		const Word lDiff = (mWords[i] ^ ioOther.mWords[i]) & lMask;
+		mWords[i] ^= lDiff;
+		ioOther.mWords[i] ^= lDiff;
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Compute a hash value of the bit string, from its packed words.
+ *  \return Hash value, equal for bit strings that are equal.
+ */
+unsigned long BitStr::BitString::computeHash() const
+{
+	Beagle_StackTraceBeginM();
+	unsigned long lHash = mSize;
+	for(unsigned int i=0; i<mWords.size(); ++i) {
+		lHash = combineHash(lHash, (unsigned long)(mWords[i] ^ ((mWords[i] >> 16) >> 16)));
+	}
+	return lHash;
 	Beagle_StackTraceEndM();
 }
 
@@ -260,7 +383,7 @@ bool BitStr::BitString::isEqual(const Object& inRightObj) const
 	Beagle_StackTraceBeginM();
 	const BitStr::BitString& lRightBS = castObjectT<const BitStr::BitString&>(inRightObj);
 	if(size() != lRightBS.size()) return false;
-	return std::equal(begin(), end(), lRightBS.begin());
+	return mWords == lRightBS.mWords;
 	Beagle_StackTraceEndM();
 }
 
@@ -279,8 +402,34 @@ bool BitStr::BitString::isLess(const Object& inRightObj) const
 	Beagle_StackTraceBeginM();
 	const BitStr::BitString& lRightBS = castObjectT<const BitStr::BitString&>(inRightObj);
 	unsigned int lSizeCompared = minOf<unsigned int>(size(),lRightBS.size());
-	return std::lexicographical_compare(begin(), begin()+lSizeCompared,
-	                                    lRightBS.begin(), lRightBS.begin()+lSizeCompared);
+	const unsigned int lFullWords = lSizeCompared / WordBits;
+	for(unsigned int i=0; i<lFullWords; ++i) {
+		if(mWords[i] != lRightBS.mWords[i]) return mWords[i] < lRightBS.mWords[i];
+	}
+	if((lSizeCompared % WordBits) == 0) return false;
+	const Word lMask = ~(~Word(0) >> (lSizeCompared % WordBits));
+	return (mWords[lFullWords] & lMask) < (lRightBS.mWords[lFullWords] & lMask);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Read a bit string from a binary archive.
+ *  \param ioArchive Binary archive from which the bit string is read.
+ *  \param ioContext Evolutionary context.
+ *
+ *  Bits are stored by chunks of 32 bits, so that the layout does not depend on the word size.
+ */
+void BitStr::BitString::readBinary(BinaryInArchive& ioArchive, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	mSize = ioArchive.readUInt();
+	mWords.assign((mSize + WordBits - 1) / WordBits, 0);
+	const unsigned int lNbChunks = (mSize + 31) / 32;
+	for(unsigned int i=0; i<lNbChunks; ++i) {
+		const unsigned int lShift = WordBits - 32 - ((32 * i) % WordBits);
+		mWords[(32 * i) / WordBits] |= (Word(ioArchive.readUInt()) << lShift);
+	}
 	Beagle_StackTraceEndM();
 }
 
@@ -311,15 +460,32 @@ void BitStr::BitString::readWithContext(PACC::XML::ConstIterator inIter, Context
 	}
 
 	clear();
-	std::istringstream lISS(lChild->getValue());
-	while(lISS.eof() == false) {
-		char lBuf = '\0';
-		lISS >> lBuf;
-		if(lBuf=='\0') break;
+	const std::string& lValue = lChild->getValue();
+	mWords.reserve((lValue.size() + WordBits - 1) / WordBits);
+	for(unsigned int i=0; i<lValue.size(); ++i) {
+		const char lBuf = lValue[i];
+		if((lBuf == ' ') || (lBuf == '\t') || (lBuf == '\n') || (lBuf == '\r')) continue;
 		if((lBuf != '0') && (lBuf != '1')) {
 			throw Beagle_IOExceptionNodeM(*lChild, "bit string value is not 0 or 1!");
 		}
-		push_back((lBuf == '1') ? true : false);
+		push_back(lBuf == '1');
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Write a bit string into a binary archive.
+ *  \param ioArchive Binary archive into which the bit string is written.
+ */
+void BitStr::BitString::writeBinary(BinaryOutArchive& ioArchive) const
+{
+	Beagle_StackTraceBeginM();
+	ioArchive.writeUInt(mSize);
+	const unsigned int lNbChunks = (mSize + 31) / 32;
+	for(unsigned int i=0; i<lNbChunks; ++i) {
+		const unsigned int lShift = WordBits - 32 - ((32 * i) % WordBits);
+		ioArchive.writeUInt((unsigned int)((mWords[(32 * i) / WordBits] >> lShift) & Word(0xFFFFFFFFUL)));
 	}
 	Beagle_StackTraceEndM();
 }
@@ -334,8 +500,10 @@ void BitStr::BitString::writeContent(PACC::XML::Streamer& ioStreamer, bool inInd
 {
 	Beagle_StackTraceBeginM();
 	ioStreamer.insertAttribute("size", uint2str(size()));
-	std::ostringstream lOSS;
-	for(unsigned int i=0; i<size(); i++) lOSS << ((*this)[i] ? '1' : '0');
-	ioStreamer.insertStringContent(lOSS.str());
+	std::string lValue(size(), '0');
+	for(unsigned int i=0; i<size(); i++) {
+		if(mWords[i / WordBits] & getMask(i)) lValue[i] = '1';
+	}
+	ioStreamer.insertStringContent(lValue);
 	Beagle_StackTraceEndM();
 }
@@ -53,12 +53,71 @@ namespace BitStr
  *  \class BitString Beagle/BitStr/BitString.hpp "Beagle/BitStr/BitString.hpp"
  *  \brief Bit string genotype class.
  *  \ingroup BitStrF
+ *
+ *  The bits are packed into machine words, the first bit of the string being the most
+ *  significant bit of the first word. The unused bits of the last word are always zero, so
+ *  that whole words can be compared, counted and exchanged. The class keeps a subset of the
+ *  std::vector<bool> interface (size, resize, operator[], push_back), so that it can be
+ *  used with the generic EC operators.
  */
-class BitString : public Genotype, public std::vector<bool>
+class BitString : public Genotype
 {
 
 public:
 
+#ifdef BEAGLE_HAVE_LONG_LONG
+	typedef unsigned long long Word;  //!< Word type into which bits are packed.
+#else // BEAGLE_HAVE_LONG_LONG
+	typedef unsigned long Word;       //!< Word type into which bits are packed.
+#endif // BEAGLE_HAVE_LONG_LONG
+
+	//! Type of the bits of the string.
+	typedef bool value_type;
+
+	/*!
+	 *  \class reference Beagle/BitStr/BitString.hpp "Beagle/BitStr/BitString.hpp"
+	 *  \brief Reference to a bit of a bit string.
+	 */
+	class reference
+	{
+	public:
+		/*!
+		 *  \brief Construct a reference to a bit.
+		 *  \param inWord Word containing the bit.
+		 *  \param inMask Mask of the bit in the word.
+		 */
+		reference(Word& inWord, Word inMask) :
+				mWord(inWord),
+				mMask(inMask)
+		{ }
+
+		//! Return the value of the referenced bit.
+		inline operator bool() const {
+			return (mWord & mMask) != 0;
+		}
+
+		//! Set the value of the referenced bit.
+		inline reference& operator=(bool inValue) {
+			if(inValue) mWord |= mMask;
+			else mWord &= ~mMask;
+			return *this;
+		}
+
+		//! Set the value of the referenced bit to the value of another bit.
+		inline reference& operator=(const reference& inRef) {
+			return (*this) = bool(inRef);
+		}
+
+		//! Flip the referenced bit.
+		inline void flip() {
+			mWord ^= mMask;
+		}
+
+	private:
+		Word& mWord;  //!< Word containing the bit.
+		Word  mMask;  //!< Mask of the bit in the word.
+	};
+
 	/*!
 	 *  \struct DecodingKey beagle/BitStr/BitString.hpp "beagle/BitStr/BitString.hpp"
 	 *  \brief Decoding key to tranform a bit string genotype into a vector of numbers.
@@ -94,27 +153,126 @@ public:
 	//! BitString bag type.
 	typedef ContainerT<BitString,Genotype::Bag> Bag;
 
+	//! Number of bits in a word.
+	static const unsigned int WordBits = 8 * sizeof(Word);
+
 	explicit BitString(unsigned int inSize=0, bool inModel=false);
 
+	virtual unsigned long       computeHash() const;
 	virtual void                copy(const Member& inOriginal, System& ioSystem);
+	unsigned int                count() const;
 	void                        decode(const BitString::DecodingKeyVector& inKeys, std::vector<double>& outVector) const;
 	void                        decodeGray(const BitString::DecodingKeyVector& inKeys, std::vector<double>& outVector) const;
+	unsigned int                findNextSet(unsigned int inIndex) const;
 	virtual unsigned int        getSize() const;
 	virtual const std::string&  getType() const;
+	void                        resize(unsigned int inSize, bool inModel=false);
 	virtual void				swap(unsigned int inI, unsigned int inJ);
+	void                        swapRange(BitString& ioOther, unsigned int inBegin, unsigned int inEnd);
+	void                        swapMasked(BitString& ioOther, const std::vector<Word>& inMasks);
 	virtual bool                isEqual(const Object& inRightObj) const;
 	virtual bool                isLess(const Object& inRightObj) const;
+	virtual void                readBinary(BinaryInArchive& ioArchive, Context& ioContext);
 	virtual void                readWithContext(PACC::XML::ConstIterator inIter, Context& ioContext);
+	virtual void                writeBinary(BinaryOutArchive& ioArchive) const;
 	virtual void                writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
+	/*!
+	 *  \brief Remove all the bits of the string.
+	 */
+	inline void clear() {
+		mWords.clear();
+		mSize = 0;
+	}
+
+	/*!
+	 *  \brief Return whether the bit string is empty.
+	 *  \return True if the string has no bits, false if not.
+	 */
+	inline bool empty() const {
+		return mSize == 0;
+	}
+
+	/*!
+	 *  \brief Flip a bit of the string.
+	 *  \param inIndex Index of the bit to flip.
+	 */
+	inline void flip(unsigned int inIndex) {
+		Beagle_StackTraceBeginM();
+		Beagle_BoundCheckAssertM(inIndex, 0, mSize-1);
+		mWords[inIndex / WordBits] ^= getMask(inIndex);
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Return the mask of a bit in its word.
+	 *  \param inIndex Index of the bit.
+	 *  \return Mask of the bit.
+	 */
+	static inline Word getMask(unsigned int inIndex) {
+		return Word(1) << (WordBits - 1 - (inIndex % WordBits));
+	}
+
+	/*!
+	 *  \brief Return the words into which the bits are packed.
+	 *  \return Packed words, the unused bits of the last word being zero.
+	 */
+	inline const std::vector<Word>& getWords() const {
+		return mWords;
+	}
+
+	/*!
+	 *  \brief Append a bit at the end of the string.
+	 *  \param inValue Value of the bit appended.
+	 */
+	inline void push_back(bool inValue) {
+		if((mSize % WordBits) == 0) mWords.push_back(0);
+		if(inValue) mWords.back() |= getMask(mSize);
+		++mSize;
+	}
+
+	/*!
+	 *  \brief Return the number of bits of the string.
+	 *  \return Size of the bit string.
+	 */
+	inline unsigned int size() const {
+		return mSize;
+	}
+
+	/*!
+	 *  \brief Access a bit of the string.
+	 *  \param inIndex Index of the bit.
+	 *  \return Reference to the bit.
+	 */
+	inline reference operator[](unsigned int inIndex) {
+		Beagle_StackTraceBeginM();
+		Beagle_BoundCheckAssertM(inIndex, 0, mSize-1);
+		return reference(mWords[inIndex / WordBits], getMask(inIndex));
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Get the value of a bit of the string.
+	 *  \param inIndex Index of the bit.
+	 *  \return Value of the bit.
+	 */
+	inline bool operator[](unsigned int inIndex) const {
+		Beagle_StackTraceBeginM();
+		Beagle_BoundCheckAssertM(inIndex, 0, mSize-1);
+		return (mWords[inIndex / WordBits] & getMask(inIndex)) != 0;
+		Beagle_StackTraceEndM();
+	}
+
 protected:
 
-	static void convertBin2Dec(const BitString::DecodingKeyVector& inKeys,
-	                           const std::vector<bool>& inBitString,
-	                           std::vector<double>& outVector);
-	static void convertGray2Bin(const BitString::DecodingKeyVector& inKeys,
-	                            const std::vector<bool>& inGrayBitString,
-	                            std::vector<bool>& outBinBitString);
+	static unsigned int countBits(Word inWord);
+	void                decodeKeys(const BitString::DecodingKeyVector& inKeys,
+	                               std::vector<double>& outVector,
+	                               bool inGray) const;
+	Word                extractBits(unsigned int inIndex, unsigned int inLength) const;
+
+	std::vector<Word> mWords;  //!< Words into which the bits are packed.
+	unsigned int      mSize;   //!< Number of bits of the string.
 
 };
 
@@ -0,0 +1,82 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/BitStr/CrossoverOnePointOp.cpp
+ *  \brief  Source code of class BitStr::CrossoverOnePointOp.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/BitStr.hpp"
+
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Mate two bit string individuals for one point crossover.
+ *  \param ioIndiv1   First individual to mate.
+ *  \param ioContext1 Evolutionary context of the first individual.
+ *  \param ioIndiv2   Second individual to mate.
+ *  \param ioContext2 Evolutionary context of the second individual.
+ *  \return True if the individuals are effectively mated, false if not.
+ *
+ *  Individuals made of one bit string exchange their prefix word by word. Individuals
+ *  made of several bit strings are mated with the generic one point crossover.
+ */
+bool BitStr::CrossoverOnePointOp::mate(Beagle::Individual& ioIndiv1,
+                                       Beagle::Context&    ioContext1,
+                                       Beagle::Individual& ioIndiv2,
+                                       Beagle::Context&    ioContext2)
+{
+	Beagle_StackTraceBeginM();
+	unsigned int lNbGenotypes = minOf<unsigned int>(ioIndiv1.size(), ioIndiv2.size());
+	if(lNbGenotypes != 1) {
+		return EC::CrossoverOnePointOpT<BitStr::BitString>::mate(ioIndiv1, ioContext1, ioIndiv2, ioContext2);
+	}
+
+	BitStr::BitString::Handle lGenotype1 = castHandleT<BitStr::BitString>(ioIndiv1[0]);
+	BitStr::BitString::Handle lGenotype2 = castHandleT<BitStr::BitString>(ioIndiv2[0]);
+	unsigned int lSize = minOf<unsigned int>(lGenotype1->size(), lGenotype2->size());
+	if(lSize < 2) return false;
+	unsigned int lMatingPoint = ioContext1.getSystem().getRandomizer().rollInteger(1, (lSize-1));
+
+	Beagle_LogDebugM(ioContext1.getSystem().getLogger(), *lGenotype1);
+	Beagle_LogDebugM(ioContext1.getSystem().getLogger(), *lGenotype2);
+	Beagle_LogVerboseM(
+	    ioContext1.getSystem().getLogger(),
+	    "Mating individuals before the " << uint2ordinal(lMatingPoint+1) << " element"
+	);
+
+	lGenotype1->swapRange(*lGenotype2, 0, lMatingPoint);
+
+	Beagle_LogDebugM(ioContext1.getSystem().getLogger(), *lGenotype1);
+	Beagle_LogDebugM(ioContext1.getSystem().getLogger(), *lGenotype2);
+
+	return true;
+	Beagle_StackTraceEndM();
+}
@@ -83,6 +83,9 @@ public:
 	virtual ~CrossoverTwoPointsOp()
 	{ }
 
+	virtual bool mate(Beagle::Individual& ioIndiv1, Beagle::Context& ioContext1,
+	                  Beagle::Individual& ioIndiv2, Beagle::Context& ioContext2);
+
 };
 
 }
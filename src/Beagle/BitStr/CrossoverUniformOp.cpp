@@ -0,0 +1,103 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/BitStr/CrossoverUniformOp.cpp
+ *  \brief  Source code of class BitStr::CrossoverUniformOp.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/BitStr.hpp"
+
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Mate two bit string individuals for uniform crossover.
+ *  \param ioIndiv1   First individual to mate.
+ *  \param ioContext1 Evolutionary context of the first individual.
+ *  \param ioIndiv2   Second individual to mate.
+ *  \param ioContext2 Evolutionary context of the second individual.
+ *  \return True if the individuals are effectively mated, false if not.
+ *
+ *  A mask of the bits to exchange is built for each bit string, and the bits are then
+ *  exchanged word by word. With a distribution probability of 0.5, the masks are random
+ *  words; otherwise, the gap between two exchanged bits is drawn from a geometric
+ *  distribution.
+ */
+bool BitStr::CrossoverUniformOp::mate(Beagle::Individual& ioIndiv1,
+                                      Beagle::Context&    ioContext1,
+                                      Beagle::Individual& ioIndiv2,
+                                      Beagle::Context&    ioContext2)
+{
+	Beagle_StackTraceBeginM();
+	unsigned int lNbGenotypes = minOf<unsigned int>(ioIndiv1.size(), ioIndiv2.size());
+	if(lNbGenotypes == 0) return false;
+
+	Beagle_LogDebugM(ioContext1.getSystem().getLogger(), ioIndiv1);
+	Beagle_LogDebugM(ioContext1.getSystem().getLogger(), ioIndiv2);
+
+	Randomizer& lRandomizer = ioContext1.getSystem().getRandomizer();
+	const double lDistribProba = mDistribProba->getWrappedValue();
+	const unsigned int lWordBits = BitStr::BitString::WordBits;
+	std::vector<BitStr::BitString::Word> lMasks;
+	for(unsigned int i=0; i<lNbGenotypes; ++i) {
+		BitStr::BitString::Handle lGenotype1 = castHandleT<BitStr::BitString>(ioIndiv1[i]);
+		BitStr::BitString::Handle lGenotype2 = castHandleT<BitStr::BitString>(ioIndiv2[i]);
+		const unsigned int lSize = minOf<unsigned int>(lGenotype1->size(), lGenotype2->size());
+		if(lSize == 0) continue;
+		lMasks.assign((lSize + lWordBits - 1) / lWordBits, 0);
+		if(lDistribProba == 0.5) {
+			for(unsigned int j=0; j<lMasks.size(); ++j) {
+				for(unsigned int k=0; k<lWordBits; k+=32) {
+					lMasks[j] <<= 16;
+					lMasks[j] <<= 16;
+					lMasks[j] |= lRandomizer.rollInteger(0, 0xFFFFFFFFUL);
+				}
+			}
+			if((lSize % lWordBits) != 0) {
+				lMasks.back() &= ~(~BitStr::BitString::Word(0) >> (lSize % lWordBits));
+			}
+		} else {
+			unsigned long j = lRandomizer.rollGeometric(lDistribProba);
+			while(j < lSize) {
+				lMasks[j / lWordBits] |= BitStr::BitString::getMask(j);
+				const unsigned long lSkip = lRandomizer.rollGeometric(lDistribProba);
+				if(lSkip >= lSize) break;
+				j += lSkip + 1;
+			}
+		}
+		lGenotype1->swapMasked(*lGenotype2, lMasks);
+	}
+
+	Beagle_LogDebugM(ioContext1.getSystem().getLogger(), ioIndiv1);
+	Beagle_LogDebugM(ioContext1.getSystem().getLogger(), ioIndiv2);
+
+	return true;
+	Beagle_StackTraceEndM();
+}
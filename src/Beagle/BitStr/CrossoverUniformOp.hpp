@@ -86,6 +86,9 @@ public:
 	virtual ~CrossoverUniformOp()
 	{ }
 
+	virtual bool mate(Beagle::Individual& ioIndiv1, Beagle::Context& ioContext1,
+	                  Beagle::Individual& ioIndiv2, Beagle::Context& ioContext2);
+
 };
 
 }
@@ -93,6 +93,9 @@ void BitStr::MutationFlipBitOp::registerParams(System& ioSystem)
  *  \param ioIndividual Individual to mutate.
  *  \param ioContext Context of the evolution.
  *  \return True if the individual is effectively mutated, false if not.
+ *
+ *  The gap between two flipped bits is drawn from a geometric distribution, so that the
+ *  cost of the mutation is proportional to the number of bits flipped.
  */
 bool BitStr::MutationFlipBitOp::mutate(Beagle::Individual& ioIndividual, Context& ioContext)
 {
@@ -104,6 +107,9 @@ bool BitStr::MutationFlipBitOp::mutate(Beagle::Individual& ioIndividual, Context
 	    std::string("Bit flip mutation probability is: ")+dbl2str(mBitMutateProba->getWrappedValue())
 	);
 
+	Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+	const double lBitMutateProba = mBitMutateProba->getWrappedValue();
+	std::vector<unsigned long> lSkips;
 	for(unsigned int i=0; i<ioIndividual.size(); i++) {
 		BitStr::BitString::Handle lBS = castHandleT<BitStr::BitString>(ioIndividual[i]);
 		Beagle_LogVerboseM(
@@ -111,12 +117,22 @@ bool BitStr::MutationFlipBitOp::mutate(Beagle::Individual& ioIndividual, Context
 		    std::string("Flip mutating the ")+uint2ordinal(i+1)+" bitstring"
 		);
 		Beagle_LogDebugM(ioContext.getSystem().getLogger(), *lBS);
-		for(unsigned int j=0; j<lBS->size(); j++) {
-			double lRolledPb = ioContext.getSystem().getRandomizer().rollUniform();
-			if(lRolledPb <= mBitMutateProba->getWrappedValue()) {
-				(*lBS)[j] = !(*lBS)[j];
-				lMutated = true;
+		// Draw the gaps between flipped bits by blocks sized on the expected number of flips.
+		const unsigned long lSize = lBS->size();
+		lSkips.resize((unsigned int)(lSize*std::min(lBitMutateProba, 1.0)) + 1);
+		lRandomizer.fillGeometric(&lSkips[0], lSkips.size(), lBitMutateProba);
+		unsigned int lNextSkip = 0;
+		unsigned long j = lSkips[lNextSkip++];
+		while(j < lSize) {
+			lBS->flip(j);
+			lMutated = true;
+			if(lNextSkip == lSkips.size()) {
+				lRandomizer.fillGeometric(&lSkips[0], lSkips.size(), lBitMutateProba);
+				lNextSkip = 0;
 			}
+			const unsigned long lSkip = lSkips[lNextSkip++];
+			if(lSkip >= lSize) break;
+			j += lSkip + 1;
 		}
 		if(lMutated) {
 			Beagle_LogVerboseM(
@@ -67,10 +67,12 @@
 #include "Beagle/CMA/AlgoCMAES.hpp"
 #include "Beagle/CMA/CMAHolder.hpp"
 #include "Beagle/CMA/InitCMAFltVecOp.hpp"
+#include "Beagle/CMA/LMMuWCommaLambdaCMAFltVecOp.hpp"
 #include "Beagle/CMA/MutationCMAFltVecOp.hpp"
 #include "Beagle/CMA/MutationQRCMAFltVecOp.hpp"
 #include "Beagle/CMA/MuWCommaLambdaCMAFltVecOp.hpp"
 #include "Beagle/CMA/PackageCMAES.hpp"
+#include "Beagle/CMA/SepMuWCommaLambdaCMAFltVecOp.hpp"
 #include "Beagle/CMA/TermCMAOp.hpp"
 
 #endif // Beagle_GA_hpp
@@ -70,10 +70,16 @@ void CMA::CMAHolder::readWithSystem(PACC::XML::ConstIterator inIter, System& ioS
 					throw Beagle_IOExceptionNodeM(*lChild2, "child expected!");
 				if(lChild2->getValue()=="B") lValues.mB.read(lChild2->getFirstChild());
 				else if(lChild2->getValue()=="D")  lValues.mD.read(lChild2->getFirstChild());
+				else if(lChild2->getValue()=="C")  lValues.mC.read(lChild2->getFirstChild());
+				else if(lChild2->getValue()=="EigenLag") lValues.mEigenLag.read(lChild2->getFirstChild());
 				else if(lChild2->getValue()=="PC") lValues.mPC.read(lChild2->getFirstChild());
 				else if(lChild2->getValue()=="PS") lValues.mPS.read(lChild2->getFirstChild());
 				else if(lChild2->getValue()=="Xmean") lValues.mXmean.read(lChild2->getFirstChild());
 				else if(lChild2->getValue()=="Sigma") lValues.mSigma.read(lChild2->getFirstChild());
+				else if(lChild2->getValue()=="LMP") lValues.mLMP.read(lChild2->getFirstChild());
+				else if(lChild2->getValue()=="LMV") lValues.mLMV.read(lChild2->getFirstChild());
+				else if(lChild2->getValue()=="LMb") lValues.mLMb.read(lChild2->getFirstChild());
+				else if(lChild2->getValue()=="LMd") lValues.mLMd.read(lChild2->getFirstChild());
 			}
 		}
 	}
@@ -98,6 +104,12 @@ void CMA::CMAHolder::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent
 		ioStreamer.openTag("D", inIndent);
 		lIterMap->second.mD.write(ioStreamer, inIndent);
 		ioStreamer.closeTag();
+		ioStreamer.openTag("C", inIndent);
+		lIterMap->second.mC.write(ioStreamer, inIndent);
+		ioStreamer.closeTag();
+		ioStreamer.openTag("EigenLag", inIndent);
+		lIterMap->second.mEigenLag.write(ioStreamer, inIndent);
+		ioStreamer.closeTag();
 		ioStreamer.openTag("PC", inIndent);
 		lIterMap->second.mPC.write(ioStreamer, inIndent);
 		ioStreamer.closeTag();
@@ -110,6 +122,20 @@ void CMA::CMAHolder::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent
 		ioStreamer.openTag("Sigma", inIndent);
 		lIterMap->second.mSigma.write(ioStreamer, inIndent);
 		ioStreamer.closeTag();
+		if(lIterMap->second.mLMP.getRows() > 0) {
+			ioStreamer.openTag("LMP", inIndent);
+			lIterMap->second.mLMP.write(ioStreamer, inIndent);
+			ioStreamer.closeTag();
+			ioStreamer.openTag("LMV", inIndent);
+			lIterMap->second.mLMV.write(ioStreamer, inIndent);
+			ioStreamer.closeTag();
+			ioStreamer.openTag("LMb", inIndent);
+			lIterMap->second.mLMb.write(ioStreamer, inIndent);
+			ioStreamer.closeTag();
+			ioStreamer.openTag("LMd", inIndent);
+			lIterMap->second.mLMd.write(ioStreamer, inIndent);
+			ioStreamer.closeTag();
+		}
 		ioStreamer.closeTag();
 	}
 	Beagle_StackTraceEndM();
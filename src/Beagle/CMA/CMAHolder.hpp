@@ -55,17 +55,34 @@ namespace CMA
  *  \brief CMA-ES matrices and vector values.
  *  \ingroup GAF
  *  \ingroup GAFV
+ *
+ *  With the separable and limited-memory variants of CMA-ES, matrices B and C are left
+ *  empty and C is represented by the standard deviations D, and for the limited-memory
+ *  variant by a few stored cumulation paths, so that memory stays linear in the dimension.
  */
 struct CMAValues
 {
 	Matrix mB;       //!< CMA-ES B matrix.
 	Vector mD;       //!< CMA-ES D matrix.
+	Matrix mC;       //!< CMA-ES covariance matrix C, B and D are its eigen decomposition.
+	UInt mEigenLag;  //!< Number of updates of C since its last eigen decomposition.
 	Vector mPC;      //!< CMA-ES P_c cumulation path.
 	Vector mPS;      //!< CMA-ES P_s cumulation path.
 	Vector mXmean;   //!< Mean float vector individual.
 	Double mSigma;   //!< CMA-ES sigma value.
-
-	CMAValues()
+	Matrix mLMP;     //!< Limited-memory CMA-ES stored p_c cumulation paths, one per row.
+	Matrix mLMV;     //!< Limited-memory CMA-ES stored paths transformed by the inverse factor of C.
+	Vector mLMb;     //!< Limited-memory CMA-ES coefficients of the factor of C.
+	Vector mLMd;     //!< Limited-memory CMA-ES coefficients of the inverse factor of C.
+
+	Matrix mSamples;            //!< Batch of mutation steps sampled for the generation (not saved).
+	unsigned int mSampleIndex;  //!< Index of the next unused row of the batch of mutation steps.
+	unsigned int mSampleBatch;  //!< Number of mutation steps to sample in a batch.
+
+	CMAValues() :
+		mEigenLag(0),
+		mSampleIndex(0),
+		mSampleBatch(0)
 	{ }
 };
 
@@ -0,0 +1,392 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/CMA/LMMuWCommaLambdaCMAFltVecOp.cpp
+ *  \brief  Source code of class CMA::LMMuWCommaLambdaCMAFltVecOp.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/CMA.hpp"
+
+#include <cmath>
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Build limited-memory CMA-ES (Mu_W,Lambda) replacement strategy operator.
+ *  \param inLMRatioName Lamda over Mu parameter name used in the register.
+ *  \param inName Name of the limited-memory CMA-ES (Mu_W,Lambda) operator.
+ */
+CMA::LMMuWCommaLambdaCMAFltVecOp::LMMuWCommaLambdaCMAFltVecOp(std::string inLMRatioName,
+        std::string inName) :
+		MuWCommaLambdaCMAFltVecOp(inLMRatioName,inName)
+{ }
+
+
+/*!
+ *  \brief Get learning rate of the rank-one updates of the factor of C.
+ *  \param inN Dimensionality of the problem.
+ *  \return Learning rate c_1, equal to 1/(10*ln(n+1)) as in LM-CMA-ES.
+ */
+double CMA::LMMuWCommaLambdaCMAFltVecOp::getLearningRate(unsigned int inN)
+{
+	Beagle_StackTraceBeginM();
+	return 1.0 / (10.0 * std::log(double(inN) + 1.0));
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Multiply a vector by the factor A of the covariance matrix.
+ *  \param outX Result of the product A*z.
+ *  \param inZ Vector z to multiply.
+ *  \param inCMAValues CMA values holding the stored paths defining the factor.
+ */
+void CMA::LMMuWCommaLambdaCMAFltVecOp::multiplyFactor(Vector& outX,
+        const Vector& inZ,
+        const CMAValues& inCMAValues)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lN = inZ.size();
+	const double lA = std::sqrt(1.0 - getLearningRate(lN));
+	outX.resize(lN);
+	for(unsigned int k=0; k<lN; ++k) outX[k] = inZ[k];
+	for(unsigned int t=0; t<inCMAValues.mLMP.getRows(); ++t) {
+		double lVZ = 0.0;
+		for(unsigned int k=0; k<lN; ++k) lVZ += inCMAValues.mLMV(t,k) * inZ[k];
+		const double lFactor = inCMAValues.mLMb[t] * lVZ;
+		for(unsigned int k=0; k<lN; ++k) {
+			outX[k] = (lA * outX[k]) + (lFactor * inCMAValues.mLMP(t,k));
+		}
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Multiply a vector by the transpose of the factor A of the covariance matrix.
+ *  \param outX Result of the product A^T*z.
+ *  \param inZ Vector z to multiply.
+ *  \param inCMAValues CMA values holding the stored paths defining the factor.
+ *
+ *  The factor is a^m*I plus a sum of rank-one terms b_t*p_t*v_t^T, so that its transpose
+ *  is obtained by exchanging the roles of the stored paths p_t and of the vectors v_t.
+ */
+void CMA::LMMuWCommaLambdaCMAFltVecOp::multiplyFactorTranspose(Vector& outX,
+        const Vector& inZ,
+        const CMAValues& inCMAValues)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lN = inZ.size();
+	const double lA = std::sqrt(1.0 - getLearningRate(lN));
+	outX.resize(lN);
+	for(unsigned int k=0; k<lN; ++k) outX[k] = inZ[k];
+	for(unsigned int t=0; t<inCMAValues.mLMP.getRows(); ++t) {
+		double lPZ = 0.0;
+		for(unsigned int k=0; k<lN; ++k) lPZ += inCMAValues.mLMP(t,k) * inZ[k];
+		const double lFactor = inCMAValues.mLMb[t] * lPZ;
+		for(unsigned int k=0; k<lN; ++k) {
+			outX[k] = (lA * outX[k]) + (lFactor * inCMAValues.mLMV(t,k));
+		}
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Multiply a vector by the inverse of the factor A of the covariance matrix.
+ *  \param outX Result of the product A^-1*z.
+ *  \param inZ Vector z to multiply.
+ *  \param inCMAValues CMA values holding the stored paths defining the factor.
+ *  \param inNbPaths Number of stored paths to use, starting with the oldest one.
+ */
+void CMA::LMMuWCommaLambdaCMAFltVecOp::multiplyInverseFactor(Vector& outX,
+        const Vector& inZ,
+        const CMAValues& inCMAValues,
+        unsigned int inNbPaths)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(inNbPaths <= inCMAValues.mLMV.getRows());
+	const unsigned int lN = inZ.size();
+	const double lInvA = 1.0 / std::sqrt(1.0 - getLearningRate(lN));
+	outX.resize(lN);
+	for(unsigned int k=0; k<lN; ++k) outX[k] = inZ[k];
+	for(unsigned int t=0; t<inNbPaths; ++t) {
+		double lVX = 0.0;
+		for(unsigned int k=0; k<lN; ++k) lVX += inCMAValues.mLMV(t,k) * outX[k];
+		const double lFactor = inCMAValues.mLMd[t] * lVX;
+		for(unsigned int k=0; k<lN; ++k) {
+			outX[k] = (lInvA * outX[k]) - (lFactor * inCMAValues.mLMV(t,k));
+		}
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Multiply a vector by the transpose of the inverse of the factor A of the covariance matrix.
+ *  \param outX Result of the product A^-T*z.
+ *  \param inZ Vector z to multiply.
+ *  \param inCMAValues CMA values holding the stored paths defining the factor.
+ *
+ *  The inverse factor is a product of symmetric matrices, one per stored path, so that its
+ *  transpose applies the same matrices in reverse order, starting with the newest path.
+ */
+void CMA::LMMuWCommaLambdaCMAFltVecOp::multiplyInverseFactorTranspose(Vector& outX,
+        const Vector& inZ,
+        const CMAValues& inCMAValues)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lN = inZ.size();
+	const double lInvA = 1.0 / std::sqrt(1.0 - getLearningRate(lN));
+	outX.resize(lN);
+	for(unsigned int k=0; k<lN; ++k) outX[k] = inZ[k];
+	for(unsigned int t=inCMAValues.mLMV.getRows(); t>0; --t) {
+		double lVX = 0.0;
+		for(unsigned int k=0; k<lN; ++k) lVX += inCMAValues.mLMV(t-1,k) * outX[k];
+		const double lFactor = inCMAValues.mLMd[t-1] * lVX;
+		for(unsigned int k=0; k<lN; ++k) {
+			outX[k] = (lInvA * outX[k]) - (lFactor * inCMAValues.mLMV(t-1,k));
+		}
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Initialize CMA values for a new run, with no B and C matrices and no stored path.
+ *  \param ioCMAValues CMA values to initialize.
+ *  \param inN Dimensionality of the problem to solve.
+ *  \param ioContext Reference to the evolutionary context.
+ */
+void CMA::LMMuWCommaLambdaCMAFltVecOp::initCMAValues(CMAValues& ioCMAValues,
+        unsigned int inN,
+        Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	ioCMAValues.mB.resize(0,0);
+	ioCMAValues.mC.resize(0,0);
+	ioCMAValues.mEigenLag = 0;
+	ioCMAValues.mD.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mD[i] = 1.0;
+	ioCMAValues.mPC.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mPC[i] = 0.0;
+	ioCMAValues.mPS.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mPS[i] = 0.0;
+	ioCMAValues.mLMP.resize(0,inN);
+	ioCMAValues.mLMV.resize(0,inN);
+	ioCMAValues.mLMb.resize(0);
+	ioCMAValues.mLMd.resize(0);
+	ioCMAValues.mSigma = mSigma->getWrappedValue();
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Register the parameters of the operator.
+ *  \param ioSystem Reference to the evolutionary system.
+ */
+void CMA::LMMuWCommaLambdaCMAFltVecOp::registerParams(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	MuWCommaLambdaCMAFltVecOp::registerParams(ioSystem);
+	{
+		Register::Description lDescription(
+		    "LM-CMA-ES number of paths",
+		    "UInt",
+		    "0",
+		    "Maximum number of p_c cumulation paths stored to define the covariance matrix of the limited-memory CMA-ES. If 0, 4+floor(3*ln(n)) paths are used, n being the dimensionality."
+		);
+		mNbPaths = castHandleT<UInt>(
+		               ioSystem.getRegister().insertEntry("ga.cmaes.lm.paths", new UInt(0), lDescription));
+	}
+	{
+		Register::Description lDescription(
+		    "LM-CMA-ES path storage period",
+		    "UInt",
+		    "0",
+		    "Number of generations between two p_c cumulation paths stored by the limited-memory CMA-ES. If 0, the period is the dimensionality divided by the number of paths, so that stored paths span about n generations."
+		);
+		mPathPeriod = castHandleT<UInt>(
+		                  ioSystem.getRegister().insertEntry("ga.cmaes.lm.period", new UInt(0), lDescription));
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Store actual p_c cumulation path and recompute the factor of the covariance matrix.
+ *  \param ioCMAValues Reference to CMA values.
+ *  \param inMaxPaths Maximum number of stored paths, the oldest one being removed if needed.
+ */
+void CMA::LMMuWCommaLambdaCMAFltVecOp::storePath(CMAValues& ioCMAValues, unsigned int inMaxPaths) const
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lN = ioCMAValues.mPC.size();
+	const unsigned int lOldPaths = ioCMAValues.mLMP.getRows();
+	const unsigned int lFirst = (lOldPaths >= inMaxPaths) ? (lOldPaths - inMaxPaths + 1) : 0;
+	const unsigned int lNbPaths = lOldPaths - lFirst + 1;
+
+	// Append actual path, dropping the oldest ones.
+	Matrix lPaths(lNbPaths, lN);
+	for(unsigned int t=0; t<(lNbPaths-1); ++t) {
+		for(unsigned int k=0; k<lN; ++k) lPaths(t,k) = ioCMAValues.mLMP(lFirst+t,k);
+	}
+	for(unsigned int k=0; k<lN; ++k) lPaths(lNbPaths-1,k) = ioCMAValues.mPC[k];
+	ioCMAValues.mLMP = lPaths;
+
+	// Recompute the rank-one updates of the factor, each path being transformed by
+	// the inverse factor defined by the paths before it.
+	const double lC1 = getLearningRate(lN);
+	const double lA = std::sqrt(1.0 - lC1);
+	ioCMAValues.mLMV.resize(lNbPaths, lN);
+	ioCMAValues.mLMb.resize(lNbPaths);
+	ioCMAValues.mLMd.resize(lNbPaths);
+	Vector lPath(lN), lV;
+	for(unsigned int t=0; t<lNbPaths; ++t) {
+		for(unsigned int k=0; k<lN; ++k) lPath[k] = ioCMAValues.mLMP(t,k);
+		multiplyInverseFactor(lV, lPath, ioCMAValues, t);
+		double lNormV2 = 0.0;
+		for(unsigned int k=0; k<lN; ++k) {
+			ioCMAValues.mLMV(t,k) = lV[k];
+			lNormV2 += (lV[k] * lV[k]);
+		}
+		if(lNormV2 > 0.0) {
+			const double lSqrt = std::sqrt(1.0 + ((lC1 / (1.0-lC1)) * lNormV2));
+			ioCMAValues.mLMb[t] = (lA / lNormV2) * (lSqrt - 1.0);
+			ioCMAValues.mLMd[t] = (1.0 / (lA * lNormV2)) * (1.0 - (1.0 / lSqrt));
+		} else {
+			ioCMAValues.mLMb[t] = 0.0;
+			ioCMAValues.mLMd[t] = 0.0;
+		}
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Update stored paths, cumulation paths and other CMA values.
+ *  \param ioDeme Deme to use to update CMA values.
+ *  \param ioContext Evolutionary context.
+ *  \param inN Dimensionality of the problem.
+ *  \param inMuEff Effective mu.
+ *  \param inSelectionWeights Selection weights.
+ *  \param ioCMAValues Reference to CMA values.
+ */
+void CMA::LMMuWCommaLambdaCMAFltVecOp::updateValues(Deme& ioDeme,
+        Context& ioContext,
+        unsigned int inN,
+        double inMuEff,
+        const Vector& inSelectionWeights,
+        CMA::CMAValues& ioCMAValues) const
+{
+	Beagle_StackTraceBeginM();
+
+	// Log messages
+	Beagle_LogTraceM(
+	    ioContext.getSystem().getLogger(),
+	    "Updating stored paths, sigma, and cumulation paths of limited-memory CMA-ES."
+	);
+
+	// Compute some constants
+	const double lCC = 4.0 / (double(inN) + 4.0);
+	const double lCS = (inMuEff+2.0) / (double(inN)+inMuEff+3.0);
+	double lDamps = std::sqrt((inMuEff-1.0) / (double(inN)+1.0)) - 1.0;
+	lDamps = 1.0 + (2.0*maxOf(0.0,lDamps)) + lCS;
+	const double lChiN = std::sqrt(double(inN)) *
+	                     (1.0 - (0.25/double(inN)) + (1.0/(21.0*double(inN)*double(inN))));
+	unsigned int lMaxPaths = mNbPaths->getWrappedValue();
+	if(lMaxPaths == 0) lMaxPaths = 4 + (unsigned int)std::floor(3.0 * std::log(double(inN)));
+	unsigned int lPeriod = mPathPeriod->getWrappedValue();
+	if(lPeriod == 0) lPeriod = maxOf<unsigned int>(1, inN / lMaxPaths);
+
+	// Compute new xmean
+	Vector lXmean_new(inN, 0.0);
+	for(unsigned int i=0; i<ioDeme.size(); ++i) {
+		FltVec::FloatVector::Handle lVecI = castHandleT<FltVec::FloatVector>((*ioDeme[i])[0]);
+		for(unsigned int j=0; j<inN; ++j) lXmean_new[j] += (inSelectionWeights[i] * (*lVecI)[j]);
+	}
+	const double lSigma=ioCMAValues.mSigma.getWrappedValue();
+	Vector lXdiff(inN);
+	for(unsigned int i=0; i<inN; ++i) lXdiff[i] = (lXmean_new[i] - ioCMAValues.mXmean[i]) / lSigma;
+
+	// Update cumulation paths
+	Vector lZdiff;
+	multiplyInverseFactor(lZdiff, lXdiff, ioCMAValues, ioCMAValues.mLMP.getRows());
+	const double lPSFactor = std::sqrt(lCS * (2.0-lCS) * inMuEff);
+	double lPSnorm = 0.0;
+	for(unsigned int i=0; i<inN; ++i) {
+		ioCMAValues.mPS[i] = ((1.0-lCS) * ioCMAValues.mPS[i]) + (lPSFactor * lZdiff[i]);
+		lPSnorm += (ioCMAValues.mPS[i] * ioCMAValues.mPS[i]);
+	}
+	lPSnorm = std::sqrt(lPSnorm);
+	const double lHLeft =
+	    lPSnorm / std::sqrt(1.0-std::pow(1.0-lCS, 2.0*double(ioContext.getGeneration())));
+	const double lHRight = (1.5+(1.0/(double(inN)-0.5))) * lChiN;
+	const bool lHSig = (lHLeft<lHRight);
+
+	const double lPCFactor = lHSig ? std::sqrt(lCC * (2.0-lCC) * inMuEff) : 0.0;
+	for(unsigned int i=0; i<inN; ++i) {
+		ioCMAValues.mPC[i] = ((1.0-lCC) * ioCMAValues.mPC[i]) + (lPCFactor * lXdiff[i]);
+	}
+	if(lHSig == false) {
+		Beagle_LogTraceM(
+		    ioContext.getSystem().getLogger(),
+		    "CMA-ES p_c cumulation path update stalled"
+		);
+	}
+
+	// Store p_c as a new rank-one update of the factor of C
+	if((ioContext.getGeneration() % lPeriod) == 0) {
+		storePath(ioCMAValues, lMaxPaths);
+		Beagle_LogTraceM(
+		    ioContext.getSystem().getLogger(),
+		    std::string("LM-CMA-ES stored p_c cumulation path, ")+
+		    uint2str(ioCMAValues.mLMP.getRows())+" paths now define the covariance matrix"
+		);
+	}
+
+	// Adapt step size sigma
+	ioCMAValues.mSigma.getWrappedValue() *= std::exp((lCS/lDamps) * ((lPSnorm/lChiN)-1.0));
+
+	// Log updated parameters.
+	Beagle_LogTraceM(
+	    ioContext.getSystem().getLogger(),
+	    std::string("CMA-ES updated sigma: ")+ioCMAValues.mSigma.serialize()
+	);
+	Beagle_LogVerboseM(
+	    ioContext.getSystem().getLogger(),
+	    std::string("CMA-ES updated p_c vector (covariance cumulation path): ")+ioCMAValues.mPC.serialize()
+	);
+	Beagle_LogVerboseM(
+	    ioContext.getSystem().getLogger(),
+	    std::string("CMA-ES updated p_s vector (sigma cumulation path): ")+ioCMAValues.mPS.serialize()
+	);
+	Beagle_StackTraceEndM();
+}
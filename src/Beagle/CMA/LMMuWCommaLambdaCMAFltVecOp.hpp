@@ -0,0 +1,127 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/CMA/LMMuWCommaLambdaCMAFltVecOp.hpp
+ *  \brief  Definition of the class CMA::LMMuWCommaLambdaCMAFltVecOp.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_CMA_LMMuWCommaLambdaCMAFltVecOp_hpp
+#define Beagle_CMA_LMMuWCommaLambdaCMAFltVecOp_hpp
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+#include "Beagle/Core/Object.hpp"
+#include "Beagle/Core/Pointer.hpp"
+#include "Beagle/Core/PointerT.hpp"
+#include "Beagle/Core/Allocator.hpp"
+#include "Beagle/Core/AllocatorT.hpp"
+#include "Beagle/Core/Container.hpp"
+#include "Beagle/Core/ContainerT.hpp"
+#include "Beagle/Core/UInt.hpp"
+#include "Beagle/CMA/MuWCommaLambdaCMAFltVecOp.hpp"
+
+namespace Beagle
+{
+namespace CMA
+{
+
+/*!
+ *  \class LMMuWCommaLambdaCMAFltVecOp Beagle/CMA/LMMuWCommaLambdaCMAFltVecOp.hpp "Beagle/CMA/LMMuWCommaLambdaCMAFltVecOp.hpp"
+ *  \brief Limited-memory CMA-ES (Mu_W,Lambda) replacement strategy operator class.
+ *  \ingroup GAF
+ *  \ingroup GAFV
+ *
+ *  Limited-memory CMA-ES (LM-CMA-ES), where the covariance matrix C = A*A^T is never stored.
+ *  The factor A is defined implicitly by m stored p_c cumulation paths, each one being a
+ *  rank-one Cholesky update of the factor (Igel et al., 2006), so that products by A and
+ *  its inverse are computed in O(m*n). A new path is stored every given number of generations,
+ *  replacing the oldest one when m paths are already held. Step size is adapted with the
+ *  cumulation path p_s computed through the inverse factor. Matrices B and C of the CMA values
+ *  are left empty, D is kept to one. Use in conjunction with the CMA-ES mutation operator
+ *  defined in class CMA::MutationCMAFltVecOp.
+ *
+ *  Reference: Loshchilov, I. (2014). A Computationally Efficient Limited Memory CMA-ES for
+ *  Large Scale Optimization. Genetic and Evolutionary Computation Conference (GECCO 2014),
+ *  pp. 397-404.
+ */
+class LMMuWCommaLambdaCMAFltVecOp : public MuWCommaLambdaCMAFltVecOp
+{
+
+public:
+
+	//! LMMuWCommaLambdaCMAFltVecOp allocator type.
+	typedef AllocatorT<LMMuWCommaLambdaCMAFltVecOp,MuWCommaLambdaCMAFltVecOp::Alloc>
+	Alloc;
+	//! LMMuWCommaLambdaCMAFltVecOp handle type.
+	typedef PointerT<LMMuWCommaLambdaCMAFltVecOp,MuWCommaLambdaCMAFltVecOp::Handle>
+	Handle;
+	//! LMMuWCommaLambdaCMAFltVecOp bag type.
+	typedef ContainerT<LMMuWCommaLambdaCMAFltVecOp,MuWCommaLambdaCMAFltVecOp::Bag>
+	Bag;
+
+	explicit LMMuWCommaLambdaCMAFltVecOp(std::string inLMRatioName="ga.cmaes.mulambdaratio",
+	                                     std::string inName="CMA-LMMuWCommaLambdaCMAFltVecOp");
+	virtual ~LMMuWCommaLambdaCMAFltVecOp()
+	{ }
+
+	virtual void registerParams(System& ioSystem);
+
+	static double getLearningRate(unsigned int inN);
+	static void   multiplyFactor(Vector& outX, const Vector& inZ, const CMAValues& inCMAValues);
+	static void   multiplyFactorTranspose(Vector& outX, const Vector& inZ, const CMAValues& inCMAValues);
+	static void   multiplyInverseFactor(Vector& outX,
+	                                    const Vector& inZ,
+	                                    const CMAValues& inCMAValues,
+	                                    unsigned int inNbPaths);
+	static void   multiplyInverseFactorTranspose(Vector& outX,
+	                                             const Vector& inZ,
+	                                             const CMAValues& inCMAValues);
+
+protected:
+
+	virtual void initCMAValues(CMAValues& ioCMAValues,
+	                           unsigned int inN,
+	                           Context& ioContext) const;
+	virtual void updateValues(Deme& ioDeme,
+	                          Context& ioContext,
+	                          unsigned int inN,
+	                          double inMuEff,
+	                          const Vector& inSelectionWeights,
+	                          CMAValues& ioCMAValues) const;
+	void         storePath(CMAValues& ioCMAValues, unsigned int inMaxPaths) const;
+
+	UInt::Handle mNbPaths;     //!< Maximum number of stored cumulation paths.
+	UInt::Handle mPathPeriod;  //!< Number of generations between two stored cumulation paths.
+
+};
+
+}
+}
+
+#endif // Beagle_CMA_LMMuWCommaLambdaCMAFltVecOp_hpp
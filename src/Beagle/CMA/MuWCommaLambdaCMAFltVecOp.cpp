@@ -143,7 +143,10 @@ void CMA::MuWCommaLambdaCMAFltVecOp::generateChildren(Deme& ioDeme,
 		ioDeme.insert(ioDeme.end(), lBestInd.begin(), lBestInd.end());
 	} else ioDeme.clear();
 
-	// Generate the children
+	// Generate the children, the CMA mutation sampling all their steps in a single batch
+	ioCMAValues.mSamples.resize(0,0);
+	ioCMAValues.mSampleIndex = 0;
+	ioCMAValues.mSampleBatch = inNbChildren;
 	Individual::Bag lBagWithMeanInd;
 	lBagWithMeanInd.push_back(lMeanInd);
 	for(unsigned int i=0; i<inNbChildren; ++i) {
@@ -212,20 +215,38 @@ CMA::CMAValues& CMA::MuWCommaLambdaCMAFltVecOp::getCMAValues(unsigned int inInde
 	CMA::CMAHolder::iterator lIterVal = lCMAHolder->find(ioContext.getDemeIndex());
 	if((ioContext.getGeneration()<=1) || (lIterVal==lCMAHolder->end())) {
 		CMA::CMAValues& lValues = (*lCMAHolder)[inIndex];
-		lValues.mB.setIdentity(inN);
-		lValues.mD.resize(inN);
-		for(unsigned int i=0; i<inN; ++i) lValues.mD[i] = 1.0;
-		lValues.mPC.resize(inN);
-		for(unsigned int i=0; i<inN; ++i) lValues.mPC[i] = 0.0;
-		lValues.mPS.resize(inN);
-		for(unsigned int i=0; i<inN; ++i) lValues.mPS[i] = 0.0;
-		lValues.mSigma = mSigma->getWrappedValue();
+		initCMAValues(lValues, inN, ioContext);
 		return lValues;
 	}
 	return lIterVal->second;
 	Beagle_StackTraceEndM();
 }
 
+
+/*!
+ *  \brief Initialize CMA values for a new run.
+ *  \param ioCMAValues CMA values to initialize.
+ *  \param inN Dimensionality of the problem to solve.
+ *  \param ioContext Reference to the evolutionary context.
+ */
+void CMA::MuWCommaLambdaCMAFltVecOp::initCMAValues(CMAValues& ioCMAValues,
+        unsigned int inN,
+        Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	ioCMAValues.mB.setIdentity(inN);
+	ioCMAValues.mD.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mD[i] = 1.0;
+	ioCMAValues.mC.setIdentity(inN);
+	ioCMAValues.mEigenLag = 0;
+	ioCMAValues.mPC.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mPC[i] = 0.0;
+	ioCMAValues.mPS.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mPS[i] = 0.0;
+	ioCMAValues.mSigma = mSigma->getWrappedValue();
+	Beagle_StackTraceEndM();
+}
+
 /*!
  *  \brief Register the parameters of the operator.
  *  \param ioSystem Reference to the evolutionary system.
@@ -282,6 +303,16 @@ void CMA::MuWCommaLambdaCMAFltVecOp::registerParams(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return False, the CMA values are held in a system component.
+ */
+bool CMA::MuWCommaLambdaCMAFltVecOp::isDemeLocal(void) const
+{
+	return false;
+}
+
+
 /*!
  *  \brief Apply the CMA-ES (Mu_W+Lambda) replacement strategy operation on a deme.
  *  \param ioDeme Reference to the deme on which the operation takes place.
@@ -413,10 +444,6 @@ void CMA::MuWCommaLambdaCMAFltVecOp::updateValues(Deme& ioDeme,
 	for(unsigned int i=0; i<inN; ++i) lZmean[i] /= ioCMAValues.mD[i];
 
 	// Update cumulation paths
-	Matrix lBD(inN,inN,0.0);
-	for(unsigned int i=0; i<inN; ++i) {
-		for(unsigned int j=0; j<inN; ++j) lBD(j,i) = ioCMAValues.mB(j,i) * ioCMAValues.mD[i];
-	}
 	Vector lBZm;
 	ioCMAValues.mB.multiply((Matrix&)lBZm, lZmean);
 	lBZm            *= std::sqrt(lCS * (2.0-lCS) * inMuEff);
@@ -433,10 +460,6 @@ void CMA::MuWCommaLambdaCMAFltVecOp::updateValues(Deme& ioDeme,
 
 	ioCMAValues.mPC *= (1.0-lCC);
 	if(lHSig) {
-		// Vector lBDZm;
-		// lBD.multiply((Matrix&)lBDZm, lZmean);
-		// lBDZm *= std::sqrt(lCC * (2.0-lCC) * inMuEff);
-		// ioCMAValues.mPC += lBDZm;
 		Vector lXdiff = lXmean_new - ioCMAValues.mXmean;
 		lXdiff *= (std::sqrt(lCC * (2.0-lCC) * inMuEff) / lSigma);
 		ioCMAValues.mPC += lXdiff;
@@ -447,48 +470,63 @@ void CMA::MuWCommaLambdaCMAFltVecOp::updateValues(Deme& ioDeme,
 		);
 	}
 
-	// Adapt covariance matrix C
-	Matrix lC, lBDt;
-	lBD.transpose(lBDt);
-	lBD.multiply(lC, lBDt);
+	// Adapt covariance matrix C, rebuilding it from B and D if it is not known.
+	Matrix& lC = ioCMAValues.mC;
+	if((lC.getRows()!=inN) || (lC.getCols()!=inN)) {
+		lC.resize(inN,inN);
+		for(unsigned int i=0; i<inN; ++i) {
+			for(unsigned int j=0; j<=i; ++j) {
+				double lCij = 0.0;
+				for(unsigned int k=0; k<inN; ++k) {
+					lCij += ioCMAValues.mB(i,k) * ioCMAValues.mB(j,k) * ioCMAValues.mD[k] * ioCMAValues.mD[k];
+				}
+				lC(i,j) = lC(j,i) = lCij;
+			}
+		}
+	}
 
 	double lAttnC = (1.0-lCCov);    // Attenuation factor
 	if(lHSig == false) lAttnC += (lCCov * lCC * (2.0-lCC) / lMuCov);
 
-	Matrix lR1Upd;                  // Rank one update
-	ioCMAValues.mPC.transpose(lR1Upd);
-	lR1Upd = ioCMAValues.mPC * lR1Upd;
-	lR1Upd *= (lCCov / lMuCov);
+	// Attenuate old matrix and add rank one update
+	const double lR1Factor = (lCCov / lMuCov);
+	for(unsigned int i=0; i<inN; ++i) {
+		const double lPCi = lR1Factor * ioCMAValues.mPC[i];
+		for(unsigned int j=i; j<inN; ++j) {
+			lC(i,j) = lC(j,i) = (lAttnC * lC(i,j)) + (lPCi * ioCMAValues.mPC[j]);
+		}
+	}
 
-	Matrix lRMuUpd(inN,inN,0.0);    // Rank Mu update
+	// Add rank mu update, as a single weighted product of the selected steps
+	Matrix lY(ioDeme.size(), inN);
 	for(unsigned int i=0; i<ioDeme.size(); ++i) {
 		FltVec::FloatVector::Handle lVecI = castHandleT<FltVec::FloatVector>((*ioDeme[i])[0]);
-		Vector lX_I(lVecI->size());
-		for(unsigned int j=0; j<lVecI->size(); ++j) lX_I[j] = (*lVecI)[j];
-		lX_I -= ioCMAValues.mXmean;
-		Matrix lX_It;
-		lX_I.transpose(lX_It);
-		lX_It *= inSelectionWeights[i];
-		lRMuUpd += (lX_I * lX_It);
+		for(unsigned int j=0; j<inN; ++j) lY(i,j) = ((*lVecI)[j] - ioCMAValues.mXmean[j]) / lSigma;
 	}
-	lRMuUpd *= (lCCov * (1.0 - (1.0/lMuCov)) / (lSigma * lSigma));
-
-	lC *= lAttnC;                   // Attenuate old matrix
-	lC += lR1Upd;                   // Add rank one update
-	lC += lRMuUpd;                  // Add rank mu update
+	lC.updateRankK(lY, inSelectionWeights, lCCov * (1.0 - (1.0/lMuCov)));
 
 	// Adapt step size sigma
 	ioCMAValues.mSigma.getWrappedValue() *= std::exp((lCS/lDamps) * ((lPSnorm/lChiN)-1.0));
 
-	// Update B and D from C
-	for(unsigned int i=1; i<inN; ++i) {
-		for(unsigned int j=0; j<i; ++j) lC(i,j) = lC(j,i);  // Enforce symetry
-	}
-	lC.computeEigens(ioCMAValues.mD, ioCMAValues.mB);     // Principal component analysis
-
-	// Adjust D as standard deviation
-	for(unsigned int i=0; i<inN; ++i) {
-		ioCMAValues.mD[i] = std::sqrt(ioCMAValues.mD[i]);
+	// Update B and D from C, the O(n^3) eigen decomposition is done lazily to
+	// amortize its cost over 1/(c_cov*n*10) generations, as in the reference CMA-ES.
+	++ioCMAValues.mEigenLag.getWrappedValue();
+	const double lEigenPeriod = 1.0 / (lCCov * double(inN) * 10.0);
+	if((double(ioCMAValues.mEigenLag.getWrappedValue()) > lEigenPeriod) ||
+	        (ioCMAValues.mB.getRows() != inN) || (ioCMAValues.mD.size() != inN)) {
+		lC.computeSymmetricEigens(ioCMAValues.mD, ioCMAValues.mB);     // Principal component analysis
+		ioCMAValues.mEigenLag = 0;
+
+		// Adjust D as standard deviation
+		for(unsigned int i=0; i<inN; ++i) {
+			ioCMAValues.mD[i] = std::sqrt(ioCMAValues.mD[i]);
+		}
+	} else {
+		Beagle_LogTraceM(
+		    ioContext.getSystem().getLogger(),
+		    std::string("CMA-ES eigen decomposition of C postponed, C updated ")+
+		    uint2str(ioCMAValues.mEigenLag.getWrappedValue())+" times since the last one"
+		);
 	}
 
 	// Log updated parameters.
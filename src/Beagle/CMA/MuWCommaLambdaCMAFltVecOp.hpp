@@ -93,6 +93,7 @@ public:
 	{ }
 
 	virtual void registerParams(System& ioSystem);
+	virtual bool isDemeLocal(void) const;
 	virtual void operate(Deme& ioDeme, Context& ioContext);
 
 protected:
@@ -108,6 +109,9 @@ protected:
 	virtual CMAValues& getCMAValues(unsigned int inIndex,
 	                                    unsigned int inN,
 	                                    Context& ioContext) const;
+	virtual void           initCMAValues(CMAValues& ioCMAValues,
+	                                     unsigned int inN,
+	                                     Context& ioContext) const;
 	virtual void           updateValues(Deme& ioDeme,
 	                                    Context& ioContext,
 	                                    unsigned int inN,
@@ -98,6 +98,46 @@ void CMA::MutationCMAFltVecOp::registerParams(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return False, the CMA values are held in a system component.
+ */
+bool CMA::MutationCMAFltVecOp::isDemeLocal(void) const
+{
+	return false;
+}
+
+
+/*!
+ *  \brief Get CMA values of the actual deme.
+ *  \param ioContext Context of the evolution.
+ *  \return Reference to the CMA values.
+ *  \throw Beagle::RunTimeException If the CMA holder or the CMA values are not found.
+ */
+CMA::CMAValues& CMA::MutationCMAFltVecOp::getCMAValues(Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	if(mCMAHolder == NULL) {
+		Component::Handle lHolderComponent = ioContext.getSystem().getComponent("CMAHolder");
+		if(lHolderComponent==NULL)
+			throw Beagle_RunTimeExceptionM("No CMA holder component found in the system!");
+		mCMAHolder = castHandleT<CMA::CMAHolder>(lHolderComponent);
+		if(mCMAHolder==NULL)
+			throw Beagle_RunTimeExceptionM("Component named 'CMAHolder' found is not of the good type!");
+	}
+	CMA::CMAHolder::iterator lIterVal = mCMAHolder->find(ioContext.getDemeIndex());
+	if(lIterVal == mCMAHolder->end()) {
+		std::ostringstream lOSS;
+		lOSS << "CMA values of index '" << ioContext.getDemeIndex() << "' not found in CMA holder ";
+		lOSS << "component. Consider having a breeding pipeline with an appropriate CMA replacement ";
+		lOSS << "strategy that would correctly initialize the CMA values at the given index.";
+		throw Beagle_RunTimeExceptionM(lOSS.str());
+	}
+	return lIterVal->second;
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Apply CMA-ES mutation on a real-valued GA individual.
  *  \param ioIndividual Real-valued GA individual to mutate.
@@ -115,45 +155,22 @@ bool CMA::MutationCMAFltVecOp::mutate(Individual& ioIndividual, Context& ioConte
 	if(ioIndividual.size()!=1) throw Beagle_RunTimeExceptionM(
 		    "CMA-ES mutation can't be applied on individuals composed by more than one float vector");
 
-	// Get the appropriate CMA values from the CMA holder component.
-	Component::Handle lHolderComponent = ioContext.getSystem().getComponent("CMAHolder");
-	if(lHolderComponent==NULL)
-		throw Beagle_RunTimeExceptionM("No CMA holder component found in the system!");
-	CMA::CMAHolder::Handle lCMAHolder = castHandleT<CMA::CMAHolder>(lHolderComponent);
-	if(lCMAHolder==NULL)
-		throw Beagle_RunTimeExceptionM("Component named 'CMAHolder' found is not of the good type!");
-	CMA::CMAHolder::iterator lIterVal = lCMAHolder->find(ioContext.getDemeIndex());
-	if(lIterVal == lCMAHolder->end()) {
-		std::ostringstream lOSS;
-		lOSS << "CMA values of index '" << ioContext.getDemeIndex() << "' not found in CMA holder ";
-		lOSS << "component. Consider having a breeding pipeline with an appropriate CMA replacement ";
-		lOSS << "strategy that would correctly initialize the CMA values at the given index.";
-		throw Beagle_RunTimeExceptionM(lOSS.str());
-	}
-	CMA::CMAValues& lValues = lIterVal->second;
-
+	// Get the mutation step from the batch of the generation, sampling a new one if needed.
+	CMA::CMAValues& lValues = getCMAValues(ioContext);
 	FltVec::FloatVector::Handle lVector=castHandleT<FltVec::FloatVector>(ioIndividual[0]);
 	Beagle_AssertM(lVector->size()==lValues.mD.size());
-	const double lSigma=lValues.mSigma.getWrappedValue();
-	Vector lArz(lVector->size());
-	for(unsigned int i=0; i<lArz.size(); ++i) {
-		double lStdErr = lSigma * lValues.mD[i];
-		if(isNaN(lStdErr) || (lStdErr<0.)) {
-			lArz[i] = 0.0;
-			std::ostringstream lOSS;
-			lOSS << "WARNING: standard deviation for CMA-ES mutation over the " << uint2ordinal(i+1);
-			lOSS << " principal component is NaN or negative (" << lStdErr << "). ";
-			lOSS << "Mutation of this component has been cancelled.";
-			Beagle_LogBasicM(ioContext.getSystem().getLogger(), lOSS.str());
-		} else lArz[i] = ioContext.getSystem().getRandomizer().rollGaussian(0.0, lStdErr);
+	if(lValues.mSampleIndex >= lValues.mSamples.getRows()) {
+		unsigned int lNbSamples = lValues.mSampleBatch;
+		if(lNbSamples == 0) lNbSamples = maxOf<unsigned int>(1, ioContext.getDeme().size());
+		sampleBatch(lValues, lNbSamples, ioContext);
 	}
-	Vector lMutFactor;
-	lValues.mB.multiply((Matrix&)lMutFactor, lArz);
-	Beagle_AssertM(lMutFactor.size()==lVector->size());
+	const unsigned int lRow = lValues.mSampleIndex++;
+	Beagle_AssertM(lValues.mSamples.getCols()==lVector->size());
+
 	for(unsigned int i=0; i<lVector->size(); ++i) {
 		const double lMaxVal = i<mMaxValue->size() ? (*mMaxValue)[i] : mMaxValue->back();
 		const double lMinVal = i<mMinValue->size() ? (*mMinValue)[i] : mMinValue->back();
-		(*lVector)[i] += lMutFactor[i];
+		(*lVector)[i] += lValues.mSamples(lRow,i);
 		if((*lVector)[i] > lMaxVal) (*lVector)[i] = lMaxVal;
 		if((*lVector)[i] < lMinVal) (*lVector)[i] = lMinVal;
 	}
@@ -165,4 +182,66 @@ bool CMA::MutationCMAFltVecOp::mutate(Individual& ioIndividual, Context& ioConte
 }
 
 
+/*!
+ *  \brief Sample a batch of CMA-ES mutation steps.
+ *  \param ioValues CMA values to sample steps from, and in which the batch is stored.
+ *  \param inNbSamples Number of mutation steps to sample.
+ *  \param ioContext Context of the evolution.
+ *
+ *  The steps are computed as the rows of Z*(sigma*B*D)^T, where Z is a matrix of standard
+ *  Gaussian deviates with one row per step. This is a single matrix-matrix product instead
+ *  of a matrix-vector product per mutated individual.
+ */
+void CMA::MutationCMAFltVecOp::sampleBatch(CMAValues& ioValues,
+        unsigned int inNbSamples,
+        Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lN = ioValues.mD.size();
+	const double lSigma = ioValues.mSigma.getWrappedValue();
+	Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+
+	// Separable and limited-memory CMA-ES, the steps are sigma*D*A*z in O(n) memory,
+	// where A is identity or the limited-memory factor of C.
+	if(ioValues.mB.getRows() != lN) {
+		ioValues.mSamples.resize(inNbSamples, lN);
+		Vector lZ(lN), lAZ(lN);
+		for(unsigned int i=0; i<inNbSamples; ++i) {
+			for(unsigned int j=0; j<lN; ++j) lZ[j] = lRandomizer.rollGaussian(0.0, 1.0);
+			if(ioValues.mLMP.getRows() > 0) LMMuWCommaLambdaCMAFltVecOp::multiplyFactor(lAZ, lZ, ioValues);
+			else lAZ = lZ;
+			for(unsigned int j=0; j<lN; ++j) ioValues.mSamples(i,j) = lSigma * ioValues.mD[j] * lAZ[j];
+		}
+		ioValues.mSampleIndex = 0;
+		return;
+	}
+
+	// Scale the principal components by their standard deviation.
+	Matrix lBD(lN, lN);
+	for(unsigned int j=0; j<lN; ++j) {
+		double lStdErr = lSigma * ioValues.mD[j];
+		if(isNaN(lStdErr) || (lStdErr<0.)) {
+			lStdErr = 0.0;
+			std::ostringstream lOSS;
+			lOSS << "WARNING: standard deviation for CMA-ES mutation over the " << uint2ordinal(j+1);
+			lOSS << " principal component is NaN or negative (" << (lSigma * ioValues.mD[j]) << "). ";
+			lOSS << "Mutation of this component has been cancelled.";
+			Beagle_LogBasicM(ioContext.getSystem().getLogger(), lOSS.str());
+		}
+		for(unsigned int i=0; i<lN; ++i) lBD(i,j) = ioValues.mB(i,j) * lStdErr;
+	}
+
+	// Draw standard Gaussian deviates and compute the mutation steps.
+	Matrix lZ(inNbSamples, lN);
+	for(unsigned int i=0; i<inNbSamples; ++i) {
+		for(unsigned int j=0; j<lN; ++j) lZ(i,j) = lRandomizer.rollGaussian(0.0, 1.0);
+	}
+	lZ.multiplyTransposed(ioValues.mSamples, lBD);
+	ioValues.mSampleIndex = 0;
 
+	Beagle_LogTraceM(
+	    ioContext.getSystem().getLogger(),
+	    std::string("Sampled a batch of ")+uint2str(inNbSamples)+" CMA-ES mutation steps"
+	);
+	Beagle_StackTraceEndM();
+}
@@ -42,6 +42,7 @@
 #include "Beagle/macros.hpp"
 #include "Beagle/Core/Object.hpp"
 #include "Beagle/EC/MutationOp.hpp"
+#include "Beagle/CMA/CMAHolder.hpp"
 
 
 namespace Beagle
@@ -60,6 +61,11 @@ namespace CMA
  *  GA::MuWCommaLambdaCMAFltVecOp replacement strategy. The parameters of the mutation
  *  are adaptively modified by this replacement strategy following the CMA-ES algorithm.
  *
+ *  The mutation steps are sampled by batch: at the first mutation of a generation, the steps
+ *  of all the lambda children of the deme are computed at once as the product of a matrix
+ *  of standard Gaussian deviates with sigma*B*D. Following mutations consume the rows of that
+ *  batch, so the CMA-ES state is read only once per generation.
+ *
  *  Reference: Hansen, N. and Ostermeier, A. (2001). Completely Derandomized Self-Adaptation
  *  in Evolution Strategies. Evolutionary Computation, 9(2), pp. 159-195.
  *  See also: http://www.bionik.tu-berlin.de/user/niko/cmaes_inmatlab.html
@@ -85,12 +91,17 @@ public:
 	{ }
 
 	virtual void registerParams(System& ioSystem);
+	virtual bool isDemeLocal(void) const;
 	virtual bool mutate(Beagle::Individual& ioIndividual, Context& ioContext);
 
 protected:
 
+	CMAValues& getCMAValues(Context& ioContext);
+	void sampleBatch(CMAValues& ioValues, unsigned int inNbSamples, Context& ioContext) const;
+
 	DoubleArray::Handle mMaxValue;    //!< Max value of GA float vectors.
 	DoubleArray::Handle mMinValue;    //!< Min value of GA float vectors.
+	CMAHolder::Handle   mCMAHolder;   //!< CMA holder component.
 
 };
 
@@ -126,6 +126,8 @@ bool CMA::MutationQRCMAFltVecOp::mutate(Individual& ioIndividual, Context& ioCon
 
 	FltVec::FloatVector::Handle lVector=castHandleT<FltVec::FloatVector>(ioIndividual[0]);
 	Beagle_AssertM(lVector->size()==lValues.mD.size());
+	if(lValues.mB.getRows()!=lVector->size()) throw Beagle_RunTimeExceptionM(
+		    "Derandomized CMA-ES mutation can only be used with the full covariance CMA-ES replacement strategy");
 	const double lSigma=lValues.mSigma.getWrappedValue();
 	Vector lArz(lVector->size());
 	QuasiRandom::Handle lQRComponent =
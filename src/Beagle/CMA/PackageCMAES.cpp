@@ -60,20 +60,24 @@ void CMA::PackageCMAES::configure(System& ioSystem)
 	lFactory.insertAllocator("Beagle::CMA::AlgoCMAES", new CMA::AlgoCMAES::Alloc);
 	lFactory.insertAllocator("Beagle::CMA::CMAHolder", new CMA::CMAHolder::Alloc);
 	lFactory.insertAllocator("Beagle::CMA::InitCMAFltVecOp", new CMA::InitCMAFltVecOp::Alloc);
+	lFactory.insertAllocator("Beagle::CMA::LMMuWCommaLambdaCMAFltVecOp", new CMA::LMMuWCommaLambdaCMAFltVecOp::Alloc);
 	lFactory.insertAllocator("Beagle::CMA::MutationCMAFltVecOp", new CMA::MutationCMAFltVecOp::Alloc);
 	lFactory.insertAllocator("Beagle::CMA::MutationQRCMAFltVecOp", new CMA::MutationQRCMAFltVecOp::Alloc);
 	lFactory.insertAllocator("Beagle::CMA::MuWCommaLambdaCMAFltVecOp", new CMA::MuWCommaLambdaCMAFltVecOp::Alloc);
 	lFactory.insertAllocator("Beagle::CMA::PackageCMAES", new CMA::PackageCMAES::Alloc);
+	lFactory.insertAllocator("Beagle::CMA::SepMuWCommaLambdaCMAFltVecOp", new CMA::SepMuWCommaLambdaCMAFltVecOp::Alloc);
 	lFactory.insertAllocator("Beagle::CMA::TermCMAOp", new CMA::TermCMAOp::Alloc);
 
 	// Aliases to short name of operators
 	lFactory.aliasAllocator("Beagle::CMA::AlgoCMAES", "GA-AlgoCMAES");
 	lFactory.aliasAllocator("Beagle::CMA::CMAHolder", "GA-CMAHolder");
 	lFactory.aliasAllocator("Beagle::CMA::InitCMAFltVecOp", "GA-InitCMAFltVecOp");
+	lFactory.aliasAllocator("Beagle::CMA::LMMuWCommaLambdaCMAFltVecOp", "GA-LMMuWCommaLambdaCMAFltVecOp");
 	lFactory.aliasAllocator("Beagle::CMA::MutationCMAFltVecOp", "GA-MutationCMAFltVecOp");
 	lFactory.aliasAllocator("Beagle::CMA::MutationQRCMAFltVecOp", "GA-MutationQRCMAFltVecOp");
 	lFactory.aliasAllocator("Beagle::CMA::MuWCommaLambdaCMAFltVecOp", "GA-MuWCommaLambdaCMAFltVecOp");
 	lFactory.aliasAllocator("Beagle::CMA::PackageCMAES", "GA-PackageCMAES");
+	lFactory.aliasAllocator("Beagle::CMA::SepMuWCommaLambdaCMAFltVecOp", "GA-SepMuWCommaLambdaCMAFltVecOp");
 	lFactory.aliasAllocator("Beagle::CMA::TermCMAOp", "GA-TermCMAOp");
 
 	// Set some basic concept-type associations in factory
@@ -0,0 +1,191 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/CMA/SepMuWCommaLambdaCMAFltVecOp.cpp
+ *  \brief  Source code of class CMA::SepMuWCommaLambdaCMAFltVecOp.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/CMA.hpp"
+
+#include <cmath>
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Build separable CMA-ES (Mu_W,Lambda) replacement strategy operator.
+ *  \param inLMRatioName Lamda over Mu parameter name used in the register.
+ *  \param inName Name of the separable CMA-ES (Mu_W,Lambda) operator.
+ */
+CMA::SepMuWCommaLambdaCMAFltVecOp::SepMuWCommaLambdaCMAFltVecOp(std::string inLMRatioName,
+        std::string inName) :
+		MuWCommaLambdaCMAFltVecOp(inLMRatioName,inName)
+{ }
+
+
+/*!
+ *  \brief Initialize CMA values for a new run, with no B and C matrices.
+ *  \param ioCMAValues CMA values to initialize.
+ *  \param inN Dimensionality of the problem to solve.
+ *  \param ioContext Reference to the evolutionary context.
+ */
+void CMA::SepMuWCommaLambdaCMAFltVecOp::initCMAValues(CMAValues& ioCMAValues,
+        unsigned int inN,
+        Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	ioCMAValues.mB.resize(0,0);
+	ioCMAValues.mC.resize(0,0);
+	ioCMAValues.mEigenLag = 0;
+	ioCMAValues.mD.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mD[i] = 1.0;
+	ioCMAValues.mPC.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mPC[i] = 0.0;
+	ioCMAValues.mPS.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mPS[i] = 0.0;
+	ioCMAValues.mSigma = mSigma->getWrappedValue();
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Update diagonal covariance, cumulation paths and other CMA values.
+ *  \param ioDeme Deme to use to update CMA values.
+ *  \param ioContext Evolutionary context.
+ *  \param inN Dimensionality of the problem.
+ *  \param inMuEff Effective mu.
+ *  \param inSelectionWeights Selection weights.
+ *  \param ioCMAValues Reference to CMA values.
+ *
+ *  Same update as CMA::MuWCommaLambdaCMAFltVecOp restricted to the diagonal of C, which is
+ *  held as the standard deviations D, in O(n) time and memory.
+ */
+void CMA::SepMuWCommaLambdaCMAFltVecOp::updateValues(Deme& ioDeme,
+        Context& ioContext,
+        unsigned int inN,
+        double inMuEff,
+        const Vector& inSelectionWeights,
+        CMA::CMAValues& ioCMAValues) const
+{
+	Beagle_StackTraceBeginM();
+
+	// Log messages
+	Beagle_LogTraceM(
+	    ioContext.getSystem().getLogger(),
+	    "Updating diagonal covariance, sigma, and cumulation paths of separable CMA-ES."
+	);
+
+	// Compute some constants
+	const double lCC = 4.0 / (double(inN) + 4.0);
+	const double lCS = (inMuEff+2.0) / (double(inN)+inMuEff+3.0);
+	const double lMuCov = inMuEff;
+	double lCCov = ((2.0*inMuEff)-1.0) / (((double(inN)+2.0)*(double(inN)+2.0)) + inMuEff);
+	lCCov = ((1.0/lMuCov) * (2.0/((double(inN)+1.414)*(double(inN)+1.414)))) +
+	        ((1.0-(1.0/lMuCov)) * minOf(1.0,lCCov));
+	lCCov = minOf(1.0, lCCov * (double(inN)+2.0) / 3.0);
+	double lDamps = std::sqrt((inMuEff-1.0) / (double(inN)+1.0)) - 1.0;
+	lDamps = 1.0 + (2.0*maxOf(0.0,lDamps)) + lCS;
+	const double lChiN = std::sqrt(double(inN)) *
+	                     (1.0 - (0.25/double(inN)) + (1.0/(21.0*double(inN)*double(inN))));
+
+	// Compute new xmean
+	Vector lXmean_new(inN, 0.0);
+	for(unsigned int i=0; i<ioDeme.size(); ++i) {
+		FltVec::FloatVector::Handle lVecI = castHandleT<FltVec::FloatVector>((*ioDeme[i])[0]);
+		for(unsigned int j=0; j<inN; ++j) lXmean_new[j] += (inSelectionWeights[i] * (*lVecI)[j]);
+	}
+	const double lSigma=ioCMAValues.mSigma.getWrappedValue();
+	Vector lXdiff(inN);
+	for(unsigned int i=0; i<inN; ++i) lXdiff[i] = (lXmean_new[i] - ioCMAValues.mXmean[i]) / lSigma;
+
+	// Update cumulation paths
+	const double lPSFactor = std::sqrt(lCS * (2.0-lCS) * inMuEff);
+	double lPSnorm = 0.0;
+	for(unsigned int i=0; i<inN; ++i) {
+		ioCMAValues.mPS[i] = ((1.0-lCS) * ioCMAValues.mPS[i]) + (lPSFactor * lXdiff[i] / ioCMAValues.mD[i]);
+		lPSnorm += (ioCMAValues.mPS[i] * ioCMAValues.mPS[i]);
+	}
+	lPSnorm = std::sqrt(lPSnorm);
+	const double lHLeft =
+	    lPSnorm / std::sqrt(1.0-std::pow(1.0-lCS, 2.0*double(ioContext.getGeneration())));
+	const double lHRight = (1.5+(1.0/(double(inN)-0.5))) * lChiN;
+	const bool lHSig = (lHLeft<lHRight);
+
+	const double lPCFactor = lHSig ? std::sqrt(lCC * (2.0-lCC) * inMuEff) : 0.0;
+	for(unsigned int i=0; i<inN; ++i) {
+		ioCMAValues.mPC[i] = ((1.0-lCC) * ioCMAValues.mPC[i]) + (lPCFactor * lXdiff[i]);
+	}
+	if(lHSig == false) {
+		Beagle_LogTraceM(
+		    ioContext.getSystem().getLogger(),
+		    "CMA-ES p_c cumulation path update stalled"
+		);
+	}
+
+	// Adapt diagonal of covariance matrix C
+	double lAttnC = (1.0-lCCov);    // Attenuation factor
+	if(lHSig == false) lAttnC += (lCCov * lCC * (2.0-lCC) / lMuCov);
+	Vector lCii(inN);
+	for(unsigned int i=0; i<inN; ++i) {
+		lCii[i] = (lAttnC * ioCMAValues.mD[i] * ioCMAValues.mD[i]) +
+		          ((lCCov / lMuCov) * ioCMAValues.mPC[i] * ioCMAValues.mPC[i]);
+	}
+	const double lRMuFactor = lCCov * (1.0 - (1.0/lMuCov)) / (lSigma * lSigma);
+	for(unsigned int i=0; i<ioDeme.size(); ++i) {
+		FltVec::FloatVector::Handle lVecI = castHandleT<FltVec::FloatVector>((*ioDeme[i])[0]);
+		const double lWeight = lRMuFactor * inSelectionWeights[i];
+		for(unsigned int j=0; j<inN; ++j) {
+			const double lYij = (*lVecI)[j] - ioCMAValues.mXmean[j];
+			lCii[j] += (lWeight * lYij * lYij);
+		}
+	}
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mD[i] = std::sqrt(lCii[i]);
+
+	// Adapt step size sigma
+	ioCMAValues.mSigma.getWrappedValue() *= std::exp((lCS/lDamps) * ((lPSnorm/lChiN)-1.0));
+
+	// Log updated parameters.
+	Beagle_LogTraceM(
+	    ioContext.getSystem().getLogger(),
+	    std::string("CMA-ES updated D vector (standard deviations): ")+ioCMAValues.mD.serialize()
+	);
+	Beagle_LogTraceM(
+	    ioContext.getSystem().getLogger(),
+	    std::string("CMA-ES updated sigma: ")+ioCMAValues.mSigma.serialize()
+	);
+	Beagle_LogVerboseM(
+	    ioContext.getSystem().getLogger(),
+	    std::string("CMA-ES updated p_c vector (covariance cumulation path): ")+ioCMAValues.mPC.serialize()
+	);
+	Beagle_LogVerboseM(
+	    ioContext.getSystem().getLogger(),
+	    std::string("CMA-ES updated p_s vector (sigma cumulation path): ")+ioCMAValues.mPS.serialize()
+	);
+	Beagle_StackTraceEndM();
+}
@@ -0,0 +1,105 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/CMA/SepMuWCommaLambdaCMAFltVecOp.hpp
+ *  \brief  Definition of the class CMA::SepMuWCommaLambdaCMAFltVecOp.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_CMA_SepMuWCommaLambdaCMAFltVecOp_hpp
+#define Beagle_CMA_SepMuWCommaLambdaCMAFltVecOp_hpp
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+#include "Beagle/Core/Object.hpp"
+#include "Beagle/Core/Pointer.hpp"
+#include "Beagle/Core/PointerT.hpp"
+#include "Beagle/Core/Allocator.hpp"
+#include "Beagle/Core/AllocatorT.hpp"
+#include "Beagle/Core/Container.hpp"
+#include "Beagle/Core/ContainerT.hpp"
+#include "Beagle/CMA/MuWCommaLambdaCMAFltVecOp.hpp"
+
+namespace Beagle
+{
+namespace CMA
+{
+
+/*!
+ *  \class SepMuWCommaLambdaCMAFltVecOp Beagle/CMA/SepMuWCommaLambdaCMAFltVecOp.hpp "Beagle/CMA/SepMuWCommaLambdaCMAFltVecOp.hpp"
+ *  \brief Separable CMA-ES (Mu_W,Lambda) replacement strategy operator class.
+ *  \ingroup GAF
+ *  \ingroup GAFV
+ *
+ *  Separable CMA-ES (sep-CMA-ES), where the covariance matrix is constrained to be diagonal.
+ *  Only the standard deviations D of the coordinates are adapted, with a learning rate
+ *  increased by a factor (n+2)/3, so that memory and time per generation are linear in the
+ *  dimensionality n. Matrices B and C of the CMA values are left empty. Use in conjunction
+ *  with the CMA-ES mutation operator defined in class CMA::MutationCMAFltVecOp.
+ *
+ *  Reference: Ros, R. and Hansen, N. (2008). A Simple Modification in CMA-ES Achieving Linear
+ *  Time and Space Complexity. Parallel Problem Solving from Nature (PPSN X), pp. 296-305.
+ */
+class SepMuWCommaLambdaCMAFltVecOp : public MuWCommaLambdaCMAFltVecOp
+{
+
+public:
+
+	//! SepMuWCommaLambdaCMAFltVecOp allocator type.
+	typedef AllocatorT<SepMuWCommaLambdaCMAFltVecOp,MuWCommaLambdaCMAFltVecOp::Alloc>
+	Alloc;
+	//! SepMuWCommaLambdaCMAFltVecOp handle type.
+	typedef PointerT<SepMuWCommaLambdaCMAFltVecOp,MuWCommaLambdaCMAFltVecOp::Handle>
+	Handle;
+	//! SepMuWCommaLambdaCMAFltVecOp bag type.
+	typedef ContainerT<SepMuWCommaLambdaCMAFltVecOp,MuWCommaLambdaCMAFltVecOp::Bag>
+	Bag;
+
+	explicit SepMuWCommaLambdaCMAFltVecOp(std::string inLMRatioName="ga.cmaes.mulambdaratio",
+	                                      std::string inName="CMA-SepMuWCommaLambdaCMAFltVecOp");
+	virtual ~SepMuWCommaLambdaCMAFltVecOp()
+	{ }
+
+protected:
+
+	virtual void initCMAValues(CMAValues& ioCMAValues,
+	                           unsigned int inN,
+	                           Context& ioContext) const;
+	virtual void updateValues(Deme& ioDeme,
+	                          Context& ioContext,
+	                          unsigned int inN,
+	                          double inMuEff,
+	                          const Vector& inSelectionWeights,
+	                          CMAValues& ioCMAValues) const;
+
+};
+
+}
+}
+
+#endif // Beagle_CMA_SepMuWCommaLambdaCMAFltVecOp_hpp
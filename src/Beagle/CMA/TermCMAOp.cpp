@@ -37,6 +37,63 @@
 
 using namespace Beagle;
 
+namespace
+{
+
+/*!
+ *  \brief Return the variance C(i,i) of a coordinate, computing it on first use with LM-CMA-ES.
+ *  \param ioCii Variances, negative for the ones not computed yet.
+ *  \param inValues CMA values, holding the stored paths of the factor A of C = A*A^T.
+ *  \param inIndex Index of the coordinate.
+ *  \return Variance of the coordinate, the squared norm of the row of A.
+ */
+double getVariance(Vector& ioCii, const CMA::CMAValues& inValues, unsigned int inIndex)
+{
+	if(ioCii[inIndex] < 0.0) {
+		Vector lUnit(ioCii.size(), 0.0);
+		lUnit[inIndex] = 1.0;
+		Vector lRow;
+		CMA::LMMuWCommaLambdaCMAFltVecOp::multiplyFactorTranspose(lRow, lUnit, inValues);
+		ioCii[inIndex] = 0.0;
+		for(unsigned int k=0; k<lRow.size(); ++k) ioCii[inIndex] += (lRow[k] * lRow[k]);
+	}
+	return ioCii[inIndex];
+}
+
+
+/*!
+ *  \brief Estimate the largest eigenvalue of C = A*A^T, or of its inverse, by power iterations.
+ *  \param inValues CMA values, holding the stored paths of the factor A.
+ *  \param inInverse Whether the largest eigenvalue of the inverse of C is estimated.
+ *  \param inNbIterations Number of power iterations.
+ *  \return Estimate of the largest eigenvalue, never above the exact one.
+ */
+double estimateLargestEigenvalue(const CMA::CMAValues& inValues, bool inInverse, unsigned int inNbIterations)
+{
+	const unsigned int lN = inValues.mD.size();
+	Vector lX(lN, 1.0 / std::sqrt(double(lN)));
+	Vector lY;
+	double lEigenvalue = 0.0;
+	for(unsigned int i=0; i<inNbIterations; ++i) {
+		if(inInverse) {
+			CMA::LMMuWCommaLambdaCMAFltVecOp::multiplyInverseFactor(lY, lX, inValues, inValues.mLMV.getRows());
+			CMA::LMMuWCommaLambdaCMAFltVecOp::multiplyInverseFactorTranspose(lX, lY, inValues);
+		} else {
+			CMA::LMMuWCommaLambdaCMAFltVecOp::multiplyFactorTranspose(lY, lX, inValues);
+			CMA::LMMuWCommaLambdaCMAFltVecOp::multiplyFactor(lX, lY, inValues);
+		}
+		double lNorm = 0.0;
+		for(unsigned int k=0; k<lN; ++k) lNorm += (lX[k] * lX[k]);
+		lNorm = std::sqrt(lNorm);
+		if(lNorm == 0.0) return 0.0;
+		lEigenvalue = lNorm;
+		for(unsigned int k=0; k<lN; ++k) lX[k] /= lNorm;
+	}
+	return lEigenvalue;
+}
+
+}
+
 
 /*!
  *  \brief Construct a termination operator for CMA-ES.
@@ -136,21 +193,47 @@ bool CMA::TermCMAOp::terminate(const Deme& ioDeme, Context& ioContext)
 		return false;
 	}
 
-	// Compute some general matrices used to evaluate termination conditions.
-	Matrix lC, lBDt, lBD(lN,lN,0.0);
-	for(unsigned int i=0; i<lN; ++i) {
-		for(unsigned int j=0; j<lN; ++j) lBD(j,i) = lValues.mB(j,i) * lValues.mD[i];
+	// Compute the variances C(i,i) and the principal axes scaled by their standard deviation.
+	// B is empty with the separable and limited-memory CMA-ES. With the separable CMA-ES, the
+	// axes are the coordinates and C is its diagonal D^2. With the limited-memory CMA-ES, C is
+	// given by its factor A once paths are stored, and its variances are computed on demand
+	// as the tests below stop at the first coordinate not meeting their criterion.
+	const bool lFullC = (lValues.mB.getRows() == lN);
+	const bool lLowRank = (lFullC == false) && (lValues.mLMP.getRows() > 0);
+	Matrix lBD;
+	Vector lCii(lN, 0.0);
+	if(lLowRank) {
+		for(unsigned int i=0; i<lN; ++i) lCii[i] = -1.0;
+	} else if(lFullC) {
+		lBD.resize(lN,lN);
+		for(unsigned int i=0; i<lN; ++i) {
+			for(unsigned int j=0; j<lN; ++j) lBD(j,i) = lValues.mB(j,i) * lValues.mD[i];
+		}
+		if((lValues.mC.getRows()==lN) && (lValues.mC.getCols()==lN)) {
+			for(unsigned int i=0; i<lN; ++i) lCii[i] = lValues.mC(i,i);
+		} else {
+			for(unsigned int i=0; i<lN; ++i) {
+				for(unsigned int j=0; j<lN; ++j) lCii[i] += (lBD(i,j) * lBD(i,j));
+			}
+		}
+	} else {
+		for(unsigned int i=0; i<lN; ++i) lCii[i] = (lValues.mD[i] * lValues.mD[i]);
 	}
-	lBD.transpose(lBDt);
-	lBD.multiply(lC, lBDt);
 
-	// conditioncov: whether condition number of matrix C exceed some value.
+	// conditioncov: whether condition number of matrix C exceed some value. With the
+	// limited-memory CMA-ES, the largest eigenvalues of C and of its inverse are estimated
+	// by power iterations, giving a lower bound of the condition number.
 	double lNormC  = 0.0;
 	double lNormCi = 0.0;
-	for(unsigned int i=0; i<lN; ++i) {
-		const double ldi2 = lValues.mD[i] * lValues.mD[i];
-		if(ldi2 > lNormC) lNormC = ldi2;
-		if((1.0/ldi2) > lNormCi) lNormCi = (1.0 / ldi2);
+	if(lLowRank) {
+		lNormC  = estimateLargestEigenvalue(lValues, false, 20);
+		lNormCi = estimateLargestEigenvalue(lValues, true, 20);
+	} else {
+		for(unsigned int i=0; i<lN; ++i) {
+			const double ldi2 = lValues.mD[i] * lValues.mD[i];
+			if(ldi2 > lNormC) lNormC = ldi2;
+			if((1.0/ldi2) > lNormCi) lNormCi = (1.0 / ldi2);
+		}
 	}
 	const double lC_condition = lNormC * lNormCi;
 	if(lC_condition > mTolCond->getWrappedValue()) {
@@ -171,7 +254,7 @@ bool CMA::TermCMAOp::terminate(const Deme& ioDeme, Context& ioContext)
 	// distribution on all components is smaller than TolX.
 	unsigned int lTolXCiiCount=0;
 	for(unsigned int i=0; i<lN; ++i) {
-		if((lSigma_g * std::sqrt(lC(i,i))) < lTolVal) ++lTolXCiiCount;
+		if((lSigma_g * std::sqrt(getVariance(lCii, lValues, i))) < lTolVal) ++lTolXCiiCount;
 		else break;
 	}
 
@@ -186,7 +269,7 @@ bool CMA::TermCMAOp::terminate(const Deme& ioDeme, Context& ioContext)
 		std::ostringstream lOSS;
 		lOSS << "Terminating as all standard deviations of matrix C (i.e. C(i,i) * sigma_g) (";
 		for(unsigned int i=0; i<lN; ++i) {
-			lOSS << (lSigma_g * std::sqrt(lC(i,i)));
+			lOSS << (lSigma_g * std::sqrt(getVariance(lCii, lValues, i)));
 			if(i!=(lN-1)) lOSS << ";";
 		}
 		lOSS << ") and all components of cumulation path (i.e. |sigma_g * P_c|) (";
@@ -201,11 +284,17 @@ bool CMA::TermCMAOp::terminate(const Deme& ioDeme, Context& ioContext)
 	}
 
 	// noeffectaxis: whether modifications over all the principal components of C
-	// does not change xmean.
+	// does not change xmean. With the limited-memory CMA-ES, the columns of the factor A
+	// are used as axes, as they span C the same way as the columns of B*D.
 	unsigned int lNoEffectAxisCount = 0;
 	for(unsigned int i=0; i<lN; ++i) {
-		Vector lBDColI;
-		lBD.extractColumn((Matrix&)lBDColI, i);
+		Vector lBDColI(lN, 0.0);
+		if(lFullC) lBD.extractColumn((Matrix&)lBDColI, i);
+		else if(lLowRank) {
+			Vector lUnit(lN, 0.0);
+			lUnit[i] = 1.0;
+			CMA::LMMuWCommaLambdaCMAFltVecOp::multiplyFactor(lBDColI, lUnit, lValues);
+		} else lBDColI[i] = lValues.mD[i];
 		lBDColI *= lValues.mSigma.getWrappedValue();
 		unsigned int lNoEffectAxisCountJ = 0;
 		for(unsigned int j=0; j<lN; ++j) {
@@ -231,7 +320,7 @@ bool CMA::TermCMAOp::terminate(const Deme& ioDeme, Context& ioContext)
 	unsigned int lNoEffectCoordCount = 0;
 	for(unsigned int i=0; i<lN; ++i) {
 		const double lXModI =
-		    lValues.mXmean[i] + (lValues.mSigma.getWrappedValue() * std::sqrt(lC(i,i)));
+		    lValues.mXmean[i] + (lValues.mSigma.getWrappedValue() * std::sqrt(getVariance(lCii, lValues, i)));
 		if(lXModI == lValues.mXmean[i]) ++lNoEffectCoordCount;
 		else break;
 	}
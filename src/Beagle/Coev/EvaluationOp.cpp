@@ -248,6 +248,16 @@ Fitness::Handle Coev::EvaluationOp::evaluate(Individual& inIndividual, Context&
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return False, evaluation sets are shared between co-evolving threads.
+ */
+bool Coev::EvaluationOp::isDemeLocal(void) const
+{
+	return false;
+}
+
+
 /*!
  *  \brief Apply co-evolutionary evaluation operation on the deme.
  *  \param ioDeme Deme to evaluate fitness.
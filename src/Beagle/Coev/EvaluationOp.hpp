@@ -160,6 +160,7 @@ public:
 	virtual Individual::Handle breed(Individual::Bag& inBreedingPool,
 	                                 BreederNode::Handle inChild,
 	                                 Context& ioContext);
+	virtual bool isDemeLocal(void) const;
 	virtual void operate(Beagle::Deme& ioDeme, Beagle::Context& ioContext);
 
 protected:
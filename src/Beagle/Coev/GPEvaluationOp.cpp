@@ -77,7 +77,7 @@ void Coev::GPEvaluationOp::setValue(std::string inName,
 		GP::Primitive::Handle lPrimitive = (*lSuperSet)[i]->getPrimitiveByName(inName);
 		if(!lPrimitive) continue;
 		lValueFound = true;
-		lPrimitive->setValue(inValue);
+		lPrimitive->setContextValue(inValue, ioContext);
 	}
 	if(lValueFound == false) {
 		std::string lMessage = "The primitive named '";
@@ -82,6 +82,7 @@
 #include "Beagle/Core/Container.hpp"
 #include "Beagle/Core/ContainerT.hpp"
 #include "Beagle/Core/HashString.hpp"
+#include "Beagle/Core/RandomStream.hpp"
 #include "Beagle/Core/Map.hpp"
 #include "Beagle/Core/Matrix.hpp"
 #include "Beagle/Core/Vector.hpp"
@@ -113,6 +114,8 @@
 #include "Beagle/Core/UInt.hpp"
 #include "Beagle/Core/ULong.hpp"
 #include "Beagle/Core/UShort.hpp"
+#include "Beagle/Core/BinaryInArchive.hpp"
+#include "Beagle/Core/BinaryOutArchive.hpp"
 #include "Beagle/Core/Member.hpp"
 #include "Beagle/Core/MemberMap.hpp"
 #include "Beagle/Core/Genotype.hpp"
@@ -133,6 +136,7 @@
 #include "Beagle/Core/Register.hpp"
 #include "Beagle/Core/Logger.hpp"
 #include "Beagle/Core/LoggerXML.hpp"
+#include "Beagle/Core/DataSet.hpp"
 #include "Beagle/Core/DataSetClassification.hpp"
 #include "Beagle/Core/DataSetRegression.hpp"
 #include "Beagle/Core/RouletteT.hpp"
@@ -140,6 +144,7 @@
 #include "Beagle/Core/HistoryEntry.hpp"
 #include "Beagle/Core/HistoryID.hpp"
 #include "Beagle/Core/HistoryTrace.hpp"
+#include "Beagle/Core/FitnessCache.hpp"
 #include "Beagle/Core/Operator.hpp"
 #include "Beagle/Core/OperatorMap.hpp"
 #include "Beagle/Core/BreederNode.hpp"
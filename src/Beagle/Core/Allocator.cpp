@@ -58,6 +58,22 @@ Beagle::Object* Beagle::Allocator::allocate() const
 }
 
 
+/*!
+ *  \brief  Allocate an object that is to be overwritten with a copy of another object.
+ *  \return Pointer to the allocated object.
+ *
+ *  The object returned may be a recycled object in an unspecified state, it must be
+ *  completely overwritten by the caller, usually with a call to its copy method. The
+ *  default implementation simply allocates a new object.
+ */
+Beagle::Object* Beagle::Allocator::allocateRecycled() const
+{
+	Beagle_StackTraceBeginM();
+	return allocate();
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief  Allocate a new object on the heap that is a clone of an existing object.
  *  \param  inOriginal Constant reference to the original object to clone.
@@ -90,3 +106,13 @@ void Beagle::Allocator::copy(Beagle::Object& outCopy,
 	Beagle_StackTraceEndM();
 }
 
+
+/*!
+ *  \brief Give back an object no longer used, for later recycling.
+ *  \param ioObject Object to recycle.
+ *
+ *  The default implementation does nothing, the object being deleted when its
+ *  last reference vanishes.
+ */
+void Beagle::Allocator::recycle(Beagle::Object&) const
+{ }
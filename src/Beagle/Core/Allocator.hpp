@@ -120,8 +120,10 @@ public:
 	{ }
 
 	virtual Object* allocate() const;
+	virtual Object* allocateRecycled() const;
 	virtual Object* clone(const Object& inOriginal) const;
 	virtual void    copy(Object& outCopy, const Object& inOriginal) const;
+	virtual void    recycle(Object& ioObject) const;
 
 };
 
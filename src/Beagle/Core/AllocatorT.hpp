@@ -38,6 +38,9 @@
 #ifndef Beagle_Core_AllocatorT_hpp
 #define Beagle_Core_AllocatorT_hpp
 
+#include <typeinfo>
+#include <vector>
+
 #include "Beagle/config.hpp"
 #include "Beagle/macros.hpp"
 #include "Beagle/Core/Object.hpp"
@@ -47,6 +50,14 @@
 #include "Beagle/Core/BadCastException.hpp"
 
 
+/*!
+ *  \def   BEAGLE_ALLOCATOR_POOL_SIZE
+ *  \brief Maximum number of objects kept for recycling by each allocator.
+ */
+#ifndef BEAGLE_ALLOCATOR_POOL_SIZE
+#define BEAGLE_ALLOCATOR_POOL_SIZE 4096
+#endif // BEAGLE_ALLOCATOR_POOL_SIZE
+
 namespace Beagle
 {
 
@@ -59,6 +70,14 @@ template <class T, class BaseType> class PointerT;
  *  \brief Templated class defining a T-type allocator.
  *  \param T Type of object allocated.
  *  \param BaseType Base type from which the actual allocator type is derived.
+ *
+ *  The allocator keeps a pool of objects given back with recycle, which are reused by
+ *  allocateRecycled instead of allocating new objects on the heap. Recycled objects
+ *  keep their internal storage (i.e. the genotypes of an individual), which is reused
+ *  when they are overwritten by a copy. The pool is shared by the threads and protected
+ *  by a critical section, as objects are usually recycled by the serial part of
+ *  replacement strategies and reallocated by parallel breeding.
+ *
  *  \ingroup Core
  *  \ingroup Allocs
  */
@@ -77,12 +96,39 @@ public:
 
 	AllocatorT()
 	{ }
-	virtual ~AllocatorT()
+
+	/*!
+	 *  \brief Copy construct an allocator, the pool of recycled objects being not copied.
+	 *  \param inOriginal Allocator to copy.
+	 */
+	AllocatorT(const AllocatorT<T,BaseType>& inOriginal) :
+		BaseType(inOriginal)
 	{ }
 
+	virtual ~AllocatorT()
+	{
+		for(unsigned int i=0; i<mRecycled.size(); ++i) mRecycled[i]->unrefer();
+	}
+
+	/*!
+	 *  \brief Copy an allocator, the pool of recycled objects being not copied.
+	 *  \param inOriginal Allocator to copy.
+	 *  \return Reference to the actual allocator.
+	 */
+	AllocatorT<T,BaseType>& operator=(const AllocatorT<T,BaseType>& inOriginal) {
+		BaseType::operator=(inOriginal);
+		return *this;
+	}
+
 	virtual Object* allocate() const;
+	virtual Object* allocateRecycled() const;
 	virtual Object* clone(const Object& inOrigObj) const;
 	virtual void    copy(Object& outCopy, const Object& inOriginal) const;
+	virtual void    recycle(Object& ioObject) const;
+
+protected:
+
+	mutable std::vector<T*> mRecycled;   //!< Objects kept for recycling, referred by the allocator.
 
 };
 
@@ -108,6 +154,28 @@ Beagle::Object* Beagle::AllocatorT<T,BaseType>::allocate() const
 }
 
 
+/*!
+ *  \brief  Allocate a T-type object to be overwritten, reusing a recycled object if available.
+ *  \return Pointer to the allocated T-type object, in an unspecified state.
+ */
+template <class T, class BaseType>
+Beagle::Object* Beagle::AllocatorT<T,BaseType>::allocateRecycled() const
+{
+	Beagle_StackTraceBeginM();
+	T* lT = NULL;
+#pragma omp critical (Beagle_AllocatorT_Pool)
+	{
+		if(mRecycled.empty() == false) {
+			lT = mRecycled.back();
+			mRecycled.pop_back();
+		}
+	}
+	if(lT == NULL) return allocate();
+	return lT->release();
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief  Allocate a new T-type object on the heap that is a clone an existing object.
  *  \param  inOriginal Constant reference to the original T-type object to clone.
@@ -149,4 +217,30 @@ void Beagle::AllocatorT<T,BaseType>::copy(Beagle::Object& outCopy,
 }
 
 
+/*!
+ *  \brief Keep a T-type object no longer used for recycling.
+ *  \param ioObject Object to recycle.
+ *  \throw BasCastException If the type of the parameter is not as specified.
+ *
+ *  The object is kept only if the caller holds its last reference, and if it is exactly
+ *  of type T. It will be handed over by a later call to allocateRecycled.
+ */
+template <class T, class BaseType>
+void Beagle::AllocatorT<T,BaseType>::recycle(Beagle::Object& ioObject) const
+{
+	Beagle_StackTraceBeginM();
+	if(ioObject.getRefCounter() != 1) return;
+	T& lT = castObjectT<T&>(ioObject);
+	if(typeid(lT) != typeid(T)) return;
+#pragma omp critical (Beagle_AllocatorT_Pool)
+	{
+		if(mRecycled.size() < BEAGLE_ALLOCATOR_POOL_SIZE) {
+			lT.refer();
+			mRecycled.push_back(&lT);
+		}
+	}
+	Beagle_StackTraceEndM();
+}
+
+
 #endif // Beagle_Core_AllocatorT_hpp
@@ -0,0 +1,95 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/Core/BinaryInArchive.cpp
+ *  \brief  Source code of class BinaryInArchive.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/Core.hpp"
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Check that enough bytes remain in the archive.
+ *  \param inNbBytes Number of bytes about to be read.
+ *  \throw Beagle::IOException If there are not enough bytes left.
+ */
+void BinaryInArchive::checkRemaining(unsigned int inNbBytes) const
+{
+	Beagle_StackTraceBeginM();
+	if((mPosition+inNbBytes) > mBuffer.size()) {
+		std::ostringstream lOSS;
+		lOSS << "unexpected end of binary archive, " << inNbBytes << " bytes needed at position ";
+		lOSS << mPosition << " of an archive of " << mBuffer.size() << " bytes!";
+		throw Beagle_IOExceptionMessageM(lOSS.str());
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Read header of the archive.
+ *  \return Version of the archive format.
+ *  \throw Beagle::IOException If the header is invalid or the version is not supported.
+ */
+unsigned int BinaryInArchive::readHeader()
+{
+	Beagle_StackTraceBeginM();
+	checkRemaining(4);
+	if(mBuffer.compare(mPosition, 4, "OBBA") != 0) {
+		throw Beagle_IOExceptionMessageM("bad magic number, the buffer is not a binary archive!");
+	}
+	mPosition += 4;
+	mVersion = readUInt();
+	if((mVersion == 0) || (mVersion > BinaryOutArchive::eVersion)) {
+		std::ostringstream lOSS;
+		lOSS << "binary archive format version " << mVersion << " is not supported, ";
+		lOSS << "latest version supported is " << BinaryOutArchive::eVersion << "!";
+		throw Beagle_IOExceptionMessageM(lOSS.str());
+	}
+	return mVersion;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Read a string.
+ *  \return String read.
+ */
+std::string BinaryInArchive::readString()
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lSize = readUInt();
+	checkRemaining(lSize);
+	std::string lValue(mBuffer, mPosition, lSize);
+	mPosition += lSize;
+	return lValue;
+	Beagle_StackTraceEndM();
+}
@@ -0,0 +1,147 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/Core/BinaryInArchive.hpp
+ *  \brief  Definition of the class BinaryInArchive.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_Core_BinaryInArchive_hpp
+#define Beagle_Core_BinaryInArchive_hpp
+
+#include <cstring>
+#include <string>
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+
+
+namespace Beagle
+{
+
+/*!
+ *  \class BinaryInArchive Beagle/Core/BinaryInArchive.hpp "Beagle/Core/BinaryInArchive.hpp"
+ *  \brief Compact binary archive from which objects are read.
+ *
+ *  Read values written by a BinaryOutArchive, in the same order. The archive refers to
+ *  a buffer owned by the caller, which must be kept alive while reading. Reading past
+ *  the end of the buffer raises an IOException.
+ *
+ *  \ingroup Core
+ *  \ingroup Sys
+ */
+class BinaryInArchive
+{
+
+public:
+
+	explicit BinaryInArchive(const std::string& inBuffer) :
+		mBuffer(inBuffer),
+		mPosition(0),
+		mVersion(0)
+	{ }
+	~BinaryInArchive()
+	{ }
+
+	unsigned int readHeader();
+	std::string  readString();
+
+	//! Return the version of the format read in the header, 0 if no header was read.
+	inline unsigned int getVersion() const {
+		return mVersion;
+	}
+
+	//! Return whether all the content of the archive has been read.
+	inline bool isEnd() const {
+		return mPosition >= mBuffer.size();
+	}
+
+	//! Read a boolean value.
+	inline bool readBool() {
+		checkRemaining(1);
+		return mBuffer[mPosition++] != char(0);
+	}
+
+	//! Read a double-precision floating-point value.
+	inline double readDouble() {
+		const unsigned long long lBits = readBits64();
+		double lValue = 0.0;
+		std::memcpy(&lValue, &lBits, sizeof(double));
+		return lValue;
+	}
+
+	//! Read a single-precision floating-point value.
+	inline float readFloat() {
+		const unsigned int lBits = readUInt();
+		float lValue = 0.0f;
+		std::memcpy(&lValue, &lBits, sizeof(float));
+		return lValue;
+	}
+
+	//! Read a signed integer value.
+	inline int readInt() {
+		return (int)readUInt();
+	}
+
+	//! Read an unsigned integer value.
+	inline unsigned int readUInt() {
+		checkRemaining(4);
+		const unsigned char* lBytes = (const unsigned char*)(mBuffer.data() + mPosition);
+		mPosition += 4;
+		return (unsigned int)lBytes[0] | ((unsigned int)lBytes[1] << 8) |
+		       ((unsigned int)lBytes[2] << 16) | ((unsigned int)lBytes[3] << 24);
+	}
+
+	//! Read an unsigned long integer value.
+	inline unsigned long readULong() {
+		return (unsigned long)readBits64();
+	}
+
+protected:
+
+	void checkRemaining(unsigned int inNbBytes) const;
+
+	//! Read 64 bits value in little-endian order.
+	inline unsigned long long readBits64() {
+		checkRemaining(8);
+		const unsigned char* lBytes = (const unsigned char*)(mBuffer.data() + mPosition);
+		mPosition += 8;
+		unsigned long long lBits = 0;
+		for(unsigned int i=0; i<8; ++i) lBits |= ((unsigned long long)lBytes[i] << (8*i));
+		return lBits;
+	}
+
+	const std::string& mBuffer;     //!< Content of the archive.
+	unsigned int       mPosition;   //!< Position of the next value to read.
+	unsigned int       mVersion;    //!< Version of the format read in the header.
+
+};
+
+}
+
+#endif // Beagle_Core_BinaryInArchive_hpp
@@ -0,0 +1,149 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/Core/BinaryOutArchive.hpp
+ *  \brief  Definition of the class BinaryOutArchive.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_Core_BinaryOutArchive_hpp
+#define Beagle_Core_BinaryOutArchive_hpp
+
+#include <cstring>
+#include <string>
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+
+
+namespace Beagle
+{
+
+/*!
+ *  \class BinaryOutArchive Beagle/Core/BinaryOutArchive.hpp "Beagle/Core/BinaryOutArchive.hpp"
+ *  \brief Compact binary archive into which objects are written.
+ *
+ *  The binary archive is an alternative to the XML streamer for the transport of
+ *  individuals and fitness between processes, where text encoding and parsing would cost
+ *  more than the evaluation itself. Values are appended to an in-memory buffer in a
+ *  fixed little-endian layout, independent of the host: unsigned and signed integers
+ *  on 32 bits, long integers on 64 bits, floating-point numbers in IEEE 754 single and
+ *  double precision, and strings as their length followed by their characters.
+ *
+ *  Archives start with a header holding a magic number and the version of the format,
+ *  checked by BinaryInArchive::readHeader.
+ *
+ *  \ingroup Core
+ *  \ingroup Sys
+ */
+class BinaryOutArchive
+{
+
+public:
+
+	//! Version of the binary archive format.
+	enum { eVersion = 1 };
+
+	BinaryOutArchive()
+	{ }
+	~BinaryOutArchive()
+	{ }
+
+	void writeHeader();
+
+	//! Remove all the content of the archive.
+	inline void clear() {
+		mBuffer.clear();
+	}
+
+	//! Return the content of the archive.
+	inline const std::string& getBuffer() const {
+		return mBuffer;
+	}
+
+	//! Write a boolean value, on one byte.
+	inline void writeBool(bool inValue) {
+		mBuffer.push_back(inValue ? char(1) : char(0));
+	}
+
+	//! Write a double-precision floating-point value.
+	inline void writeDouble(double inValue) {
+		unsigned long long lBits = 0;
+		std::memcpy(&lBits, &inValue, sizeof(double));
+		writeBits64(lBits);
+	}
+
+	//! Write a single-precision floating-point value.
+	inline void writeFloat(float inValue) {
+		unsigned int lBits = 0;
+		std::memcpy(&lBits, &inValue, sizeof(float));
+		writeUInt(lBits);
+	}
+
+	//! Write a signed integer value, on 32 bits.
+	inline void writeInt(int inValue) {
+		writeUInt((unsigned int)inValue);
+	}
+
+	//! Write a string, as its length followed by its characters.
+	inline void writeString(const std::string& inValue) {
+		writeUInt(inValue.size());
+		mBuffer.append(inValue);
+	}
+
+	//! Write an unsigned integer value, on 32 bits.
+	inline void writeUInt(unsigned int inValue) {
+		char lBytes[4];
+		lBytes[0] = char(inValue & 0xFF);
+		lBytes[1] = char((inValue >> 8) & 0xFF);
+		lBytes[2] = char((inValue >> 16) & 0xFF);
+		lBytes[3] = char((inValue >> 24) & 0xFF);
+		mBuffer.append(lBytes, 4);
+	}
+
+	//! Write an unsigned long integer value, on 64 bits.
+	inline void writeULong(unsigned long inValue) {
+		writeBits64((unsigned long long)inValue);
+	}
+
+protected:
+
+	//! Write 64 bits value in little-endian order.
+	inline void writeBits64(unsigned long long inBits) {
+		char lBytes[8];
+		for(unsigned int i=0; i<8; ++i) lBytes[i] = char((inBits >> (8*i)) & 0xFF);
+		mBuffer.append(lBytes, 8);
+	}
+
+	std::string mBuffer;   //!< Content of the archive.
+
+};
+
+}
+
+#endif // Beagle_Core_BinaryOutArchive_hpp
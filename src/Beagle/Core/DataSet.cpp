@@ -0,0 +1,303 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/Core/DataSet.cpp
+ *  \brief  Implementation of the class DataSet.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/Core.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#ifdef BEAGLE_HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif // BEAGLE_HAVE_SYS_MMAN_H
+
+using namespace Beagle;
+
+
+namespace
+{
+
+/*!
+ *  \brief Test whether a line of text contains only white spaces.
+ *  \param inBegin Beginning of the line.
+ *  \param inEnd End of the line.
+ *  \return True if the line is blank, false if not.
+ */
+bool isBlankLine(const char* inBegin, const char* inEnd)
+{
+	for(const char* lIter=inBegin; lIter!=inEnd; ++lIter) {
+		if((*lIter != ' ') && (*lIter != '\t') && (*lIter != '\r')) return false;
+	}
+	return true;
+}
+
+/*!
+ *  \brief Get the end of a line of text.
+ *  \param inBegin Beginning of the line.
+ *  \param inEnd End of the text.
+ *  \return Pointer to the end of line character, or the end of the text.
+ */
+const char* findLineEnd(const char* inBegin, const char* inEnd)
+{
+	const char* lLineEnd = static_cast<const char*>(std::memchr(inBegin, '\n', inEnd-inBegin));
+	return (lLineEnd == NULL) ? inEnd : lLineEnd;
+}
+
+}
+
+
+/*!
+ *  \brief Construct data set component.
+ *  \param inName Name of the component.
+ */
+DataSet::DataSet(const std::string& inName) :
+		Component(inName),
+		mSize(0),
+		mNumberColumns(0),
+		mStride(0)
+{ }
+
+
+/*!
+ *  \brief Remove all the samples of the data set.
+ */
+void DataSet::clear()
+{
+	Beagle_StackTraceBeginM();
+	mValues.clear();
+	mSize = 0;
+	mNumberColumns = 0;
+	mStride = 0;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Copy the feature values of a sample into a vector.
+ *  \param inRow Index of the sample.
+ *  \param outValues Vector receiving the feature values.
+ */
+void DataSet::getRow(unsigned int inRow, Beagle::Vector& outValues) const
+{
+	Beagle_StackTraceBeginM();
+	Beagle_UpperBoundCheckAssertM(inRow,mSize-1);
+	outValues.resize(mNumberColumns);
+	for(unsigned int j=0; j<mNumberColumns; ++j) outValues[j] = mValues[(j*mStride)+inRow];
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Parse a data set in CSV format.
+ *  \param inBegin Beginning of the CSV text.
+ *  \param inEnd End of the CSV text.
+ *  \throw Beagle::IOException If the text is not a valid data set.
+ *
+ *  Each non blank line is a sample, made of comma-separated values. The last value of a line
+ *  is the target of the sample, the other ones its features. All the lines must have the same
+ *  number of values. The text is scanned a first time to size the data set, and the values
+ *  are then parsed directly into the feature columns.
+ */
+void DataSet::parseCSV(const char* inBegin, const char* inEnd)
+{
+	Beagle_StackTraceBeginM();
+	// Count samples, and number of values of the first sample
+	unsigned int lNbRows = 0;
+	unsigned int lNbFields = 0;
+	for(const char* lLineBegin=inBegin; lLineBegin<inEnd;) {
+		const char* lLineEnd = findLineEnd(lLineBegin, inEnd);
+		if(isBlankLine(lLineBegin, lLineEnd) == false) {
+			if(lNbRows == 0) lNbFields = std::count(lLineBegin, lLineEnd, ',') + 1;
+			++lNbRows;
+		}
+		lLineBegin = lLineEnd + 1;
+	}
+	resize(lNbRows, (lNbFields == 0) ? 0 : (lNbFields-1));
+
+	// Parse values, line by line
+	std::string lLine;
+	unsigned int lRow = 0;
+	unsigned int lLineNumber = 0;
+	for(const char* lLineBegin=inBegin; lLineBegin<inEnd;) {
+		const char* lLineEnd = findLineEnd(lLineBegin, inEnd);
+		++lLineNumber;
+		if(isBlankLine(lLineBegin, lLineEnd)) {
+			lLineBegin = lLineEnd + 1;
+			continue;
+		}
+		lLine.assign(lLineBegin, lLineEnd);
+		const char* lField = lLine.c_str();
+		for(unsigned int j=0; j<lNbFields; ++j) {
+			char* lFieldEnd = NULL;
+			const double lValue = std::strtod(lField, &lFieldEnd);
+			while((*lFieldEnd == ' ') || (*lFieldEnd == '\t') || (*lFieldEnd == '\r')) ++lFieldEnd;
+			const char lExpected = ((j+1) < lNbFields) ? ',' : '\0';
+			if((lFieldEnd == lField) || (*lFieldEnd != lExpected)) {
+				std::ostringstream lOSS;
+				lOSS << "Unable to read data set in CSV format: line " << lLineNumber;
+				lOSS << " should be made of " << lNbFields << " comma-separated numbers!";
+				throw Beagle_IOExceptionMessageM(lOSS.str());
+			}
+			if(lExpected == ',') mValues[(j*mStride)+lRow] = lValue;
+			else setTargetValue(lRow, lValue);
+			lField = lFieldEnd + 1;
+		}
+		++lRow;
+		lLineBegin = lLineEnd + 1;
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Read data set from a CSV stream.
+ *  \param ioIS Input stream referring to CSV data.
+ *  \throw Beagle::IOException If the stream content is not a valid data set.
+ */
+void DataSet::readCSV(std::istream& ioIS)
+{
+	Beagle_StackTraceBeginM();
+	const std::string lText((std::istreambuf_iterator<char>(ioIS)), std::istreambuf_iterator<char>());
+	parseCSV(lText.data(), lText.data()+lText.size());
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Read data set from a CSV file.
+ *  \param inFileName Name of the CSV file.
+ *  \throw Beagle::RunTimeException If the file can not be opened.
+ *  \throw Beagle::IOException If the file content is not a valid data set.
+ *
+ *  When available, the file is memory-mapped and parsed in place, which avoids copying
+ *  large files through a stream buffer.
+ */
+void DataSet::readCSV(const std::string& inFileName)
+{
+	Beagle_StackTraceBeginM();
+#ifdef BEAGLE_HAVE_SYS_MMAN_H
+	const int lFD = ::open(inFileName.c_str(), O_RDONLY);
+	if(lFD < 0) {
+		throw Beagle_RunTimeExceptionM(std::string("Could not open data set file '")+inFileName+"'!");
+	}
+	struct stat lStat;
+	if(::fstat(lFD, &lStat) != 0) {
+		::close(lFD);
+		throw Beagle_RunTimeExceptionM(std::string("Could not get size of data set file '")+inFileName+"'!");
+	}
+	const size_t lSize = lStat.st_size;
+	if(lSize == 0) {
+		::close(lFD);
+		clear();
+		return;
+	}
+	void* lMap = ::mmap(NULL, lSize, PROT_READ, MAP_PRIVATE, lFD, 0);
+	::close(lFD);
+	if(lMap == MAP_FAILED) {
+		throw Beagle_RunTimeExceptionM(std::string("Could not map data set file '")+inFileName+"' in memory!");
+	}
+	::madvise(lMap, lSize, MADV_SEQUENTIAL);
+	const char* lText = static_cast<const char*>(lMap);
+	try {
+		parseCSV(lText, lText+lSize);
+	} catch(...) {
+		::munmap(lMap, lSize);
+		throw;
+	}
+	::munmap(lMap, lSize);
+#else // BEAGLE_HAVE_SYS_MMAN_H
+	std::ifstream lIFS(inFileName.c_str());
+	if(!lIFS) {
+		throw Beagle_RunTimeExceptionM(std::string("Could not open data set file '")+inFileName+"'!");
+	}
+	readCSV(lIFS);
+#endif // BEAGLE_HAVE_SYS_MMAN_H
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Resize the data set, keeping the values of the samples and features preserved.
+ *  \param inSize New number of samples.
+ *  \param inNumberColumns New number of features.
+ */
+void DataSet::resize(unsigned int inSize, unsigned int inNumberColumns)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lStride = (inSize + 7) & ~7U;
+	if((lStride == mStride) && (inNumberColumns == mNumberColumns)) {
+		for(unsigned int j=0; j<mNumberColumns; ++j) {
+			for(unsigned int i=inSize; i<mSize; ++i) mValues[(j*mStride)+i] = 0.0;
+		}
+		mSize = inSize;
+		return;
+	}
+	std::vector<double> lValues(lStride*inNumberColumns, 0.0);
+	const unsigned int lNbRows = std::min(mSize, inSize);
+	const unsigned int lNbColumns = std::min(mNumberColumns, inNumberColumns);
+	for(unsigned int j=0; j<lNbColumns; ++j) {
+		std::copy(mValues.begin()+(j*mStride), mValues.begin()+(j*mStride)+lNbRows, lValues.begin()+(j*lStride));
+	}
+	mValues.swap(lValues);
+	mSize = inSize;
+	mNumberColumns = inNumberColumns;
+	mStride = lStride;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Set the feature values of a sample.
+ *  \param inRow Index of the sample.
+ *  \param inValues Feature values of the sample.
+ *  \throw Beagle::RunTimeException If the number of values is not the number of features.
+ */
+void DataSet::setRow(unsigned int inRow, const PACC::Vector& inValues)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_UpperBoundCheckAssertM(inRow,mSize-1);
+	if(inValues.size() != mNumberColumns) {
+		std::ostringstream lOSS;
+		lOSS << "Could not set sample " << inRow << " of data set: " << inValues.size();
+		lOSS << " values given, while there is " << mNumberColumns << " features!";
+		throw Beagle_RunTimeExceptionM(lOSS.str());
+	}
+	for(unsigned int j=0; j<mNumberColumns; ++j) mValues[(j*mStride)+inRow] = inValues[j];
+	Beagle_StackTraceEndM();
+}
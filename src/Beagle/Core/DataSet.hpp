@@ -0,0 +1,244 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/Core/DataSet.hpp
+ *  \brief  Definition of the type DataSet.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_Core_DataSet_hpp
+#define Beagle_Core_DataSet_hpp
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+#include "Beagle/Core/Component.hpp"
+#include "Beagle/Core/AbstractAllocT.hpp"
+#include "Beagle/Core/PointerT.hpp"
+#include "Beagle/Core/ContainerT.hpp"
+#include "Beagle/Core/Vector.hpp"
+#include "Beagle/Core/AssertException.hpp"
+
+
+namespace Beagle
+{
+
+/*!
+ *  \class DataSet Beagle/Core/DataSet.hpp "Beagle/Core/DataSet.hpp"
+ *  \brief Abstract component of a data set, with features stored column by column.
+ *  \ingroup Core
+ *
+ *  The feature values are stored as a structure of arrays: the values of each feature over
+ *  all the samples (rows) are contiguous, so that evaluators can stream a whole column of
+ *  values at once. Columns are padded to a multiple of eight values, such that they all
+ *  share the alignment of the first one. The targets of the samples are stored by the
+ *  concrete data sets.
+ */
+class DataSet : public Component
+{
+
+public:
+
+	//! DataSet allocator type.
+	typedef AbstractAllocT< DataSet, Component::Alloc > Alloc;
+	//!< DataSet handle type.
+	typedef PointerT< DataSet, Component::Handle > Handle;
+	//!< DataSet bag type.
+	typedef ContainerT< DataSet, Component::Bag > Bag;
+
+	/*!
+	 *  \brief Read-only view of the feature values of a sample of a data set.
+	 */
+	class Row
+	{
+	public:
+		Row(const double* inFirst, unsigned int inStride, unsigned int inSize) :
+				mFirst(inFirst), mStride(inStride), mSize(inSize)
+		{ }
+
+		/*!
+		 *  \return Value of the feature inN of the sample.
+		 */
+		inline double operator[](unsigned int inN) const
+		{
+			Beagle_StackTraceBeginM();
+			Beagle_UpperBoundCheckAssertM(inN,mSize-1);
+			return mFirst[inN*mStride];
+			Beagle_StackTraceEndM();
+		}
+
+		/*!
+		 *  \return Number of features of the sample.
+		 */
+		inline unsigned int size() const
+		{
+			return mSize;
+		}
+
+	protected:
+		const double* mFirst;   //!< Value of the first feature of the sample.
+		unsigned int  mStride;  //!< Distance between two features of the sample.
+		unsigned int  mSize;    //!< Number of features.
+	};
+
+	explicit DataSet(const std::string& inName=std::string("DataSet"));
+	virtual ~DataSet()
+	{ }
+
+	virtual void clear();
+	virtual void resize(unsigned int inSize, unsigned int inNumberColumns);
+
+	void getRow(unsigned int inRow, Beagle::Vector& outValues) const;
+	void readCSV(std::istream& ioIS);
+	void readCSV(const std::string& inFileName);
+	void setRow(unsigned int inRow, const PACC::Vector& inValues);
+
+	/*!
+	 *  \brief Test whether the data set is empty.
+	 *  \return True if there is no sample in the data set, false if not.
+	 */
+	inline bool empty() const
+	{
+		Beagle_StackTraceBeginM();
+		return (mSize == 0);
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Get the values of a feature for all the samples.
+	 *  \param inN Index of the feature.
+	 *  \return Pointer to the contiguous values of the feature, one per sample.
+	 */
+	inline const double* getColumn(unsigned int inN) const
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inN,mNumberColumns-1);
+		return &mValues[inN*mStride];
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Get the values of a feature for all the samples.
+	 *  \param inN Index of the feature.
+	 *  \return Pointer to the contiguous values of the feature, one per sample.
+	 */
+	inline double* getColumn(unsigned int inN)
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inN,mNumberColumns-1);
+		return &mValues[inN*mStride];
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \return Number of features (columns) of the data set.
+	 */
+	inline unsigned int getNumberColumns() const
+	{
+		Beagle_StackTraceBeginM();
+		return mNumberColumns;
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Get a view of the feature values of a sample.
+	 *  \param inN Index of the sample.
+	 *  \return View of the sample features.
+	 */
+	inline Row getRow(unsigned int inN) const
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inN,mSize-1);
+		return Row(mValues.empty() ? NULL : &mValues[inN], mStride, mNumberColumns);
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Get a feature value of a sample.
+	 *  \param inRow Index of the sample.
+	 *  \param inColumn Index of the feature.
+	 *  \return Value of the feature for the sample.
+	 */
+	inline double getValue(unsigned int inRow, unsigned int inColumn) const
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inRow,mSize-1);
+		Beagle_UpperBoundCheckAssertM(inColumn,mNumberColumns-1);
+		return mValues[(inColumn*mStride)+inRow];
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Get a feature value of a sample.
+	 *  \param inRow Index of the sample.
+	 *  \param inColumn Index of the feature.
+	 *  \return Reference to the value of the feature for the sample.
+	 */
+	inline double& getValue(unsigned int inRow, unsigned int inColumn)
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inRow,mSize-1);
+		Beagle_UpperBoundCheckAssertM(inColumn,mNumberColumns-1);
+		return mValues[(inColumn*mStride)+inRow];
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \return Number of samples (rows) of the data set.
+	 */
+	inline unsigned int size() const
+	{
+		Beagle_StackTraceBeginM();
+		return mSize;
+		Beagle_StackTraceEndM();
+	}
+
+protected:
+
+	/*!
+	 *  \brief Set the target of a sample read from a CSV file.
+	 *  \param inRow Index of the sample.
+	 *  \param inValue Value read in the last field of the sample line.
+	 */
+	virtual void setTargetValue(unsigned int inRow, double inValue) =0;
+
+	void parseCSV(const char* inBegin, const char* inEnd);
+
+	std::vector<double> mValues;         //!< Feature values, column by column.
+	unsigned int        mSize;           //!< Number of samples.
+	unsigned int        mNumberColumns;  //!< Number of features.
+	unsigned int        mStride;         //!< Distance between the start of two columns.
+
+};
+
+}
+
+#endif // Beagle_Core_DataSet_hpp
@@ -36,8 +36,6 @@
 
 #include "Beagle/Core.hpp"
 
-#include <stdexcept>
-
 using namespace Beagle;
 
 
@@ -46,48 +44,24 @@ using namespace Beagle;
  *  \param inName Name of the component.
  */
 DataSetClassification::DataSetClassification(const std::string& inName) :
-	Component(inName)
+	DataSet(inName)
 { }
 
 
 /*!
- *  \brief Read data set from a CVS file.
- *  \param ioIS Input stream referring to CVS file.
+ *  \brief Remove all the samples of the data set.
  */
-void DataSetClassification::readCSV(std::istream& ioIS)
+void DataSetClassification::clear()
 {
-	clear();
-	char lBuf[4096];
-	for(ioIS.getline(lBuf,4096); ioIS.gcount()<4096; ioIS.getline(lBuf,4096)) {
-		std::string lStr(lBuf);
-		if(lStr.empty()) {
-			if(ioIS.good()==false) break;
-			else continue;
-		}
-		resize(size()+1);
-		back().second.resize(0);
-		std::istringstream lISS(lStr);
-		double lDbl=0.0;
-		for(lISS >> lDbl; (lISS.peek()==',') && lISS.good(); lISS >> lDbl) {
-			const unsigned int lSize = back().second.size();
-			back().second.resize(lSize + 1);
-			back().second[lSize] = lDbl;
-			lISS.get();
-		}
-		back().first = (int)lDbl;
-		if(ioIS.good()==false) break;
-	}
-	if(ioIS.gcount() == 4096) {
-		std::ostringstream lOSS;
-		lOSS << "Unable to read data set from given stream, number of characters on one ";
-		lOSS << "line exceed 4096 characters!";
-		throw std::runtime_error(lOSS.str());
-	}
+	Beagle_StackTraceBeginM();
+	DataSet::clear();
+	mLabels.clear();
+	Beagle_StackTraceEndM();
 }
 
 
 /*!
- *  \brief Read data set for regression component.
+ *  \brief Read data set for classification component.
  *  \param inIter XML iterator to use to read the set.
  *  \param ioSystem Evolutionary system.
  */
@@ -113,23 +87,32 @@ void DataSetClassification::readWithSystem(PACC::XML::ConstIterator inIter, Syst
 			throw Beagle_IOExceptionNodeM(*inIter, lOSS.str());
 		}
 	}
-	resize(lCount);
+	clear();
 
 	// Read data set
-	lCount = 0;
+	Beagle::Vector lValues;
+	unsigned int lRow = 0;
 	for(PACC::XML::ConstIterator lChild=inIter->getFirstChild(); lChild; ++lChild) {
 		if((lChild->getType() == PACC::XML::eData) && (lChild->getValue() == "Data")) {
 			std::string lIdAttr = lChild->getAttribute("id");
 			if(lIdAttr.empty()) {
 				throw Beagle_IOExceptionNodeM(*lChild, "id attribute should be provided!");
 			}
-			(*this)[lCount].first = str2int(lIdAttr);
 			PACC::XML::ConstIterator lChild2 = lChild->getFirstChild();
 			if(lChild2->getType() != PACC::XML::eString) {
 				throw Beagle_IOExceptionNodeM(*lChild2, "expected string content!");
 			}
-			(*this)[lCount].second.read(lChild2);
-			++lCount;
+			lValues.read(lChild2);
+			if(lRow == 0) resize(lCount, lValues.size());
+			else if(lValues.size() != getNumberColumns()) {
+				std::ostringstream lOSS;
+				lOSS << "number of values (" << lValues.size() << ") mismatch the number of ";
+				lOSS << "values of the first 'Data' tag (" << getNumberColumns() << ")!";
+				throw Beagle_IOExceptionNodeM(*lChild, lOSS.str());
+			}
+			setRow(lRow, lValues);
+			mLabels[lRow] = str2int(lIdAttr);
+			++lRow;
 		}
 	}
 
@@ -137,9 +120,35 @@ void DataSetClassification::readWithSystem(PACC::XML::ConstIterator inIter, Syst
 }
 
 
+/*!
+ *  \brief Resize the data set, keeping the values of the samples and features preserved.
+ *  \param inSize New number of samples.
+ *  \param inNumberColumns New number of features.
+ */
+void DataSetClassification::resize(unsigned int inSize, unsigned int inNumberColumns)
+{
+	Beagle_StackTraceBeginM();
+	DataSet::resize(inSize, inNumberColumns);
+	mLabels.resize(inSize, 0);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Set the label of a sample read from a CSV file.
+ *  \param inRow Index of the sample.
+ *  \param inValue Value read in the last field of the sample line.
+ */
+void DataSetClassification::setTargetValue(unsigned int inRow, double inValue)
+{
+	Beagle_StackTraceBeginM();
+	mLabels[inRow] = static_cast<int>(inValue);
+	Beagle_StackTraceEndM();
+}
+
 
 /*!
- *  \brief Write data set for regression into XML streamer.
+ *  \brief Write data set for classification into XML streamer.
  *  \param ioStreamer XML streamer.
  *  \param inIndent Indent (or not) XML output.
  */
@@ -147,10 +156,12 @@ void DataSetClassification::writeContent(PACC::XML::Streamer& ioStreamer, bool i
 {
 	Beagle_StackTraceBeginM();
 	ioStreamer.insertAttribute("size", uint2str(size()));
+	Beagle::Vector lValues;
 	for(unsigned int i=0; i<size(); ++i) {
 		ioStreamer.openTag("Data", false);
-		ioStreamer.insertAttribute("id", int2str((*this)[i].first));
-		(*this)[i].second.write(ioStreamer, false);
+		ioStreamer.insertAttribute("id", int2str(mLabels[i]));
+		getRow(i, lValues);
+		lValues.write(ioStreamer, false);
 		ioStreamer.closeTag();
 	}
 	Beagle_StackTraceEndM();
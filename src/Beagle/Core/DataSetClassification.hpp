@@ -39,8 +39,7 @@
 
 #include "Beagle/config.hpp"
 #include "Beagle/macros.hpp"
-#include "Beagle/Core/Component.hpp"
-#include "Beagle/Core/Vector.hpp"
+#include "Beagle/Core/DataSet.hpp"
 #include <vector>
 
 
@@ -51,27 +50,73 @@ namespace Beagle
  *  \class DataSetClassification Beagle/Core/DataSetClassification.hpp "Beagle/Core/DataSetClassification.hpp"
  *  \brief Component of a data set useful for classification problems.
  *  \ingroup Core
+ *
+ *  The features of the samples are stored column by column by the DataSet base class,
+ *  while the labels are stored in a separate contiguous vector.
  */
-class DataSetClassification : public Component, public std::vector< std::pair<int,Beagle::Vector> >
+class DataSetClassification : public DataSet
 {
 
 public:
 
 	//! DataSetClassification allocator type.
-	typedef AllocatorT< DataSetClassification, Component::Alloc > Alloc;
+	typedef AllocatorT< DataSetClassification, DataSet::Alloc > Alloc;
 	//!< DataSetClassification handle type.
-	typedef PointerT< DataSetClassification, Component::Handle > Handle;
+	typedef PointerT< DataSetClassification, DataSet::Handle > Handle;
 	//!< DataSetClassification bag type.
-	typedef ContainerT< DataSetClassification, Component::Bag > Bag;
+	typedef ContainerT< DataSetClassification, DataSet::Bag > Bag;
 
 	explicit DataSetClassification(const std::string& inName=std::string("DataSetClassification"));
 	virtual ~DataSetClassification()
 	{ }
 
-	void readCSV(std::istream& ioIS);
+	virtual void clear();
 	virtual void readWithSystem(PACC::XML::ConstIterator inIter, System& ioSystem);
+	virtual void resize(unsigned int inSize, unsigned int inNumberColumns);
 	virtual void writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
+	/*!
+	 *  \brief Get the label of a sample.
+	 *  \param inN Index of the sample.
+	 *  \return Label of the sample.
+	 */
+	inline int getLabel(unsigned int inN) const
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inN,mLabels.size()-1);
+		return mLabels[inN];
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Get the label of a sample.
+	 *  \param inN Index of the sample.
+	 *  \return Reference to the label of the sample.
+	 */
+	inline int& getLabel(unsigned int inN)
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inN,mLabels.size()-1);
+		return mLabels[inN];
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \return Labels of all the samples.
+	 */
+	inline const std::vector<int>& getLabels() const
+	{
+		Beagle_StackTraceBeginM();
+		return mLabels;
+		Beagle_StackTraceEndM();
+	}
+
+protected:
+
+	virtual void setTargetValue(unsigned int inRow, double inValue);
+
+	std::vector<int> mLabels;  //!< Labels of the samples.
+
 };
 
 }
@@ -36,8 +36,6 @@
 
 #include "Beagle/Core.hpp"
 
-#include <stdexcept>
-
 using namespace Beagle;
 
 
@@ -46,43 +44,19 @@ using namespace Beagle;
  *  \param inName Name of the component.
  */
 DataSetRegression::DataSetRegression(const std::string& inName) :
-	Component(inName)
+	DataSet(inName)
 { }
 
 
 /*!
- *  \brief Read data set from a CVS file.
- *  \param ioIS Input stream referring to CVS file.
+ *  \brief Remove all the samples of the data set.
  */
-void DataSetRegression::readCSV(std::istream& ioIS)
+void DataSetRegression::clear()
 {
-	clear();
-	char lBuf[4096];
-	for(ioIS.getline(lBuf,4096); ioIS.gcount()<4096; ioIS.getline(lBuf,4096)) {
-		std::string lStr(lBuf);
-		if(lStr.empty()) {
-			if(ioIS.good()==false) break;
-			else continue;
-		}
-		resize(size()+1);
-		back().second.resize(0);
-		std::istringstream lISS(lStr);
-		double lDbl=0.0;
-		for(lISS >> lDbl; (lISS.peek()==',') && lISS.good(); lISS >> lDbl) {
-			const unsigned int lSize = back().second.size();
-			back().second.resize(lSize + 1);
-			back().second[lSize] = lDbl;
-			lISS.get();
-		}
-		back().first = lDbl;
-		if(ioIS.good()==false) break;
-	}
-	if(ioIS.gcount() == 4096) {
-		std::ostringstream lOSS;
-		lOSS << "Unable to read data set from given stream, number of characters on one ";
-		lOSS << "line exceed 4096 characters!";
-		throw std::runtime_error(lOSS.str());
-	}
+	Beagle_StackTraceBeginM();
+	DataSet::clear();
+	mTargets.clear();
+	Beagle_StackTraceEndM();
 }
 
 
@@ -113,23 +87,32 @@ void DataSetRegression::readWithSystem(PACC::XML::ConstIterator inIter, System&
 			throw Beagle_IOExceptionNodeM(*inIter, lOSS.str());
 		}
 	}
-	resize(lCount);
+	clear();
 
 	// Read data set
-	lCount = 0;
+	Beagle::Vector lValues;
+	unsigned int lRow = 0;
 	for(PACC::XML::ConstIterator lChild=inIter->getFirstChild(); lChild; ++lChild) {
 		if((lChild->getType() == PACC::XML::eData) && (lChild->getValue() == "Data")) {
 			std::string lTargetAttr = lChild->getAttribute("target");
 			if(lTargetAttr.empty()) {
 				throw Beagle_IOExceptionNodeM(*lChild, "target attribute should be provided!");
 			}
-			(*this)[lCount].first = str2dbl(lTargetAttr);
 			PACC::XML::ConstIterator lChild2 = lChild->getFirstChild();
 			if(lChild2->getType() != PACC::XML::eString) {
 				throw Beagle_IOExceptionNodeM(*lChild2, "expected string content!");
 			}
-			(*this)[lCount].second.read(lChild2);
-			++lCount;
+			lValues.read(lChild2);
+			if(lRow == 0) resize(lCount, lValues.size());
+			else if(lValues.size() != getNumberColumns()) {
+				std::ostringstream lOSS;
+				lOSS << "number of values (" << lValues.size() << ") mismatch the number of ";
+				lOSS << "values of the first 'Data' tag (" << getNumberColumns() << ")!";
+				throw Beagle_IOExceptionNodeM(*lChild, lOSS.str());
+			}
+			setRow(lRow, lValues);
+			mTargets[lRow] = str2dbl(lTargetAttr);
+			++lRow;
 		}
 	}
 
@@ -137,6 +120,32 @@ void DataSetRegression::readWithSystem(PACC::XML::ConstIterator inIter, System&
 }
 
 
+/*!
+ *  \brief Resize the data set, keeping the values of the samples and features preserved.
+ *  \param inSize New number of samples.
+ *  \param inNumberColumns New number of features.
+ */
+void DataSetRegression::resize(unsigned int inSize, unsigned int inNumberColumns)
+{
+	Beagle_StackTraceBeginM();
+	DataSet::resize(inSize, inNumberColumns);
+	mTargets.resize(inSize, 0);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Set the target of a sample read from a CSV file.
+ *  \param inRow Index of the sample.
+ *  \param inValue Value read in the last field of the sample line.
+ */
+void DataSetRegression::setTargetValue(unsigned int inRow, double inValue)
+{
+	Beagle_StackTraceBeginM();
+	mTargets[inRow] = inValue;
+	Beagle_StackTraceEndM();
+}
+
 
 /*!
  *  \brief Write data set for regression into XML streamer.
@@ -147,10 +156,12 @@ void DataSetRegression::writeContent(PACC::XML::Streamer& ioStreamer, bool inInd
 {
 	Beagle_StackTraceBeginM();
 	ioStreamer.insertAttribute("size", uint2str(size()));
+	Beagle::Vector lValues;
 	for(unsigned int i=0; i<size(); ++i) {
 		ioStreamer.openTag("Data", false);
-		ioStreamer.insertAttribute("target", dbl2str((*this)[i].first));
-		(*this)[i].second.write(ioStreamer, false);
+		ioStreamer.insertAttribute("target", dbl2str(mTargets[i]));
+		getRow(i, lValues);
+		lValues.write(ioStreamer, false);
 		ioStreamer.closeTag();
 	}
 	Beagle_StackTraceEndM();
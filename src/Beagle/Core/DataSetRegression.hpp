@@ -39,8 +39,7 @@
 
 #include "Beagle/config.hpp"
 #include "Beagle/macros.hpp"
-#include "Beagle/Core/Vector.hpp"
-#include "Beagle/Core/Component.hpp"
+#include "Beagle/Core/DataSet.hpp"
 #include <vector>
 
 
@@ -51,27 +50,73 @@ namespace Beagle
  *  \class DataSetRegression Beagle/Core/DataSetRegression.hpp "Beagle/Core/DataSetRegression.hpp"
  *  \brief Component of a data set useful for regression problems.
  *  \ingroup Core
+ *
+ *  The features of the samples are stored column by column by the DataSet base class,
+ *  while the targets are stored in a separate contiguous vector.
  */
-class DataSetRegression : public Component, public std::vector< std::pair<double,Beagle::Vector> >
+class DataSetRegression : public DataSet
 {
 
 public:
 
 	//! DataSetRegression allocator type.
-	typedef AllocatorT< DataSetRegression, Component::Alloc > Alloc;
+	typedef AllocatorT< DataSetRegression, DataSet::Alloc > Alloc;
 	//!< DataSetRegression handle type.
-	typedef PointerT< DataSetRegression, Component::Handle > Handle;
+	typedef PointerT< DataSetRegression, DataSet::Handle > Handle;
 	//!< DataSetRegression bag type.
-	typedef ContainerT< DataSetRegression, Component::Bag > Bag;
+	typedef ContainerT< DataSetRegression, DataSet::Bag > Bag;
 
 	explicit DataSetRegression(const std::string& inName=std::string("DataSetRegression"));
 	virtual ~DataSetRegression()
 	{ }
 
-	void readCSV(std::istream& ioIS);
+	virtual void clear();
 	virtual void readWithSystem(PACC::XML::ConstIterator inIter, System& ioSystem);
+	virtual void resize(unsigned int inSize, unsigned int inNumberColumns);
 	virtual void writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
+	/*!
+	 *  \brief Get the target of a sample.
+	 *  \param inN Index of the sample.
+	 *  \return Target of the sample.
+	 */
+	inline double getTarget(unsigned int inN) const
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inN,mTargets.size()-1);
+		return mTargets[inN];
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Get the target of a sample.
+	 *  \param inN Index of the sample.
+	 *  \return Reference to the target of the sample.
+	 */
+	inline double& getTarget(unsigned int inN)
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inN,mTargets.size()-1);
+		return mTargets[inN];
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \return Targets of all the samples.
+	 */
+	inline const std::vector<double>& getTargets() const
+	{
+		Beagle_StackTraceBeginM();
+		return mTargets;
+		Beagle_StackTraceEndM();
+	}
+
+protected:
+
+	virtual void setTargetValue(unsigned int inRow, double inValue);
+
+	std::vector<double> mTargets;  //!< Targets of the samples.
+
 };
 
 }
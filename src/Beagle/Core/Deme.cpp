@@ -240,6 +240,42 @@ void Deme::readPopulation(PACC::XML::ConstIterator inIter, Context& ioContext)
 }
 
 
+/*!
+ *  \brief Read the population of a deme from a binary archive.
+ *  \param ioArchive Binary archive to read the population from.
+ *  \param ioContext Evolutionary context.
+ *  \throw Beagle::IOException If the format is not respected.
+ */
+void Deme::readPopulationBinary(BinaryInArchive& ioArchive, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	const Factory& lFactory = ioContext.getSystem().getFactory();
+	unsigned int lPrevIndividualIndex = ioContext.getIndividualIndex();
+	Individual::Handle lPrevIndividualHandle = ioContext.getIndividualHandle();
+	clear();
+	const unsigned int lNbIndividuals = ioArchive.readUInt();
+	for(unsigned int i=0; i<lNbIndividuals; ++i) {
+		const std::string lIndividualType = ioArchive.readString();
+		Individual::Alloc::Handle lIndividualAlloc =
+		    castHandleT<Individual::Alloc>(lFactory.getAllocator(lIndividualType));
+		if(lIndividualAlloc == NULL) {
+			std::ostringstream lOSS;
+			lOSS << "Type '" << lIndividualType << "' associated to individual object ";
+			lOSS << "is not valid!";
+			throw Beagle_IOExceptionMessageM(lOSS.str());
+		}
+		Individual::Handle lIndividual = castHandleT<Individual>(lIndividualAlloc->allocate());
+		ioContext.setIndividualHandle(lIndividual);
+		ioContext.setIndividualIndex(size());
+		push_back(lIndividual);
+		lIndividual->readBinary(ioArchive, ioContext);
+	}
+	ioContext.setIndividualHandle(lPrevIndividualHandle);
+	ioContext.setIndividualIndex(lPrevIndividualIndex);
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Read a deme from an XML iterator.
  *  \param inIter XML iterator to read the deme from.
@@ -358,3 +394,19 @@ void Deme::writePopulation(PACC::XML::Streamer& ioStreamer, bool inIndent) const
 	Beagle_StackTraceEndM();
 }
 
+
+/*!
+ *  \brief Write the deme population in a binary archive.
+ *  \param ioArchive Binary archive to write the deme population into.
+ */
+void Deme::writePopulationBinary(BinaryOutArchive& ioArchive) const
+{
+	Beagle_StackTraceBeginM();
+	ioArchive.writeUInt(size());
+	for(unsigned int i=0; i<size(); ++i) {
+		Beagle_NonNullPointerAssertM((*this)[i]);
+		ioArchive.writeString((*this)[i]->getType());
+		(*this)[i]->writeBinary(ioArchive);
+	}
+	Beagle_StackTraceEndM();
+}
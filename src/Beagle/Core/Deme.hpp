@@ -87,12 +87,14 @@ public:
 	virtual const std::string&  getType() const;
 	virtual void                readMembers(PACC::XML::ConstIterator inIter, Context& ioContext);
 	virtual void                readPopulation(PACC::XML::ConstIterator inIter, Context& ioContext);
+	virtual void                readPopulationBinary(BinaryInArchive& ioArchive, Context& ioContext);
 	virtual void                readWithContext(PACC::XML::ConstIterator inIter, Context& ioContext);
 	virtual Member::Handle      removeMember(const std::string& inName);
 	virtual void                write(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 	virtual void                writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 	virtual void                writeMembers(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 	virtual void                writePopulation(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
+	virtual void                writePopulationBinary(BinaryOutArchive& ioArchive) const;
 
 	/*!
 	 *  \brief Get an handle to the hall-of-fame.
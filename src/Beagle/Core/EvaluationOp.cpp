@@ -86,7 +86,26 @@ Individual::Handle EvaluationOp::breed(Individual::Bag& inBreedingPool,
 		    "Evaluating the fitness of a new bred individual"
 		);
 
-		lBredIndividual->setFitness(evaluate(*lBredIndividual, ioContext));
+		// Look up the fitness of identical genotypes already evaluated.
+		FitnessCache::Handle lFitnessCache =
+		    castHandleT<FitnessCache>(ioContext.getSystem().haveComponent("FitnessCache"));
+		Fitness::Handle lCachedFitness = NULL;
+		unsigned long lHash = 0;
+		if(lFitnessCache != NULL) {
+			lHash = lBredIndividual->computeHash();
+			lCachedFitness = lFitnessCache->lookup(*lBredIndividual, lHash, ioContext.getSystem());
+		}
+
+		if(lCachedFitness != NULL) {
+			lBredIndividual->setFitness(lCachedFitness);
+		} else {
+			lBredIndividual->setFitness(evaluate(*lBredIndividual, ioContext));
+			if(lFitnessCache != NULL) lFitnessCache->insert(*lBredIndividual, lHash, ioContext.getSystem());
+			ioContext.setProcessedDeme(ioContext.getProcessedDeme()+1);
+			ioContext.setTotalProcessedDeme(ioContext.getTotalProcessedDeme()+1);
+			ioContext.setProcessedVivarium(ioContext.getProcessedVivarium()+1);
+			ioContext.setTotalProcessedVivarium(ioContext.getTotalProcessedVivarium()+1);
+		}
 		lBredIndividual->getFitness()->setValid();
 		History::Handle lHistory = castHandleT<History>(ioContext.getSystem().haveComponent("History"));
 		if(lHistory != NULL) {
@@ -94,11 +113,6 @@ Individual::Handle EvaluationOp::breed(Individual::Bag& inBreedingPool,
 			lHistory->trace(ioContext, std::vector<HistoryID>(), lBredIndividual, getName(), "evaluation");
 		}
 
-		ioContext.setProcessedDeme(ioContext.getProcessedDeme()+1);
-		ioContext.setTotalProcessedDeme(ioContext.getTotalProcessedDeme()+1);
-		ioContext.setProcessedVivarium(ioContext.getProcessedVivarium()+1);
-		ioContext.setTotalProcessedVivarium(ioContext.getTotalProcessedVivarium()+1);
-
 		Beagle_LogVerboseM(ioContext.getSystem().getLogger(), *lBredIndividual->getFitness());
 
 		updateHallOfFameWithIndividual(*lBredIndividual, ioContext);
@@ -123,6 +137,19 @@ double EvaluationOp::getBreedingProba(BreederNode::Handle inChild)
 }
 
 
+/*!
+ *  \brief Return whether the evaluation operator only modifies the deme it is applied on.
+ *  \return True, vivarium members being updated in critical sections.
+ *
+ *  Evaluation operators that share state between demes (i.e. distributed evaluation)
+ *  must over-define this method to return false.
+ */
+bool EvaluationOp::isDemeLocal(void) const
+{
+	return true;
+}
+
+
 /*!
  *  \brief Apply the evaluation process on the invalid individuals of the deme.
  *  \param ioDeme Deme to process.
@@ -144,6 +171,9 @@ void EvaluationOp::operate(Deme& ioDeme, Context& ioContext)
 	History::Handle lHistory = castHandleT<History>(ioContext.getSystem().haveComponent("History"));
 
 	int lNbrEvaluations = 0; // Used to count how many evaluations have been done.
+	int lNbrCacheHits = 0;   // Used to count how many fitness have been found in the cache.
+	FitnessCache::Handle lFitnessCache =
+	    castHandleT<FitnessCache>(ioContext.getSystem().haveComponent("FitnessCache"));
 	const int lSize = ioDeme.size();
 
 #if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
@@ -155,10 +185,10 @@ void EvaluationOp::operate(Deme& ioDeme, Context& ioContext)
 	for(unsigned int i = 0; i < lOpenMP->getMaxNumThreads(); ++i)
 		lContexts[i] = castHandleT<Context>(lContextAlloc->clone(ioContext));
 #if defined(BEAGLE_USE_OMP_NR)
-#pragma omp parallel for reduction(+:lNbrEvaluations) schedule(dynamic)
+#pragma omp parallel for reduction(+:lNbrEvaluations,lNbrCacheHits) schedule(dynamic)
 #elif defined(BEAGLE_USE_OMP_R)
 	const int lChunkSize = std::max((int)(lSize / lOpenMP->getMaxNumThreads()), 1);
-#pragma omp parallel for reduction(+:lNbrEvaluations) schedule(static, lChunkSize)
+#pragma omp parallel for reduction(+:lNbrEvaluations,lNbrCacheHits) schedule(static, lChunkSize)
 #endif
 #endif
 	for(int i=0; i < lSize; ++i) {
@@ -171,15 +201,33 @@ void EvaluationOp::operate(Deme& ioDeme, Context& ioContext)
 			    " individual"
 			);
 
+			// Look up the fitness of identical genotypes already evaluated.
+			Fitness::Handle lCachedFitness = NULL;
+			unsigned long lHash = 0;
+			if(lFitnessCache != NULL) {
+				lHash = ioDeme[i]->computeHash();
+				lCachedFitness = lFitnessCache->lookup(*ioDeme[i], lHash, ioContext.getSystem());
+			}
+
+			if(lCachedFitness != NULL) {
+				ioDeme[i]->setFitness(lCachedFitness);
+				++lNbrCacheHits;
+			} else {
 #if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
-			lContexts[lOpenMP->getThreadNum()]->setIndividualIndex(i);
-			lContexts[lOpenMP->getThreadNum()]->setIndividualHandle(ioDeme[i]);
-			ioDeme[i]->setFitness(evaluate(*ioDeme[i], *lContexts[lOpenMP->getThreadNum()]));
+				Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+				lRandomizer.setStream(ioContext.getGeneration(), ioContext.getDemeIndex(), i, getName());
+				lContexts[lOpenMP->getThreadNum()]->setIndividualIndex(i);
+				lContexts[lOpenMP->getThreadNum()]->setIndividualHandle(ioDeme[i]);
+				ioDeme[i]->setFitness(evaluate(*ioDeme[i], *lContexts[lOpenMP->getThreadNum()]));
+				lRandomizer.clearStream();
 #else
-			ioContext.setIndividualIndex(i);
-			ioContext.setIndividualHandle(ioDeme[i]);
-			ioDeme[i]->setFitness(evaluate(*ioDeme[i], ioContext));
+				ioContext.setIndividualIndex(i);
+				ioContext.setIndividualHandle(ioDeme[i]);
+				ioDeme[i]->setFitness(evaluate(*ioDeme[i], ioContext));
 #endif
+				if(lFitnessCache != NULL) lFitnessCache->insert(*ioDeme[i], lHash, ioContext.getSystem());
+				++lNbrEvaluations;
+			}
 			ioDeme[i]->getFitness()->setValid();
 			if(lHistory != NULL) {
 #pragma omp critical (Beagle_History)
@@ -193,9 +241,6 @@ void EvaluationOp::operate(Deme& ioDeme, Context& ioContext)
 				}
 			}
 
-
-			++lNbrEvaluations;
-
 			Beagle_LogVerboseM(ioContext.getSystem().getLogger(), *ioDeme[i]->getFitness());
 		}
 	}
@@ -206,8 +251,15 @@ void EvaluationOp::operate(Deme& ioDeme, Context& ioContext)
 	updateStats(lNbrEvaluations,ioContext);
 	updateHallOfFameWithDeme(ioDeme,ioContext);
 
+	if(lNbrCacheHits > 0) {
+		Beagle_LogDetailedM(
+		    ioContext.getSystem().getLogger(),
+		    std::string("Fitness of ")+uint2str(lNbrCacheHits)+" individuals found in the fitness cache"
+		);
+	}
+
 	// Warn if the operator has not evaluated anything
-	if(lNbrEvaluations == 0) {
+	if((lNbrEvaluations == 0) && (lNbrCacheHits == 0)) {
 		Beagle_LogBasicM(
 		    ioContext.getSystem().getLogger(),
 		    std::string("Warning!  The '")+getName()+"' operator did not evaluate any individuals.  "+
@@ -250,28 +302,29 @@ void EvaluationOp::prepareStats(Deme& ioDeme, Context& ioContext)
 	}
 
 	if(ioContext.getDemeIndex()==0) {
+#pragma omp critical (Beagle_Vivarium)
+		{
+			Stats::Handle lVivaStats = ioContext.getVivarium().getStats();
+
+			if(lVivaStats == NULL) {
+				const Factory& lFactory = ioContext.getSystem().getFactory();
+				Stats::Alloc::Handle lStatsAlloc =
+				    castHandleT<Stats::Alloc>(lFactory.getConceptAllocator("Stats"));
+				lVivaStats = castHandleT<Stats>(lStatsAlloc->allocate());
+				ioContext.getVivarium().addMember(lVivaStats);
+			}
 
-		Stats::Handle lVivaStats = ioContext.getVivarium().getStats();
-
-		if(lVivaStats == NULL) {
-			const Factory& lFactory = ioContext.getSystem().getFactory();
-			Stats::Alloc::Handle lStatsAlloc =
-			    castHandleT<Stats::Alloc>(lFactory.getConceptAllocator("Stats"));
-			lVivaStats = castHandleT<Stats>(lStatsAlloc->allocate());
-			ioContext.getVivarium().addMember(lVivaStats);
-		}
-
-		if(lVivaStats->isValid()) {
-			ioContext.setProcessedVivarium(0);
-			if((ioContext.getGeneration()!=0) && (lVivaStats->existItem("total-processed"))) {
-				ioContext.setTotalProcessedVivarium((unsigned int)lVivaStats->getItem("total-processed"));
-			} else ioContext.setTotalProcessedVivarium(0);
-			lVivaStats->setInvalid();
-		} else {
-			ioContext.setProcessedVivarium(0);
-			ioContext.setTotalProcessedVivarium(0);
+			if(lVivaStats->isValid()) {
+				ioContext.setProcessedVivarium(0);
+				if((ioContext.getGeneration()!=0) && (lVivaStats->existItem("total-processed"))) {
+					ioContext.setTotalProcessedVivarium((unsigned int)lVivaStats->getItem("total-processed"));
+				} else ioContext.setTotalProcessedVivarium(0);
+				lVivaStats->setInvalid();
+			} else {
+				ioContext.setProcessedVivarium(0);
+				ioContext.setTotalProcessedVivarium(0);
+			}
 		}
-
 	}
 
 	Beagle_StackTraceEndM();
@@ -371,17 +424,20 @@ void EvaluationOp::updateHallOfFameWithDeme(Deme& ioDeme, Context& ioContext)
 		Beagle_LogVerboseM(ioContext.getSystem().getLogger(), *lHoF);
 	}
 	if(mVivaHOFSize->getWrappedValue() > 0) {
-		Beagle_LogDetailedM(ioContext.getSystem().getLogger(), "Updating the vivarium's hall-of-fame");
-		HallOfFame::Handle lHoF = ioContext.getVivarium().getHallOfFame();
-		if(lHoF == NULL) {
-			const Factory& lFactory = ioContext.getSystem().getFactory();
-			const HallOfFame::Alloc::Handle lHoFAlloc =
-			    castHandleT<HallOfFame::Alloc>(lFactory.getConceptAllocator("HallOfFame"));
-			lHoF = castHandleT<HallOfFame>(lHoFAlloc->allocate());
-			ioContext.getVivarium().addMember(lHoF);
+#pragma omp critical (Beagle_Vivarium)
+		{
+			Beagle_LogDetailedM(ioContext.getSystem().getLogger(), "Updating the vivarium's hall-of-fame");
+			HallOfFame::Handle lHoF = ioContext.getVivarium().getHallOfFame();
+			if(lHoF == NULL) {
+				const Factory& lFactory = ioContext.getSystem().getFactory();
+				const HallOfFame::Alloc::Handle lHoFAlloc =
+				    castHandleT<HallOfFame::Alloc>(lFactory.getConceptAllocator("HallOfFame"));
+				lHoF = castHandleT<HallOfFame>(lHoFAlloc->allocate());
+				ioContext.getVivarium().addMember(lHoF);
+			}
+			lHoF->updateWithDeme(mVivaHOFSize->getWrappedValue(), ioDeme, ioContext);
+			Beagle_LogVerboseM(ioContext.getSystem().getLogger(), *lHoF);
 		}
-		lHoF->updateWithDeme(mVivaHOFSize->getWrappedValue(), ioDeme, ioContext);
-		Beagle_LogVerboseM(ioContext.getSystem().getLogger(), *lHoF);
 	}
 	Beagle_StackTraceEndM();
 }
@@ -396,34 +452,41 @@ void EvaluationOp::updateHallOfFameWithIndividual(Individual& ioIndividual, Cont
 {
 	Beagle_StackTraceBeginM();
 	if(mDemeHOFSize->getWrappedValue() > 0) {
-		Beagle_LogVerboseM(
-		    ioContext.getSystem().getLogger(),
-		    "Updating the deme hall-of-fame"
-		);
-		HallOfFame::Handle lHoF = ioContext.getDeme().getHallOfFame();
-		if(lHoF == NULL) {
-			const Factory& lFactory = ioContext.getSystem().getFactory();
-			const HallOfFame::Alloc::Handle lHoFAlloc =
-			    castHandleT<HallOfFame::Alloc>(lFactory.getConceptAllocator("HallOfFame"));
-			lHoF = castHandleT<HallOfFame>(lHoFAlloc->allocate());
-			ioContext.getDeme().addMember(lHoF);
+		// Offsprings may be bred concurrently by the replacement strategies
+#pragma omp critical (Beagle_Deme_HallOfFame)
+		{
+			Beagle_LogVerboseM(
+			    ioContext.getSystem().getLogger(),
+			    "Updating the deme hall-of-fame"
+			);
+			HallOfFame::Handle lHoF = ioContext.getDeme().getHallOfFame();
+			if(lHoF == NULL) {
+				const Factory& lFactory = ioContext.getSystem().getFactory();
+				const HallOfFame::Alloc::Handle lHoFAlloc =
+				    castHandleT<HallOfFame::Alloc>(lFactory.getConceptAllocator("HallOfFame"));
+				lHoF = castHandleT<HallOfFame>(lHoFAlloc->allocate());
+				ioContext.getDeme().addMember(lHoF);
+			}
+			lHoF->updateWithIndividual(mDemeHOFSize->getWrappedValue(), ioIndividual, ioContext);
 		}
-		lHoF->updateWithIndividual(mDemeHOFSize->getWrappedValue(), ioIndividual, ioContext);
 	}
 	if(mVivaHOFSize->getWrappedValue() > 0) {
-		Beagle_LogVerboseM(
-		    ioContext.getSystem().getLogger(),
-		    "Updating the vivarium hall-of-fame"
-		);
-		HallOfFame::Handle lHoF = ioContext.getVivarium().getHallOfFame();
-		if(lHoF == NULL) {
-			const Factory& lFactory = ioContext.getSystem().getFactory();
-			const HallOfFame::Alloc::Handle lHoFAlloc =
-			    castHandleT<HallOfFame::Alloc>(lFactory.getConceptAllocator("HallOfFame"));
-			lHoF = castHandleT<HallOfFame>(lHoFAlloc->allocate());
-			ioContext.getVivarium().addMember(lHoF);
+#pragma omp critical (Beagle_Vivarium)
+		{
+			Beagle_LogVerboseM(
+			    ioContext.getSystem().getLogger(),
+			    "Updating the vivarium hall-of-fame"
+			);
+			HallOfFame::Handle lHoF = ioContext.getVivarium().getHallOfFame();
+			if(lHoF == NULL) {
+				const Factory& lFactory = ioContext.getSystem().getFactory();
+				const HallOfFame::Alloc::Handle lHoFAlloc =
+				    castHandleT<HallOfFame::Alloc>(lFactory.getConceptAllocator("HallOfFame"));
+				lHoF = castHandleT<HallOfFame>(lHoFAlloc->allocate());
+				ioContext.getVivarium().addMember(lHoF);
+			}
+			lHoF->updateWithIndividual(mVivaHOFSize->getWrappedValue(), ioIndividual, ioContext);
 		}
-		lHoF->updateWithIndividual(mVivaHOFSize->getWrappedValue(), ioIndividual, ioContext);
 	}
 	Beagle_StackTraceEndM();
 }
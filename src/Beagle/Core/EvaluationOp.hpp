@@ -54,6 +54,7 @@
 #include "Beagle/Core/Logger.hpp"
 #include "Beagle/Core/BreederOp.hpp"
 #include "Beagle/Core/Double.hpp"
+#include "Beagle/Core/FitnessCache.hpp"
 
 namespace Beagle
 {
@@ -61,6 +62,11 @@ namespace Beagle
 /*!
  *  \class EvaluationOp Beagle/Core/EvaluationOp.hpp "Beagle/Core/EvaluationOp.hpp"
  *  \brief Abstract evaluation operator class.
+ *
+ *  When a FitnessCache component is installed in the system, the fitness of individuals
+ *  identical to recently evaluated ones is taken from the cache instead of calling
+ *  evaluate. Such individuals are not counted as processed.
+ *
  *  \ingroup Core
  *  \ingroup Op
  *  \ingroup FitStats
@@ -96,6 +102,7 @@ public:
 	                                 BreederNode::Handle inChild,
 	                                 Context& ioContext);
 	virtual double             getBreedingProba(BreederNode::Handle inChild);
+	virtual bool               isDemeLocal(void) const;
 	virtual void               registerParams(System& ioSystem);
 	virtual void               operate(Deme& ioDeme, Context& ioContext);
 	virtual Fitness::Handle    test(Individual::Handle inIndividual, System::Handle ioSystem);
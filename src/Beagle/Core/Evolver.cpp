@@ -140,6 +140,18 @@ void Evolver::evolve(Vivarium::Handle ioVivarium, System::Handle ioSystem)
 		lEvolContext->setGeneration(lGeneration);
 	}
 
+#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
+	// Evolve the demes concurrently up to the termination, skipping the sequential loop below.
+	if(mParallelDemes->getWrappedValue() && (ioVivarium->size() > 1)) {
+		if(ioSystem->haveComponent("History") != NULL) {
+			Beagle_LogBasicM(
+			    ioSystem->getLogger(),
+			    "Warning!  Demes are processed sequentially, as the history component is not thread-safe."
+			);
+		} else evolveDemesInParallel(*ioVivarium, *lEvolContext);
+	}
+#endif
+
 	while( lEvolContext->getContinueFlag() ) {
 		unsigned int lGeneration = lEvolContext->getGeneration();
 		lEvolContext->setSelectionIndex(0);
@@ -249,6 +261,132 @@ void Evolver::evolve(Vivarium::Handle ioVivarium, System::Handle ioSystem)
 }
 
 
+#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
+/*!
+ *  \brief Evolve the demes of a vivarium concurrently, until the evolution is terminated.
+ *  \param ioVivarium Vivarium to evolve.
+ *  \param ioEvolContext Evolution context, with continue flag set to false on return.
+ *
+ *  Each deme is processed with its own context. The operator sets are split into
+ *  sequences of consecutive deme-local operators (see Operator::isDemeLocal), which are
+ *  applied on all the demes concurrently, and sequences of other operators (migration,
+ *  statistics, termination, milestone, etc.), which are applied deme by deme once every
+ *  deme has reached them. The vivarium processed counters of the contexts are summed over
+ *  the demes at each of these barriers. With reproducible OpenMP mode, demes are
+ *  statically assigned to the threads, so that each deme draws its random numbers from
+ *  the same randomizer stream from one run to another.
+ */
+void Evolver::evolveDemesInParallel(Vivarium& ioVivarium, Context& ioEvolContext)
+{
+	Beagle_StackTraceBeginM();
+
+	System& lSystem = ioEvolContext.getSystem();
+	OpenMP::Handle lOpenMP = castHandleT<OpenMP>(lSystem.getComponent("OpenMP"));
+	Context::Alloc::Handle lContextAlloc =
+	    castHandleT<Context::Alloc>(lSystem.getFactory().getConceptAllocator("Context"));
+	const int lNbDemes = ioVivarium.size();
+	Context::Bag lDemeContexts(lNbDemes);
+	for(int i=0; i<lNbDemes; ++i) {
+		lDemeContexts[i] = castHandleT<Context>(lContextAlloc->clone(ioEvolContext));
+		lDemeContexts[i]->setDemeIndex(i);
+		lDemeContexts[i]->setDemeHandle(ioVivarium[i]);
+	}
+
+	Beagle_LogInfoM(
+	    lSystem.getLogger(),
+	    std::string("Processing the ")+uint2str(lNbDemes)+" demes in parallel using "+
+	    uint2str(lOpenMP->getMaxNumThreads())+" threads"
+	);
+
+	while(ioEvolContext.getContinueFlag()) {
+		const unsigned int lGeneration = ioEvolContext.getGeneration();
+		const int lFirstDeme = ioEvolContext.getDemeIndex();
+		Operator::Bag& lOperators = (lGeneration == 0) ? mBootStrapSet : mMainLoopSet;
+
+		Beagle_LogBasicM(
+		    lSystem.getLogger(),
+		    std::string("Evolving generation ")+uint2str(lGeneration)
+		);
+		for(int i=lFirstDeme; i<lNbDemes; ++i) {
+			lDemeContexts[i]->setGeneration(lGeneration);
+			lDemeContexts[i]->setSelectionIndex(0);
+		}
+
+		unsigned int j=0;
+		while((j<lOperators.size()) && ioEvolContext.getContinueFlag()) {
+			const bool lDemeLocal = lOperators[j]->isDemeLocal();
+			unsigned int lEnd = j+1;
+			while((lEnd<lOperators.size()) && (lOperators[lEnd]->isDemeLocal() == lDemeLocal)) ++lEnd;
+
+			if(lDemeLocal) {
+#if defined(BEAGLE_USE_OMP_NR)
+#pragma omp parallel for num_threads(lOpenMP->getMaxNumThreads()) schedule(dynamic)
+#elif defined(BEAGLE_USE_OMP_R)
+#pragma omp parallel for num_threads(lOpenMP->getMaxNumThreads()) schedule(static, 1)
+#endif
+				for(int i=lFirstDeme; i<lNbDemes; ++i) {
+					for(unsigned int k=j; k<lEnd; ++k) {
+						Beagle_LogDetailedM(
+						    lSystem.getLogger(),
+						    std::string("Applying '")+lOperators[k]->getName()+"' to the "+
+						    uint2ordinal(i+1)+" deme"
+						);
+						lOperators[k]->operate(*ioVivarium[i], *lDemeContexts[i]);
+					}
+				}
+				unsigned int lProcessed = 0;
+				unsigned int lTotalProcessed = 0;
+				for(int i=0; i<lNbDemes; ++i) {
+					lProcessed += lDemeContexts[i]->getProcessedDeme();
+					lTotalProcessed += lDemeContexts[i]->getTotalProcessedDeme();
+				}
+				for(int i=0; i<lNbDemes; ++i) {
+					lDemeContexts[i]->setProcessedVivarium(lProcessed);
+					lDemeContexts[i]->setTotalProcessedVivarium(lTotalProcessed);
+				}
+			} else {
+				for(int i=lFirstDeme; i<lNbDemes; ++i) {
+					for(unsigned int k=j; k<lEnd; ++k) {
+						Beagle_LogDetailedM(
+						    lSystem.getLogger(),
+						    std::string("Applying '")+lOperators[k]->getName()+"' to the "+
+						    uint2ordinal(i+1)+" deme"
+						);
+						lOperators[k]->operate(*ioVivarium[i], *lDemeContexts[i]);
+					}
+					if(lDemeContexts[i]->getContinueFlag() == false) break;
+				}
+			}
+
+			for(int i=lFirstDeme; i<lNbDemes; ++i) {
+				if(lDemeContexts[i]->getContinueFlag() == false) {
+					ioEvolContext.setContinueFlag(false);
+					if(lDemeContexts[i]->isTerminationSuccessful()) ioEvolContext.setTerminationSuccessful();
+				}
+			}
+			if(mConfigChanged) {
+				Beagle_LogBasicM(
+				    lSystem.getLogger(),
+				    "Evolver configuration changed after applying '" <<
+				    lOperators[lEnd-1]->getName() << "' operator"
+				);
+				Beagle_LogDetailedM(lSystem.getLogger(), (*this));
+				mConfigChanged = false;
+			}
+			j = lEnd;
+		}
+
+		if(ioEvolContext.getContinueFlag()) {
+			ioEvolContext.setGeneration(lGeneration+1);
+			ioEvolContext.setDemeIndex(0);
+		}
+	}
+
+	Beagle_StackTraceEndM();
+}
+#endif
+
+
 /*!
  *  \brief Initialize the evolver, its operators and the system.
  *  \param ioSystem Handle to the system of the evolution.
@@ -924,6 +1062,23 @@ void Evolver::registerParams(System& ioSystem)
 		            (ioSystem.getRegister().insertEntry("ec.test.indi", new String(""), lDescription));
 	}
 
+#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
+	// Add parallel demes parameter
+	{
+		Register::Description lDescription(
+		    "Process demes in parallel",
+		    "Bool",
+		    "0",
+		    std::string("If true, the deme-local operators are applied concurrently on all the demes of ")+
+		    std::string("the vivarium, each deme having its own context. Other operators, such as migration, ")+
+		    std::string("statistics and termination operators, are applied deme by deme once every deme has ")+
+		    std::string("reached them. Demes are processed sequentially when the history is traced.")
+		);
+		mParallelDemes = castHandleT<Bool>
+		                 (ioSystem.getRegister().insertEntry("ec.omp.demes", new Bool(false), lDescription));
+	}
+#endif
+
 	// register bootstrap and main-loop operator set parameters
 	registerOperatorParams(ioSystem);
 
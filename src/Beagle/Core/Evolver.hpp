@@ -55,6 +55,7 @@
 #include "Beagle/Core/OperatorMap.hpp"
 #include "Beagle/Core/Vivarium.hpp"
 #include "Beagle/Core/UInt.hpp"
+#include "Beagle/Core/Bool.hpp"
 #include "Beagle/Core/Package.hpp"
 
 
@@ -125,6 +126,9 @@ public:
 
 protected:
 
+#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
+	void evolveDemesInParallel(Vivarium& ioVivarium, Context& ioEvolContext);
+#endif
 	void logWelcomeMessages(System& ioSystem);
 	void parseCommandLine(System& ioSystem, int inArgc, char** inArgv);
 	void readMilestone(const std::string& inFileName, System& ioSystem);
@@ -141,6 +145,7 @@ protected:
 	Operator::Bag      mMainLoopSet;       //!< Main-loop operator set.
 	UIntArray::Handle  mPopSize;           //!< Population size for the evolution.
 	String::Handle     mTestIndi;          //!< File name of indi to test.
+	Bool::Handle       mParallelDemes;     //!< Flag to process the demes in parallel.
 	std::string        mVivariumFileName;  //!< File from which vivarium can be read.
 	unsigned int       mGeneration;        //!< Generation number of evolution
 	unsigned int       mDemeIndex;         //!< Deme index of evolution
@@ -0,0 +1,256 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/Core/FitnessCache.cpp
+ *  \brief  Source code of class FitnessCache.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/Core.hpp"
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Construct a fitness cache.
+ */
+FitnessCache::FitnessCache() :
+	Component("FitnessCache"),
+	mNbHits(0),
+	mNbLookups(0)
+{ }
+
+
+/*!
+ *  \brief Remove all the entries of the cache and reset the lookup counters.
+ */
+void FitnessCache::clear()
+{
+	Beagle_StackTraceBeginM();
+#pragma omp critical (Beagle_FitnessCache)
+	{
+		mIndex.clear();
+		mEntries.clear();
+		mNbHits = 0;
+		mNbLookups = 0;
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Find the entry of the cache with the same genotypes than given individual.
+ *  \param inIndividual Individual to look for.
+ *  \param inHash Hash value of the genotypes of the individual.
+ *  \return Iterator to the entry found, end of the entries if there is none.
+ */
+FitnessCache::EntryList::iterator FitnessCache::find(const Individual& inIndividual,
+                                                     unsigned long inHash)
+{
+	Beagle_StackTraceBeginM();
+	std::pair<HashIndex::iterator,HashIndex::iterator> lRange = mIndex.equal_range(inHash);
+	for(HashIndex::iterator lIter=lRange.first; lIter!=lRange.second; ++lIter) {
+		const Genotype::Bag& lGenotypes = lIter->second->mGenotypes;
+		if(lGenotypes.size() != inIndividual.size()) continue;
+		bool lIdentical = true;
+		for(unsigned int i=0; i<lGenotypes.size(); ++i) {
+			if(lGenotypes[i]->isEqual(*inIndividual[i]) == false) {
+				lIdentical = false;
+				break;
+			}
+		}
+		if(lIdentical) return lIter->second;
+	}
+	return mEntries.end();
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the ratio of lookups that found a cached fitness.
+ *  \return Hit rate of the cache, 0 if no lookup has been made.
+ */
+double FitnessCache::getHitRate() const
+{
+	Beagle_StackTraceBeginM();
+	if(mNbLookups == 0) return 0.0;
+	return double(mNbHits) / double(mNbLookups);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the number of lookups that found a cached fitness.
+ *  \return Number of hits since the cache has been initialized.
+ */
+unsigned long FitnessCache::getNbHits() const
+{
+	Beagle_StackTraceBeginM();
+	return mNbHits;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the number of lookups made in the cache.
+ *  \return Number of lookups since the cache has been initialized.
+ */
+unsigned long FitnessCache::getNbLookups() const
+{
+	Beagle_StackTraceBeginM();
+	return mNbLookups;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Memorize the fitness of an evaluated individual.
+ *  \param inIndividual Evaluated individual.
+ *  \param inHash Hash value of the genotypes of the individual.
+ *  \param ioSystem Evolutionary system.
+ *
+ *  The genotypes and the fitness of the individual are copied, the least recently
+ *  used entry being evicted when the cache is full.
+ */
+void FitnessCache::insert(const Individual& inIndividual, unsigned long inHash, System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_NonNullPointerAssertM(mCacheSize);
+	Beagle_NonNullPointerAssertM(inIndividual.getFitness());
+	const unsigned int lCacheSize = mCacheSize->getWrappedValue();
+	if(lCacheSize == 0) return;
+
+	// Copy genotypes and fitness outside of the critical section.
+	const Factory& lFactory = ioSystem.getFactory();
+	Entry lEntry;
+	lEntry.mHash = inHash;
+	lEntry.mGenotypes.resize(inIndividual.size());
+	for(unsigned int i=0; i<inIndividual.size(); ++i) {
+		Genotype::Alloc::Handle lGenotypeAlloc =
+		    castHandleT<Genotype::Alloc>(lFactory.getAllocator(inIndividual[i]->getType()));
+		lEntry.mGenotypes[i] = castHandleT<Genotype>(lGenotypeAlloc->allocate());
+		lEntry.mGenotypes[i]->copy(*inIndividual[i], ioSystem);
+	}
+	Fitness::Alloc::Handle lFitnessAlloc =
+	    castHandleT<Fitness::Alloc>(lFactory.getAllocator(inIndividual.getFitness()->getType()));
+	lEntry.mFitness = castHandleT<Fitness>(lFitnessAlloc->allocate());
+	lEntry.mFitness->copy(*inIndividual.getFitness(), ioSystem);
+	lEntry.mFitness->setValid();
+
+#pragma omp critical (Beagle_FitnessCache)
+	{
+		EntryList::iterator lFound = find(inIndividual, inHash);
+		if(lFound != mEntries.end()) {
+			lFound->mFitness = lEntry.mFitness;
+			mEntries.splice(mEntries.begin(), mEntries, lFound);
+		} else {
+			mEntries.push_front(lEntry);
+			mIndex.insert(std::make_pair(inHash, mEntries.begin()));
+			while(mIndex.size() > lCacheSize) {
+				EntryList::iterator lOldest = --mEntries.end();
+				std::pair<HashIndex::iterator,HashIndex::iterator> lRange = mIndex.equal_range(lOldest->mHash);
+				for(HashIndex::iterator lIter=lRange.first; lIter!=lRange.second; ++lIter) {
+					if(lIter->second == lOldest) {
+						mIndex.erase(lIter);
+						break;
+					}
+				}
+				mEntries.erase(lOldest);
+			}
+		}
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Look up the fitness of an individual in the cache.
+ *  \param inIndividual Individual to look for.
+ *  \param inHash Hash value of the genotypes of the individual.
+ *  \param ioSystem Evolutionary system.
+ *  \return Copy of the cached fitness, NULL if the genotypes are not in the cache.
+ */
+Fitness::Handle FitnessCache::lookup(const Individual& inIndividual, unsigned long inHash, System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_NonNullPointerAssertM(mCacheSize);
+	if(mCacheSize->getWrappedValue() == 0) return NULL;
+
+	// Only take a handle to the cached fitness in the critical section. Cached fitnesses
+	// are never modified, an insertion replacing the handle, so it can be copied after.
+	Fitness::Handle lCached = NULL;
+#pragma omp critical (Beagle_FitnessCache)
+	{
+		++mNbLookups;
+		EntryList::iterator lFound = find(inIndividual, inHash);
+		if(lFound != mEntries.end()) {
+			++mNbHits;
+			mEntries.splice(mEntries.begin(), mEntries, lFound);
+			lCached = lFound->mFitness;
+		}
+	}
+	if(lCached == NULL) return NULL;
+
+	const Factory& lFactory = ioSystem.getFactory();
+	Fitness::Alloc::Handle lFitnessAlloc =
+	    castHandleT<Fitness::Alloc>(lFactory.getAllocator(lCached->getType()));
+	Fitness::Handle lFitness = castHandleT<Fitness>(lFitnessAlloc->allocate());
+	lFitness->copy(*lCached, ioSystem);
+	return lFitness;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Register the parameters of the fitness cache.
+ *  \param ioSystem Evolutionary system.
+ */
+void FitnessCache::registerParams(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_LogDetailedM(
+	    ioSystem.getLogger(),
+	    "Initializing fitness cache component"
+	);
+	{
+		std::ostringstream lOSS;
+		lOSS << "Maximum number of fitness values memorized by the fitness cache. ";
+		lOSS << "When the cache is full, the least recently used value is evicted. ";
+		lOSS << "A value of 0 disables the cache.";
+		Register::Description lDescription(
+		    "Fitness cache size",
+		    "UInt",
+		    "10000",
+		    lOSS.str()
+		);
+		mCacheSize = castHandleT<UInt>(
+		                 ioSystem.getRegister().insertEntry("ec.eval.cache.size", new UInt(10000), lDescription));
+	}
+	clear();
+	Beagle_StackTraceEndM();
+}
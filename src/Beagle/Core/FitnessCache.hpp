@@ -0,0 +1,138 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/Core/FitnessCache.hpp
+ *  \brief  Definition of the class FitnessCache.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_Core_FitnessCache_hpp
+#define Beagle_Core_FitnessCache_hpp
+
+#include <list>
+#include <map>
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+#include "Beagle/Core/Object.hpp"
+#include "Beagle/Core/AllocatorT.hpp"
+#include "Beagle/Core/PointerT.hpp"
+#include "Beagle/Core/ContainerT.hpp"
+#include "Beagle/Core/Component.hpp"
+#include "Beagle/Core/UInt.hpp"
+#include "Beagle/Core/Genotype.hpp"
+#include "Beagle/Core/Fitness.hpp"
+#include "Beagle/Core/Individual.hpp"
+
+
+namespace Beagle
+{
+
+// Forward declaration
+class System;
+
+/*!
+ *  \class FitnessCache Beagle/Core/FitnessCache.hpp "Beagle/Core/FitnessCache.hpp"
+ *  \brief System component memorizing the fitness of recently evaluated genotypes.
+ *
+ *  When this component is installed in the system, evaluation operators look up the
+ *  fitness of individuals to evaluate in the cache before calling the evaluation
+ *  function, and skip evaluation of individuals whose genotypes are identical to ones
+ *  recently evaluated. Entries are indexed by the hash value of the genotypes
+ *  (see Individual::computeHash), collisions being resolved by comparing the genotypes.
+ *  The cache holds at most \c ec.eval.cache.size entries, the least recently used entry
+ *  being evicted first.
+ *
+ *  \code
+ *  Beagle::System::Handle lSystem = new System;
+ *  lSystem->addComponent(new Beagle::FitnessCache());
+ *  \endcode
+ *
+ *  The cache assumes a deterministic evaluation function; it must not be used when the
+ *  fitness of a genotype changes over time (noisy or coevolutionary evaluation).
+ *  Lookups and insertions are done in an OpenMP critical section, so the cache can be
+ *  shared by evaluation threads.
+ *
+ *  \ingroup Core
+ *  \ingroup Sys
+ *  \ingroup FitStats
+ */
+class FitnessCache : public Component
+{
+
+public:
+
+	//! FitnessCache allocator type.
+	typedef AllocatorT<FitnessCache,Component::Alloc> Alloc;
+	//! FitnessCache handle type.
+	typedef PointerT<FitnessCache,Component::Handle> Handle;
+	//! FitnessCache bag type.
+	typedef ContainerT<FitnessCache,Component::Bag> Bag;
+
+	explicit FitnessCache();
+	virtual ~FitnessCache()
+	{ }
+
+	void                  clear();
+	double                getHitRate() const;
+	unsigned long         getNbHits() const;
+	unsigned long         getNbLookups() const;
+	void                  insert(const Individual& inIndividual, unsigned long inHash, System& ioSystem);
+	Fitness::Handle       lookup(const Individual& inIndividual, unsigned long inHash, System& ioSystem);
+	virtual void          registerParams(System& ioSystem);
+
+protected:
+
+	/*!
+	 *  \brief Fitness memorized for a genotype.
+	 */
+	struct Entry
+	{
+		unsigned long    mHash;        //!< Hash value of the genotypes.
+		Genotype::Bag    mGenotypes;   //!< Copy of the genotypes evaluated.
+		Fitness::Handle  mFitness;     //!< Fitness value of the genotypes.
+	};
+
+	//! Entries, from the most to the least recently used.
+	typedef std::list<Entry> EntryList;
+	//! Entries indexed by hash value of the genotypes.
+	typedef std::multimap<unsigned long,EntryList::iterator> HashIndex;
+
+	EntryList::iterator find(const Individual& inIndividual, unsigned long inHash);
+
+	EntryList      mEntries;      //!< Cached entries, from the most to the least recently used.
+	HashIndex      mIndex;        //!< Cached entries indexed by hash value.
+	UInt::Handle   mCacheSize;    //!< Maximum number of entries in the cache.
+	unsigned long  mNbHits;       //!< Number of successful lookups.
+	unsigned long  mNbLookups;    //!< Total number of lookups.
+
+};
+
+}
+
+#endif // Beagle_Core_FitnessCache_hpp
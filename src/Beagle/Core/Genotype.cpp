@@ -40,6 +40,21 @@
 using namespace Beagle;
 
 
+/*!
+ *  \brief Compute a hash value of the structure of the genotype.
+ *  \return Hash value, equal for genotypes that are equal.
+ *
+ *  The basic implementation hashes the XML serialization of the genotype. Genotypes
+ *  should override it with a direct hash of their content, consistent with isEqual.
+ */
+unsigned long Genotype::computeHash() const
+{
+	Beagle_StackTraceBeginM();
+	return HashString()(serialize());
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Get the name of the member concept.
  *  \return Member concept name, "Genotype".
@@ -82,6 +82,7 @@ public:
 	virtual ~Genotype()
 	{ }
 
+	virtual unsigned long       computeHash() const;
 	virtual const std::string&  getName() const;
 	virtual unsigned int        getSize() const;
 	virtual void				swap(unsigned int inI, unsigned int inJ);
@@ -89,6 +90,16 @@ public:
 	virtual void                write(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 	virtual void                writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
+	/*!
+	 *  \brief Mix a value into a hash value.
+	 *  \param inSeed Hash value computed so far.
+	 *  \param inValue Value to mix in.
+	 *  \return New hash value.
+	 */
+	static inline unsigned long combineHash(unsigned long inSeed, unsigned long inValue) {
+		return inSeed ^ (inValue + 0x9e3779b9UL + (inSeed << 6) + (inSeed >> 2));
+	}
+
 };
 
 }
@@ -54,7 +54,9 @@ HallOfFame::Entry::Entry(Individual::Handle inIndividual,
                          unsigned int inDemeIndex) :
 	mIndividual(inIndividual),
 	mGeneration(inGeneration),
-	mDemeIndex(inDemeIndex)
+	mDemeIndex(inDemeIndex),
+	mHash(0),
+	mHashed(NULL)
 { }
 
 
@@ -122,6 +124,22 @@ HallOfFame::HallOfFame(unsigned int inN, const HallOfFame::Entry& inModel) :
 { }
 
 
+/*!
+ *  \brief Index the members of the hall-of-fame by the hash value of their genotypes.
+ *  \param outIndex Index of the members.
+ */
+void HallOfFame::buildHashIndex(HallOfFame::HashIndex& outIndex)
+{
+	Beagle_StackTraceBeginM();
+	outIndex.clear();
+	for(unsigned int i=0; i<mEntries.size(); ++i) {
+		const unsigned long lHash = getEntryHash(mEntries[i]);
+		outIndex.insert(std::make_pair(lHash, mEntries[i].mIndividual.getPointer()));
+	}
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Copy a hall-of-fame into current one.
  *  \param inOriginal Hall-of-fame to copy.
@@ -147,6 +165,27 @@ void HallOfFame::copy(const Member& inOriginal, System& ioSystem)
 }
 
 
+/*!
+ *  \brief Get hash value of the genotypes of an hall-of-fame member.
+ *  \param ioEntry Hall-of-fame member.
+ *  \return Hash value of the member genotypes.
+ *
+ *  The hash value is cached in the entry, and recomputed only when the individual
+ *  of the entry has been replaced since the last call. Individuals of the hall-of-fame
+ *  are private copies, which are not modified in place.
+ */
+unsigned long HallOfFame::getEntryHash(HallOfFame::Entry& ioEntry)
+{
+	Beagle_StackTraceBeginM();
+	if(ioEntry.mHashed != ioEntry.mIndividual.getPointer()) {
+		ioEntry.mHash = ioEntry.mIndividual->computeHash();
+		ioEntry.mHashed = ioEntry.mIndividual.getPointer();
+	}
+	return ioEntry.mHash;
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Get name of object.
  *  \return Object name, "HallOfFame".
@@ -173,6 +212,27 @@ const std::string& HallOfFame::getType() const
 }
 
 
+/*!
+ *  \brief Test whether an individual is identical to a member of the hall-of-fame.
+ *  \param inIndex Members of the hall-of-fame, indexed by hash value.
+ *  \param inIndividual Individual to look for.
+ *  \param inHash Hash value of the genotypes of the individual.
+ *  \return True if an identical individual is in the index, false if not.
+ */
+bool HallOfFame::isInHashIndex(const HallOfFame::HashIndex& inIndex,
+                               const Individual& inIndividual,
+                               unsigned long inHash)
+{
+	Beagle_StackTraceBeginM();
+	std::pair<HashIndex::const_iterator,HashIndex::const_iterator> lRange = inIndex.equal_range(inHash);
+	for(HashIndex::const_iterator lIter=lRange.first; lIter!=lRange.second; ++lIter) {
+		if(inIndividual.isIdentical(*lIter->second)) return true;
+	}
+	return false;
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Read a hall-of-fame from an XML subtree.
  *  \param inIter XML iterator to read the hall-of-fame from.
@@ -287,6 +347,10 @@ bool HallOfFame::updateWithDeme(unsigned int inSizeHOF, const Deme& inDeme, Cont
 		lHOFModified = true;
 	}
 
+	// Index the members by hash value of their genotypes, to detect duplicates.
+	HashIndex lHashIndex;
+	buildHashIndex(lHashIndex);
+
 	// Temporary buffer of individuals.
 	Individual::Bag lTempPop;
 	// Insert pointer of all the individuals of the deme in the buffer.
@@ -299,14 +363,9 @@ bool HallOfFame::updateWithDeme(unsigned int inSizeHOF, const Deme& inDeme, Cont
 	while((lTempPop.empty() == false) && (mEntries.size() < inSizeHOF)) {
 
 		// Test if individual on the top of the heap is identical to one
-		// individual in the heap.
-		bool lIsIdentical = false;
-		for(unsigned int i=0; i<mEntries.size(); i++) {
-			if(lTempPop[0]->isIdentical(*mEntries[i].mIndividual)) {
-				lIsIdentical = true;
-				break;
-			}
-		}
+		// individual in the heap, deep comparing only those with the same hash value.
+		const unsigned long lHash = lTempPop[0]->computeHash();
+		const bool lIsIdentical = isInHashIndex(lHashIndex, *lTempPop[0], lHash);
 
 		// If the individual on the top of the heap is not identical, add it to the
 		// new HOF.
@@ -324,6 +383,9 @@ bool HallOfFame::updateWithDeme(unsigned int inSizeHOF, const Deme& inDeme, Cont
 			Individual::Handle lIndivCopy = castHandleT<Individual>(lIndividualAlloc->allocate());
 			lIndivCopy->copy(*lTempPop[0], ioContext.getSystem());
 			HallOfFame::Entry lEntry(lIndivCopy, ioContext.getGeneration(), ioContext.getDemeIndex());
+			lEntry.mHash = lHash;
+			lEntry.mHashed = lIndivCopy.getPointer();
+			lHashIndex.insert(std::make_pair(lHash, lEntry.mHashed));
 			mEntries.push_back(lEntry);
 			std::push_heap(mEntries.begin(), mEntries.end(), std::greater<HallOfFame::Entry>());
 			Beagle_LogDebugM(ioContext.getSystem().getLogger(), *lTempPop[0]);
@@ -343,14 +405,9 @@ bool HallOfFame::updateWithDeme(unsigned int inSizeHOF, const Deme& inDeme, Cont
 	while((lTempPop.empty() == false) && (mEntries[0].mIndividual->isLess(*lTempPop[0]))) {
 
 		// Test if individual on the top of the heap is identical to one
-		// individual in the heap.
-		bool lIsIdentical = false;
-		for(unsigned int i=0; i<mEntries.size(); i++) {
-			if(lTempPop[0]->isIdentical(*mEntries[i].mIndividual)) {
-				lIsIdentical = true;
-				break;
-			}
-		}
+		// individual in the heap, deep comparing only those with the same hash value.
+		const unsigned long lHash = lTempPop[0]->computeHash();
+		const bool lIsIdentical = isInHashIndex(lHashIndex, *lTempPop[0], lHash);
 
 		// If the individual on the top of the heap is not identical, add it to the
 		// new HOF.
@@ -359,6 +416,14 @@ bool HallOfFame::updateWithDeme(unsigned int inSizeHOF, const Deme& inDeme, Cont
 			std::pop_heap(mEntries.begin(), mEntries.end(), std::greater<HallOfFame::Entry>());
 			
 			Beagle_LogDebugM(ioContext.getSystem().getLogger(), *mEntries.back().mIndividual);
+			const unsigned long lOldHash = getEntryHash(mEntries.back());
+			std::pair<HashIndex::iterator,HashIndex::iterator> lRange = lHashIndex.equal_range(lOldHash);
+			for(HashIndex::iterator lIter=lRange.first; lIter!=lRange.second; ++lIter) {
+				if(lIter->second == mEntries.back().mIndividual.getPointer()) {
+					lHashIndex.erase(lIter);
+					break;
+				}
+			}
 
 			// Replace the popped individual with the best of the temporary buffer.
 			const Factory& lFactory = ioContext.getSystem().getFactory();
@@ -371,10 +436,14 @@ bool HallOfFame::updateWithDeme(unsigned int inSizeHOF, const Deme& inDeme, Cont
 				lOSS << "is not valid!";
 				throw Beagle_RunTimeExceptionM(lOSS.str());
 			}
-			mEntries.back().mIndividual = castHandleT<Individual>(lIndividualAlloc->allocate());
+			lIndividualAlloc->recycle(*mEntries.back().mIndividual);
+			mEntries.back().mIndividual = castHandleT<Individual>(lIndividualAlloc->allocateRecycled());
 			mEntries.back().mIndividual->copy(*lTempPop[0], ioContext.getSystem());
 			mEntries.back().mGeneration = ioContext.getGeneration();
 			mEntries.back().mDemeIndex  = ioContext.getDemeIndex();
+			mEntries.back().mHash       = lHash;
+			mEntries.back().mHashed     = mEntries.back().mIndividual.getPointer();
+			lHashIndex.insert(std::make_pair(lHash, mEntries.back().mHashed));
 
 			Beagle_LogDebugM(ioContext.getSystem().getLogger(), *lTempPop[0]);
 
@@ -430,9 +499,10 @@ bool HallOfFame::updateWithIndividual(unsigned int inSizeHOF,
 
 	bool lHOFModified = false;
 	if(mEntries.empty() || mEntries[0].mIndividual->isLess(inIndividual)) {
+		const unsigned long lHash = inIndividual.computeHash();
 		bool lIsIdentical = false;
 		for(unsigned int i=0; i<mEntries.size(); ++i) {
-			if(inIndividual.isIdentical(*mEntries[i].mIndividual)) {
+			if((getEntryHash(mEntries[i]) == lHash) && inIndividual.isIdentical(*mEntries[i].mIndividual)) {
 				lIsIdentical = true;
 				break;
 			}
@@ -459,6 +529,8 @@ bool HallOfFame::updateWithIndividual(unsigned int inSizeHOF,
 			lEntry.mIndividual->copy(inIndividual, ioContext.getSystem());
 			lEntry.mGeneration = ioContext.getGeneration();
 			lEntry.mDemeIndex  = ioContext.getDemeIndex();
+			lEntry.mHash       = lHash;
+			lEntry.mHashed     = lEntry.mIndividual.getPointer();
 			mEntries.push_back(lEntry);
 			std::push_heap(mEntries.begin(), mEntries.end(), std::greater<HallOfFame::Entry>());
 			lHOFModified = true;
@@ -38,6 +38,8 @@
 #ifndef Beagle_Core_HallOfFame_hpp
 #define Beagle_Core_HallOfFame_hpp
 
+#include <map>
+
 #include "Beagle/config.hpp"
 #include "Beagle/macros.hpp"
 #include "Beagle/Core/Object.hpp"
@@ -77,6 +79,8 @@ public:
 		Individual::Handle mIndividual;    //!< Individual member of the hall-of-fame.
 		unsigned int       mGeneration;    //!< Generation of introduction in the hall-of-fame.
 		unsigned int       mDemeIndex;     //!< Deme index to which the member belong.
+		unsigned long      mHash;          //!< Cached hash value of the genotypes of the member.
+		const Individual*  mHashed;        //!< Individual for which the cached hash value was computed.
 
 		Entry(Individual::Handle inIndividual=NULL,
 		      unsigned int inGeneration=0,
@@ -151,6 +155,15 @@ public:
 
 protected:
 
+	//! Members of the hall-of-fame indexed by the hash value of their genotypes.
+	typedef std::multimap< unsigned long, const Individual* > HashIndex;
+
+	void                 buildHashIndex(HashIndex& outIndex);
+	static unsigned long getEntryHash(HallOfFame::Entry& ioEntry);
+	static bool          isInHashIndex(const HashIndex& inIndex,
+	                                   const Individual& inIndividual,
+	                                   unsigned long inHash);
+
 	std::vector< HallOfFame::Entry > mEntries;   //!< Vector of members of the hall-of-fame.
 
 };
@@ -95,24 +95,29 @@ void Individual::copy(const Individual& inOriginal, System& ioSystem)
 		mMemberMap[lIterMap->first] = lMember;
 	}
 
-	// Copy fitness
+	// Copy fitness, reusing actual fitness object if it is not shared and of the same type
 	if(inOriginal.getFitness() == NULL) {
 		mFitness = NULL;
 	} else {
 		const std::string& lFitnessType = inOriginal.getFitness()->getType();
-		Fitness::Alloc::Handle lFitnessAlloc =
-		    castHandleT<Fitness::Alloc>(lFactory.getAllocator(lFitnessType));
-		mFitness = castHandleT<Fitness>(lFitnessAlloc->allocate());
+		if((mFitness == NULL) || (mFitness->getRefCounter() != 1) || (mFitness->getType() != lFitnessType)) {
+			Fitness::Alloc::Handle lFitnessAlloc =
+			    castHandleT<Fitness::Alloc>(lFactory.getAllocator(lFitnessType));
+			mFitness = castHandleT<Fitness>(lFitnessAlloc->allocate());
+		}
 		mFitness->copy(*inOriginal.getFitness(), ioSystem);
 	}
 
-	// Copy genotypes
+	// Copy genotypes, reusing actual genotypes storage if not shared and of the same type
 	resize(inOriginal.size());
 	for(unsigned int i=0; i<inOriginal.size(); ++i) {
 		const std::string& lGenotypeType = inOriginal[i]->getType();
-		Genotype::Alloc::Handle lGenotypeAlloc =
-		    castHandleT<Genotype::Alloc>(lFactory.getAllocator(lGenotypeType));
-		(*this)[i] = castHandleT<Genotype>(lGenotypeAlloc->allocate());
+		if(((*this)[i] == NULL) || ((*this)[i]->getRefCounter() != 1) ||
+		        ((*this)[i]->getType() != lGenotypeType)) {
+			Genotype::Alloc::Handle lGenotypeAlloc =
+			    castHandleT<Genotype::Alloc>(lFactory.getAllocator(lGenotypeType));
+			(*this)[i] = castHandleT<Genotype>(lGenotypeAlloc->allocate());
+		}
 		(*this)[i]->copy(*inOriginal[i], ioSystem);
 	}
 
@@ -202,6 +207,25 @@ bool Individual::isEqual(const Object& inRightObj) const
 }
 
 
+/*!
+ *  \brief  Compute a hash value of the genotypes of the individual.
+ *  \return Hash value, equal for individuals with equal genotypes.
+ *
+ *  The hash value allows to find individuals that may be identical without comparing
+ *  their genotypes one by one. Fitness is not part of the hash value.
+ */
+unsigned long Individual::computeHash() const
+{
+	Beagle_StackTraceBeginM();
+	unsigned long lHash = size();
+	for(unsigned int i=0; i<size(); ++i) {
+		lHash = Genotype::combineHash(lHash, (*this)[i]->computeHash());
+	}
+	return lHash;
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief  Compare the equality of the genotypes of two individuals.
  *  \param  inRightIndividual Individual to compare to this.
@@ -257,6 +281,83 @@ void Individual::read(PACC::XML::ConstIterator)
 }
 
 
+/*!
+ *  \brief Read an individual from a binary archive.
+ *  \param ioArchive Binary archive to read the individual from.
+ *  \param ioContext Evolutionary context to use to read the individual.
+ *  \throw Beagle::IOException If the format is not respected.
+ *
+ *  Members, fitness and genotypes are read in the order written by writeBinary, each
+ *  preceded by its type name, which is used to get its allocator from the factory.
+ */
+void Individual::readBinary(BinaryInArchive& ioArchive, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	const Factory& lFactory = ioContext.getSystem().getFactory();
+
+	// Read members
+	mMemberMap.clear();
+	const unsigned int lNbMembers = ioArchive.readUInt();
+	for(unsigned int i=0; i<lNbMembers; ++i) {
+		const std::string lMemberName = ioArchive.readString();
+		const std::string lMemberType = ioArchive.readString();
+		Member::Alloc::Handle lMemberAlloc =
+		    castHandleT<Member::Alloc>(lFactory.getAllocator(lMemberType));
+		if(lMemberAlloc == NULL) {
+			std::ostringstream lOSS;
+			lOSS << "It seems that type '" << lMemberType << "' associated to member '";
+			lOSS << lMemberName << "' is not valid!";
+			throw Beagle_IOExceptionMessageM(lOSS.str());
+		}
+		Member::Handle lMember = castHandleT<Member>(lMemberAlloc->allocate());
+		lMember->readBinary(ioArchive, ioContext);
+		mMemberMap[lMemberName] = lMember;
+	}
+
+	// Read fitness
+	if(ioArchive.readBool()) {
+		const std::string lFitnessType = ioArchive.readString();
+		Fitness::Alloc::Handle lFitnessAlloc =
+		    castHandleT<Fitness::Alloc>(lFactory.getAllocator(lFitnessType));
+		if(lFitnessAlloc == NULL) {
+			std::ostringstream lOSS;
+			lOSS << "Type '" << lFitnessType << "' associated to fitness object ";
+			lOSS << "is not valid!";
+			throw Beagle_IOExceptionMessageM(lOSS.str());
+		}
+		mFitness = castHandleT<Fitness>(lFitnessAlloc->allocate());
+		mFitness->readBinary(ioArchive, ioContext);
+	} else {
+		mFitness = NULL;
+	}
+
+	// Read genotypes
+	unsigned int lPrevGenoIndex = ioContext.getGenotypeIndex();
+	Genotype::Handle lPrevGenoHandle = ioContext.getGenotypeHandle();
+	clear();
+	const unsigned int lNbGenotypes = ioArchive.readUInt();
+	for(unsigned int i=0; i<lNbGenotypes; ++i) {
+		const std::string lGenotypeType = ioArchive.readString();
+		Genotype::Alloc::Handle lGenotypeAlloc =
+		    castHandleT<Genotype::Alloc>(lFactory.getAllocator(lGenotypeType));
+		if(lGenotypeAlloc == NULL) {
+			std::ostringstream lOSS;
+			lOSS << "Type '" << lGenotypeType << "' associated to genotype object ";
+			lOSS << "is not valid!";
+			throw Beagle_IOExceptionMessageM(lOSS.str());
+		}
+		Genotype::Handle lGenotype = castHandleT<Genotype>(lGenotypeAlloc->allocate());
+		ioContext.setGenotypeHandle(lGenotype);
+		ioContext.setGenotypeIndex(size());
+		push_back(lGenotype);
+		lGenotype->readBinary(ioArchive, ioContext);
+	}
+	ioContext.setGenotypeHandle(lPrevGenoHandle);
+	ioContext.setGenotypeIndex(lPrevGenoIndex);
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Read individual from a XML file. If several individuals are in file, read
  *    first tagged occurence of individual.
@@ -487,6 +588,35 @@ void Individual::write(PACC::XML::Streamer& ioStreamer, bool inIndent) const
 }
 
 
+/*!
+ *  \brief Write an individual into a binary archive.
+ *  \param ioArchive Binary archive to write the individual into.
+ */
+void Individual::writeBinary(BinaryOutArchive& ioArchive) const
+{
+	Beagle_StackTraceBeginM();
+	ioArchive.writeUInt(mMemberMap.size());
+	for(MemberMap::const_iterator lIterMap=mMemberMap.begin();
+	        lIterMap!=mMemberMap.end(); ++lIterMap) {
+		const Member::Handle lMember = castHandleT<Member>(lIterMap->second);
+		ioArchive.writeString(lIterMap->first);
+		ioArchive.writeString(lMember->getType());
+		lMember->writeBinary(ioArchive);
+	}
+	ioArchive.writeBool(mFitness != NULL);
+	if(mFitness != NULL) {
+		ioArchive.writeString(mFitness->getType());
+		mFitness->writeBinary(ioArchive);
+	}
+	ioArchive.writeUInt(size());
+	for(unsigned int i=0; i<size(); ++i) {
+		ioArchive.writeString((*this)[i]->getType());
+		(*this)[i]->writeBinary(ioArchive);
+	}
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Write content of an individual into a XML streamer.
  *  \param ioStreamer XML streamer to write the individual into.
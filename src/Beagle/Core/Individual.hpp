@@ -83,6 +83,7 @@ public:
 	{ }
 
 	virtual void                addMember(Member::Handle inMember);
+	virtual unsigned long       computeHash() const;
 	virtual void                copy(const Individual& inOriginal, System& ioSystem);
 	virtual double              getDistanceGenotype(const Individual& inRightIndividual) const;
 	virtual double              getDistancePhenotype(const Individual& inRightIndividual) const;
@@ -92,6 +93,7 @@ public:
 	virtual bool                isEqual(const Object& inRightObj) const;
 	virtual bool                isIdentical(const Individual& inRightIndividual) const;
 	virtual bool                isLess(const Object& inRightObj) const;
+	virtual void                readBinary(BinaryInArchive& ioArchive, Context& ioContext);
 	virtual bool                readFromFile(std::string inFileName, System& ioSystem);
 	virtual void                readFitness(PACC::XML::ConstIterator inIter, Context& ioContext);
 	virtual void                readGenotypes(PACC::XML::ConstIterator inIter, Context& ioContext);
@@ -99,6 +101,7 @@ public:
 	virtual void                readWithContext(PACC::XML::ConstIterator inIter, Context& ioContext);
 	virtual Member::Handle      removeMember(const std::string& inName);
 	virtual void                write(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
+	virtual void                writeBinary(BinaryOutArchive& ioArchive) const;
 	virtual void                writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 	virtual void                writeFitness(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 	virtual void                writeGenotypes(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
@@ -37,8 +37,11 @@
 
 #include "Beagle/Core.hpp"
 
+#include <algorithm>
 #include <cfloat>
 #include <climits>
+#include <cmath>
+#include <vector>
 
 using namespace Beagle;
 
@@ -129,6 +132,301 @@ Matrix& Matrix::operator=(const Beagle::Vector& inVector)
 }
 
 
+/*!
+ *  \brief Compute eigenvalues and eigenvectors of a symmetric matrix.
+ *  \param outValues Eigenvalues of the matrix, in ascending order.
+ *  \param outVectors Matrix with the eigenvectors as columns, in the order of the eigenvalues.
+ *  \throw Beagle::RunTimeException If the QL iterations do not converge.
+ *
+ *  The matrix is reduced to a tridiagonal form by Householder transformations and the
+ *  tridiagonal matrix is then diagonalized with the implicit QL algorithm (procedures tred2 and
+ *  tql2 of EISPACK, as adapted in the JAMA package). Only the lower triangle of the matrix is
+ *  used. The working copy of the eigenvectors is held transposed in a contiguous buffer, so all
+ *  the inner loops of the reduction and of the plane rotations run with unit stride.
+ *  This is substantially faster than the general PACC::Matrix::computeEigens for large
+ *  covariance matrices.
+ */
+void Matrix::computeSymmetricEigens(Beagle::Vector& outValues, Beagle::Matrix& outVectors) const
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(getRows() == getCols());
+	const unsigned int lN = getRows();
+	outValues.resize(lN);
+	outVectors.resize(lN, lN);
+	if(lN == 0) return;
+
+	// Row j of lW holds column j of the eigenvectors matrix V, i.e. lW[j*lN+k] = V(k,j).
+	std::vector<double> lW(lN*lN);
+	for(unsigned int i=0; i<lN; ++i) {
+		for(unsigned int j=0; j<=i; ++j) lW[i*lN+j] = lW[j*lN+i] = (*this)(i,j);
+	}
+	std::vector<double> lD(lN), lE(lN, 0.0);
+
+	// Householder reduction to tridiagonal form.
+	for(unsigned int j=0; j<lN; ++j) lD[j] = lW[j*lN+lN-1];
+	for(unsigned int i=lN-1; i>0; --i) {
+		double lScale = 0.0;
+		double lH = 0.0;
+		for(unsigned int k=0; k<i; ++k) lScale += std::fabs(lD[k]);
+		if(lScale == 0.0) {
+			lE[i] = lD[i-1];
+			for(unsigned int j=0; j<i; ++j) {
+				lD[j] = lW[j*lN+i-1];
+				lW[j*lN+i] = 0.0;
+				lW[i*lN+j] = 0.0;
+			}
+		} else {
+			for(unsigned int k=0; k<i; ++k) {
+				lD[k] /= lScale;
+				lH += lD[k] * lD[k];
+			}
+			double lF = lD[i-1];
+			double lG = std::sqrt(lH);
+			if(lF > 0.0) lG = -lG;
+			lE[i] = lScale * lG;
+			lH -= lF * lG;
+			lD[i-1] = lF - lG;
+			for(unsigned int j=0; j<i; ++j) lE[j] = 0.0;
+			for(unsigned int j=0; j<i; ++j) {
+				double* lWj = &lW[j*lN];
+				lF = lD[j];
+				lW[i*lN+j] = lF;
+				lG = lE[j] + (lWj[j] * lF);
+				for(unsigned int k=j+1; k<i; ++k) {
+					lG += lWj[k] * lD[k];
+					lE[k] += lWj[k] * lF;
+				}
+				lE[j] = lG;
+			}
+			lF = 0.0;
+			for(unsigned int j=0; j<i; ++j) {
+				lE[j] /= lH;
+				lF += lE[j] * lD[j];
+			}
+			const double lHH = lF / (lH + lH);
+			for(unsigned int j=0; j<i; ++j) lE[j] -= lHH * lD[j];
+			for(unsigned int j=0; j<i; ++j) {
+				double* lWj = &lW[j*lN];
+				lF = lD[j];
+				lG = lE[j];
+				for(unsigned int k=j; k<i; ++k) lWj[k] -= ((lF * lE[k]) + (lG * lD[k]));
+				lD[j] = lWj[i-1];
+				lWj[i] = 0.0;
+			}
+		}
+		lD[i] = lH;
+	}
+
+	// Accumulate transformations.
+	for(unsigned int i=0; i<(lN-1); ++i) {
+		double* lWi1 = &lW[(i+1)*lN];
+		lW[i*lN+lN-1] = lW[i*lN+i];
+		lW[i*lN+i] = 1.0;
+		const double lH = lD[i+1];
+		if(lH != 0.0) {
+			for(unsigned int k=0; k<=i; ++k) lD[k] = lWi1[k] / lH;
+			for(unsigned int j=0; j<=i; ++j) {
+				double* lWj = &lW[j*lN];
+				double lG = 0.0;
+				for(unsigned int k=0; k<=i; ++k) lG += lWi1[k] * lWj[k];
+				for(unsigned int k=0; k<=i; ++k) lWj[k] -= lG * lD[k];
+			}
+		}
+		for(unsigned int k=0; k<=i; ++k) lWi1[k] = 0.0;
+	}
+	for(unsigned int j=0; j<lN; ++j) {
+		lD[j] = lW[j*lN+lN-1];
+		lW[j*lN+lN-1] = 0.0;
+	}
+	lW[lN*lN-1] = 1.0;
+	lE[0] = 0.0;
+
+	// Diagonalize tridiagonal matrix with implicit QL iterations.
+	for(unsigned int i=1; i<lN; ++i) lE[i-1] = lE[i];
+	lE[lN-1] = 0.0;
+	double lF = 0.0;
+	double lTst1 = 0.0;
+	for(unsigned int l=0; l<lN; ++l) {
+		lTst1 = maxOf(lTst1, std::fabs(lD[l]) + std::fabs(lE[l]));
+		unsigned int m = l;
+		while(m < (lN-1)) {
+			if(std::fabs(lE[m]) <= (DBL_EPSILON * lTst1)) break;
+			++m;
+		}
+		if(m > l) {
+			unsigned int lIter = 0;
+			do {
+				if(++lIter > 60) {
+					throw Beagle_RunTimeExceptionM("Eigen decomposition of symmetric matrix did not converge!");
+				}
+				double lG = lD[l];
+				double lP = (lD[l+1] - lG) / (2.0 * lE[l]);
+				double lR = std::sqrt((lP * lP) + 1.0);
+				if(lP < 0.0) lR = -lR;
+				lD[l] = lE[l] / (lP + lR);
+				lD[l+1] = lE[l] * (lP + lR);
+				const double lDL1 = lD[l+1];
+				double lH = lG - lD[l];
+				for(unsigned int i=l+2; i<lN; ++i) lD[i] -= lH;
+				lF += lH;
+
+				lP = lD[m];
+				double lC = 1.0;
+				double lC2 = lC;
+				double lC3 = lC;
+				const double lEL1 = lE[l+1];
+				double lS = 0.0;
+				double lS2 = 0.0;
+				for(unsigned int i=m; i-- > l;) {
+					lC3 = lC2;
+					lC2 = lC;
+					lS2 = lS;
+					lG = lC * lE[i];
+					lH = lC * lP;
+					lR = std::sqrt((lP * lP) + (lE[i] * lE[i]));
+					lE[i+1] = lS * lR;
+					lS = lE[i] / lR;
+					lC = lP / lR;
+					lP = (lC * lD[i]) - (lS * lG);
+					lD[i+1] = lH + (lS * ((lC * lG) + (lS * lD[i])));
+					double* lWi  = &lW[i*lN];
+					double* lWi1 = &lW[(i+1)*lN];
+					for(unsigned int k=0; k<lN; ++k) {
+						lH = lWi1[k];
+						lWi1[k] = (lS * lWi[k]) + (lC * lH);
+						lWi[k]  = (lC * lWi[k]) - (lS * lH);
+					}
+				}
+				lP = -lS * lS2 * lC3 * lEL1 * lE[l] / lDL1;
+				lE[l] = lS * lP;
+				lD[l] = lC * lP;
+			} while(std::fabs(lE[l]) > (DBL_EPSILON * lTst1));
+		}
+		lD[l] += lF;
+		lE[l] = 0.0;
+	}
+
+	// Sort eigenvalues in ascending order and copy eigenvectors as columns.
+	std::vector<unsigned int> lOrder(lN);
+	for(unsigned int i=0; i<lN; ++i) lOrder[i] = i;
+	for(unsigned int i=1; i<lN; ++i) {
+		const unsigned int lIdx = lOrder[i];
+		unsigned int j = i;
+		for(; (j > 0) && (lD[lOrder[j-1]] > lD[lIdx]); --j) lOrder[j] = lOrder[j-1];
+		lOrder[j] = lIdx;
+	}
+	for(unsigned int j=0; j<lN; ++j) {
+		const double* lWj = &lW[lOrder[j]*lN];
+		outValues[j] = lD[lOrder[j]];
+		for(unsigned int i=0; i<lN; ++i) outVectors(i,j) = lWj[i];
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Multiply the matrix by the transpose of another matrix.
+ *  \param outResult Result of the product, A*R^T.
+ *  \param inRight Right matrix R, with the same number of columns as the actual matrix.
+ *
+ *  Each element of the result is the dot product of a row of A and a row of R, so both
+ *  operands are read with unit stride. The product is computed by tiles of rows of R to
+ *  keep them in cache, and the rows of the result are computed in parallel when OpenMP
+ *  is enabled.
+ */
+void Matrix::multiplyTransposed(Beagle::Matrix& outResult, const Beagle::Matrix& inRight) const
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(inRight.getCols() == getCols());
+	const int lRows = getRows();
+	const unsigned int lCols = inRight.getRows();
+	const unsigned int lK = getCols();
+	outResult.resize(lRows, lCols);
+	if((lRows == 0) || (lCols == 0)) return;
+
+	// Contiguous copies of the operands.
+	std::vector<double> lA(lRows*lK), lR(lCols*lK);
+	for(int i=0; i<lRows; ++i) {
+		for(unsigned int k=0; k<lK; ++k) lA[i*lK+k] = (*this)(i,k);
+	}
+	for(unsigned int j=0; j<lCols; ++j) {
+		for(unsigned int k=0; k<lK; ++k) lR[j*lK+k] = inRight(j,k);
+	}
+
+	const unsigned int lTile = 64;
+	for(unsigned int lJ0=0; lJ0<lCols; lJ0+=lTile) {
+		const unsigned int lJ1 = minOf(lCols, lJ0+lTile);
+#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
+#pragma omp parallel for schedule(static)
+#endif
+		for(int i=0; i<lRows; ++i) {
+			const double* lAi = &lA[i*lK];
+			for(unsigned int j=lJ0; j<lJ1; ++j) {
+				const double* lRj = &lR[j*lK];
+				double lSum = 0.0;
+				for(unsigned int k=0; k<lK; ++k) lSum += lAi[k] * lRj[k];
+				outResult(i,j) = lSum;
+			}
+		}
+	}
+	Beagle_StackTraceEndM();
+}
+
+/*!
+ *  \brief Symmetric rank-k update of a square matrix.
+ *  \param inY Matrix of k rows, each row being a vector of the size of the matrix.
+ *  \param inWeights Weight of each row of inY.
+ *  \param inAlpha Scaling factor of the update.
+ *  \param inBeta Scaling factor applied to the actual matrix.
+ *
+ *  Compute A = beta*A + alpha*Y^T*diag(w)*Y in one pass, without allocating an outer product
+ *  per row of Y (equivalent of the BLAS dsyrk routine). Only the upper triangle is computed,
+ *  tile by tile, and then mirrored so that the resulting matrix is exactly symmetric.
+ */
+void Matrix::updateRankK(const Beagle::Matrix& inY,
+                         const Beagle::Vector& inWeights,
+                         double inAlpha,
+                         double inBeta)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(getRows() == getCols());
+	Beagle_AssertM(inY.getCols() == getCols());
+	Beagle_AssertM(inWeights.size() == inY.getRows());
+	const unsigned int lN = getRows();
+	const unsigned int lK = inY.getRows();
+
+	// Columns of Y and of diag(w)*Y, stored contiguously.
+	std::vector<double> lYt(lN*lK), lWYt(lN*lK);
+	for(unsigned int k=0; k<lK; ++k) {
+		const double lWeight = inAlpha * inWeights[k];
+		for(unsigned int i=0; i<lN; ++i) {
+			lYt[i*lK+k]  = inY(k,i);
+			lWYt[i*lK+k] = lWeight * inY(k,i);
+		}
+	}
+
+	const unsigned int lTile = 64;
+	for(unsigned int lI0=0; lI0<lN; lI0+=lTile) {
+		const unsigned int lI1 = minOf(lN, lI0+lTile);
+		for(unsigned int lJ0=lI0; lJ0<lN; lJ0+=lTile) {
+			const unsigned int lJ1 = minOf(lN, lJ0+lTile);
+			for(unsigned int i=lI0; i<lI1; ++i) {
+				const double* lWYi = &lWYt[i*lK];
+				for(unsigned int j=maxOf(i,lJ0); j<lJ1; ++j) {
+					const double* lYj = &lYt[j*lK];
+					double lSum = 0.0;
+					for(unsigned int k=0; k<lK; ++k) lSum += lWYi[k] * lYj[k];
+					const double lValue = (inBeta * (*this)(i,j)) + lSum;
+					(*this)(i,j) = lValue;
+					(*this)(j,i) = lValue;
+				}
+			}
+		}
+	}
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Read matrix from a XML subtree.
  *  \param inIter XML iterator to read the matrix from.
@@ -87,6 +87,13 @@ public:
 	Matrix& operator=(const PACC::Vector& inVector);
 	Matrix& operator=(const Beagle::Vector& inVector);
 
+	void computeSymmetricEigens(Beagle::Vector& outValues, Beagle::Matrix& outVectors) const;
+	void multiplyTransposed(Beagle::Matrix& outResult, const Beagle::Matrix& inRight) const;
+	void updateRankK(const Beagle::Matrix& inY,
+	                 const Beagle::Vector& inWeights,
+	                 double inAlpha,
+	                 double inBeta=1.0);
+
 	virtual void read(PACC::XML::ConstIterator inIter);
 	virtual std::string serialize(bool inIndent=false, unsigned int inIndentWidth=0) const;
 	virtual void write(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
@@ -50,6 +50,27 @@ void Member::read(PACC::XML::ConstIterator inIter)
 }
 
 
+/*!
+ *  \brief Read the member instance from a binary archive.
+ *  \param ioArchive Binary archive to read the member from.
+ *  \param ioContext Evolutionary context.
+ *
+ *  The default implementation reads the XML representation written by writeBinary.
+ *  Members that are transported often should over-define both methods with a compact
+ *  binary layout.
+ */
+void Member::readBinary(BinaryInArchive& ioArchive, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	std::istringstream lISS(ioArchive.readString());
+	PACC::XML::Document lDocument(lISS);
+	PACC::XML::ConstIterator lRoot = lDocument.getFirstRoot();
+	if(!lRoot) throw Beagle_IOExceptionMessageM("XML representation of a member expected in binary archive!");
+	readWithContext(lRoot, ioContext);
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Read the member instance.
  *  \param inIter Iterator to XML node to read component from.
@@ -91,6 +112,23 @@ void Member::write(PACC::XML::Streamer& ioStreamer, bool inIndent) const
 }
 
 
+/*!
+ *  \brief Write the member instance into a binary archive.
+ *  \param ioArchive Binary archive to write the member into.
+ *
+ *  The default implementation writes the XML representation of the member as a string.
+ */
+void Member::writeBinary(BinaryOutArchive& ioArchive) const
+{
+	Beagle_StackTraceBeginM();
+	std::ostringstream lOSS;
+	PACC::XML::Streamer lStreamer(lOSS);
+	write(lStreamer, false);
+	ioArchive.writeString(lOSS.str());
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Write content of the member instance.
  *  \param ioStreamer XML streamer used to write member into.
@@ -48,6 +48,8 @@
 #include "Beagle/Core/AllocatorT.hpp"
 #include "Beagle/Core/Container.hpp"
 #include "Beagle/Core/ContainerT.hpp"
+#include "Beagle/Core/BinaryInArchive.hpp"
+#include "Beagle/Core/BinaryOutArchive.hpp"
 
 
 namespace Beagle
@@ -101,8 +103,10 @@ public:
 	virtual const std::string& getType() const =0;
 
 	virtual void read(PACC::XML::ConstIterator inIter);
+	virtual void readBinary(BinaryInArchive& ioArchive, Context& ioContext);
 	virtual void readWithContext(PACC::XML::ConstIterator inIter, Context& ioContext);
 	virtual void write(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
+	virtual void writeBinary(BinaryOutArchive& ioArchive) const;
 	virtual void writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
 };
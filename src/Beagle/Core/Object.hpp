@@ -192,6 +192,9 @@ public:
 	 *  \return Pointer to the actual object.
 	 */
 	inline Object* refer() {
+#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
+#pragma omp atomic
+#endif
 		++mRefCounter;
 		return this;
 	}
@@ -200,7 +203,30 @@ public:
 	 *  \brief  Decrement the reference counter and deletes the actual object if it reaches zero.
 	 */
 	inline void unrefer() {
+#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
+		// Objects such as allocators and parents are shared by the threads of parallel sections.
+		unsigned int lRefCounter;
+#pragma omp atomic capture
+		lRefCounter = --mRefCounter;
+		if(lRefCounter == 0) delete this;
+#else
 		if((--mRefCounter) == 0) delete this;
+#endif
+	}
+
+	/*!
+	 *  \brief  Decrement the reference counter without deleting the actual object.
+	 *  \return Pointer to the actual object.
+	 *
+	 *  Used by allocators to hand over an object they were referring to, the object being
+	 *  referred again by the caller of the allocator.
+	 */
+	inline Object* release() {
+#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
+#pragma omp atomic
+#endif
+		--mRefCounter;
+		return this;
 	}
 
 private:
@@ -100,12 +100,20 @@ public:
 		Beagle_StackTraceEndM();
 	}
 
-	/*!	\brief
-	 *	\return
+	/*!	\brief Return the thread number in the innermost active parallel section.
+	 *	\return Thread number, or 0 outside of any active parallel section.
+	 *
+	 *	When demes are processed in parallel, the parallel sections of the operators are
+	 *	nested and inactive. The thread number of the enclosing deme-level section is then
+	 *	returned, so that per-thread randomizers and contexts are never shared by two demes.
 	 */
 	inline unsigned int getThreadNum() const {
 		Beagle_StackTraceBeginM();
-		return omp_get_thread_num();
+		if(omp_get_active_level() == omp_get_level()) return omp_get_thread_num();
+		for(int lLevel=omp_get_level(); lLevel>0; --lLevel) {
+			if(omp_get_team_size(lLevel) > 1) return omp_get_ancestor_thread_num(lLevel);
+		}
+		return 0;
 		Beagle_StackTraceEndM();
 	}
 
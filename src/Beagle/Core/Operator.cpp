@@ -61,6 +61,21 @@ void Operator::init(System& ioSystem)
 {}
 
 
+/*!
+ *  \brief Return whether the operation only reads and modifies the deme it is applied on.
+ *  \return True if the operator can be applied concurrently on different demes.
+ *
+ *  The evolver applies consecutive deme-local operators on all demes concurrently when
+ *  parameter "ec.omp.demes" is set. Operators that move individuals between demes or
+ *  that modify vivarium-wide or system-wide state must return false, which is the
+ *  default behavior.
+ */
+bool Operator::isDemeLocal(void) const
+{
+	return false;
+}
+
+
 /*!
  *  \brief Reading a operator with method read is undefined. Use readWithSystem instead.
  */
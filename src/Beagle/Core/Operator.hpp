@@ -155,6 +155,7 @@ public:
 	virtual void operate(Deme& ioDeme, Context& ioContext) = 0;
 
 	virtual void init(System& ioSystem);
+	virtual bool isDemeLocal(void) const;
 	virtual void read(PACC::XML::ConstIterator);
 	virtual void readWithSystem(PACC::XML::ConstIterator inIter, System& ioSystem);
 	virtual void registerParams(System& ioSystem);
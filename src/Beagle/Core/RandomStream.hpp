@@ -0,0 +1,288 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/Core/RandomStream.hpp
+ *  \brief  Definition of the class RandomStream.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_Core_RandomStream_hpp
+#define Beagle_Core_RandomStream_hpp
+
+#include <cmath>
+#include <climits>
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+#include "Beagle/Core/HashString.hpp"
+
+#ifdef BEAGLE_HAVE_STDINT_H
+#include <stdint.h>
+#elif defined(BEAGLE_HAVE_INTTYPES_H)
+#include <inttypes.h>
+#else // BEAGLE_HAVE_STDINT_H
+#define uint32_t unsigned int
+#endif // BEAGLE_HAVE_STDINT_H
+
+namespace Beagle
+{
+
+/*!
+ *  \class RandomStream Beagle/Core/RandomStream.hpp "Beagle/Core/RandomStream.hpp"
+ *  \brief Counter-based random number stream, using the Philox4x32-10 generator.
+ *  \ingroup Core
+ *  \ingroup Sys
+ *
+ *  The numbers of a stream are a pure function of a 64 bits key and three 32 bits
+ *  stream identifiers, as described in Salmon et al., "Parallel Random Numbers: As
+ *  Easy as 1, 2, 3", SC'11. Streams are cheap to build, so that a new stream can be
+ *  opened for each unit of work (e.g. an individual to mutate), giving the same
+ *  numbers whatever the thread processing it. All methods are inline and non-virtual,
+ *  and bulk generation is provided with methods fillUniform and fillBits.
+ *  \note The operator() allow compliance with the STL random number generator interface.
+ */
+class RandomStream
+{
+
+public:
+
+	/*!
+	 *  \brief Construct a random stream.
+	 *  \param inKey Key of the stream, usually derived from the randomizer seed.
+	 *  \param inStream1 First stream identifier.
+	 *  \param inStream2 Second stream identifier.
+	 *  \param inStream3 Third stream identifier.
+	 */
+	explicit RandomStream(unsigned long inKey=0,
+	                      unsigned int inStream1=0,
+	                      unsigned int inStream2=0,
+	                      unsigned int inStream3=0) :
+		mIndex(4),
+		mHasGaussian(false),
+		mGaussian(0.0)
+	{
+		mKey[0] = (uint32_t)(inKey & 0xFFFFFFFFUL);
+		mKey[1] = (uint32_t)((inKey >> 16) >> 16);
+		mCounter[0] = 0;
+		mCounter[1] = inStream1;
+		mCounter[2] = inStream2;
+		mCounter[3] = inStream3;
+	}
+
+	/*!
+	 *  \brief Hash a name into a stream identifier.
+	 *  \param inName Name to hash, usually an operator name.
+	 *  \return Stream identifier.
+	 */
+	static inline unsigned int hashName(const std::string& inName) {
+		return HashString()(inName);
+	}
+
+	/*!
+	 *  \brief Fill a buffer with random 32 bits words.
+	 *  \param outBits Buffer to fill.
+	 *  \param inN Number of words to generate.
+	 */
+	inline void fillBits(uint32_t* outBits, unsigned int inN) {
+		for(unsigned int i=0; i<inN; ++i) outBits[i] = rollBits();
+	}
+
+	/*!
+	 *  \brief Fill a buffer with numbers following a geometric distribution.
+	 *  \param outValues Buffer to fill.
+	 *  \param inN Number of values to generate.
+	 *  \param inProba Success probability of each trial.
+	 */
+	inline void fillGeometric(unsigned long* outValues, unsigned int inN, double inProba) {
+		if((inProba >= 1.0) || (inProba <= 0.0)) {
+			const unsigned long lValue = (inProba >= 1.0) ? 0 : ULONG_MAX;
+			for(unsigned int i=0; i<inN; ++i) outValues[i] = lValue;
+			return;
+		}
+		const double lLogFail = std::log(1.0-inProba);
+		for(unsigned int i=0; i<inN; ++i) {
+			const double lValue = std::floor(std::log(1.0-rollUniform()) / lLogFail);
+			outValues[i] = (lValue >= (double)ULONG_MAX) ? ULONG_MAX : (unsigned long)lValue;
+		}
+	}
+
+	/*!
+	 *  \brief Fill a buffer with standard Gaussian deviates, generated by pairs.
+	 *  \param outValues Buffer to fill.
+	 *  \param inN Number of values to generate.
+	 */
+	inline void fillGaussian(double* outValues, unsigned int inN) {
+		for(unsigned int i=0; i<inN; ++i) outValues[i] = rollGaussian();
+	}
+
+	/*!
+	 *  \brief Fill a buffer with numbers uniformly distributed in [0,1).
+	 *  \param outValues Buffer to fill.
+	 *  \param inN Number of values to generate.
+	 */
+	inline void fillUniform(double* outValues, unsigned int inN) {
+		for(unsigned int i=0; i<inN; ++i) outValues[i] = rollUniform();
+	}
+
+	/*!
+	 *  \brief Generate a random 32 bits word.
+	 *  \return Random word.
+	 */
+	inline uint32_t rollBits() {
+		if(mIndex == 4) generateBlock();
+		return mBlock[mIndex++];
+	}
+
+	/*!
+	 *  \brief Generate the number of failures before the first success of Bernoulli trials.
+	 *  \param inProba Success probability of each trial.
+	 *  \return Random number generated, following a geometric distribution.
+	 */
+	inline unsigned long rollGeometric(double inProba) {
+		if(inProba >= 1.0) return 0;
+		if(inProba <= 0.0) return ULONG_MAX;
+		const double lValue = std::floor(std::log(1.0-rollUniform()) / std::log(1.0-inProba));
+		return (lValue >= (double)ULONG_MAX) ? ULONG_MAX : (unsigned long)lValue;
+	}
+
+	/*!
+	 *  \brief Generate a floating-point number following a Gaussian distribution.
+	 *  \param inMean Mean of the Gaussian distribution.
+	 *  \param inStdDev Standard-error of the Gaussian distribution.
+	 *  \return Random number generated.
+	 */
+	inline double rollGaussian(double inMean=0.0, double inStdDev=1.0) {
+		if(mHasGaussian) {
+			mHasGaussian = false;
+			return inMean + (inStdDev * mGaussian);
+		}
+		double lU1 = 0.0;
+		do {
+			lU1 = rollUniform();
+		} while(lU1 == 0.0);
+		const double lU2 = rollUniform();
+		const double lRadius = std::sqrt(-2.0 * std::log(lU1));
+		const double lAngle = 6.283185307179586476925286766559 * lU2;
+		mGaussian = lRadius * std::sin(lAngle);
+		mHasGaussian = true;
+		return inMean + (inStdDev * lRadius * std::cos(lAngle));
+	}
+
+	/*!
+	 *  \brief Generate an integer following an uniform discrete distribution.
+	 *  \param inLower Lower bound of the distribution.
+	 *  \param inUpper Upper bound of the distribution.
+	 *  \return Random integer generated in [inLower, inUpper].
+	 */
+	inline unsigned long rollInteger(unsigned long inLower=0, unsigned long inUpper=ULONG_MAX) {
+		const unsigned long lRange = inUpper - inLower;
+		if(lRange == 0) return inLower;
+		unsigned long lMask = lRange;
+		lMask |= lMask >> 1;
+		lMask |= lMask >> 2;
+		lMask |= lMask >> 4;
+		lMask |= lMask >> 8;
+		lMask |= lMask >> 16;
+		lMask |= (lMask >> 16) >> 16;
+		unsigned long lValue = 0;
+		if(lRange <= 0xFFFFFFFFUL) {
+			do {
+				lValue = rollBits() & lMask;
+			} while(lValue > lRange);
+		} else {
+			do {
+				lValue = ((((unsigned long)rollBits() << 16) << 16) | rollBits()) & lMask;
+			} while(lValue > lRange);
+		}
+		return inLower + lValue;
+	}
+
+	/*!
+	 *  \brief Generate a number following a uniform distribution in the interval [inLower,inUpper).
+	 *  \param inLower Lower bound of the uniform distribution.
+	 *  \param inUpper Upper bound of the uniform distribution.
+	 *  \return Random number generated in [inLower,inUpper), with 53 bits of resolution.
+	 */
+	inline double rollUniform(double inLower=0.0, double inUpper=1.0) {
+		const uint32_t lHigh = rollBits() >> 5;
+		const uint32_t lLow = rollBits() >> 6;
+		const double lValue = ((lHigh * 67108864.0) + lLow) * (1.0 / 9007199254740992.0);
+		return (lValue * (inUpper-inLower)) + inLower;
+	}
+
+	/*!
+	 *  \brief Generate an integer in [0,inN), for the STL random number generator interface.
+	 *  \param inN Upper bound (excluded) of the generated integer.
+	 *  \return Random integer generated.
+	 */
+	inline unsigned long operator()(unsigned long inN) {
+		return rollInteger(0, inN-1);
+	}
+
+protected:
+
+	/*!
+	 *  \brief Compute the next block of four words, applying the ten Philox rounds on the counter.
+	 */
+	inline void generateBlock() {
+		uint32_t lX[4] = {mCounter[0], mCounter[1], mCounter[2], mCounter[3]};
+		uint32_t lK[2] = {mKey[0], mKey[1]};
+		for(unsigned int lRound=0; lRound<10; ++lRound) {
+			const unsigned long long lProd0 = 0xD2511F53ULL * lX[0];
+			const unsigned long long lProd1 = 0xCD9E8D57ULL * lX[2];
+			const uint32_t lHi0 = (uint32_t)(lProd0 >> 32);
+			const uint32_t lLo0 = (uint32_t)lProd0;
+			const uint32_t lHi1 = (uint32_t)(lProd1 >> 32);
+			const uint32_t lLo1 = (uint32_t)lProd1;
+			lX[0] = lHi1 ^ lX[1] ^ lK[0];
+			lX[1] = lLo1;
+			lX[2] = lHi0 ^ lX[3] ^ lK[1];
+			lX[3] = lLo0;
+			lK[0] += 0x9E3779B9U;
+			lK[1] += 0xBB67AE85U;
+		}
+		mBlock[0] = lX[0];
+		mBlock[1] = lX[1];
+		mBlock[2] = lX[2];
+		mBlock[3] = lX[3];
+		++mCounter[0];
+		mIndex = 0;
+	}
+
+	uint32_t     mKey[2];      //!< Key of the stream.
+	uint32_t     mCounter[4];  //!< Counter, the first word being the block number.
+	uint32_t     mBlock[4];    //!< Last generated block.
+	unsigned int mIndex;       //!< Index of the next word to use in the block.
+	bool         mHasGaussian; //!< Whether a Gaussian number is cached.
+	double       mGaussian;    //!< Cached Gaussian number.
+
+};
+
+}
+
+#endif // Beagle_Core_RandomStream_hpp
@@ -51,10 +51,54 @@ Randomizer::Randomizer(unsigned long inSeed) :
 	Component("Randomizer"),
 	PACC::Randomizer(inSeed),
 	mRegisteredSeed(NULL),
-	mSeed(*state)
+	mSeed(*state),
+	mStreamActive(false)
 { }
 
 
+/*!
+ *  \brief Return the seed of the run, shared by all the randomizers of the system.
+ *  \return Run seed.
+ */
+unsigned long Randomizer::getRunSeed() const
+{
+	Beagle_StackTraceBeginM();
+#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
+	if((mRegisteredSeed != NULL) && (mRegisteredSeed->empty() == false)) return (*mRegisteredSeed)[0];
+#else
+	if(mRegisteredSeed != NULL) return mRegisteredSeed->getWrappedValue();
+#endif
+	return mSeed;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Build the counter-based stream associated to the given keys.
+ *  \param inGeneration Generation number of the stream.
+ *  \param inDeme Deme index of the stream.
+ *  \param inIndex Index of the unit of work (e.g. individual) of the stream.
+ *  \param inName Name of the operator using the stream.
+ *  \return Counter-based random stream.
+ *
+ *  The stream returned only depends on the run seed and on the keys given, not on the
+ *  state of the randomizer, nor on the thread calling the method.  The operator is
+ *  identified by its name only: two operators with the same name, called in the same
+ *  generation and deme with the same index, draw the same numbers.  An operator used
+ *  at several places of the evolver must thus be given a distinct name at each place.
+ */
+RandomStream Randomizer::getStream(unsigned int inGeneration,
+                                   unsigned int inDeme,
+                                   unsigned int inIndex,
+                                   const std::string& inName) const
+{
+	Beagle_StackTraceBeginM();
+	const unsigned long lKey = getRunSeed() ^ RandomStream::hashName(inName);
+	return RandomStream(lKey, inIndex, inDeme, inGeneration);
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Initialize this randomizer.
  *  \param ioSystem Evolutionary system.
@@ -38,6 +38,9 @@
 #ifndef Beagle_Core_Randomizer_hpp
 #define Beagle_Core_Randomizer_hpp
 
+#include <cmath>
+#include <climits>
+
 #include "PACC/Util.hpp"
 
 #include "Beagle/config.hpp"
@@ -49,6 +52,7 @@
 #include "Beagle/Core/Component.hpp"
 #include "Beagle/Core/WrapperT.hpp"
 #include "Beagle/Core/ULong.hpp"
+#include "Beagle/Core/RandomStream.hpp"
 
 #ifdef BEAGLE_HAVE_OPENMP
 #include <omp.h>
@@ -63,6 +67,12 @@ class System;
 /*!
  *  \class Randomizer Beagle/Randomizer.hpp "Beagle/Randomizer.hpp"
  *  \brief Random number generator class.
+ *
+ *  By default, numbers are drawn from a Mersenne Twister generator whose state evolves
+ *  with each call. A counter-based stream can be activated with method setStream, in
+ *  which case the numbers drawn are a function of the run seed and of the keys given
+ *  (generation, deme, index and operator name) only. This allows parallel loops to get
+ *  the same numbers whatever the number of threads and the scheduling used.
  *  \note The operator() allow compliance with the STL random number generator interface.
  *  \ingroup Core
  *  \ingroup Sys
@@ -91,6 +101,116 @@ public:
 	virtual void readWithSystem(PACC::XML::ConstIterator inIter, System& ioSystem);
 	virtual void writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
+	unsigned long getRunSeed() const;
+	RandomStream  getStream(unsigned int inGeneration,
+	                        unsigned int inDeme,
+	                        unsigned int inIndex,
+	                        const std::string& inName) const;
+
+	/*!
+	 *  \brief Deactivate the counter-based stream, going back to the Mersenne Twister generator.
+	 */
+	inline void clearStream() {
+		mStreamActive = false;
+	}
+
+	/*!
+	 *  \brief Return the active counter-based stream.
+	 *  \return Reference to the active stream.
+	 */
+	inline RandomStream& getActiveStream() {
+		Beagle_StackTraceBeginM();
+		Beagle_AssertM(mStreamActive);
+		return mStream;
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Return whether a counter-based stream is active.
+	 *  \return True if numbers are drawn from a counter-based stream, false if not.
+	 */
+	inline bool isStreamActive() const {
+		return mStreamActive;
+	}
+
+	/*!
+	 *  \brief Activate a counter-based stream, used until the next call to setStream or clearStream.
+	 *  \param inGeneration Generation number of the stream.
+	 *  \param inDeme Deme index of the stream.
+	 *  \param inIndex Index of the unit of work (e.g. individual) of the stream.
+	 *  \param inName Name of the operator using the stream.
+	 */
+	inline void setStream(unsigned int inGeneration,
+	                      unsigned int inDeme,
+	                      unsigned int inIndex,
+	                      const std::string& inName) {
+		Beagle_StackTraceBeginM();
+		mStream = getStream(inGeneration, inDeme, inIndex, inName);
+		mStreamActive = true;
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Fill a buffer with numbers following a geometric distribution.
+	 *  \param outValues Buffer to fill.
+	 *  \param inN Number of values to generate.
+	 *  \param inProba Success probability of each trial.
+	 *
+	 *  When a counter-based stream is active, the whole block is drawn from it at once.
+	 */
+	inline void fillGeometric(unsigned long* outValues, unsigned int inN, double inProba) {
+		Beagle_StackTraceBeginM();
+		Beagle_AssertM(inProba >= 0.0);
+		if(mStreamActive) mStream.fillGeometric(outValues, inN, inProba);
+		else for(unsigned int i=0; i<inN; ++i) outValues[i] = rollGeometric(inProba);
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Fill a buffer with standard Gaussian deviates.
+	 *  \param outValues Buffer to fill.
+	 *  \param inN Number of values to generate.
+	 *
+	 *  When a counter-based stream is active, the whole block is drawn from it at once.
+	 */
+	inline void fillGaussian(double* outValues, unsigned int inN) {
+		Beagle_StackTraceBeginM();
+		if(mStreamActive) mStream.fillGaussian(outValues, inN);
+		else for(unsigned int i=0; i<inN; ++i) outValues[i] = randNorm(0.0, 1.0);
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Generate an integer in [0,inN), for the STL random number generator interface.
+	 *  \param inN Upper bound (excluded) of the generated integer.
+	 *  \return Random integer generated.
+	 */
+	inline unsigned long operator()(unsigned long inN) {
+		Beagle_StackTraceBeginM();
+		Beagle_AssertM(inN > 0);
+		return rollInteger(0, inN-1);
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Generate the number of failures before the first success of Bernoulli trials.
+	 *  \param inProba Success probability of each trial.
+	 *  \return Random number generated, following a geometric distribution.
+	 *
+	 *  This allows to skip directly to the next gene to mutate, instead of rolling a
+	 *  uniform number for each gene, when genes are mutated with a given probability.
+	 */
+	inline unsigned long rollGeometric(double inProba) {
+		Beagle_StackTraceBeginM();
+		Beagle_AssertM(inProba >= 0.0);
+		if(mStreamActive) return mStream.rollGeometric(inProba);
+		if(inProba >= 1.0) return 0;
+		if(inProba <= 0.0) return ULONG_MAX;
+		const double lValue = std::floor(std::log(1.0-randExc()) / std::log(1.0-inProba));
+		return (lValue >= (double)ULONG_MAX) ? ULONG_MAX : (unsigned long)lValue;
+		Beagle_StackTraceEndM();
+	}
+
 	/*!
 	 *  \brief Generate a floating-point number following a Gaussian distribution.
 	 *  \param inMean Mean of the Gaussain distribution.
@@ -99,6 +219,7 @@ public:
 	inline double rollGaussian(double inMean=0.0, double inStdDev=1.0) {
 		Beagle_StackTraceBeginM();
 		Beagle_AssertM(inStdDev >= 0.0);
+		if(mStreamActive) return mStream.rollGaussian(inMean, inStdDev);
 		return randNorm(inMean, inStdDev);
 		Beagle_StackTraceEndM();
 	}
@@ -112,6 +233,7 @@ public:
 	inline unsigned long rollInteger(unsigned long inLower=0, unsigned long inUpper=ULONG_MAX) {
 		Beagle_StackTraceBeginM();
 		Beagle_AssertM(inLower <= inUpper);
+		if(mStreamActive) return mStream.rollInteger(inLower, inUpper);
 		return randInt(inUpper-inLower)+inLower;
 		Beagle_StackTraceEndM();
 	}
@@ -125,6 +247,7 @@ public:
 	inline double rollUniform(double inLower=0.0, double inUpper=1.0) {
 		Beagle_StackTraceBeginM();
 		Beagle_AssertM(inLower <= inUpper);
+		if(mStreamActive) return mStream.rollUniform(inLower, inUpper);
 		return (randExc() * (inUpper-inLower)) + inLower;
 		Beagle_StackTraceEndM();
 	}
@@ -137,6 +260,8 @@ protected:
 	ULong::Handle mRegisteredSeed;  //!< Registered seed of the random number generator.
 #endif
 	unsigned long mSeed;            //!< Seed used to initialize the random number generator.
+	RandomStream  mStream;          //!< Counter-based stream in use.
+	bool          mStreamActive;    //!< Whether numbers are drawn from the counter-based stream.
 };
 
 }
@@ -51,6 +51,125 @@ ReplacementStrategyOp::ReplacementStrategyOp(std::string inName) :
 { }
 
 
+/*!
+ *  \brief Breed offsprings using the breeder tree, appending them to a bag.
+ *  \param inNumber Number of offsprings to breed.
+ *  \param ioBreedingPool Breeding pool to use for the breeding operations.
+ *  \param ioOffsprings Bag to which the bred offsprings are appended.
+ *  \param inRoulette Routing table of the breeder tree, as built by buildRoulette.
+ *  \param ioContext Evolutionary context.
+ *
+ *  With OpenMP, the offsprings are bred concurrently, each thread using its own
+ *  context. The first offspring is always bred sequentially with the given context,
+ *  as breeding may prepare the statistics of the deme, and the processed counters of
+ *  the thread contexts are accumulated back into the given context. Each offspring
+ *  is bred with a counter-based random stream keyed by the generation, the deme and
+ *  the offspring index, so that the offsprings depend neither on the number of
+ *  threads nor on the scheduling. Offsprings are bred sequentially when the history
+ *  is traced.
+ */
+void ReplacementStrategyOp::breedOffsprings(unsigned int inNumber,
+        Individual::Bag& ioBreedingPool,
+        Individual::Bag& ioOffsprings,
+        const RouletteT<unsigned int>& inRoulette,
+        Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+
+	const unsigned int lFirst = ioOffsprings.size();
+	ioOffsprings.resize(lFirst+inNumber);
+	if(inNumber == 0) return;
+
+#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
+	if(ioContext.getSystem().haveComponent("History") == NULL) {
+		const unsigned int lGeneration = ioContext.getGeneration();
+		const unsigned int lDemeIndex = ioContext.getDemeIndex();
+		{
+			Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+			lRandomizer.setStream(lGeneration, lDemeIndex, lFirst, getName());
+			ioOffsprings[lFirst] = breedOneOffspring(ioBreedingPool, inRoulette, ioContext);
+			lRandomizer.clearStream();
+		}
+		if(inNumber == 1) return;
+
+		static OpenMP::Handle lOpenMP = castHandleT<OpenMP>(ioContext.getSystem().getComponent("OpenMP"));
+		const Factory& lFactory = ioContext.getSystem().getFactory();
+		Context::Alloc::Handle lContextAlloc =
+		    castHandleT<Context::Alloc>(lFactory.getConceptAllocator("Context"));
+		Context::Bag lContexts(lOpenMP->getMaxNumThreads());
+		for(unsigned int i=0; i<lContexts.size(); ++i) {
+			lContexts[i] = castHandleT<Context>(lContextAlloc->clone(ioContext));
+		}
+
+		const int lNumber = inNumber;
+#pragma omp parallel num_threads(lOpenMP->getMaxNumThreads())
+		{
+			Context& lContext = *lContexts[lOpenMP->getThreadNum()];
+			Randomizer& lRandomizer = lContext.getSystem().getRandomizer();
+#if defined(BEAGLE_USE_OMP_R)
+#pragma omp for schedule(static)
+#else
+#pragma omp for schedule(dynamic)
+#endif
+			for(int i=1; i<lNumber; ++i) {
+				lRandomizer.setStream(lGeneration, lDemeIndex, lFirst+i, getName());
+				ioOffsprings[lFirst+i] = breedOneOffspring(ioBreedingPool, inRoulette, lContext);
+			}
+			lRandomizer.clearStream();
+		}
+
+		unsigned int lProcessedDeme = ioContext.getProcessedDeme();
+		unsigned int lTotalProcessedDeme = ioContext.getTotalProcessedDeme();
+		unsigned int lProcessedViva = ioContext.getProcessedVivarium();
+		unsigned int lTotalProcessedViva = ioContext.getTotalProcessedVivarium();
+		for(unsigned int i=0; i<lContexts.size(); ++i) {
+			lProcessedDeme += lContexts[i]->getProcessedDeme() - ioContext.getProcessedDeme();
+			lTotalProcessedDeme += lContexts[i]->getTotalProcessedDeme() - ioContext.getTotalProcessedDeme();
+			lProcessedViva += lContexts[i]->getProcessedVivarium() - ioContext.getProcessedVivarium();
+			lTotalProcessedViva += lContexts[i]->getTotalProcessedVivarium() - ioContext.getTotalProcessedVivarium();
+		}
+		ioContext.setProcessedDeme(lProcessedDeme);
+		ioContext.setTotalProcessedDeme(lTotalProcessedDeme);
+		ioContext.setProcessedVivarium(lProcessedViva);
+		ioContext.setTotalProcessedVivarium(lTotalProcessedViva);
+		return;
+	}
+#endif
+
+	for(unsigned int i=0; i<inNumber; ++i) {
+		ioOffsprings[lFirst+i] = breedOneOffspring(ioBreedingPool, inRoulette, ioContext);
+	}
+
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Breed one offspring, using a breeder operator of the tree selected with the roulette.
+ *  \param ioBreedingPool Breeding pool to use for the breeding operation.
+ *  \param inRoulette Routing table of the breeder tree, as built by buildRoulette.
+ *  \param ioContext Evolutionary context.
+ *  \return Bred offspring.
+ */
+Individual::Handle ReplacementStrategyOp::breedOneOffspring(Individual::Bag& ioBreedingPool,
+        const RouletteT<unsigned int>& inRoulette,
+        Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	unsigned int lIndexBreeder = inRoulette.select(ioContext.getSystem().getRandomizer());
+	BreederNode::Handle lSelectedBreeder=getRootNode();
+	for(unsigned int j=0; j<lIndexBreeder; ++j)
+		lSelectedBreeder=lSelectedBreeder->getNextSibling();
+	Beagle_NonNullPointerAssertM(lSelectedBreeder);
+	Beagle_NonNullPointerAssertM(lSelectedBreeder->getBreederOp());
+	Individual::Handle lBredIndiv =
+	    lSelectedBreeder->getBreederOp()->breed(ioBreedingPool, lSelectedBreeder->getFirstChild(), ioContext);
+	Beagle_NonNullPointerAssertM(lBredIndiv);
+	return lBredIndiv;
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Build routing tables for breeding children.
  *  \param outRoulette Normalized probability tables.
@@ -89,6 +208,33 @@ void ReplacementStrategyOp::buildRoulette(RouletteT<unsigned int>& outRoulette,
 }
 
 
+/*!
+ *  \brief Give back individuals about to be dropped to their allocator, for recycling.
+ *  \param ioIndividuals Individuals to recycle.
+ *  \param ioContext Evolutionary context used.
+ *
+ *  Only the individuals referred by the bag alone are recycled. The bag must release
+ *  its references before the next allocation of recycled individuals.
+ */
+void ReplacementStrategyOp::recycleIndividuals(Individual::Bag& ioIndividuals,
+        Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	const Factory& lFactory = ioContext.getSystem().getFactory();
+	std::string lIndividualType;
+	Allocator::Handle lIndividualAlloc = NULL;
+	for(unsigned int i=0; i<ioIndividuals.size(); ++i) {
+		if(ioIndividuals[i] == NULL) continue;
+		if(ioIndividuals[i]->getType() != lIndividualType) {
+			lIndividualType = ioIndividuals[i]->getType();
+			lIndividualAlloc = lFactory.getAllocator(lIndividualType);
+		}
+		if(lIndividualAlloc != NULL) lIndividualAlloc->recycle(*ioIndividuals[i]);
+	}
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Regsiter the parameters of this operator.
  *  \param ioSystem Reference to the evolutionary system.
@@ -117,6 +263,29 @@ void ReplacementStrategyOp::init(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return whether the replacement strategy only reads and modifies the deme it is applied on.
+ *  \return True if every breeder operator of the breeder tree is deme-local.
+ */
+bool ReplacementStrategyOp::isDemeLocal(void) const
+{
+	Beagle_StackTraceBeginM();
+
+	std::vector<BreederNode::Handle> lStack;
+	if(getRootNode() != NULL) lStack.push_back(getRootNode());
+	while(lStack.empty() == false) {
+		BreederNode::Handle lNode = lStack.back();
+		lStack.pop_back();
+		if((lNode->getBreederOp() != NULL) && (lNode->getBreederOp()->isDemeLocal() == false)) return false;
+		if(lNode->getFirstChild() != NULL) lStack.push_back(lNode->getFirstChild());
+		if(lNode->getNextSibling() != NULL) lStack.push_back(lNode->getNextSibling());
+	}
+	return true;
+
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Read a replacement strategy operator for XML subtree.
  *  \param inIter XML iterator to use to read replacement strategy operator.
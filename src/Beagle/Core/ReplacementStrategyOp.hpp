@@ -91,6 +91,7 @@ public:
 
 	virtual void registerParams(System& ioSystem);
 	virtual void init(System& ioSystem);
+	virtual bool isDemeLocal(void) const;
 	virtual void readWithSystem(PACC::XML::ConstIterator inIter, System& ioSystem);
 	virtual void write(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
@@ -115,7 +116,16 @@ public:
 
 protected:
 
-	void buildRoulette(RouletteT<unsigned int>& outRoulette, Context& ioContext) const;
+	void               breedOffsprings(unsigned int inNumber,
+	                                   Individual::Bag& ioBreedingPool,
+	                                   Individual::Bag& ioOffsprings,
+	                                   const RouletteT<unsigned int>& inRoulette,
+	                                   Context& ioContext) const;
+	Individual::Handle breedOneOffspring(Individual::Bag& ioBreedingPool,
+	                                     const RouletteT<unsigned int>& inRoulette,
+	                                     Context& ioContext) const;
+	void               buildRoulette(RouletteT<unsigned int>& outRoulette, Context& ioContext) const;
+	void               recycleIndividuals(Individual::Bag& ioIndividuals, Context& ioContext) const;
 
 private:
 
@@ -154,6 +154,16 @@ void CrossoverOp::registerParams(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return True, mates are taken from the processed deme.
+ */
+bool CrossoverOp::isDemeLocal(void) const
+{
+	return true;
+}
+
+
 /*!
  *  \brief Apply the crossover operation on the deme.
  *  \param ioDeme Current deme of individuals to mate.
@@ -220,6 +230,10 @@ void CrossoverOp::operate(Deme& ioDeme, Context& ioContext)
 	for(j=0; j<lSize; j+=2) {
 		unsigned int lFirstMate  = lMateVector[j];
 		unsigned int lSecondMate = lMateVector[j+1];
+#if defined(BEAGLE_USE_OMP_NR) || defined(BEAGLE_USE_OMP_R)
+		Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+		lRandomizer.setStream(ioContext.getGeneration(), ioContext.getDemeIndex(), j/2, getName());
+#endif
 
 #if defined(BEAGLE_USE_OMP_NR) || defined(BEAGLE_USE_OMP_R)
 		lContexts[lOpenMP->getThreadNum()]->setIndividualIndex(lFirstMate);
@@ -280,6 +294,9 @@ void CrossoverOp::operate(Deme& ioDeme, Context& ioContext)
 				}
 			}
 		}
+#if defined(BEAGLE_USE_OMP_NR) || defined(BEAGLE_USE_OMP_R)
+		lRandomizer.clearStream();
+#endif
 	}
 
 	ioContext.setIndividualIndex(lOldIndividualIndex);
@@ -98,6 +98,16 @@ void DecimateOp::registerParams(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return True, only the processed deme is decimated.
+ */
+bool DecimateOp::isDemeLocal(void) const
+{
+	return true;
+}
+
+
 /*!
  *  \brief Apply the decimation operation on the deme.
  *  \param ioDeme Current deme of individuals to decimate.
@@ -195,6 +195,24 @@ bool FitnessSimple::isLess(const Object& inRightObj) const
 }
 
 
+/*!
+ *  \brief Read a simple fitness from a binary archive.
+ *  \param ioArchive Binary archive from which the fitness is read.
+ *  \param ioContext Evolutionary context.
+ */
+void FitnessSimple::readBinary(Beagle::BinaryInArchive& ioArchive, Beagle::Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	if(ioArchive.readBool()) {
+		mValue = ioArchive.readDouble();
+		setValid();
+	} else {
+		setInvalid();
+	}
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Read a simple fitness from a XML subtree.
  *  \param inIter XML iterator to use to read the fitness value.
@@ -249,6 +267,19 @@ void FitnessSimple::setValue(double inValue)
 }
 
 
+/*!
+ *  \brief Write a simple fitness into a binary archive.
+ *  \param ioArchive Binary archive into which the fitness is written.
+ */
+void FitnessSimple::writeBinary(Beagle::BinaryOutArchive& ioArchive) const
+{
+	Beagle_StackTraceBeginM();
+	ioArchive.writeBool(isValid());
+	if(isValid()) ioArchive.writeDouble(mValue);
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Write a simple fitness into an XML streamer.
  *  \param ioStreamer XML streamer to use to write the fitness value.
@@ -78,8 +78,10 @@ public:
 	virtual bool                isDominated(const Beagle::Fitness& inRightFitness) const;
 	virtual bool                isEqual(const Beagle::Object& inRightObj) const;
 	virtual bool                isLess(const Beagle::Object& inRightObj) const;
+	virtual void                readBinary(Beagle::BinaryInArchive& ioArchive, Beagle::Context& ioContext);
 	virtual void                read(PACC::XML::ConstIterator inIter);
 	virtual void                setValue(double inValue);
+	virtual void                writeBinary(Beagle::BinaryOutArchive& ioArchive) const;
 	virtual void                writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
 	/*!
@@ -105,7 +105,7 @@ void GenerationalOp::operate(Deme& ioDeme, Context& ioContext)
 			std::string lIndividualType = ioDeme[0]->getType();
 			Individual::Alloc::Handle lIndividualAlloc =
 			    castHandleT<Individual::Alloc>(lFactory.getAllocator(lIndividualType));
-			Individual::Handle lEliteIndiv = castHandleT<Individual>(lIndividualAlloc->allocate());
+			Individual::Handle lEliteIndiv = castHandleT<Individual>(lIndividualAlloc->allocateRecycled());
 			lEliteIndiv->copy(*ioDeme[0], ioContext.getSystem());
 			lOffsprings.push_back(lEliteIndiv);
 			if(lHistory != NULL) {
@@ -119,19 +119,9 @@ void GenerationalOp::operate(Deme& ioDeme, Context& ioContext)
 		}
 	}
 
-	for(unsigned int i=mElitismKeepSize->getWrappedValue(); i<ioDeme.size(); ++i) {
-		unsigned int lIndexBreeder = lRoulette.select(ioContext.getSystem().getRandomizer());
-		BreederNode::Handle lSelectedBreeder=getRootNode();
-		for(unsigned int j=0; j<lIndexBreeder; ++j)
-			lSelectedBreeder=lSelectedBreeder->getNextSibling();
-		Beagle_NonNullPointerAssertM(lSelectedBreeder);
-		Beagle_NonNullPointerAssertM(lSelectedBreeder->getBreederOp());
-		Individual::Handle lBredIndiv =
-		    lSelectedBreeder->getBreederOp()->breed(ioDeme, lSelectedBreeder->getFirstChild(), ioContext);
-		Beagle_NonNullPointerAssertM(lBredIndiv);
-		lOffsprings.push_back(lBredIndiv);
-	}
+	breedOffsprings(ioDeme.size()-mElitismKeepSize->getWrappedValue(), ioDeme, lOffsprings, lRoulette, ioContext);
 
+	recycleIndividuals(ioDeme, ioContext);
 	for(unsigned int j=0; j<lOffsprings.size(); ++j) ioDeme[j] = lOffsprings[j];
 	Beagle_StackTraceEndM();
 }
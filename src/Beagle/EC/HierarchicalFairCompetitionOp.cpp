@@ -124,6 +124,16 @@ void HierarchicalFairCompetitionOp::registerParams(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return False, individuals are moved between demes.
+ */
+bool HierarchicalFairCompetitionOp::isDemeLocal(void) const
+{
+	return false;
+}
+
+
 /*!
  *  \brief Apply the operation on a deme in the given context.
  *  \param ioDeme Reference to the deme on which the operation takes place.
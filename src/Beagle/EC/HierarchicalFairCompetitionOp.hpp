@@ -104,6 +104,7 @@ public:
 	{ }
 
 	virtual void registerParams(Beagle::System& ioSystem);
+	virtual bool isDemeLocal(void) const;
 	virtual void operate(Beagle::Deme& ioDeme, Beagle::Context& ioContext);
 
 protected:
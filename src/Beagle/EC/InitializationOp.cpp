@@ -151,6 +151,16 @@ void InitializationOp::registerParams(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return True, only the processed deme is initialized.
+ */
+bool InitializationOp::isDemeLocal(void) const
+{
+	return true;
+}
+
+
 /*!
  *  \brief Apply the initialization operation on the deme.
  *  \param ioDeme Current deme of individuals to initialize.
@@ -88,6 +88,7 @@ public:
 	        Beagle::Context& ioContext);
 	virtual double       getBreedingProba(Beagle::BreederNode::Handle inChild);
 	virtual void         registerParams(Beagle::System& ioSystem);
+	virtual bool         isDemeLocal(void) const;
 	virtual void         operate(Beagle::Deme& ioDeme, Beagle::Context& ioContext);
 	virtual unsigned int readSeeds(std::string inFileName, Beagle::Deme& ioDeme, Beagle::Context& ioContext);
 	virtual void         readWithSystem(PACC::XML::ConstIterator inIter, Beagle::System& ioSystem);
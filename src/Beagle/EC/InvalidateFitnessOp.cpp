@@ -93,6 +93,16 @@ double InvalidateFitnessOp::getBreedingProba(BreederNode::Handle inChild)
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return True, only individuals of the processed deme are invalidated.
+ */
+bool InvalidateFitnessOp::isDemeLocal(void) const
+{
+	return true;
+}
+
+
 /*!
  *  \brief Invalidates the fitness of every individual in ioDeme.
  *  \param ioDeme The deme to operate on.
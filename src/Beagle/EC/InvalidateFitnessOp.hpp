@@ -73,6 +73,7 @@ public:
 	        Beagle::BreederNode::Handle inChild,
 	        Beagle::Context& ioContext);
 	virtual double             getBreedingProba(Beagle::BreederNode::Handle inChild);
+	virtual bool               isDemeLocal(void) const;
 	virtual void               operate(Beagle::Deme& ioDeme, Beagle::Context& ioContext);
 
 };
@@ -159,7 +159,7 @@ void MuCommaLambdaOp::operate(Deme& ioDeme, Context& ioContext)
 			std::string lIndividualType = ioDeme[0]->getType();
 			Individual::Alloc::Handle lIndividualAlloc =
 			    castHandleT<Individual::Alloc>(lFactory.getAllocator(lIndividualType));
-			Individual::Handle lEliteIndiv = castHandleT<Individual>(lIndividualAlloc->allocate());
+			Individual::Handle lEliteIndiv = castHandleT<Individual>(lIndividualAlloc->allocateRecycled());
 			lEliteIndiv->copy(*ioDeme[0], ioContext.getSystem());
 			lOffsprings.push_back(lEliteIndiv);
 			if(lHistory != NULL) {
@@ -176,18 +176,7 @@ void MuCommaLambdaOp::operate(Deme& ioDeme, Context& ioContext)
 
 	unsigned int lLambda =
 	    (unsigned int)std::ceil(mLMRatio->getWrappedValue()*float(ioDeme.size()));
-	for(unsigned int i=0; i<lLambda; ++i) {
-		unsigned int lIndexBreeder = lRoulette.select(ioContext.getSystem().getRandomizer());
-		BreederNode::Handle lSelectedBreeder=getRootNode();
-		for(unsigned int j=0; j<lIndexBreeder; ++j)
-			lSelectedBreeder=lSelectedBreeder->getNextSibling();
-		Beagle_NonNullPointerAssertM(lSelectedBreeder);
-		Beagle_NonNullPointerAssertM(lSelectedBreeder->getBreederOp());
-		Individual::Handle lBredIndiv =
-		    lSelectedBreeder->getBreederOp()->breed(ioDeme, lSelectedBreeder->getFirstChild(), ioContext);
-		Beagle_NonNullPointerAssertM(lBredIndiv);
-		lOffsprings.push_back(lBredIndiv);
-	}
+	breedOffsprings(lLambda, ioDeme, lOffsprings, lRoulette, ioContext);
 
 	Beagle_AssertM(lOffsprings.size() > ioDeme.size());
 	for(unsigned int i=0; i<lOffsprings.size(); ++i) {
@@ -198,11 +187,13 @@ void MuCommaLambdaOp::operate(Deme& ioDeme, Context& ioContext)
 		}
 	}
 
+	recycleIndividuals(ioDeme, ioContext);
 	std::make_heap(lOffsprings.begin(), lOffsprings.end(), IsLessPointerPredicate());
 	for(unsigned int j=0; j<ioDeme.size(); ++j) {
 		ioDeme[j] = lOffsprings[0];
 		std::pop_heap(lOffsprings.begin(), (lOffsprings.end()-j), IsLessPointerPredicate());
 	}
+	recycleIndividuals(lOffsprings, ioContext);
 	Beagle_StackTraceEndM();
 }
 
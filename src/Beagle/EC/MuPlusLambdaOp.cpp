@@ -141,18 +141,7 @@ void MuPlusLambdaOp::operate(Deme& ioDeme, Context& ioContext)
 
 	unsigned int lLambda =
 	    (unsigned int)std::ceil(mLMRatio->getWrappedValue()*float(ioDeme.size()));
-	for(unsigned int i=0; i<lLambda; ++i) {
-		unsigned int lIndexBreeder = lRoulette.select(ioContext.getSystem().getRandomizer());
-		BreederNode::Handle lSelectedBreeder=getRootNode();
-		for(unsigned int j=0; j<lIndexBreeder; ++j)
-			lSelectedBreeder=lSelectedBreeder->getNextSibling();
-		Beagle_NonNullPointerAssertM(lSelectedBreeder);
-		Beagle_NonNullPointerAssertM(lSelectedBreeder->getBreederOp());
-		Individual::Handle lBredIndiv =
-		    lSelectedBreeder->getBreederOp()->breed(ioDeme, lSelectedBreeder->getFirstChild(), ioContext);
-		Beagle_NonNullPointerAssertM(lBredIndiv);
-		lOffsprings.push_back(lBredIndiv);
-	}
+	breedOffsprings(lLambda, ioDeme, lOffsprings, lRoulette, ioContext);
 
 	Beagle_AssertM(lOffsprings.size() > ioDeme.size());
 	for(unsigned int i=0; i<lOffsprings.size(); ++i) {
@@ -135,6 +135,16 @@ void MutationOp::registerParams(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return True, only individuals of the processed deme are mutated.
+ */
+bool MutationOp::isDemeLocal(void) const
+{
+	return true;
+}
+
+
 /*!
  *  \brief Apply the mutation operation on the deme.
  *  \param ioDeme Current deme of individuals to mutate.
@@ -176,6 +186,10 @@ void MutationOp::operate(Deme& ioDeme, Context& ioContext)
 #endif
 #endif
 	for(int i=0; i<lSize; ++i) {
+#if defined(BEAGLE_USE_OMP_NR) || defined(BEAGLE_USE_OMP_R)
+		Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+		lRandomizer.setStream(ioContext.getGeneration(), ioContext.getDemeIndex(), i, getName());
+#endif
 		if(ioContext.getSystem().getRandomizer().rollUniform() <= mMutationProba->getWrappedValue()) {
 #if defined(BEAGLE_USE_OMP_NR) || defined(BEAGLE_USE_OMP_R)
 			lContexts[lOpenMP->getThreadNum()]->setIndividualIndex(i);
@@ -214,6 +228,9 @@ void MutationOp::operate(Deme& ioDeme, Context& ioContext)
 				}
 			}
 		}
+#if defined(BEAGLE_USE_OMP_NR) || defined(BEAGLE_USE_OMP_R)
+		lRandomizer.clearStream();
+#endif
 	}
 
 	ioContext.setIndividualIndex(lOldIndividualIndex);
@@ -119,6 +119,16 @@ void OneCommaLambdaAdaptedOp::registerParams(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return False, the adapted number of offsprings is shared by all demes.
+ */
+bool OneCommaLambdaAdaptedOp::isDemeLocal(void) const
+{
+	return false;
+}
+
+
 /*!
  *  \brief Apply the (1,lambda_adapt) replacement strategy operation on a deme.
  *  \param ioDeme Reference to the deme on which the operation takes place.
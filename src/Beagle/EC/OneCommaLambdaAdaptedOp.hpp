@@ -84,6 +84,7 @@ public:
 	{ }
 
 	virtual void registerParams(Beagle::System& ioSystem);
+	virtual bool isDemeLocal(void) const;
 	virtual void operate(Beagle::Deme& ioDeme, Beagle::Context& ioContext);
 	virtual void init(Beagle::System& ioSystem);
 
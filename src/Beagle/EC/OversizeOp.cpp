@@ -140,18 +140,7 @@ void OversizeOp::operate(Deme& ioDeme, Context& ioContext)
 
 	// Create the new individuals.
 	Individual::Bag lOffsprings;
-	for(unsigned int i=0; i<lLambda; ++i) {
-		unsigned int lIndexBreeder = lRoulette.select(ioContext.getSystem().getRandomizer());
-		BreederNode::Handle lSelectedBreeder=getRootNode();
-		for(unsigned int j=0; j<lIndexBreeder; ++j)
-			lSelectedBreeder=lSelectedBreeder->getNextSibling();
-		Beagle_NonNullPointerAssertM(lSelectedBreeder);
-		Beagle_NonNullPointerAssertM(lSelectedBreeder->getBreederOp());
-		Individual::Handle lBredIndiv =
-		    lSelectedBreeder->getBreederOp()->breed(ioDeme, lSelectedBreeder->getFirstChild(), ioContext);
-		Beagle_NonNullPointerAssertM(lBredIndiv);
-		lOffsprings.push_back(lBredIndiv);
-	}
+	breedOffsprings(lLambda, ioDeme, lOffsprings, lRoulette, ioContext);
 
 	// Add the new individuals into the deme.
 	ioDeme.insert(ioDeme.end(), lOffsprings.begin(), lOffsprings.end());
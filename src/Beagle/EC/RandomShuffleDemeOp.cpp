@@ -52,6 +52,16 @@ RandomShuffleDemeOp::RandomShuffleDemeOp(std::string inName) :
 { }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return True, only the processed deme is shuffled.
+ */
+bool RandomShuffleDemeOp::isDemeLocal(void) const
+{
+	return true;
+}
+
+
 /*!
  *  \brief Apply the characteristic operation.
  *  \param ioDeme Deme to use to write the milestone.
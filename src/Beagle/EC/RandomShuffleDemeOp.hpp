@@ -71,6 +71,7 @@ public:
 	virtual ~RandomShuffleDemeOp()
 	{ }
 
+	virtual bool isDemeLocal(void) const;
 	virtual void operate(Deme& ioDeme, Context& ioContext);
 
 };
@@ -176,6 +176,16 @@ void RecombinationOp::registerParams(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return True, parents are taken from the processed deme.
+ */
+bool RecombinationOp::isDemeLocal(void) const
+{
+	return true;
+}
+
+
 /*!
  *  \brief Apply the recombination operation on the deme.
  *  \param ioDeme Current deme of individuals to recombine.
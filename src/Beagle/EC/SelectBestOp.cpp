@@ -79,6 +79,16 @@ SelectBestOp::SelectBestOp(std::string inReproProbaName, std::string inName) :
 { }
 
 
+/*!
+ *  \brief Return the number of selections made at once in parallel mode.
+ *  \return Largest possible size, as the best individuals must be selected all at once.
+ */
+unsigned int SelectBestOp::getSelectionBlockSize(void) const
+{
+	return UINT_MAX;
+}
+
+
 /*!
  *  \brief Select inN best individuals.
  *  \param inN Number of individuals to select.
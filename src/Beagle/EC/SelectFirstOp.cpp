@@ -51,6 +51,16 @@ SelectFirstOp::SelectFirstOp(std::string inReproProbaName, std::string inName) :
 { }
 
 
+/*!
+ *  \brief Return the number of selections made at once in parallel mode.
+ *  \return Largest possible size, as the first individuals must be selected all at once.
+ */
+unsigned int SelectFirstOp::getSelectionBlockSize(void) const
+{
+	return UINT_MAX;
+}
+
+
 /*!
  *  \brief Select first individual of the population.
  *  \param ioPool Pool of individuals to use for selection.
@@ -72,6 +72,7 @@ public:
 	virtual ~SelectFirstOp()
 	{ }
 
+	virtual unsigned int getSelectionBlockSize(void) const;
 	virtual unsigned int selectOneIndividual(Beagle::Individual::Bag& ioPool, Beagle::Context& ioContext);
 	virtual void         selectManyIndividuals(unsigned int inN,
 	        Beagle::Individual::Bag& ioPool,
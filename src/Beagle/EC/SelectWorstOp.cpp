@@ -79,6 +79,16 @@ SelectWorstOp::SelectWorstOp(std::string inReproProbaName, std::string inName) :
 { }
 
 
+/*!
+ *  \brief Return the number of selections made at once in parallel mode.
+ *  \return Largest possible size, as the worst individuals must be selected all at once.
+ */
+unsigned int SelectWorstOp::getSelectionBlockSize(void) const
+{
+	return UINT_MAX;
+}
+
+
 /*!
  *  \brief Select worst individual of a pool of individuals.
  *  \param ioPool Pool of individuals to use for selection.
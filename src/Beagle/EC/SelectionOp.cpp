@@ -77,7 +77,7 @@ Individual::Handle SelectionOp::breed(Individual::Bag& inBreedingPool,
 	std::string lIndividualType = lOriginalIndiv->getType();
 	Individual::Alloc::Handle lIndividualAlloc =
 	    castHandleT<Individual::Alloc>(lFactory.getAllocator(lIndividualType));
-	Individual::Handle lClonedIndiv = castHandleT<Individual>(lIndividualAlloc->allocate());
+	Individual::Handle lClonedIndiv = castHandleT<Individual>(lIndividualAlloc->allocateRecycled());
 	Beagle_NonNullPointerAssertM(lClonedIndiv);
 	lClonedIndiv->copy(*lOriginalIndiv, ioContext.getSystem());
 	ioContext.setIndividualIndex(lSelectedIndiv);
@@ -162,6 +162,31 @@ void SelectionOp::registerParams(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return the number of selections made at once with a random stream in parallel mode.
+ *  \return Number of selections of each block, 64 by default.
+ *
+ *  With OpenMP, the selections of a deme are split in blocks of this size, each one
+ *  making its selections with method selectManyIndividuals and the random stream of
+ *  its block index. Operators that must make all their selections at once
+ *  (e.g. selecting the best individuals) return the largest possible size.
+ */
+unsigned int SelectionOp::getSelectionBlockSize(void) const
+{
+	return 64;
+}
+
+
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return True, individuals are selected within the processed deme.
+ */
+bool SelectionOp::isDemeLocal(void) const
+{
+	return true;
+}
+
+
 /*!
  *  \brief Apply the selection operation on all the deme.
  *  \param ioDeme Deme to which the selection operation is applied.
@@ -198,17 +223,27 @@ void SelectionOp::operate(Deme& ioDeme, Context& ioContext)
 	for(int i = 0; i < lNumThreads; ++i)
 		lContexts[i] = castHandleT<Context>(lContextAlloc->clone(ioContext));
 
-	unsigned int lNbIndividualInt = ioDeme.size() / lNumThreads;
-	unsigned int lNbIndividualFrac = ioDeme.size() % lNumThreads;
-	//	lIndices.resize(ioDeme.size(), 0);
+	// The selections are made by blocks of fixed size, each one drawing from the random
+	// stream of its block index, so that the selected individuals do not depend on the
+	// number of threads.
+	const int lBlockSize = (int)std::max(std::min(getSelectionBlockSize(), (unsigned int)lSize), 1U);
+	const int lNbBlocks = (lSize + lBlockSize - 1) / lBlockSize;
 
-#pragma omp parallel shared(lIndices, lContexts, lNumThreads)
+#pragma omp parallel shared(lIndices, lContexts)
 	{
 		std::vector<unsigned int> lIndicesVector(lSize, 0);
-		unsigned int lNbIndividual = lNbIndividualInt;
-		if(lOpenMP->getThreadNum() < lNbIndividualFrac)
-			++lNbIndividual;
-		selectManyIndividuals(lNbIndividual, ioDeme, *lContexts[lOpenMP->getThreadNum()], lIndicesVector);
+		std::vector<unsigned int> lBlockIndices(lSize, 0);
+		Context& lContext = *lContexts[lOpenMP->getThreadNum()];
+		Randomizer& lRandomizer = lContext.getSystem().getRandomizer();
+#pragma omp for schedule(dynamic)
+		for(int b = 0; b < lNbBlocks; ++b) {
+			const int lNbIndividual = std::min(lBlockSize, lSize - (b * lBlockSize));
+			lRandomizer.setStream(ioContext.getGeneration(), ioContext.getDemeIndex(), b, getName());
+			selectManyIndividuals(lNbIndividual, ioDeme, lContext, lBlockIndices);
+			lRandomizer.clearStream();
+			for(int i = 0; i < lSize; ++i)
+				lIndicesVector[i] += lBlockIndices[i];
+		}
 
 #pragma omp critical (Beagle_SelectionOp_Reduce_Indices)
 		{
@@ -86,6 +86,8 @@ public:
 	                                   Beagle::Context& ioContext,
 	                                   std::vector<unsigned int>& outSelections);
 
+	virtual unsigned int getSelectionBlockSize(void) const;
+
 	void convertToList(unsigned int inN, std::vector<unsigned int>& ioSelections);
 
 	virtual Individual::Handle breed(Beagle::Individual::Bag& inBreedingPool,
@@ -93,6 +95,7 @@ public:
 	                                 Beagle::Context& ioContext);
 	virtual double             getBreedingProba(Beagle::BreederNode::Handle inChild);
 	virtual void               registerParams(Beagle::System& ioSystem);
+	virtual bool               isDemeLocal(void) const;
 	virtual void               operate(Beagle::Deme& ioDeme, Beagle::Context& ioContext);
 	virtual void               readWithSystem(PACC::XML::ConstIterator inIter, Beagle::System& ioSystem);
 	virtual void               writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
@@ -57,6 +57,26 @@ StatsCalculateOp::StatsCalculateOp(std::string inName) :
 { }
 
 
+/*!
+ *  \brief  Add the fitness cache counters to computed statistics.
+ *  \param  ioStats Computed statistics.
+ *  \param  ioContext Context of the evolution.
+ *
+ *  Items "cache-hits" and "cache-hit-rate" are added, cumulated since the beginning of
+ *  the evolution, only when a FitnessCache component is installed in the system.
+ */
+void StatsCalculateOp::addFitnessCacheStats(Stats& ioStats, Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	FitnessCache::Handle lFitnessCache =
+	    castHandleT<FitnessCache>(ioContext.getSystem().haveComponent("FitnessCache"));
+	if(lFitnessCache == NULL) return;
+	ioStats.addItem("cache-hits", double(lFitnessCache->getNbHits()));
+	ioStats.addItem("cache-hit-rate", lFitnessCache->getHitRate());
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief  Calculate statistics of a given vivarium.
  *  \param  outStats Computed stats of the deme.
@@ -187,6 +207,7 @@ void StatsCalculateOp::operate(Deme& ioDeme, Context& ioContext)
 
 	if(ioDeme.getStats()->isValid() == false) {
 		calculateStatsDeme(*ioDeme.getStats(), ioDeme, ioContext);
+		addFitnessCacheStats(*ioDeme.getStats(), ioContext);
 		ioDeme.getStats()->setValid();
 	}
 
@@ -209,6 +230,7 @@ void StatsCalculateOp::operate(Deme& ioDeme, Context& ioContext)
 		calculateStatsVivarium(*ioContext.getVivarium().getStats(),
 		                       ioContext.getVivarium(),
 		                       ioContext);
+		addFitnessCacheStats(*ioContext.getVivarium().getStats(), ioContext);
 		ioContext.getVivarium().getStats()->setValid();
 
 		Beagle_LogStatsM(ioContext.getSystem().getLogger(), *ioContext.getVivarium().getStats());
@@ -90,6 +90,8 @@ public:
 
 protected:
 
+	virtual void addFitnessCacheStats(Beagle::Stats& ioStats, Beagle::Context& ioContext) const;
+
 	Beagle::UIntArray::Handle  mPopSize;              //!< Population size for the evolution.
 	unsigned int               mNbDemesCalculated;    //!< Number of demes for which stats is computed.
 	unsigned int               mGenerationCalculated; //!< Actual generation for which stats is computed.
@@ -79,6 +79,10 @@ void SteadyStateOp::registerParams(System& ioSystem)
  *  \brief Apply the operation on a deme in the given context.
  *  \param ioDeme Reference to the deme on which the operation takes place.
  *  \param ioContext Evolutionary context of the operation.
+ *
+ *  Each offspring replaces an individual of the deme as soon as it is bred, and may be
+ *  selected as a parent of the following ones.  The offsprings are thus bred sequentially,
+ *  whether OpenMP is enabled or not.
  */
 void SteadyStateOp::operate(Deme& ioDeme, Context& ioContext)
 {
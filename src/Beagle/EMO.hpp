@@ -69,10 +69,14 @@
 #include "Beagle/EMO/FitnessMultiObj.hpp"
 #include "Beagle/EMO/FitnessMultiObjMin.hpp"
 #include "Beagle/EMO/NPGA2Op.hpp"
+#include "Beagle/EMO/Hypervolume.hpp"
+#include "Beagle/EMO/NondominatedSorting.hpp"
+#include "Beagle/EMO/ParetoArchive.hpp"
 #include "Beagle/EMO/NSGA2Op.hpp"
 #include "Beagle/EMO/PackageMultiObj.hpp"
 #include "Beagle/EMO/ParetoFrontCalculateOp.hpp"
 #include "Beagle/EMO/ParetoFrontHOF.hpp"
+#include "Beagle/EMO/SMSEMOAOp.hpp"
 #include "Beagle/EMO/StatsCalcFitnessMultiObjOp.hpp"
 
 #endif // Beagle_GA_hpp
@@ -216,6 +216,27 @@ bool EMO::FitnessMultiObj::isLess(const Object& inRightObj) const
 }
 
 
+/*!
+ *  \brief Read a multiobjective fitness from a binary archive.
+ *  \param ioArchive Binary archive from which the fitness is read.
+ *  \param ioContext Evolutionary context.
+ */
+void EMO::FitnessMultiObj::readBinary(BinaryInArchive& ioArchive, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	clear();
+	if(ioArchive.readBool()) {
+		const unsigned int lSize = ioArchive.readUInt();
+		reserve(lSize);
+		for(unsigned int i=0; i<lSize; ++i) push_back(ioArchive.readDouble());
+		setValid();
+	} else {
+		setInvalid();
+	}
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Read a multiobjective fitness from a XML subtree.
  *  \param inIter XML iterator to use to read the fitness value.
@@ -261,6 +282,22 @@ void EMO::FitnessMultiObj::read(PACC::XML::ConstIterator inIter)
 }
 
 
+/*!
+ *  \brief Write a multiobjective fitness into a binary archive.
+ *  \param ioArchive Binary archive into which the fitness is written.
+ */
+void EMO::FitnessMultiObj::writeBinary(BinaryOutArchive& ioArchive) const
+{
+	Beagle_StackTraceBeginM();
+	ioArchive.writeBool(isValid());
+	if(isValid()) {
+		ioArchive.writeUInt(size());
+		for(unsigned int i=0; i<size(); ++i) ioArchive.writeDouble((*this)[i]);
+	}
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Write a multiobjective fitness into an XML streamer.
  *  \param ioStreamer XML streamer to use to write the fitness value.
@@ -124,7 +124,9 @@ public:
 	virtual bool                isDominated(const Fitness& inRightFitness) const;
 	virtual bool                isEqual(const Object& inRightObj) const;
 	virtual bool                isLess(const Object& inRightObj) const;
+	virtual void                readBinary(BinaryInArchive& ioArchive, Context& ioContext);
 	virtual void                read(PACC::XML::ConstIterator inIter);
+	virtual void                writeBinary(BinaryOutArchive& ioArchive) const;
 	virtual void                writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
 };
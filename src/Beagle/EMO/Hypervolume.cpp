@@ -0,0 +1,552 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/EMO/Hypervolume.cpp
+ *  \brief  Source code of class EMO::Hypervolume.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/EMO.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+using namespace Beagle;
+
+
+namespace Beagle
+{
+namespace EMO
+{
+
+// Used internally to order the rows of a box matrix by decreasing values, from first to last column.
+class IsGreaterBoxPredicate
+{
+public:
+	IsGreaterBoxPredicate(const std::vector<double>& inBoxes, unsigned int inNbObjectives) :
+		mBoxes(inBoxes),
+		mNbObjectives(inNbObjectives)
+	{ }
+	inline bool operator()(unsigned int inLeft, unsigned int inRight) const
+	{
+		const double* lLeft = &mBoxes[inLeft*mNbObjectives];
+		const double* lRight = &mBoxes[inRight*mNbObjectives];
+		for(unsigned int i=0; i<mNbObjectives; ++i) {
+			if(lLeft[i] > lRight[i]) return true;
+			if(lLeft[i] < lRight[i]) return false;
+		}
+		return false;
+	}
+private:
+	const std::vector<double>& mBoxes;
+	unsigned int               mNbObjectives;
+};
+
+// Used internally to order the rows of a box matrix by increasing value of the last column.
+class IsLessLastObjectivePredicate
+{
+public:
+	IsLessLastObjectivePredicate(const std::vector<double>& inBoxes, unsigned int inNbObjectives) :
+		mBoxes(inBoxes),
+		mNbObjectives(inNbObjectives)
+	{ }
+	inline bool operator()(unsigned int inLeft, unsigned int inRight) const
+	{
+		return mBoxes[(inLeft+1)*mNbObjectives-1] < mBoxes[(inRight+1)*mNbObjectives-1];
+	}
+private:
+	const std::vector<double>& mBoxes;
+	unsigned int               mNbObjectives;
+};
+
+}
+}
+
+
+/*!
+ *  \brief Translate points into boxes anchored at the reference point.
+ *  \param outBoxes Upper corner of the boxes, the lower corner being the origin.
+ *  \param inPoints Points, one row per point, all objectives being maximized.
+ *  \param inNbObjectives Number of objectives of the points.
+ *  \param inReference Reference point.
+ *
+ *  Coordinates worse than the reference point are set to zero, giving boxes of null volume.
+ */
+void EMO::Hypervolume::clipPoints(std::vector<double>& outBoxes,
+                                  const std::vector<double>& inPoints,
+                                  unsigned int inNbObjectives,
+                                  const std::vector<double>& inReference)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(inReference.size() == inNbObjectives);
+	outBoxes.resize(inPoints.size());
+	for(unsigned int i=0; i<inPoints.size(); ++i) {
+		const double lCoordinate = inPoints[i] - inReference[i%inNbObjectives];
+		outBoxes[i] = (lCoordinate > 0.0) ? lCoordinate : 0.0;
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Compute the exact hypervolume of a set of points.
+ *  \param inPoints Points, one row per point, all objectives being maximized.
+ *  \param inNbObjectives Number of objectives of the points.
+ *  \param inReference Reference point.
+ *  \return Hypervolume of the points.
+ */
+double EMO::Hypervolume::compute(const std::vector<double>& inPoints,
+                                 unsigned int inNbObjectives,
+                                 const std::vector<double>& inReference)
+{
+	Beagle_StackTraceBeginM();
+	if(inPoints.empty()) return 0.0;
+	std::vector<double> lBoxes;
+	clipPoints(lBoxes, inPoints, inNbObjectives, inReference);
+	if(inNbObjectives > 2) filterNondominated(lBoxes, inNbObjectives);
+	return computeBoxes(lBoxes, inNbObjectives);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Compute the volume of the union of boxes anchored at the origin.
+ *  \param ioBoxes Upper corner of the boxes, one row per box, which may be reordered.
+ *  \param inNbObjectives Number of dimensions of the boxes.
+ *  \return Volume of the union of the boxes.
+ *
+ *  The boxes are processed by increasing last coordinate, so that the boxes limited by a box
+ *  share its last coordinate, and their volume is computed in one dimension less.
+ */
+double EMO::Hypervolume::computeBoxes(std::vector<double>& ioBoxes, unsigned int inNbObjectives)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lNbBoxes = ioBoxes.size() / inNbObjectives;
+	if(lNbBoxes == 0) return 0.0;
+	if(inNbObjectives == 1) return *std::max_element(ioBoxes.begin(), ioBoxes.end());
+	if(lNbBoxes == 1) {
+		double lVolume = 1.0;
+		for(unsigned int k=0; k<inNbObjectives; ++k) lVolume *= ioBoxes[k];
+		return lVolume;
+	}
+
+	std::vector<unsigned int> lOrder(lNbBoxes);
+	for(unsigned int i=0; i<lNbBoxes; ++i) lOrder[i] = i;
+	if(inNbObjectives == 2) {
+		// Sweep by decreasing first coordinate, adding the part of each box above the others.
+		std::sort(lOrder.begin(), lOrder.end(), IsGreaterBoxPredicate(ioBoxes, 2));
+		double lVolume = 0.0;
+		double lHeight = 0.0;
+		for(unsigned int i=0; i<lNbBoxes; ++i) {
+			const double* lBox = &ioBoxes[lOrder[i]*2];
+			if(lBox[1] <= lHeight) continue;
+			lVolume += lBox[0] * (lBox[1] - lHeight);
+			lHeight = lBox[1];
+		}
+		return lVolume;
+	}
+
+	std::sort(lOrder.begin(), lOrder.end(), IsLessLastObjectivePredicate(ioBoxes, inNbObjectives));
+	const unsigned int lNbSliced = inNbObjectives - 1;
+	double lVolume = 0.0;
+	std::vector<double> lLimited;
+	for(unsigned int i=0; i<lNbBoxes; ++i) {
+		const double* lBox = &ioBoxes[lOrder[i]*inNbObjectives];
+		double lSlicedVolume = 1.0;
+		for(unsigned int k=0; k<lNbSliced; ++k) lSlicedVolume *= lBox[k];
+		if((lBox[lNbSliced] <= 0.0) || (lSlicedVolume <= 0.0)) continue;
+		lLimited.clear();
+		lLimited.reserve((lNbBoxes-i-1)*lNbSliced);
+		for(unsigned int j=i+1; j<lNbBoxes; ++j) {
+			const double* lOther = &ioBoxes[lOrder[j]*inNbObjectives];
+			for(unsigned int k=0; k<lNbSliced; ++k) lLimited.push_back(std::min(lBox[k], lOther[k]));
+		}
+		if(lNbSliced > 2) filterNondominated(lLimited, lNbSliced);
+		lVolume += lBox[lNbSliced] * (lSlicedVolume - computeBoxes(lLimited, lNbSliced));
+	}
+	return lVolume;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Compute the exact exclusive hypervolume contribution of each point of a set.
+ *  \param outContributions Volume dominated by each point, and by no other point of the set.
+ *  \param inPoints Points, one row per point, all objectives being maximized.
+ *  \param inNbObjectives Number of objectives of the points.
+ *  \param inReference Reference point.
+ */
+void EMO::Hypervolume::computeContributions(std::vector<double>& outContributions,
+        const std::vector<double>& inPoints,
+        unsigned int inNbObjectives,
+        const std::vector<double>& inReference)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lNbPoints = inPoints.size() / inNbObjectives;
+	std::vector<double> lBoxes;
+	clipPoints(lBoxes, inPoints, inNbObjectives, inReference);
+	outContributions.resize(lNbPoints);
+	std::vector<bool> lSkipped(lNbPoints, false);
+	for(unsigned int i=0; i<lNbPoints; ++i) {
+		lSkipped[i] = true;
+		outContributions[i] = computeExclusive(&lBoxes[i*inNbObjectives], lBoxes, inNbObjectives, lSkipped);
+		lSkipped[i] = false;
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Compute the volume of a box that is not covered by a set of boxes.
+ *  \param inBox Upper corner of the box.
+ *  \param inBoxes Upper corner of the covering boxes, one row per box.
+ *  \param inNbObjectives Number of dimensions of the boxes.
+ *  \param inSkipped Flags of the covering boxes to ignore.
+ *  \return Exclusive volume of the box.
+ */
+double EMO::Hypervolume::computeExclusive(const double* inBox,
+        const std::vector<double>& inBoxes,
+        unsigned int inNbObjectives,
+        const std::vector<bool>& inSkipped)
+{
+	Beagle_StackTraceBeginM();
+	double lVolume = 1.0;
+	for(unsigned int k=0; k<inNbObjectives; ++k) lVolume *= inBox[k];
+	if(lVolume <= 0.0) return 0.0;
+	std::vector<double> lLimited;
+	lLimited.reserve(inBoxes.size());
+	for(unsigned int j=0; j<inSkipped.size(); ++j) {
+		if(inSkipped[j]) continue;
+		const double* lOther = &inBoxes[j*inNbObjectives];
+		for(unsigned int k=0; k<inNbObjectives; ++k) lLimited.push_back(std::min(inBox[k], lOther[k]));
+	}
+	if(inNbObjectives > 2) filterNondominated(lLimited, inNbObjectives);
+	return std::max(0.0, lVolume - computeBoxes(lLimited, inNbObjectives));
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Estimate the hypervolume of a set of points by Monte-Carlo sampling.
+ *  \param inPoints Points, one row per point, all objectives being maximized.
+ *  \param inNbObjectives Number of objectives of the points.
+ *  \param inReference Reference point.
+ *  \param inNbSamples Number of points sampled in the box bounded by the reference point.
+ *  \param ioStream Random stream used for sampling.
+ *  \return Estimated hypervolume of the points.
+ */
+double EMO::Hypervolume::estimate(const std::vector<double>& inPoints,
+                                  unsigned int inNbObjectives,
+                                  const std::vector<double>& inReference,
+                                  unsigned int inNbSamples,
+                                  RandomStream& ioStream)
+{
+	Beagle_StackTraceBeginM();
+	std::vector<double> lBoxes;
+	clipPoints(lBoxes, inPoints, inNbObjectives, inReference);
+	filterNondominated(lBoxes, inNbObjectives);
+	const unsigned int lNbBoxes = lBoxes.size() / inNbObjectives;
+	if((lNbBoxes == 0) || (inNbSamples == 0)) return 0.0;
+	std::vector<double> lUpper(lBoxes.begin(), lBoxes.begin()+inNbObjectives);
+	for(unsigned int i=1; i<lNbBoxes; ++i) {
+		for(unsigned int k=0; k<inNbObjectives; ++k) {
+			lUpper[k] = std::max(lUpper[k], lBoxes[i*inNbObjectives+k]);
+		}
+	}
+	double lBoundingVolume = 1.0;
+	for(unsigned int k=0; k<inNbObjectives; ++k) lBoundingVolume *= lUpper[k];
+
+	std::vector<double> lSample(inNbObjectives);
+	unsigned int lNbCovered = 0;
+	for(unsigned int s=0; s<inNbSamples; ++s) {
+		ioStream.fillUniform(&lSample[0], inNbObjectives);
+		for(unsigned int k=0; k<inNbObjectives; ++k) lSample[k] *= lUpper[k];
+		for(unsigned int i=0; i<lNbBoxes; ++i) {
+			const double* lBox = &lBoxes[i*inNbObjectives];
+			unsigned int k=0;
+			while((k<inNbObjectives) && (lSample[k] <= lBox[k])) ++k;
+			if(k == inNbObjectives) {
+				++lNbCovered;
+				break;
+			}
+		}
+	}
+	return lBoundingVolume * double(lNbCovered) / double(inNbSamples);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Estimate the exclusive hypervolume contribution of each point by Monte-Carlo sampling.
+ *  \param outContributions Estimated volume dominated by each point, and by no other point.
+ *  \param inPoints Points, one row per point, all objectives being maximized.
+ *  \param inNbObjectives Number of objectives of the points.
+ *  \param inReference Reference point.
+ *  \param inNbSamples Number of points sampled in the box bounded by the reference point.
+ *  \param ioStream Random stream used for sampling.
+ */
+void EMO::Hypervolume::estimateContributions(std::vector<double>& outContributions,
+        const std::vector<double>& inPoints,
+        unsigned int inNbObjectives,
+        const std::vector<double>& inReference,
+        unsigned int inNbSamples,
+        RandomStream& ioStream)
+{
+	Beagle_StackTraceBeginM();
+	std::vector<double> lBoxes;
+	clipPoints(lBoxes, inPoints, inNbObjectives, inReference);
+	const unsigned int lNbBoxes = lBoxes.size() / inNbObjectives;
+	outContributions.assign(lNbBoxes, 0.0);
+	if((lNbBoxes == 0) || (inNbSamples == 0)) return;
+	std::vector<double> lUpper(lBoxes.begin(), lBoxes.begin()+inNbObjectives);
+	for(unsigned int i=1; i<lNbBoxes; ++i) {
+		for(unsigned int k=0; k<inNbObjectives; ++k) {
+			lUpper[k] = std::max(lUpper[k], lBoxes[i*inNbObjectives+k]);
+		}
+	}
+	double lBoundingVolume = 1.0;
+	for(unsigned int k=0; k<inNbObjectives; ++k) lBoundingVolume *= lUpper[k];
+	if(lBoundingVolume <= 0.0) return;
+
+	std::vector<double> lSample(inNbObjectives);
+	std::vector<unsigned int> lNbCovered(lNbBoxes, 0);
+	for(unsigned int s=0; s<inNbSamples; ++s) {
+		ioStream.fillUniform(&lSample[0], inNbObjectives);
+		for(unsigned int k=0; k<inNbObjectives; ++k) lSample[k] *= lUpper[k];
+		unsigned int lCovering = lNbBoxes;
+		for(unsigned int i=0; i<lNbBoxes; ++i) {
+			const double* lBox = &lBoxes[i*inNbObjectives];
+			unsigned int k=0;
+			while((k<inNbObjectives) && (lSample[k] <= lBox[k])) ++k;
+			if(k < inNbObjectives) continue;
+			if(lCovering != lNbBoxes) {
+				lCovering = lNbBoxes;
+				break;
+			}
+			lCovering = i;
+		}
+		if(lCovering != lNbBoxes) ++lNbCovered[lCovering];
+	}
+	for(unsigned int i=0; i<lNbBoxes; ++i) {
+		outContributions[i] = lBoundingVolume * double(lNbCovered[i]) / double(inNbSamples);
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Remove the boxes of null volume, and the boxes covered by another box.
+ *  \param ioBoxes Upper corner of the boxes, one row per box.
+ *  \param inNbObjectives Number of dimensions of the boxes.
+ *
+ *  Of a set of equal boxes, only one is kept.
+ */
+void EMO::Hypervolume::filterNondominated(std::vector<double>& ioBoxes, unsigned int inNbObjectives)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lNbBoxes = ioBoxes.size() / inNbObjectives;
+	std::vector<unsigned int> lOrder;
+	lOrder.reserve(lNbBoxes);
+	for(unsigned int i=0; i<lNbBoxes; ++i) {
+		unsigned int k=0;
+		while((k<inNbObjectives) && (ioBoxes[i*inNbObjectives+k] > 0.0)) ++k;
+		if(k == inNbObjectives) lOrder.push_back(i);
+	}
+	// Sorted by decreasing values, a box can only be covered by a box preceding it.
+	std::sort(lOrder.begin(), lOrder.end(), IsGreaterBoxPredicate(ioBoxes, inNbObjectives));
+	std::vector<double> lKept;
+	lKept.reserve(lOrder.size()*inNbObjectives);
+	for(unsigned int i=0; i<lOrder.size(); ++i) {
+		const double* lBox = &ioBoxes[lOrder[i]*inNbObjectives];
+		bool lCovered = false;
+		for(unsigned int j=0; (j<lKept.size()) && (lCovered==false); j+=inNbObjectives) {
+			unsigned int k=0;
+			while((k<inNbObjectives) && (lBox[k] <= lKept[j+k])) ++k;
+			lCovered = (k == inNbObjectives);
+		}
+		if(lCovered == false) lKept.insert(lKept.end(), lBox, lBox+inNbObjectives);
+	}
+	ioBoxes.swap(lKept);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Register the hypervolume parameters, shared by all the operators using them.
+ *  \param ioSystem System of the evolution.
+ *  \param outReference Handle to the reference point parameter.
+ *  \param outExactMax Handle to the maximum number of objectives of exact computations.
+ *  \param outNbSamples Handle to the number of samples of Monte-Carlo estimates.
+ */
+void EMO::Hypervolume::registerParams(System& ioSystem,
+                                      DoubleArray::Handle& outReference,
+                                      UInt::Handle& outExactMax,
+                                      UInt::Handle& outNbSamples)
+{
+	Beagle_StackTraceBeginM();
+	{
+		std::ostringstream lOSS;
+		lOSS << "Reference point of the hypervolume, with one value per objective, given in the ";
+		lOSS << "space of the fitness (e.g. the largest values of the objectives minimized with ";
+		lOSS << "FitnessMultiObjMin). The reference point should be worse than the individuals ";
+		lOSS << "on every objective. If empty, the reference point is the worst value of each ";
+		lOSS << "objective over the individuals measured, worsened by one.";
+		Register::Description lDescription(
+		    "Hypervolume reference point",
+		    "DoubleArray",
+		    "",
+		    lOSS.str()
+		);
+		outReference = castHandleT<DoubleArray>(
+		                 ioSystem.getRegister().insertEntry("ec.hv.ref", new DoubleArray, lDescription));
+	}
+	{
+		std::ostringstream lOSS;
+		lOSS << "Maximum number of objectives for which the hypervolume is computed exactly. ";
+		lOSS << "With more objectives, the hypervolume is estimated by Monte-Carlo sampling.";
+		Register::Description lDescription(
+		    "Hypervolume exact objectives",
+		    "UInt",
+		    "5",
+		    lOSS.str()
+		);
+		outExactMax = castHandleT<UInt>(
+		                ioSystem.getRegister().insertEntry("ec.hv.exactmax", new UInt(5), lDescription));
+	}
+	{
+		Register::Description lDescription(
+		    "Hypervolume samples",
+		    "UInt",
+		    "10000",
+		    "Number of points sampled by Monte-Carlo estimates of the hypervolume."
+		);
+		outNbSamples = castHandleT<UInt>(
+		                 ioSystem.getRegister().insertEntry("ec.hv.samples", new UInt(10000), lDescription));
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Set the reference point of the hypervolume.
+ *  \param outReference Reference point, all objectives being maximized.
+ *  \param inPoints Points, one row per point, all objectives being maximized.
+ *  \param inNbObjectives Number of objectives of the points.
+ *  \param inUserReference Reference point given by the user, in the space of the fitness.
+ *    If empty, the reference point is the worst value of each objective over the points,
+ *    minus one.
+ *  \param inMinimize Whether the objectives of the fitness are minimized, in which case the
+ *    user reference point is negated.
+ *  \throw Beagle::RunTimeException If the user reference point is not of the right size.
+ */
+void EMO::Hypervolume::setReference(std::vector<double>& outReference,
+                                    const std::vector<double>& inPoints,
+                                    unsigned int inNbObjectives,
+                                    const std::vector<double>& inUserReference,
+                                    bool inMinimize)
+{
+	Beagle_StackTraceBeginM();
+	outReference.resize(inNbObjectives);
+	if(inUserReference.empty() == false) {
+		if(inUserReference.size() != inNbObjectives) {
+			std::ostringstream lOSS;
+			lOSS << "The hypervolume reference point has " << inUserReference.size();
+			lOSS << " values, while the fitness has " << inNbObjectives << " objectives!";
+			throw Beagle_RunTimeExceptionM(lOSS.str());
+		}
+		for(unsigned int k=0; k<inNbObjectives; ++k) {
+			outReference[k] = inMinimize ? -inUserReference[k] : inUserReference[k];
+		}
+		return;
+	}
+	if(inPoints.empty()) {
+		outReference.assign(inNbObjectives, 0.0);
+		return;
+	}
+	outReference.assign(inPoints.begin(), inPoints.begin()+inNbObjectives);
+	for(unsigned int i=inNbObjectives; i<inPoints.size(); ++i) {
+		outReference[i%inNbObjectives] = std::min(outReference[i%inNbObjectives], inPoints[i]);
+	}
+	for(unsigned int k=0; k<inNbObjectives; ++k) outReference[k] -= 1.0;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Update the exclusive contributions of the points of a set after a point was removed.
+ *  \param ioContributions Exclusive contributions of the points, updated for the remaining ones.
+ *  \param inPoints Points, one row per point, all objectives being maximized.
+ *  \param inNbObjectives Number of objectives of the points.
+ *  \param inReference Reference point.
+ *  \param inRemoved Flags of the points removed from the set, including the last one.
+ *  \param inLastRemoved Index of the last point removed.
+ *
+ *  The contribution of a point grows by the volume it dominated jointly with the removed point,
+ *  and with no other point. This joint volume is the exclusive volume of the intersection of both
+ *  boxes, which is null unless the intersection is not covered by another point; the update is
+ *  thus much cheaper than computing the contributions again.
+ */
+void EMO::Hypervolume::updateContributions(std::vector<double>& ioContributions,
+        const std::vector<double>& inPoints,
+        unsigned int inNbObjectives,
+        const std::vector<double>& inReference,
+        const std::vector<bool>& inRemoved,
+        unsigned int inLastRemoved)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lNbPoints = inPoints.size() / inNbObjectives;
+	Beagle_AssertM(inRemoved.size() == lNbPoints);
+	std::vector<double> lBoxes;
+	clipPoints(lBoxes, inPoints, inNbObjectives, inReference);
+	const double* lRemovedBox = &lBoxes[inLastRemoved*inNbObjectives];
+	std::vector<double> lJoint(inNbObjectives);
+	std::vector<bool> lSkipped(inRemoved);
+	for(unsigned int i=0; i<lNbPoints; ++i) {
+		if(inRemoved[i]) continue;
+		const double* lBox = &lBoxes[i*inNbObjectives];
+		double lVolume = 1.0;
+		for(unsigned int k=0; k<inNbObjectives; ++k) {
+			lJoint[k] = std::min(lBox[k], lRemovedBox[k]);
+			lVolume *= lJoint[k];
+		}
+		if(lVolume <= 0.0) continue;
+		bool lCovered = false;
+		for(unsigned int j=0; (j<lNbPoints) && (lCovered==false); ++j) {
+			if((j == i) || inRemoved[j]) continue;
+			const double* lOther = &lBoxes[j*inNbObjectives];
+			unsigned int k=0;
+			while((k<inNbObjectives) && (lJoint[k] <= lOther[k])) ++k;
+			lCovered = (k == inNbObjectives);
+		}
+		if(lCovered) continue;
+		lSkipped[i] = true;
+		ioContributions[i] += computeExclusive(&lJoint[0], lBoxes, inNbObjectives, lSkipped);
+		lSkipped[i] = false;
+	}
+	Beagle_StackTraceEndM();
+}
@@ -0,0 +1,133 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/EMO/Hypervolume.hpp
+ *  \brief  Definition of the class EMO::Hypervolume.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_EMO_Hypervolume_hpp
+#define Beagle_EMO_Hypervolume_hpp
+
+#include <vector>
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+#include "Beagle/Core/RandomStream.hpp"
+#include "Beagle/Core/System.hpp"
+#include "Beagle/Core/Double.hpp"
+#include "Beagle/Core/UInt.hpp"
+
+
+namespace Beagle
+{
+namespace EMO
+{
+
+/*!
+ *  \class Hypervolume Beagle/EMO/Hypervolume.hpp "Beagle/EMO/Hypervolume.hpp"
+ *  \brief Hypervolume indicator engine, computing the volume of objective space dominated by
+ *    a set of points and the exclusive contribution of each point.
+ *  \ingroup MultiObj
+ *
+ *  Points are given as an objective matrix with one row per point, all objectives being
+ *  maximized (see NondominatedSorting::extractObjectives), and the volume is bounded by a
+ *  reference point, worse than the points on every objective. Points that are not better than
+ *  the reference point on every objective do not contribute to the hypervolume.
+ *
+ *  The exact hypervolume is computed with the WFG algorithm, the points being processed by
+ *  increasing value of the last objective, so that each exclusive hypervolume reduces to a
+ *  hypervolume in one dimension less. Two objectives are handled by a sweep in O(N log N).
+ *  As the run-time of exact algorithms is exponential in the number of objectives, Monte-Carlo
+ *  estimators are also given, sampling the box bounded by the reference point with a counter-
+ *  based random stream.
+ *
+ *  When the points of a set are removed one by one (as in SMS-EMOA), method updateContributions
+ *  updates the exclusive contributions of the remaining points, instead of computing them again.
+ *  \par Reference
+ *  L. While, L. Bradstreet, and L. Barone, "A fast way of calculating exact hypervolumes", IEEE
+ *  Trans. on Evolutionary Computation, vol. 16, no. 1, 2012.
+ */
+class Hypervolume
+{
+
+public:
+
+	static double compute(const std::vector<double>& inPoints,
+	                      unsigned int inNbObjectives,
+	                      const std::vector<double>& inReference);
+	static void   computeContributions(std::vector<double>& outContributions,
+	                                   const std::vector<double>& inPoints,
+	                                   unsigned int inNbObjectives,
+	                                   const std::vector<double>& inReference);
+	static double estimate(const std::vector<double>& inPoints,
+	                       unsigned int inNbObjectives,
+	                       const std::vector<double>& inReference,
+	                       unsigned int inNbSamples,
+	                       RandomStream& ioStream);
+	static void   estimateContributions(std::vector<double>& outContributions,
+	                                    const std::vector<double>& inPoints,
+	                                    unsigned int inNbObjectives,
+	                                    const std::vector<double>& inReference,
+	                                    unsigned int inNbSamples,
+	                                    RandomStream& ioStream);
+	static void   registerParams(System& ioSystem,
+	                             DoubleArray::Handle& outReference,
+	                             UInt::Handle& outExactMax,
+	                             UInt::Handle& outNbSamples);
+	static void   setReference(std::vector<double>& outReference,
+	                           const std::vector<double>& inPoints,
+	                           unsigned int inNbObjectives,
+	                           const std::vector<double>& inUserReference,
+	                           bool inMinimize);
+	static void   updateContributions(std::vector<double>& ioContributions,
+	                                  const std::vector<double>& inPoints,
+	                                  unsigned int inNbObjectives,
+	                                  const std::vector<double>& inReference,
+	                                  const std::vector<bool>& inRemoved,
+	                                  unsigned int inLastRemoved);
+
+protected:
+
+	static void   clipPoints(std::vector<double>& outBoxes,
+	                         const std::vector<double>& inPoints,
+	                         unsigned int inNbObjectives,
+	                         const std::vector<double>& inReference);
+	static double computeBoxes(std::vector<double>& ioBoxes, unsigned int inNbObjectives);
+	static double computeExclusive(const double* inBox,
+	                               const std::vector<double>& inBoxes,
+	                               unsigned int inNbObjectives,
+	                               const std::vector<bool>& inSkipped);
+	static void   filterNondominated(std::vector<double>& ioBoxes, unsigned int inNbObjectives);
+
+};
+
+}
+}
+
+#endif // Beagle_EMO_Hypervolume_hpp
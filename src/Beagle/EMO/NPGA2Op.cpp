@@ -38,10 +38,85 @@
 #include <cmath>
 #include <cfloat>
 #include <algorithm>
+#include <map>
 
 using namespace Beagle;
 
 
+namespace Beagle
+{
+namespace EMO
+{
+
+// Used internally to compute niche counts over a growing pool of objective vectors. The points
+// are hashed into a grid of cells as large as the niche radius, on at most three objectives, so
+// that only the points of the neighboring cells are within the niche radius of a point.
+class NicheCountGrid
+{
+public:
+	NicheCountGrid(unsigned int inNbObjectives, double inNicheRadius) :
+		mNbObjectives(inNbObjectives),
+		mNbGridObjectives(std::min(inNbObjectives, 3u)),
+		mNicheRadius(inNicheRadius)
+	{ }
+	void insert(const double* inPoint)
+	{
+		if(mNicheRadius <= 0.0) return;
+		std::vector<long> lCell(mNbGridObjectives);
+		for(unsigned int k=0; k<mNbGridObjectives; ++k) {
+			lCell[k] = long(std::floor(inPoint[k] / mNicheRadius));
+		}
+		mCells[lCell].insert(mCells[lCell].end(), inPoint, inPoint+mNbObjectives);
+	}
+	double count(const double* inPoint) const
+	{
+		if(mNicheRadius <= 0.0) return 0.0;
+		std::vector<long> lCenter(mNbGridObjectives);
+		for(unsigned int k=0; k<mNbGridObjectives; ++k) {
+			lCenter[k] = long(std::floor(inPoint[k] / mNicheRadius));
+		}
+		// Visit the 3^D neighboring cells, D being the number of objectives of the grid.
+		double lNicheCount = 0.0;
+		std::vector<long> lCell(lCenter);
+		for(unsigned int k=0; k<mNbGridObjectives; ++k) lCell[k] = lCenter[k]-1;
+		while(true) {
+			CellMap::const_iterator lIter = mCells.find(lCell);
+			if(lIter != mCells.end()) {
+				const std::vector<double>& lPoints = lIter->second;
+				for(unsigned int i=0; i<lPoints.size(); i+=mNbObjectives) {
+					double lSumSquare = 0.0;
+					for(unsigned int k=0; k<mNbObjectives; ++k) {
+						const double lDiff = inPoint[k] - lPoints[i+k];
+						lSumSquare += lDiff * lDiff;
+					}
+					const double lDistance = std::sqrt(lSumSquare);
+					if(lDistance < mNicheRadius) lNicheCount += (1.0 - (lDistance / mNicheRadius));
+				}
+			}
+			unsigned int k=0;
+			for(; k<mNbGridObjectives; ++k) {
+				if(lCell[k] < (lCenter[k]+1)) {
+					++lCell[k];
+					break;
+				}
+				lCell[k] = lCenter[k]-1;
+			}
+			if(k == mNbGridObjectives) break;
+		}
+		return lNicheCount;
+	}
+private:
+	typedef std::map< std::vector<long>, std::vector<double> > CellMap;
+	CellMap      mCells;
+	unsigned int mNbObjectives;
+	unsigned int mNbGridObjectives;
+	double       mNicheRadius;
+};
+
+}
+}
+
+
 /*!
  *  \brief Build NPGA2 selection operator.
  *  \param inName Name of the NPGA2 operator.
@@ -103,6 +178,7 @@ void EMO::NPGA2Op::registerParams(System& ioSystem)
 		mNicheRadius = castHandleT<Float>(
 		                   ioSystem.getRegister().insertEntry("ec.npga2.nicheradius", new Float(1.0f), lDescription));
 	}
+	ParetoFrontHOF::registerParams(ioSystem);
 
 	Beagle_StackTraceEndM();
 }
@@ -128,6 +204,14 @@ void EMO::NPGA2Op::operate(Deme& ioDeme, Context& ioContext)
 	Individual::Bag   lSelectedIndividual;
 	const Factory&    lFactory = ioContext.getSystem().getFactory();
 
+	// The niche counts over the selected individuals are computed with a grid of their objectives,
+	// which is filled as the individuals are selected.
+	std::vector<double> lObjectives;
+	unsigned int lNbObjectives = 0;
+	const bool lUseGrid =
+	    NondominatedSorting::extractObjectives(lObjectives, lNbObjectives, ioDeme) && (lNbObjectives != 0);
+	NicheCountGrid lNicheGrid(lNbObjectives, mNicheRadius->getWrappedValue());
+
 	// Generate new generation by selection
 	for(unsigned int i=0; i<ioDeme.size(); ++i) {
 
@@ -158,9 +242,13 @@ void EMO::NPGA2Op::operate(Deme& ioDeme, Context& ioContext)
 		Beagle_AssertM(lNDParticipants.size() != 0);
 		unsigned int lWinner = lNDParticipants[0];
 		if(lNDParticipants.size() > 1) {
-			float lLowestNicheCount = evalNicheCount(*ioDeme[lNDParticipants[0]], lSelectedIndividual);
+			double lLowestNicheCount = lUseGrid ?
+			                           lNicheGrid.count(&lObjectives[lNDParticipants[0]*lNbObjectives]) :
+			                           evalNicheCount(*ioDeme[lNDParticipants[0]], lSelectedIndividual);
 			for(unsigned int j=1; j<lNDParticipants.size(); ++j) {
-				float lNicheCount = evalNicheCount(*ioDeme[lNDParticipants[j]], lSelectedIndividual);
+				double lNicheCount = lUseGrid ?
+				                     lNicheGrid.count(&lObjectives[lNDParticipants[j]*lNbObjectives]) :
+				                     evalNicheCount(*ioDeme[lNDParticipants[j]], lSelectedIndividual);
 				if(lNicheCount < lLowestNicheCount) {
 					lLowestNicheCount = lNicheCount;
 					lWinner = lNDParticipants[j];
@@ -169,6 +257,7 @@ void EMO::NPGA2Op::operate(Deme& ioDeme, Context& ioContext)
 		}
 
 		// Put winner in selected individual bag
+		if(lUseGrid) lNicheGrid.insert(&lObjectives[lWinner*lNbObjectives]);
 		if(lAlreadySelectedIndiv[lWinner]) {
 			std::string lIndividualType = ioDeme[lWinner]->getType();
 			Individual::Alloc::Handle lIndividualAlloc =
@@ -67,6 +67,11 @@ namespace EMO
  *
  *  The NPGA2 operator implement the multiobjective evolutionary algorithm NPGA 2
  *  (Niched Pareto Genetic Algorithm) of Erickson, Mayer, and Horn.
+ *
+ *  With fitness of type FitnessMultiObj or FitnessMultiObjMin, the niche counts are computed
+ *  from a grid of the objectives of the selected individuals, with cells as large as the niche
+ *  radius, so that only the individuals of the neighboring cells are compared. Other fitness
+ *  types are compared to every selected individual with method Fitness::getDistance.
  *  \par Reference
  *  Mark Erickson, Alex Mayer, and Jeffrey Horn, "The Niched Pareto Genetic Algorithm 2
  *  Applied to the Design of Groundwater Remediation Systems", First International
@@ -109,18 +109,7 @@ void EMO::NSGA2Op::applyAsReplacementStrategy(Deme& ioDeme, Context& ioContext)
 	RouletteT<unsigned int> lRoulette;
 	buildRoulette(lRoulette, ioContext);
 	Individual::Bag lOffsprings(ioDeme);
-	for(unsigned int i=0; i<lLambda; ++i) {
-		unsigned int lIndexBreeder = lRoulette.select(ioContext.getSystem().getRandomizer());
-		BreederNode::Handle lSelectedBreeder=getRootNode();
-		for(unsigned int j=0; j<lIndexBreeder; ++j)
-			lSelectedBreeder=lSelectedBreeder->getNextSibling();
-		Beagle_NonNullPointerAssertM(lSelectedBreeder);
-		Beagle_NonNullPointerAssertM(lSelectedBreeder->getBreederOp());
-		Individual::Handle lBredIndiv =
-		    lSelectedBreeder->getBreederOp()->breed(ioDeme, lSelectedBreeder->getFirstChild(), ioContext);
-		Beagle_NonNullPointerAssertM(lBredIndiv);
-		lOffsprings.push_back(lBredIndiv);
-	}
+	breedOffsprings(lLambda, ioDeme, lOffsprings, lRoulette, ioContext);
 
 	// Fast non-dominated sorting, followed by insertion of the first Pareto fronts.
 	Beagle_LogVerboseM(
@@ -141,15 +130,14 @@ void EMO::NSGA2Op::applyAsReplacementStrategy(Deme& ioDeme, Context& ioContext)
 	for(unsigned int l=0; l<lParetoFronts.back().size(); ++l) {
 		lLastFrontIndiv.push_back(lOffsprings[lParetoFronts.back()[l]]);
 	}
-	NSGA2Op::Distances lDistances;
 	Beagle_LogVerboseM(
 	    ioContext.getSystem().getLogger(),
-	    "Computing crowding distance on the " << uint2ordinal(lParetoFronts.size()) <<
+	    "Reducing the " << uint2ordinal(lParetoFronts.size()) <<
 	    " Pareto front, which is made of " << lParetoFronts.back().size() << " individuals"
 	);
-	evalCrowdingDistance(lDistances, lLastFrontIndiv);
+	reduceLastFront(lLastFrontIndiv, ioDeme.size()-lIndexDeme, ioContext);
 	for(unsigned int m=0; lIndexDeme<ioDeme.size(); ++m) {
-		ioDeme[lIndexDeme++] = lLastFrontIndiv[lDistances[m].second];
+		ioDeme[lIndexDeme++] = lLastFrontIndiv[m];
 	}
 	Beagle_StackTraceEndM();
 }
@@ -184,15 +172,14 @@ void EMO::NSGA2Op::applyAsStandardOperator(Deme& ioDeme, Context& ioContext)
 	for(unsigned int l=0; l<lParetoFronts.back().size(); ++l) {
 		lLastFrontIndiv.push_back(lSortedPop[lParetoFronts.back()[l]]);
 	}
-	NSGA2Op::Distances lDistances;
 	Beagle_LogVerboseM(
 	    ioContext.getSystem().getLogger(),
-	    "Computing crowding distance on the " << uint2ordinal(lParetoFronts.size()) <<
-	    " Pareto front, which is made of " << uint2ordinal(lParetoFronts.back().size()) << " individuals"
+	    "Reducing the " << uint2ordinal(lParetoFronts.size()) <<
+	    " Pareto front, which is made of " << lParetoFronts.back().size() << " individuals"
 	);
-	evalCrowdingDistance(lDistances, lLastFrontIndiv);
+	reduceLastFront(lLastFrontIndiv, lDesiredPopSize-lIndexDeme, ioContext);
 	for(unsigned int m=0; lIndexDeme<lDesiredPopSize; ++m) {
-		ioDeme[lIndexDeme++] = lLastFrontIndiv[lDistances[m].second];
+		ioDeme[lIndexDeme++] = lLastFrontIndiv[m];
 	}
 	ioDeme.resize(lDesiredPopSize);
 	Beagle_StackTraceEndM();
@@ -236,6 +223,29 @@ void EMO::NSGA2Op::evalCrowdingDistance(NSGA2Op::Distances& outDistances,
 	Beagle_StackTraceEndM();
 }
 
+/*!
+ *  \brief Reduce the last Pareto front inserted in the population, using crowding distance.
+ *  \param ioLastFront Individuals of the last Pareto front, reduced to the kept individuals.
+ *  \param inNbKept Number of individuals to keep.
+ *  \param ioContext Evolutionary context.
+ *
+ *  The individuals of largest crowding distance are kept.
+ */
+void EMO::NSGA2Op::reduceLastFront(Individual::Bag& ioLastFront,
+                                   unsigned int inNbKept,
+                                   Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	if(inNbKept >= ioLastFront.size()) return;
+	NSGA2Op::Distances lDistances;
+	evalCrowdingDistance(lDistances, ioLastFront);
+	Individual::Bag lKept;
+	for(unsigned int i=0; i<inNbKept; ++i) lKept.push_back(ioLastFront[lDistances[i].second]);
+	ioLastFront = lKept;
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Register the parameters of this operator.
  *  \param ioSystem Reference to the system to use for the initialization.
@@ -275,6 +285,23 @@ void EMO::NSGA2Op::registerParams(System& ioSystem)
 		mLMRatio = castHandleT<Float>(
 		               ioSystem.getRegister().insertEntry(mLMRatioName, new Float(1.0f), lDescription));
 	}
+	{
+		std::ostringstream lOSS;
+		lOSS << "Non-dominated sorting algorithm. Value 'dc' is for the divide-and-conquer ";
+		lOSS << "algorithm of Jensen and Fortin et al. (a sweep with two objectives), 'ens' ";
+		lOSS << "is for the efficient non-dominated sort of Zhang et al., and 'pairwise' is ";
+		lOSS << "for the fast non-dominated sort of Deb et al. Fitness types other than ";
+		lOSS << "FitnessMultiObj and FitnessMultiObjMin are always sorted pairwise.";
+		Register::Description lDescription(
+		    "Non-dominated sorting algorithm",
+		    "String",
+		    "dc",
+		    lOSS.str()
+		);
+		mSortingAlgo = castHandleT<String>(
+		                   ioSystem.getRegister().insertEntry("ec.ndsort.algo", new String("dc"), lDescription));
+	}
+	ParetoFrontHOF::registerParams(ioSystem);
 
 	Beagle_StackTraceEndM();
 }
@@ -355,11 +382,13 @@ void EMO::NSGA2Op::readWithSystem(PACC::XML::ConstIterator inIter, System& ioSys
 
 
 /*!
- *  \brief Do fast non-dominated sort and evaluate Pareto fronts of data up to given size.
+ *  \brief Do non-dominated sort and evaluate Pareto fronts of data up to given size.
  *  \param outParetoFronts Pareto fronts from the fast ND sort.
  *  \param inSortStop Number of individuals on the Pareto fronts needed to stop the sort.
  *  \param inIndividualPool Pool of individuals to get next Pareto front of.
  *  \param ioContext Evolutionary context.
+ *
+ *  The sorting algorithm is given by parameter "ec.ndsort.algo".
  */
 void EMO::NSGA2Op::sortFastND(NSGA2Op::Fronts& outParetoFronts,
                          unsigned int inSortStop,
@@ -367,58 +396,13 @@ void EMO::NSGA2Op::sortFastND(NSGA2Op::Fronts& outParetoFronts,
                          Context& ioContext) const
 {
 	Beagle_StackTraceBeginM();
-	outParetoFronts.clear();
-	if(inSortStop == 0) return;
-	outParetoFronts.resize(1);
-	unsigned int lParetoSorted = 0;
-	// N: Number of dominating individuals
-	std::vector<unsigned int> lN(inIndividualPool.size(), 0);
-	// S: Set of dominated individuals
-	Fronts lS(inIndividualPool.size());
-
-	// First pass to get first Pareto front and domination sets
-	for(unsigned int i=0; i<inIndividualPool.size(); ++i) {
-		Fitness::Handle lFitI = inIndividualPool[i]->getFitness();
-		for(unsigned int j=(i+1); j<inIndividualPool.size(); ++j) {
-			Fitness::Handle lFitJ = inIndividualPool[j]->getFitness();
-			if(lFitJ->isDominated(*lFitI)) {
-				lS[i].push_back(j);  // Add index j to dominated set of i
-				++lN[j];             // Increment domination counter of j
-			} else if(lFitI->isDominated(*lFitJ)) {
-				lS[j].push_back(i);  // Add index i to dominated set of j
-				++lN[i];             // Increment domination counter of i
-			}
-		}
-		if(lN[i] == 0) {         // If i is non-dominated
-			outParetoFronts.back().push_back(i);
-			++lParetoSorted;
-		}
-	}
-
-	Beagle_LogVerboseM(
-	    ioContext.getSystem().getLogger(),
-	    uint2ordinal(1)+std::string(" Pareto front consists of ")+
-	    uint2str(outParetoFronts.back().size())+" individuals"
-	);
-
-	// Continue ranking until individual pool is empty or stop criterion reach
-	while((lParetoSorted < inIndividualPool.size()) && (lParetoSorted < inSortStop)) {
-		unsigned int lIndexLastFront = outParetoFronts.size() - 1;
-		outParetoFronts.resize(outParetoFronts.size() + 1);
-		for(unsigned int k=0; k<outParetoFronts[lIndexLastFront].size(); ++k) {
-			unsigned int lIndexPk = outParetoFronts[lIndexLastFront][k];
-			for(unsigned int l=0; l<lS[lIndexPk].size(); ++l) {
-				unsigned int lIndexSl = lS[lIndexPk][l];
-				if(--lN[lIndexSl] == 0) {
-					outParetoFronts.back().push_back(lIndexSl);
-					++lParetoSorted;
-				}
-			}
-		}
+	NondominatedSorting::sort(outParetoFronts, inSortStop, inIndividualPool,
+	                          NondominatedSorting::parseAlgorithm(mSortingAlgo->getWrappedValue()));
+	for(unsigned int i=0; i<outParetoFronts.size(); ++i) {
 		Beagle_LogVerboseM(
 		    ioContext.getSystem().getLogger(),
-		    uint2ordinal(outParetoFronts.size())+std::string(" Pareto front consists of ")+
-		    uint2str(outParetoFronts.back().size())+" individuals"
+		    uint2ordinal(i+1)+std::string(" Pareto front consists of ")+
+		    uint2str(outParetoFronts[i].size())+" individuals"
 		);
 	}
 	Beagle_StackTraceEndM();
@@ -50,6 +50,7 @@
 #include "Beagle/Core/Operator.hpp"
 #include "Beagle/Core/ReplacementStrategyOp.hpp"
 #include "Beagle/Core/Fitness.hpp"
+#include "Beagle/EMO/NondominatedSorting.hpp"
 
 
 namespace Beagle
@@ -108,12 +109,14 @@ protected:
 	void applyAsReplacementStrategy(Deme& ioDeme, Context& ioContext);
 	void applyAsStandardOperator(Deme& ioDeme, Context& ioContext);
 	void evalCrowdingDistance(Distances& outDistances, const Individual::Bag& inIndividualPool) const;
+	virtual void reduceLastFront(Individual::Bag& ioLastFront, unsigned int inNbKept, Context& ioContext) const;
 	void sortFastND(Fronts& outParetoFronts, unsigned int inSortStop,
 	                const Individual::Bag& inIndividualPool, Context& ioContext) const;
 
 	UIntArray::Handle mPopSize;      //!< Population size for the evolution.
 	Float::Handle     mLMRatio;      //!< (Lambda / Mu) ratio to use for replacement operator.
 	std::string       mLMRatioName;  //!< (Lambda / Mu) ratio parameter name used in register.
+	String::Handle    mSortingAlgo;  //!< Non-dominated sorting algorithm used.
 
 };
 
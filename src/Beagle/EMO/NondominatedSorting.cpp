@@ -0,0 +1,519 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/EMO/NondominatedSorting.cpp
+ *  \brief  Source code of class EMO::NondominatedSorting.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/EMO.hpp"
+
+#include <algorithm>
+#include <map>
+
+using namespace Beagle;
+
+
+namespace Beagle
+{
+namespace EMO
+{
+
+// Used internally to order the rows of an objective matrix lexicographically.
+class IsLessObjectivesPredicate
+{
+public:
+	IsLessObjectivesPredicate(const std::vector<double>& inObjectives, unsigned int inNbObjectives) :
+		mObjectives(inObjectives),
+		mNbObjectives(inNbObjectives)
+	{ }
+	inline bool operator()(unsigned int inLeft, unsigned int inRight) const
+	{
+		const double* lLeft = &mObjectives[inLeft*mNbObjectives];
+		const double* lRight = &mObjectives[inRight*mNbObjectives];
+		for(unsigned int i=0; i<mNbObjectives; ++i) {
+			if(lLeft[i] < lRight[i]) return true;
+			if(lLeft[i] > lRight[i]) return false;
+		}
+		return false;
+	}
+private:
+	const std::vector<double>& mObjectives;
+	unsigned int               mNbObjectives;
+};
+
+// Used internally to compute the Pareto ranks of distinct points, sorted lexicographically.
+// Objectives are minimized, and the first objective is given by the order of the points.
+class NondominatedRanker
+{
+public:
+	typedef std::vector<unsigned int> Indices;
+
+	NondominatedRanker(const std::vector<double>& inPoints,
+	                   unsigned int inNbObjectives,
+	                   std::vector<unsigned int>& ioRanks) :
+		mPoints(inPoints),
+		mNbObjectives(inNbObjectives),
+		mRanks(ioRanks)
+	{ }
+
+	// Divide-and-conquer ranking of all the points.
+	void rankDivideConquer()
+	{
+		Indices lAll(mRanks.size());
+		for(unsigned int i=0; i<lAll.size(); ++i) lAll[i] = i;
+		if(mNbObjectives == 1) {
+			for(unsigned int i=1; i<lAll.size(); ++i) mRanks[i] = mRanks[i-1] + 1;
+		} else helperA(lAll, mNbObjectives);
+	}
+
+	// Efficient non-dominated sort with binary search over the fronts.
+	void rankEfficient()
+	{
+		std::vector<Indices> lFronts;
+		for(unsigned int i=0; i<mRanks.size(); ++i) {
+			unsigned int lLow = 0;
+			unsigned int lHigh = lFronts.size();
+			while(lLow < lHigh) {
+				const unsigned int lMiddle = (lLow + lHigh) / 2;
+				bool lDominated = false;
+				for(unsigned int j=lFronts[lMiddle].size(); (j>0) && !lDominated; --j) {
+					lDominated = dominates(lFronts[lMiddle][j-1], i, mNbObjectives);
+				}
+				if(lDominated) lLow = lMiddle + 1;
+				else lHigh = lMiddle;
+			}
+			if(lLow == lFronts.size()) lFronts.resize(lLow + 1);
+			lFronts[lLow].push_back(i);
+			mRanks[i] = lLow;
+		}
+	}
+
+private:
+
+	typedef std::map<double,unsigned int> Staircase;
+
+	inline double getValue(unsigned int inPoint, unsigned int inObjective) const
+	{
+		return mPoints[inPoint*mNbObjectives + inObjective];
+	}
+
+	// Whether point inLeft, placed before point inRight, dominates it on objectives [0,inK).
+	inline bool dominates(unsigned int inLeft, unsigned int inRight, unsigned int inK) const
+	{
+		if(inLeft >= inRight) return false;
+		for(unsigned int i=1; i<inK; ++i) {
+			if(getValue(inLeft,i) > getValue(inRight,i)) return false;
+		}
+		return true;
+	}
+
+	inline void updateRank(unsigned int inDominating, unsigned int inDominated)
+	{
+		if(mRanks[inDominated] <= mRanks[inDominating]) mRanks[inDominated] = mRanks[inDominating] + 1;
+	}
+
+	// Number of fronts dominating a value, using a staircase of (value, rank+1).
+	static inline unsigned int queryStaircase(const Staircase& inStaircase, double inValue)
+	{
+		Staircase::const_iterator lIter = inStaircase.upper_bound(inValue);
+		if(lIter == inStaircase.begin()) return 0;
+		--lIter;
+		return lIter->second;
+	}
+
+	static inline void insertStaircase(Staircase& ioStaircase, double inValue, unsigned int inLevel)
+	{
+		if(queryStaircase(ioStaircase, inValue) >= inLevel) return;
+		Staircase::iterator lIter = ioStaircase.lower_bound(inValue);
+		while((lIter != ioStaircase.end()) && (lIter->second <= inLevel)) ioStaircase.erase(lIter++);
+		ioStaircase[inValue] = inLevel;
+	}
+
+	static void merge(Indices& outMerged, const Indices& inFirst, const Indices& inSecond)
+	{
+		outMerged.resize(inFirst.size() + inSecond.size());
+		std::merge(inFirst.begin(), inFirst.end(), inSecond.begin(), inSecond.end(), outMerged.begin());
+	}
+
+	double median(const Indices& inFirst, const Indices& inSecond, unsigned int inObjective) const
+	{
+		std::vector<double> lValues;
+		lValues.reserve(inFirst.size() + inSecond.size());
+		for(unsigned int i=0; i<inFirst.size(); ++i) lValues.push_back(getValue(inFirst[i], inObjective));
+		for(unsigned int i=0; i<inSecond.size(); ++i) lValues.push_back(getValue(inSecond[i], inObjective));
+		std::nth_element(lValues.begin(), lValues.begin() + lValues.size()/2, lValues.end());
+		return lValues[lValues.size()/2];
+	}
+
+	void split(const Indices& inPoints, unsigned int inObjective, double inMedian,
+	           Indices& outLess, Indices& outEqual, Indices& outGreater) const
+	{
+		for(unsigned int i=0; i<inPoints.size(); ++i) {
+			const double lValue = getValue(inPoints[i], inObjective);
+			if(lValue < inMedian) outLess.push_back(inPoints[i]);
+			else if(lValue > inMedian) outGreater.push_back(inPoints[i]);
+			else outEqual.push_back(inPoints[i]);
+		}
+	}
+
+	// Rank the points of S among themselves on objectives [0,inK), the points being
+	// equal on the other objectives.
+	void helperA(const Indices& inS, unsigned int inK)
+	{
+		if(inS.size() < 2) return;
+		if(inS.size() == 2) {
+			if(dominates(inS[0], inS[1], inK)) updateRank(inS[0], inS[1]);
+			return;
+		}
+		if(inK == 2) {
+			Staircase lStaircase;
+			for(unsigned int i=0; i<inS.size(); ++i) {
+				const double lValue = getValue(inS[i], 1);
+				const unsigned int lLevel = queryStaircase(lStaircase, lValue);
+				if(mRanks[inS[i]] < lLevel) mRanks[inS[i]] = lLevel;
+				insertStaircase(lStaircase, lValue, mRanks[inS[i]] + 1);
+			}
+			return;
+		}
+		const double lMedian = median(inS, Indices(), inK-1);
+		Indices lLess, lEqual, lGreater;
+		split(inS, inK-1, lMedian, lLess, lEqual, lGreater);
+		if(lLess.empty() && lGreater.empty()) {
+			helperA(inS, inK-1);
+			return;
+		}
+		helperA(lLess, inK);
+		helperB(lLess, lEqual, inK-1);
+		helperA(lEqual, inK-1);
+		Indices lLessEqual;
+		merge(lLessEqual, lLess, lEqual);
+		helperB(lLessEqual, lGreater, inK-1);
+		helperA(lGreater, inK);
+	}
+
+	// Update the ranks of the points of H with the ranks of the points of L, on objectives
+	// [0,inK), the points of L being not greater than the points of H on the other objectives.
+	void helperB(const Indices& inL, const Indices& inH, unsigned int inK)
+	{
+		if(inL.empty() || inH.empty()) return;
+		if((inL.size() == 1) || (inH.size() == 1)) {
+			for(unsigned int i=0; i<inL.size(); ++i) {
+				for(unsigned int j=0; j<inH.size(); ++j) {
+					if(dominates(inL[i], inH[j], inK)) updateRank(inL[i], inH[j]);
+				}
+			}
+			return;
+		}
+		if(inK == 2) {
+			Staircase lStaircase;
+			unsigned int j=0;
+			for(unsigned int i=0; i<inH.size(); ++i) {
+				for(; (j<inL.size()) && (inL[j]<inH[i]); ++j) {
+					insertStaircase(lStaircase, getValue(inL[j], 1), mRanks[inL[j]] + 1);
+				}
+				const unsigned int lLevel = queryStaircase(lStaircase, getValue(inH[i], 1));
+				if(mRanks[inH[i]] < lLevel) mRanks[inH[i]] = lLevel;
+			}
+			return;
+		}
+		double lMaxL = getValue(inL[0], inK-1);
+		double lMinL = lMaxL;
+		for(unsigned int i=1; i<inL.size(); ++i) {
+			lMaxL = std::max(lMaxL, getValue(inL[i], inK-1));
+			lMinL = std::min(lMinL, getValue(inL[i], inK-1));
+		}
+		double lMaxH = getValue(inH[0], inK-1);
+		double lMinH = lMaxH;
+		for(unsigned int i=1; i<inH.size(); ++i) {
+			lMaxH = std::max(lMaxH, getValue(inH[i], inK-1));
+			lMinH = std::min(lMinH, getValue(inH[i], inK-1));
+		}
+		if(lMaxL <= lMinH) {
+			helperB(inL, inH, inK-1);
+			return;
+		}
+		if(lMinL > lMaxH) return;
+		const double lMedian = median(inL, inH, inK-1);
+		Indices lL1, lL2, lL3, lH1, lH2, lH3;
+		split(inL, inK-1, lMedian, lL1, lL2, lL3);
+		split(inH, inK-1, lMedian, lH1, lH2, lH3);
+		helperB(lL1, lH1, inK);
+		Indices lL12, lH23;
+		merge(lL12, lL1, lL2);
+		merge(lH23, lH2, lH3);
+		helperB(lL12, lH23, inK-1);
+		helperB(lL3, lH3, inK);
+	}
+
+	const std::vector<double>& mPoints;       // Distinct points, sorted lexicographically.
+	unsigned int               mNbObjectives; // Number of objectives.
+	std::vector<unsigned int>& mRanks;        // Pareto ranks of the points.
+};
+
+}
+}
+
+
+/*!
+ *  \brief Extract the objectives of individuals into a matrix.
+ *  \param outObjectives Objective matrix, one row per individual, larger values being better.
+ *  \param outNbObjectives Number of objectives (columns) of the matrix.
+ *  \param inIndividualPool Individuals to extract the objectives of.
+ *  \return True if the objectives are extracted, false if the fitness of some individuals
+ *    is invalid or is not of type FitnessMultiObj or FitnessMultiObjMin.
+ *
+ *  The objectives of FitnessMultiObjMin measures are negated, so that all the objectives
+ *  of the matrix are maximized.
+ */
+bool EMO::NondominatedSorting::extractObjectives(std::vector<double>& outObjectives,
+        unsigned int& outNbObjectives,
+        const Individual::Bag& inIndividualPool)
+{
+	Beagle_StackTraceBeginM();
+	outObjectives.clear();
+	outNbObjectives = 0;
+	std::vector<double> lRow;
+	for(unsigned int i=0; i<inIndividualPool.size(); ++i) {
+		unsigned int lNbObjectives = 0;
+		if(extractObjectives(lRow, lNbObjectives, *inIndividualPool[i]) == false) return false;
+		if(i == 0) {
+			outNbObjectives = lNbObjectives;
+			outObjectives.reserve(outNbObjectives * inIndividualPool.size());
+		} else if(lNbObjectives != outNbObjectives) return false;
+		outObjectives.insert(outObjectives.end(), lRow.begin(), lRow.end());
+	}
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Extract the objectives of an individual into a vector.
+ *  \param outObjectives Objectives of the individual, larger values being better.
+ *  \param outNbObjectives Number of objectives of the individual.
+ *  \param inIndividual Individual to extract the objectives of.
+ *  \return True if the objectives are extracted, false if the fitness of the individual
+ *    is invalid or is not of type FitnessMultiObj or FitnessMultiObjMin.
+ */
+bool EMO::NondominatedSorting::extractObjectives(std::vector<double>& outObjectives,
+        unsigned int& outNbObjectives,
+        const Individual& inIndividual)
+{
+	Beagle_StackTraceBeginM();
+	outObjectives.clear();
+	outNbObjectives = 0;
+	const Fitness::Handle lFitness = inIndividual.getFitness();
+	if((lFitness == NULL) || (lFitness->isValid() == false)) return false;
+	const std::string& lType = lFitness->getType();
+	bool lMinimize = false;
+	if(lType == "FitnessMultiObjMin") lMinimize = true;
+	else if(lType != "FitnessMultiObj") return false;
+	const FitnessMultiObj& lFitnessMO = castObjectT<const FitnessMultiObj&>(*lFitness);
+	outNbObjectives = lFitnessMO.size();
+	outObjectives.resize(outNbObjectives);
+	for(unsigned int j=0; j<outNbObjectives; ++j) {
+		outObjectives[j] = lMinimize ? -lFitnessMO[j] : lFitnessMO[j];
+	}
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the non-dominated sorting algorithm associated to a name.
+ *  \param inName Name of the algorithm, "dc", "ens" or "pairwise".
+ *  \return Algorithm associated to the name.
+ *  \throw Beagle::RunTimeException If the name is not valid.
+ */
+EMO::NondominatedSorting::Algorithm EMO::NondominatedSorting::parseAlgorithm(const std::string& inName)
+{
+	Beagle_StackTraceBeginM();
+	if(inName == "dc") return eDivideConquer;
+	if(inName == "ens") return eEfficient;
+	if(inName == "pairwise") return ePairwise;
+	std::ostringstream lOSS;
+	lOSS << "Non-dominated sorting algorithm '" << inName << "' is not valid; ";
+	lOSS << "valid algorithms are 'dc', 'ens' and 'pairwise'!";
+	throw Beagle_RunTimeExceptionM(lOSS.str());
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Compute the Pareto ranks of the rows of an objective matrix.
+ *  \param outRanks Pareto rank of each row, 0 being the first Pareto front.
+ *  \param inObjectives Objective matrix, one row per point, larger values being better.
+ *  \param inNbObjectives Number of objectives (columns) of the matrix.
+ *  \param inAlgorithm Algorithm used, the pairwise algorithm being replaced by "ens".
+ */
+void EMO::NondominatedSorting::rankObjectives(std::vector<unsigned int>& outRanks,
+        const std::vector<double>& inObjectives,
+        unsigned int inNbObjectives,
+        Algorithm inAlgorithm)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lNbPoints = (inNbObjectives == 0) ? 0 : (inObjectives.size() / inNbObjectives);
+	outRanks.assign(lNbPoints, 0);
+	if((lNbPoints < 2) || (inNbObjectives == 0)) return;
+
+	// Objectives are minimized internally, and points are sorted lexicographically.
+	std::vector<double> lNegated(inObjectives.size());
+	for(unsigned int i=0; i<inObjectives.size(); ++i) lNegated[i] = -inObjectives[i];
+	std::vector<unsigned int> lOrder(lNbPoints);
+	for(unsigned int i=0; i<lNbPoints; ++i) lOrder[i] = i;
+	IsLessObjectivesPredicate lIsLess(lNegated, inNbObjectives);
+	std::sort(lOrder.begin(), lOrder.end(), lIsLess);
+
+	// Duplicated points share the same rank, only one copy is sorted.
+	std::vector<double> lPoints;
+	lPoints.reserve(inObjectives.size());
+	std::vector<unsigned int> lDistinct(lNbPoints);
+	unsigned int lNbDistinct = 0;
+	for(unsigned int i=0; i<lNbPoints; ++i) {
+		if((i == 0) || lIsLess(lOrder[i-1], lOrder[i])) {
+			lPoints.insert(lPoints.end(),
+			               lNegated.begin() + (lOrder[i]*inNbObjectives),
+			               lNegated.begin() + ((lOrder[i]+1)*inNbObjectives));
+			++lNbDistinct;
+		}
+		lDistinct[lOrder[i]] = lNbDistinct - 1;
+	}
+
+	std::vector<unsigned int> lRanks(lNbDistinct, 0);
+	NondominatedRanker lRanker(lPoints, inNbObjectives, lRanks);
+	if(inAlgorithm == eDivideConquer) lRanker.rankDivideConquer();
+	else lRanker.rankEfficient();
+	for(unsigned int i=0; i<lNbPoints; ++i) outRanks[i] = lRanks[lDistinct[i]];
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Sort individuals into Pareto fronts.
+ *  \param outParetoFronts Pareto fronts, each made of the indices of its individuals.
+ *  \param inSortStop Minimum number of individuals to sort, fronts are not computed further.
+ *  \param inIndividualPool Individuals to sort.
+ *  \param inAlgorithm Sorting algorithm to use.
+ *
+ *  The indices of each front are sorted in increasing order, except with the pairwise
+ *  algorithm, which keeps the order in which the individuals are found non-dominated.
+ */
+void EMO::NondominatedSorting::sort(NondominatedSorting::Fronts& outParetoFronts,
+                                    unsigned int inSortStop,
+                                    const Individual::Bag& inIndividualPool,
+                                    Algorithm inAlgorithm)
+{
+	Beagle_StackTraceBeginM();
+	outParetoFronts.clear();
+	if(inSortStop == 0) return;
+
+	std::vector<double> lObjectives;
+	unsigned int lNbObjectives = 0;
+	if((inAlgorithm == ePairwise) ||
+	        (extractObjectives(lObjectives, lNbObjectives, inIndividualPool) == false)) {
+		sortPairwise(outParetoFronts, inSortStop, inIndividualPool);
+		return;
+	}
+
+	std::vector<unsigned int> lRanks;
+	rankObjectives(lRanks, lObjectives, lNbObjectives, inAlgorithm);
+	std::vector<unsigned int> lFrontSizes;
+	for(unsigned int i=0; i<lRanks.size(); ++i) {
+		if(lRanks[i] >= lFrontSizes.size()) lFrontSizes.resize(lRanks[i]+1, 0);
+		++lFrontSizes[lRanks[i]];
+	}
+	unsigned int lNbFronts = 0;
+	for(unsigned int lSorted=0; (lNbFronts<lFrontSizes.size()) && (lSorted<inSortStop); ++lNbFronts) {
+		lSorted += lFrontSizes[lNbFronts];
+	}
+	outParetoFronts.resize(std::max(lNbFronts, 1u));
+	for(unsigned int i=0; i<lNbFronts; ++i) outParetoFronts[i].reserve(lFrontSizes[i]);
+	for(unsigned int i=0; i<lRanks.size(); ++i) {
+		if(lRanks[i] < lNbFronts) outParetoFronts[lRanks[i]].push_back(i);
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Sort individuals into Pareto fronts with the fast non-dominated sort of Deb et al.
+ *  \param outParetoFronts Pareto fronts, each made of the indices of its individuals.
+ *  \param inSortStop Minimum number of individuals to sort, fronts are not computed further.
+ *  \param inIndividualPool Individuals to sort.
+ */
+void EMO::NondominatedSorting::sortPairwise(NondominatedSorting::Fronts& outParetoFronts,
+        unsigned int inSortStop,
+        const Individual::Bag& inIndividualPool)
+{
+	Beagle_StackTraceBeginM();
+	outParetoFronts.clear();
+	if(inSortStop == 0) return;
+	outParetoFronts.resize(1);
+	unsigned int lParetoSorted = 0;
+	// N: Number of dominating individuals
+	std::vector<unsigned int> lN(inIndividualPool.size(), 0);
+	// S: Set of dominated individuals
+	Fronts lS(inIndividualPool.size());
+
+	// First pass to get first Pareto front and domination sets
+	for(unsigned int i=0; i<inIndividualPool.size(); ++i) {
+		Fitness::Handle lFitI = inIndividualPool[i]->getFitness();
+		for(unsigned int j=(i+1); j<inIndividualPool.size(); ++j) {
+			Fitness::Handle lFitJ = inIndividualPool[j]->getFitness();
+			if(lFitJ->isDominated(*lFitI)) {
+				lS[i].push_back(j);  // Add index j to dominated set of i
+				++lN[j];             // Increment domination counter of j
+			} else if(lFitI->isDominated(*lFitJ)) {
+				lS[j].push_back(i);  // Add index i to dominated set of j
+				++lN[i];             // Increment domination counter of i
+			}
+		}
+		if(lN[i] == 0) {         // If i is non-dominated
+			outParetoFronts.back().push_back(i);
+			++lParetoSorted;
+		}
+	}
+
+	// Continue ranking until individual pool is empty or stop criterion reach
+	while((lParetoSorted < inIndividualPool.size()) && (lParetoSorted < inSortStop)) {
+		unsigned int lIndexLastFront = outParetoFronts.size() - 1;
+		outParetoFronts.resize(outParetoFronts.size() + 1);
+		for(unsigned int k=0; k<outParetoFronts[lIndexLastFront].size(); ++k) {
+			unsigned int lIndexPk = outParetoFronts[lIndexLastFront][k];
+			for(unsigned int l=0; l<lS[lIndexPk].size(); ++l) {
+				unsigned int lIndexSl = lS[lIndexPk][l];
+				if(--lN[lIndexSl] == 0) {
+					outParetoFronts.back().push_back(lIndexSl);
+					++lParetoSorted;
+				}
+			}
+		}
+	}
+	Beagle_StackTraceEndM();
+}
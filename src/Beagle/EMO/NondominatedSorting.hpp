@@ -0,0 +1,118 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/EMO/NondominatedSorting.hpp
+ *  \brief  Definition of the class EMO::NondominatedSorting.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_EMO_NondominatedSorting_hpp
+#define Beagle_EMO_NondominatedSorting_hpp
+
+#include <string>
+#include <vector>
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+#include "Beagle/Core/Individual.hpp"
+
+
+namespace Beagle
+{
+namespace EMO
+{
+
+/*!
+ *  \class NondominatedSorting Beagle/EMO/NondominatedSorting.hpp "Beagle/EMO/NondominatedSorting.hpp"
+ *  \brief Non-dominated sorting engine, partitioning individuals into Pareto fronts.
+ *  \ingroup MultiObj
+ *
+ *  The objectives of the individuals are first extracted into a packed matrix, from which the
+ *  Pareto ranks are computed with one of the following algorithms:
+ *  - "dc": divide-and-conquer algorithm of Jensen, generalized by Fortin et al. and Buzdalov
+ *    and Shalyto to handle equal objective values, in O(N log^(M-1) N). With two objectives,
+ *    it reduces to a sweep in O(N log N);
+ *  - "ens": efficient non-dominated sort with binary search of Zhang et al., which compares
+ *    each individual to the fronts already built;
+ *  - "pairwise": fast non-dominated sort of Deb et al., in O(M N^2), comparing the fitness
+ *    measures with method Fitness::isDominated.
+ *
+ *  The matrix based algorithms require fitness of type FitnessMultiObj or FitnessMultiObjMin.
+ *  Other fitness types (which may redefine the dominance relation) are sorted pairwise.
+ *  \par References
+ *  M. T. Jensen, "Reducing the run-time complexity of multiobjective EAs: The NSGA-II and
+ *  other algorithms", IEEE Trans. on Evolutionary Computation, vol. 7, no. 5, 2003.
+ *  F.-A. Fortin, S. Grenier, and M. Parizeau, "Generalizing the improved run-time complexity
+ *  algorithm for non-dominated sorting", GECCO 2013.
+ *  X. Zhang, Y. Tian, R. Cheng, and Y. Jin, "An efficient approach to nondominated sorting
+ *  for evolutionary multiobjective optimization", IEEE Trans. on Evolutionary Computation,
+ *  vol. 19, no. 2, 2015.
+ */
+class NondominatedSorting
+{
+
+public:
+
+	//! Pareto fronts, each front being made of the indices of its individuals.
+	typedef std::vector< std::vector<unsigned int> > Fronts;
+
+	//! Non-dominated sorting algorithms.
+	enum Algorithm {
+	    eDivideConquer,  //!< Divide-and-conquer (sweep with two objectives).
+	    eEfficient,      //!< Efficient non-dominated sort with binary search.
+	    ePairwise        //!< Pairwise comparisons with Fitness::isDominated.
+	};
+
+	static bool      extractObjectives(std::vector<double>& outObjectives,
+	                                   unsigned int& outNbObjectives,
+	                                   const Individual::Bag& inIndividualPool);
+	static bool      extractObjectives(std::vector<double>& outObjectives,
+	                                   unsigned int& outNbObjectives,
+	                                   const Individual& inIndividual);
+	static Algorithm parseAlgorithm(const std::string& inName);
+	static void      rankObjectives(std::vector<unsigned int>& outRanks,
+	                                const std::vector<double>& inObjectives,
+	                                unsigned int inNbObjectives,
+	                                Algorithm inAlgorithm=eDivideConquer);
+	static void      sort(Fronts& outParetoFronts,
+	                      unsigned int inSortStop,
+	                      const Individual::Bag& inIndividualPool,
+	                      Algorithm inAlgorithm=eDivideConquer);
+
+protected:
+
+	static void sortPairwise(Fronts& outParetoFronts,
+	                         unsigned int inSortStop,
+	                         const Individual::Bag& inIndividualPool);
+
+};
+
+}
+}
+
+#endif // Beagle_EMO_NondominatedSorting_hpp
@@ -63,6 +63,7 @@ void EMO::PackageMultiObj::configure(System& ioSystem)
 	lFactory.insertAllocator("Beagle::EMO::PackageMultiObj", new PackageMultiObj::Alloc);
 	lFactory.insertAllocator("Beagle::EMO::ParetoFrontCalculateOp", new ParetoFrontCalculateOp::Alloc);
 	lFactory.insertAllocator("Beagle::EMO::ParetoFrontHOF", new ParetoFrontHOF::Alloc);
+	lFactory.insertAllocator("Beagle::EMO::SMSEMOAOp", new SMSEMOAOp::Alloc);
 	lFactory.insertAllocator("Beagle::EMO::StatsCalcFitnessMultiObjOp", new StatsCalcFitnessMultiObjOp::Alloc);
 
 	// Set aliases
@@ -74,6 +75,7 @@ void EMO::PackageMultiObj::configure(System& ioSystem)
 	lFactory.aliasAllocator("Beagle::EMO::PackageMultiObj", "PackageMultiObj");
 	lFactory.aliasAllocator("Beagle::EMO::ParetoFrontCalculateOp", "ParetoFrontCalculateOp");
 	lFactory.aliasAllocator("Beagle::EMO::ParetoFrontHOF", "ParetoFrontHOF");
+	lFactory.aliasAllocator("Beagle::EMO::SMSEMOAOp", "SMSEMOAOp");
 	lFactory.aliasAllocator("Beagle::EMO::StatsCalcFitnessMultiObjOp", "StatsCalcFitnessMultiObjOp");
 
 	// Set some basic concept-type associations in factory
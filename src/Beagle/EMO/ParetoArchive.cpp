@@ -0,0 +1,670 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/EMO/ParetoArchive.cpp
+ *  \brief  Source code of class EMO::ParetoArchive.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/EMO.hpp"
+
+#include <algorithm>
+#include <limits>
+
+using namespace Beagle;
+
+
+namespace Beagle
+{
+namespace EMO
+{
+
+// Used internally to order indices of points on one objective, in ascending order.
+class IsLessObjectivePredicate
+{
+public:
+	IsLessObjectivePredicate(const std::vector<double>& inPoints,
+	                         unsigned int inNbObjectives,
+	                         unsigned int inObjective) :
+		mPoints(inPoints),
+		mNbObjectives(inNbObjectives),
+		mObjective(inObjective)
+	{ }
+	inline bool operator()(unsigned int inLeft, unsigned int inRight) const
+	{
+		const double lLeft = mPoints[inLeft*mNbObjectives+mObjective];
+		const double lRight = mPoints[inRight*mNbObjectives+mObjective];
+		if(lLeft < lRight) return true;
+		if(lLeft > lRight) return false;
+		return inLeft < inRight;
+	}
+private:
+	const std::vector<double>& mPoints;
+	unsigned int               mNbObjectives;
+	unsigned int               mObjective;
+};
+
+}
+}
+
+
+/*!
+ *  \brief Construct an empty Pareto archive.
+ *  \param inNbObjectives Number of objectives of the points.
+ *  \param inMaxLeafSize Maximum number of points in a leaf of the tree.
+ */
+EMO::ParetoArchive::ParetoArchive(unsigned int inNbObjectives, unsigned int inMaxLeafSize) :
+		mNodes(1),
+		mNbObjectives(inNbObjectives),
+		mMaxLeafSize(std::max(inMaxLeafSize, 2u)),
+		mSize(0)
+{ }
+
+
+/*!
+ *  \brief Allocate a new empty node in the tree.
+ *  \return Index of the allocated node.
+ *  \warning References to the nodes of the tree may be invalidated.
+ */
+unsigned int EMO::ParetoArchive::allocateNode()
+{
+	Beagle_StackTraceBeginM();
+	if(mFreeNodes.empty()) {
+		mNodes.push_back(Node());
+		return mNodes.size()-1;
+	}
+	const unsigned int lNode = mFreeNodes.back();
+	mFreeNodes.pop_back();
+	return lNode;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Remove all the points of the archive.
+ *  \param inNbObjectives Number of objectives of the points to be inserted.
+ */
+void EMO::ParetoArchive::clear(unsigned int inNbObjectives)
+{
+	Beagle_StackTraceBeginM();
+	mNodes.assign(1, Node());
+	mFreeNodes.clear();
+	mNbObjectives = inNbObjectives;
+	mSize = 0;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Append the identifiers of the points of a subtree.
+ *  \param outIds Identifiers to append to.
+ *  \param inNode Root of the subtree.
+ */
+void EMO::ParetoArchive::collectIds(std::vector<unsigned int>& outIds, unsigned int inNode) const
+{
+	Beagle_StackTraceBeginM();
+	const Node& lNode = mNodes[inNode];
+	outIds.insert(outIds.end(), lNode.mIds.begin(), lNode.mIds.end());
+	for(unsigned int i=0; i<lNode.mChildren.size(); ++i) collectIds(outIds, lNode.mChildren[i]);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Remove a set of points from the archive.
+ *  \param inIds Identifiers of the points to remove.
+ */
+void EMO::ParetoArchive::erase(const std::vector<unsigned int>& inIds)
+{
+	Beagle_StackTraceBeginM();
+	if(inIds.empty() || (mSize == 0)) return;
+	std::vector<bool> lErased(*std::max_element(inIds.begin(), inIds.end())+1, false);
+	for(unsigned int i=0; i<inIds.size(); ++i) lErased[inIds[i]] = true;
+	mSize -= eraseInNode(lErased, 0);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Remove a set of points from a subtree, pruning the nodes left empty.
+ *  \param inErased Flags of the identifiers to remove.
+ *  \param inNode Root of the subtree.
+ *  \return Number of points removed.
+ */
+unsigned int EMO::ParetoArchive::eraseInNode(const std::vector<bool>& inErased, unsigned int inNode)
+{
+	Beagle_StackTraceBeginM();
+	unsigned int lNbErased = 0;
+	if(mNodes[inNode].mChildren.empty()) {
+		Node& lNode = mNodes[inNode];
+		unsigned int lKept = 0;
+		for(unsigned int i=0; i<lNode.mIds.size(); ++i) {
+			if((lNode.mIds[i] < inErased.size()) && inErased[lNode.mIds[i]]) continue;
+			if(lKept != i) {
+				lNode.mIds[lKept] = lNode.mIds[i];
+				std::copy(lNode.mPoints.begin()+i*mNbObjectives,
+				          lNode.mPoints.begin()+(i+1)*mNbObjectives,
+				          lNode.mPoints.begin()+lKept*mNbObjectives);
+			}
+			++lKept;
+		}
+		lNbErased = lNode.mIds.size() - lKept;
+		lNode.mIds.resize(lKept);
+		lNode.mPoints.resize(lKept*mNbObjectives);
+	} else {
+		std::vector<unsigned int>& lChildren = mNodes[inNode].mChildren;
+		unsigned int lKept = 0;
+		for(unsigned int i=0; i<lChildren.size(); ++i) {
+			lNbErased += eraseInNode(inErased, lChildren[i]);
+			if(mNodes[lChildren[i]].mIdeal.empty()) freeSubtree(lChildren[i]);
+			else lChildren[lKept++] = lChildren[i];
+		}
+		lChildren.resize(lKept);
+	}
+	if(lNbErased != 0) updateBounds(inNode);
+	return lNbErased;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Expand the bounds of a node to cover a point.
+ *  \param inNode Node to expand the bounds of.
+ *  \param inPoint Point to cover.
+ */
+void EMO::ParetoArchive::expandBounds(unsigned int inNode, const double* inPoint)
+{
+	Beagle_StackTraceBeginM();
+	Node& lNode = mNodes[inNode];
+	if(lNode.mIdeal.empty()) {
+		lNode.mIdeal.assign(inPoint, inPoint+mNbObjectives);
+		lNode.mNadir.assign(inPoint, inPoint+mNbObjectives);
+		return;
+	}
+	for(unsigned int k=0; k<mNbObjectives; ++k) {
+		if(inPoint[k] > lNode.mIdeal[k]) lNode.mIdeal[k] = inPoint[k];
+		if(inPoint[k] < lNode.mNadir[k]) lNode.mNadir[k] = inPoint[k];
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the identifiers of the points equal to a given point.
+ *  \param outIds Identifiers of the points with objectives equal to the given point.
+ *  \param inPoint Point to look for.
+ */
+void EMO::ParetoArchive::findEqual(std::vector<unsigned int>& outIds, const double* inPoint) const
+{
+	Beagle_StackTraceBeginM();
+	outIds.clear();
+	if(mSize == 0) return;
+	std::vector<unsigned int> lStack(1, 0);
+	while(lStack.empty() == false) {
+		const Node& lNode = mNodes[lStack.back()];
+		lStack.pop_back();
+		if(lNode.mIdeal.empty()) continue;
+		bool lInside = true;
+		for(unsigned int k=0; (k<mNbObjectives) && lInside; ++k) {
+			lInside = (inPoint[k] <= lNode.mIdeal[k]) && (inPoint[k] >= lNode.mNadir[k]);
+		}
+		if(lInside == false) continue;
+		lStack.insert(lStack.end(), lNode.mChildren.begin(), lNode.mChildren.end());
+		for(unsigned int i=0; i<lNode.mIds.size(); ++i) {
+			if(std::equal(inPoint, inPoint+mNbObjectives, lNode.mPoints.begin()+i*mNbObjectives)) {
+				outIds.push_back(lNode.mIds[i]);
+			}
+		}
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Release the nodes of a subtree.
+ *  \param inNode Root of the subtree, which must not be the root of the tree.
+ */
+void EMO::ParetoArchive::freeSubtree(unsigned int inNode)
+{
+	Beagle_StackTraceBeginM();
+	for(unsigned int i=0; i<mNodes[inNode].mChildren.size(); ++i) {
+		freeSubtree(mNodes[inNode].mChildren[i]);
+	}
+	mNodes[inNode] = Node();
+	mFreeNodes.push_back(inNode);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the points of the archive.
+ *  \param outPoints Points of the archive, one row per point.
+ *  \param outIds Identifiers of the points, in the same order as the rows.
+ */
+void EMO::ParetoArchive::getPoints(std::vector<double>& outPoints, std::vector<unsigned int>& outIds) const
+{
+	Beagle_StackTraceBeginM();
+	outPoints.clear();
+	outIds.clear();
+	outPoints.reserve(mSize*mNbObjectives);
+	outIds.reserve(mSize);
+	for(unsigned int i=0; i<mNodes.size(); ++i) {
+		outPoints.insert(outPoints.end(), mNodes[i].mPoints.begin(), mNodes[i].mPoints.end());
+		outIds.insert(outIds.end(), mNodes[i].mIds.begin(), mNodes[i].mIds.end());
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Insert a point into the archive, removing the points it dominates.
+ *  \param outRemovedIds Identifiers of the points removed from the archive.
+ *  \param inPoint Point to insert, which must not be dominated by the archive.
+ *  \param inId Identifier associated to the point.
+ */
+void EMO::ParetoArchive::insert(std::vector<unsigned int>& outRemovedIds,
+                                const double* inPoint,
+                                unsigned int inId)
+{
+	Beagle_StackTraceBeginM();
+	outRemovedIds.clear();
+	if(mSize != 0) {
+		removeDominatedInNode(outRemovedIds, 0, inPoint);
+		mSize -= outRemovedIds.size();
+	}
+	insertInNode(0, inPoint, inId);
+	++mSize;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Insert a point into a subtree, descending into the children of closest center.
+ *  \param inNode Root of the subtree.
+ *  \param inPoint Point to insert.
+ *  \param inId Identifier associated to the point.
+ */
+void EMO::ParetoArchive::insertInNode(unsigned int inNode, const double* inPoint, unsigned int inId)
+{
+	Beagle_StackTraceBeginM();
+	unsigned int lNodeIndex = inNode;
+	while(mNodes[lNodeIndex].mChildren.empty() == false) {
+		expandBounds(lNodeIndex, inPoint);
+		const std::vector<unsigned int>& lChildren = mNodes[lNodeIndex].mChildren;
+		unsigned int lClosest = lChildren[0];
+		double lClosestDistance = std::numeric_limits<double>::max();
+		for(unsigned int i=0; i<lChildren.size(); ++i) {
+			const Node& lChild = mNodes[lChildren[i]];
+			double lDistance = 0.0;
+			for(unsigned int k=0; k<mNbObjectives; ++k) {
+				const double lDelta = inPoint[k] - 0.5*(lChild.mIdeal[k]+lChild.mNadir[k]);
+				lDistance += lDelta*lDelta;
+			}
+			if(lDistance < lClosestDistance) {
+				lClosestDistance = lDistance;
+				lClosest = lChildren[i];
+			}
+		}
+		lNodeIndex = lClosest;
+	}
+	expandBounds(lNodeIndex, inPoint);
+	Node& lLeaf = mNodes[lNodeIndex];
+	lLeaf.mPoints.insert(lLeaf.mPoints.end(), inPoint, inPoint+mNbObjectives);
+	lLeaf.mIds.push_back(inId);
+	// Leaves of identical points are not split, as no seed would separate them.
+	if((lLeaf.mIds.size() > mMaxLeafSize) && (lLeaf.mIdeal != lLeaf.mNadir)) splitLeaf(lNodeIndex);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Test whether a point is dominated by some point of the archive.
+ *  \param inPoint Point to test.
+ *  \return True if the point is dominated, false if not.
+ */
+bool EMO::ParetoArchive::isDominated(const double* inPoint) const
+{
+	Beagle_StackTraceBeginM();
+	if(mSize == 0) return false;
+	return isDominatedInNode(0, inPoint);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Test whether a point is dominated by some point of a subtree.
+ *  \param inNode Root of the subtree.
+ *  \param inPoint Point to test.
+ *  \return True if the point is dominated, false if not.
+ */
+bool EMO::ParetoArchive::isDominatedInNode(unsigned int inNode, const double* inPoint) const
+{
+	Beagle_StackTraceBeginM();
+	const Node& lNode = mNodes[inNode];
+	if(lNode.mIdeal.empty()) return false;
+	// No point of the node dominates the tested point if it is better than the ideal corner.
+	for(unsigned int k=0; k<mNbObjectives; ++k) {
+		if(inPoint[k] > lNode.mIdeal[k]) return false;
+	}
+	// All the points of the node dominate the tested point if the nadir corner does.
+	bool lNadirCovers = true;
+	bool lNadirEqual = true;
+	for(unsigned int k=0; (k<mNbObjectives) && lNadirCovers; ++k) {
+		if(lNode.mNadir[k] < inPoint[k]) lNadirCovers = false;
+		else if(lNode.mNadir[k] > inPoint[k]) lNadirEqual = false;
+	}
+	if(lNadirCovers && (lNadirEqual == false)) return true;
+	for(unsigned int i=0; i<lNode.mIds.size(); ++i) {
+		const double* lPoint = &lNode.mPoints[i*mNbObjectives];
+		bool lCovers = true;
+		bool lEqual = true;
+		for(unsigned int k=0; (k<mNbObjectives) && lCovers; ++k) {
+			if(lPoint[k] < inPoint[k]) lCovers = false;
+			else if(lPoint[k] > inPoint[k]) lEqual = false;
+		}
+		if(lCovers && (lEqual == false)) return true;
+	}
+	for(unsigned int i=0; i<lNode.mChildren.size(); ++i) {
+		if(isDominatedInNode(lNode.mChildren[i], inPoint)) return true;
+	}
+	return false;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the truncation method associated to a name.
+ *  \param inName Name of the truncation method, "crowding" or "hypervolume".
+ *  \return Truncation method associated to the name.
+ *  \throw Beagle::RunTimeException If the name is not valid.
+ */
+EMO::ParetoArchive::Truncation EMO::ParetoArchive::parseTruncation(const std::string& inName)
+{
+	Beagle_StackTraceBeginM();
+	if(inName == "crowding") return eCrowding;
+	if(inName == "hypervolume") return eHypervolume;
+	std::ostringstream lOSS;
+	lOSS << "Pareto archive truncation method '" << inName << "' is not valid; ";
+	lOSS << "valid methods are 'crowding' and 'hypervolume'!";
+	throw Beagle_RunTimeExceptionM(lOSS.str());
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Remove from a subtree the points dominated by a given point.
+ *  \param outRemovedIds Identifiers to append the removed points to.
+ *  \param inNode Root of the subtree.
+ *  \param inPoint Dominating point.
+ */
+void EMO::ParetoArchive::removeDominatedInNode(std::vector<unsigned int>& outRemovedIds,
+        unsigned int inNode,
+        const double* inPoint)
+{
+	Beagle_StackTraceBeginM();
+	Node& lNode = mNodes[inNode];
+	if(lNode.mIdeal.empty()) return;
+	// The point dominates no point of the node if it is worse than the nadir corner.
+	for(unsigned int k=0; k<mNbObjectives; ++k) {
+		if(inPoint[k] < lNode.mNadir[k]) return;
+	}
+	// The point dominates all the points of the node if it dominates the ideal corner.
+	bool lIdealCovered = true;
+	bool lIdealEqual = true;
+	for(unsigned int k=0; (k<mNbObjectives) && lIdealCovered; ++k) {
+		if(inPoint[k] < lNode.mIdeal[k]) lIdealCovered = false;
+		else if(inPoint[k] > lNode.mIdeal[k]) lIdealEqual = false;
+	}
+	if(lIdealCovered && (lIdealEqual == false)) {
+		collectIds(outRemovedIds, inNode);
+		for(unsigned int i=0; i<lNode.mChildren.size(); ++i) freeSubtree(lNode.mChildren[i]);
+		lNode = Node();
+		return;
+	}
+
+	const unsigned int lNbRemoved = outRemovedIds.size();
+	if(lNode.mChildren.empty()) {
+		unsigned int lKept = 0;
+		for(unsigned int i=0; i<lNode.mIds.size(); ++i) {
+			const double* lPoint = &lNode.mPoints[i*mNbObjectives];
+			bool lCovered = true;
+			bool lEqual = true;
+			for(unsigned int k=0; (k<mNbObjectives) && lCovered; ++k) {
+				if(inPoint[k] < lPoint[k]) lCovered = false;
+				else if(inPoint[k] > lPoint[k]) lEqual = false;
+			}
+			if(lCovered && (lEqual == false)) {
+				outRemovedIds.push_back(lNode.mIds[i]);
+				continue;
+			}
+			if(lKept != i) {
+				lNode.mIds[lKept] = lNode.mIds[i];
+				std::copy(lPoint, lPoint+mNbObjectives, lNode.mPoints.begin()+lKept*mNbObjectives);
+			}
+			++lKept;
+		}
+		lNode.mIds.resize(lKept);
+		lNode.mPoints.resize(lKept*mNbObjectives);
+	} else {
+		unsigned int lKept = 0;
+		for(unsigned int i=0; i<lNode.mChildren.size(); ++i) {
+			removeDominatedInNode(outRemovedIds, lNode.mChildren[i], inPoint);
+			if(mNodes[lNode.mChildren[i]].mIdeal.empty()) freeSubtree(lNode.mChildren[i]);
+			else lNode.mChildren[lKept++] = lNode.mChildren[i];
+		}
+		lNode.mChildren.resize(lKept);
+	}
+	if(outRemovedIds.size() != lNbRemoved) updateBounds(inNode);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Change the identifiers of the points of the archive.
+ *  \param inNewIds New identifier of the points, indexed by their actual identifier.
+ */
+void EMO::ParetoArchive::renumber(const std::vector<unsigned int>& inNewIds)
+{
+	Beagle_StackTraceBeginM();
+	for(unsigned int i=0; i<mNodes.size(); ++i) {
+		std::vector<unsigned int>& lIds = mNodes[i].mIds;
+		for(unsigned int j=0; j<lIds.size(); ++j) {
+			Beagle_UpperBoundCheckAssertM(lIds[j], inNewIds.size()-1);
+			lIds[j] = inNewIds[lIds[j]];
+		}
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Split a leaf into (M+1) children, around seed points far from each other.
+ *  \param inNode Leaf to split.
+ *
+ *  The first seed is the point of largest average distance to the other points, while each
+ *  following seed is the point farthest from the seeds already chosen. The other points are
+ *  then moved to the child of the closest seed.
+ */
+void EMO::ParetoArchive::splitLeaf(unsigned int inNode)
+{
+	Beagle_StackTraceBeginM();
+	std::vector<double> lPoints;
+	std::vector<unsigned int> lIds;
+	lPoints.swap(mNodes[inNode].mPoints);
+	lIds.swap(mNodes[inNode].mIds);
+	const unsigned int lNbPoints = lIds.size();
+	const unsigned int lNbChildren = std::min(mNbObjectives+1, lNbPoints);
+
+	std::vector<double> lDistances(lNbPoints*lNbPoints, 0.0);
+	for(unsigned int i=0; i<lNbPoints; ++i) {
+		for(unsigned int j=i+1; j<lNbPoints; ++j) {
+			double lDistance = 0.0;
+			for(unsigned int k=0; k<mNbObjectives; ++k) {
+				const double lDelta = lPoints[i*mNbObjectives+k] - lPoints[j*mNbObjectives+k];
+				lDistance += lDelta*lDelta;
+			}
+			lDistances[i*lNbPoints+j] = lDistances[j*lNbPoints+i] = lDistance;
+		}
+	}
+	unsigned int lFirstSeed = 0;
+	double lFirstSum = -1.0;
+	for(unsigned int i=0; i<lNbPoints; ++i) {
+		double lSum = 0.0;
+		for(unsigned int j=0; j<lNbPoints; ++j) lSum += lDistances[i*lNbPoints+j];
+		if(lSum > lFirstSum) {
+			lFirstSum = lSum;
+			lFirstSeed = i;
+		}
+	}
+	std::vector<unsigned int> lSeeds(1, lFirstSeed);
+	std::vector<unsigned int> lClosestSeed(lNbPoints, 0);
+	std::vector<double> lSeedDistances(lNbPoints);
+	for(unsigned int i=0; i<lNbPoints; ++i) lSeedDistances[i] = lDistances[i*lNbPoints+lFirstSeed];
+	std::vector<bool> lIsSeed(lNbPoints, false);
+	lIsSeed[lFirstSeed] = true;
+	while(lSeeds.size() < lNbChildren) {
+		unsigned int lSeed = lNbPoints;
+		for(unsigned int i=0; i<lNbPoints; ++i) {
+			if(lIsSeed[i]) continue;
+			if((lSeed == lNbPoints) || (lSeedDistances[i] > lSeedDistances[lSeed])) lSeed = i;
+		}
+		lIsSeed[lSeed] = true;
+		for(unsigned int i=0; i<lNbPoints; ++i) {
+			if(lIsSeed[i] && (i != lSeed)) continue;
+			if((i == lSeed) || (lDistances[i*lNbPoints+lSeed] < lSeedDistances[i])) {
+				lSeedDistances[i] = lDistances[i*lNbPoints+lSeed];
+				lClosestSeed[i] = lSeeds.size();
+			}
+		}
+		lSeeds.push_back(lSeed);
+	}
+
+	std::vector<unsigned int> lChildren(lNbChildren);
+	for(unsigned int i=0; i<lNbChildren; ++i) lChildren[i] = allocateNode();
+	for(unsigned int i=0; i<lNbPoints; ++i) {
+		const double* lPoint = &lPoints[i*mNbObjectives];
+		Node& lChild = mNodes[lChildren[lClosestSeed[i]]];
+		lChild.mPoints.insert(lChild.mPoints.end(), lPoint, lPoint+mNbObjectives);
+		lChild.mIds.push_back(lIds[i]);
+		expandBounds(lChildren[lClosestSeed[i]], lPoint);
+	}
+	mNodes[inNode].mChildren.swap(lChildren);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Select points to remove from a set of non-dominated points to bound its size.
+ *  \param outRemoved Indices of the points to remove, in order of removal.
+ *  \param inPoints Non-dominated points, one row per point, all objectives being maximized.
+ *  \param inNbObjectives Number of objectives of the points.
+ *  \param inMaxSize Maximum number of points to keep.
+ *  \param inTruncation Truncation method.
+ *
+ *  Points are removed one at a time, the measure being computed again on the remaining points
+ *  after each removal. The crowding distance is the one of NSGA-II, normalized by the range of
+ *  each objective, the extreme points being never removed first. The exclusive hypervolume
+ *  contribution of the points is computed with two objectives; with more objectives, the
+ *  crowding distance is used instead.
+ */
+void EMO::ParetoArchive::truncate(std::vector<unsigned int>& outRemoved,
+                                  const std::vector<double>& inPoints,
+                                  unsigned int inNbObjectives,
+                                  unsigned int inMaxSize,
+                                  Truncation inTruncation)
+{
+	Beagle_StackTraceBeginM();
+	outRemoved.clear();
+	if(inNbObjectives == 0) return;
+	const unsigned int lNbPoints = inPoints.size() / inNbObjectives;
+	if(lNbPoints <= inMaxSize) return;
+	const double lInfinity = std::numeric_limits<double>::infinity();
+	const bool lUseHypervolume = (inTruncation == eHypervolume) && (inNbObjectives == 2);
+
+	std::vector<unsigned int> lRemaining(lNbPoints);
+	for(unsigned int i=0; i<lNbPoints; ++i) lRemaining[i] = i;
+	std::vector<double> lMeasures(lNbPoints);
+	std::vector<unsigned int> lSorted;
+	while(lRemaining.size() > inMaxSize) {
+		for(unsigned int i=0; i<lRemaining.size(); ++i) lMeasures[lRemaining[i]] = 0.0;
+		if(lUseHypervolume) {
+			// Sorted by increasing first objective, the second objective is decreasing.
+			lSorted = lRemaining;
+			std::sort(lSorted.begin(), lSorted.end(), IsLessObjectivePredicate(inPoints, 2, 0));
+			lMeasures[lSorted.front()] = lMeasures[lSorted.back()] = lInfinity;
+			for(unsigned int j=1; (j+1)<lSorted.size(); ++j) {
+				lMeasures[lSorted[j]] =
+				    (inPoints[lSorted[j]*2] - inPoints[lSorted[j-1]*2]) *
+				    (inPoints[lSorted[j]*2+1] - inPoints[lSorted[j+1]*2+1]);
+			}
+		} else {
+			for(unsigned int k=0; k<inNbObjectives; ++k) {
+				lSorted = lRemaining;
+				std::sort(lSorted.begin(), lSorted.end(), IsLessObjectivePredicate(inPoints, inNbObjectives, k));
+				lMeasures[lSorted.front()] = lMeasures[lSorted.back()] = lInfinity;
+				const double lRange =
+				    inPoints[lSorted.back()*inNbObjectives+k] - inPoints[lSorted.front()*inNbObjectives+k];
+				if(lRange <= 0.0) continue;
+				for(unsigned int j=1; (j+1)<lSorted.size(); ++j) {
+					lMeasures[lSorted[j]] +=
+					    (inPoints[lSorted[j+1]*inNbObjectives+k] - inPoints[lSorted[j-1]*inNbObjectives+k]) / lRange;
+				}
+			}
+		}
+		unsigned int lWorst = 0;
+		for(unsigned int i=1; i<lRemaining.size(); ++i) {
+			if(lMeasures[lRemaining[i]] < lMeasures[lRemaining[lWorst]]) lWorst = i;
+		}
+		outRemoved.push_back(lRemaining[lWorst]);
+		lRemaining.erase(lRemaining.begin()+lWorst);
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Compute again the bounds of a node from its points or its children.
+ *  \param inNode Node to update the bounds of.
+ */
+void EMO::ParetoArchive::updateBounds(unsigned int inNode)
+{
+	Beagle_StackTraceBeginM();
+	Node& lNode = mNodes[inNode];
+	lNode.mIdeal.clear();
+	lNode.mNadir.clear();
+	for(unsigned int i=0; i<lNode.mIds.size(); ++i) {
+		expandBounds(inNode, &lNode.mPoints[i*mNbObjectives]);
+	}
+	for(unsigned int i=0; i<lNode.mChildren.size(); ++i) {
+		const Node& lChild = mNodes[lNode.mChildren[i]];
+		if(lChild.mIdeal.empty()) continue;
+		expandBounds(inNode, &lChild.mIdeal[0]);
+		expandBounds(inNode, &lChild.mNadir[0]);
+	}
+	Beagle_StackTraceEndM();
+}
@@ -0,0 +1,152 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/EMO/ParetoArchive.hpp
+ *  \brief  Definition of the class EMO::ParetoArchive.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_EMO_ParetoArchive_hpp
+#define Beagle_EMO_ParetoArchive_hpp
+
+#include <string>
+#include <vector>
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+
+
+namespace Beagle
+{
+namespace EMO
+{
+
+/*!
+ *  \class ParetoArchive Beagle/EMO/ParetoArchive.hpp "Beagle/EMO/ParetoArchive.hpp"
+ *  \brief Non-dominated archive of objective vectors, organized as an ND-tree.
+ *  \ingroup MultiObj
+ *
+ *  Each point of the archive is an objective vector, all objectives being maximized, that is
+ *  associated to an identifier given at insertion. The points are held in the leaves of a tree
+ *  whose nodes keep the ideal (best) and nadir (worst) corners of the box bounding their
+ *  points. Dominance queries and updates only visit the nodes whose box may hold points that
+ *  dominate, or are dominated by, the tested point, and whole subtrees are discarded when the
+ *  inserted point dominates their ideal corner. When a leaf grows over the maximum leaf size,
+ *  it is split into (M+1) children around distant seed points.
+ *
+ *  Points with equal objectives do not dominate each other, and are all kept in the archive.
+ *  \par Reference
+ *  A. Jaszkiewicz and T. Lust, "ND-Tree-based update: a fast algorithm for the dynamic
+ *  nondominance problem", IEEE Trans. on Evolutionary Computation, vol. 22, no. 5, 2018.
+ */
+class ParetoArchive
+{
+
+public:
+
+	//! Truncation methods used to bound the size of a set of non-dominated points.
+	enum Truncation {
+	    eCrowding,     //!< Iteratively remove the point of smallest crowding distance.
+	    eHypervolume   //!< Iteratively remove the point of smallest exclusive hypervolume.
+	};
+
+	explicit ParetoArchive(unsigned int inNbObjectives=0, unsigned int inMaxLeafSize=20);
+
+	void       clear(unsigned int inNbObjectives);
+	void       erase(const std::vector<unsigned int>& inIds);
+	void       findEqual(std::vector<unsigned int>& outIds, const double* inPoint) const;
+	void       getPoints(std::vector<double>& outPoints, std::vector<unsigned int>& outIds) const;
+	void       insert(std::vector<unsigned int>& outRemovedIds, const double* inPoint, unsigned int inId);
+	bool       isDominated(const double* inPoint) const;
+	void       renumber(const std::vector<unsigned int>& inNewIds);
+
+	static Truncation parseTruncation(const std::string& inName);
+	static void       truncate(std::vector<unsigned int>& outRemoved,
+	                           const std::vector<double>& inPoints,
+	                           unsigned int inNbObjectives,
+	                           unsigned int inMaxSize,
+	                           Truncation inTruncation=eCrowding);
+
+	/*!
+	 *  \return Number of objectives of the points in the archive.
+	 */
+	inline unsigned int getNbObjectives() const
+	{
+		Beagle_StackTraceBeginM();
+		return mNbObjectives;
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \return Number of points in the archive.
+	 */
+	inline unsigned int size() const
+	{
+		Beagle_StackTraceBeginM();
+		return mSize;
+		Beagle_StackTraceEndM();
+	}
+
+protected:
+
+	/*!
+	 *  \brief Node of the ND-tree, either a leaf holding points or an internal node.
+	 */
+	struct Node {
+		std::vector<double>       mIdeal;     //!< Best value of each objective in the node.
+		std::vector<double>       mNadir;     //!< Worst value of each objective in the node.
+		std::vector<unsigned int> mChildren;  //!< Children nodes, empty for a leaf.
+		std::vector<double>       mPoints;    //!< Points of a leaf, one row per point.
+		std::vector<unsigned int> mIds;       //!< Identifiers of the points of a leaf.
+	};
+
+	unsigned int allocateNode();
+	void         collectIds(std::vector<unsigned int>& outIds, unsigned int inNode) const;
+	unsigned int eraseInNode(const std::vector<bool>& inErased, unsigned int inNode);
+	void         expandBounds(unsigned int inNode, const double* inPoint);
+	void         freeSubtree(unsigned int inNode);
+	void         insertInNode(unsigned int inNode, const double* inPoint, unsigned int inId);
+	bool         isDominatedInNode(unsigned int inNode, const double* inPoint) const;
+	void         removeDominatedInNode(std::vector<unsigned int>& outRemovedIds,
+	                                   unsigned int inNode,
+	                                   const double* inPoint);
+	void         splitLeaf(unsigned int inNode);
+	void         updateBounds(unsigned int inNode);
+
+	std::vector<Node>         mNodes;          //!< Nodes of the tree, the root being the first.
+	std::vector<unsigned int> mFreeNodes;      //!< Unused nodes of the tree.
+	unsigned int              mNbObjectives;   //!< Number of objectives of the points.
+	unsigned int              mMaxLeafSize;    //!< Maximum number of points in a leaf.
+	unsigned int              mSize;           //!< Number of points in the archive.
+
+};
+
+}
+}
+
+#endif // Beagle_EMO_ParetoArchive_hpp
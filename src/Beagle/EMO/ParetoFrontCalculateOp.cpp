@@ -117,6 +117,22 @@ void EMO::ParetoFrontCalculateOp::registerParams(System& ioSystem)
 		mPopSize = castHandleT<UIntArray>(
 		               ioSystem.getRegister().insertEntry("ec.pop.size", new UIntArray(1,100), lDescription));
 	}
+	{
+		std::ostringstream lOSS;
+		lOSS << "Non-dominated sorting algorithm. Value 'dc' is for the divide-and-conquer ";
+		lOSS << "algorithm of Jensen and Fortin et al. (a sweep with two objectives), 'ens' ";
+		lOSS << "is for the efficient non-dominated sort of Zhang et al., and 'pairwise' is ";
+		lOSS << "for the fast non-dominated sort of Deb et al. Fitness types other than ";
+		lOSS << "FitnessMultiObj and FitnessMultiObjMin are always sorted pairwise.";
+		Register::Description lDescription(
+		    "Non-dominated sorting algorithm",
+		    "String",
+		    "dc",
+		    lOSS.str()
+		);
+		mSortingAlgo = castHandleT<String>(
+		                   ioSystem.getRegister().insertEntry("ec.ndsort.algo", new String("dc"), lDescription));
+	}
 
 	Beagle_StackTraceEndM();
 }
@@ -141,6 +157,12 @@ void EMO::ParetoFrontCalculateOp::operate(Deme& ioDeme, Context& ioContext)
 	unsigned int lOldDemeIndex  = ioContext.getDemeIndex();
 	Deme::Handle lOldDemeHandle = ioContext.getDemeHandle();
 
+	// The first front of each deme is extracted with the non-dominated sorting engine,
+	// only these individuals being then inserted into the Pareto front hall-of-fames.
+	const NondominatedSorting::Algorithm lAlgorithm =
+	    NondominatedSorting::parseAlgorithm(mSortingAlgo->getWrappedValue());
+	Individual::Bag lCandidates;
+	std::vector<unsigned int> lCandidatesDeme;
 	for(unsigned int i=0; i<ioContext.getVivarium().size(); ++i) {
 		Beagle_LogInfoM(
 		    ioContext.getSystem().getLogger(),
@@ -148,8 +170,17 @@ void EMO::ParetoFrontCalculateOp::operate(Deme& ioDeme, Context& ioContext)
 		);
 		ioContext.setDemeIndex(i);
 		ioContext.setDemeHandle(ioContext.getVivarium()[i]);
+		const Deme& lDeme = *ioContext.getVivarium()[i];
+		NondominatedSorting::Fronts lFronts;
+		NondominatedSorting::sort(lFronts, 1, lDeme, lAlgorithm);
 		ParetoFrontHOF::Handle lParetoFront = new ParetoFrontHOF;
-		lParetoFront->updateWithDeme(1, *ioContext.getVivarium()[i], ioContext);
+		if(lFronts.empty() == false) {
+			for(unsigned int j=0; j<lFronts[0].size(); ++j) {
+				lParetoFront->updateWithIndividual(1, *lDeme[lFronts[0][j]], ioContext);
+				lCandidates.push_back(lDeme[lFronts[0][j]]);
+				lCandidatesDeme.push_back(i);
+			}
+		}
 		ioContext.getVivarium()[i]->removeMember("HallOfFame");
 		ioContext.getVivarium()[i]->addMember(lParetoFront);
 	}
@@ -159,10 +190,15 @@ void EMO::ParetoFrontCalculateOp::operate(Deme& ioDeme, Context& ioContext)
 	    "Computing Pareto front for the whole vivarium"
 	);
 	ParetoFrontHOF::Handle lParetoFrontViva = new ParetoFrontHOF;
-	for(unsigned int j=0; j<ioContext.getVivarium().size(); ++j) {
-		ioContext.setDemeIndex(j);
-		ioContext.setDemeHandle(ioContext.getVivarium()[j]);
-		lParetoFrontViva->updateWithDeme(1, *ioContext.getVivarium()[j], ioContext);
+	NondominatedSorting::Fronts lFrontsViva;
+	NondominatedSorting::sort(lFrontsViva, 1, lCandidates, lAlgorithm);
+	if(lFrontsViva.empty() == false) {
+		for(unsigned int j=0; j<lFrontsViva[0].size(); ++j) {
+			const unsigned int lDemeIndex = lCandidatesDeme[lFrontsViva[0][j]];
+			ioContext.setDemeIndex(lDemeIndex);
+			ioContext.setDemeHandle(ioContext.getVivarium()[lDemeIndex]);
+			lParetoFrontViva->updateWithIndividual(1, *lCandidates[lFrontsViva[0][j]], ioContext);
+		}
 	}
 	ioContext.getVivarium().removeMember("HallOfFame");
 	ioContext.getVivarium().addMember(lParetoFrontViva);
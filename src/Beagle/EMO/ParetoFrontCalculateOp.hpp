@@ -94,6 +94,7 @@ private:
 	UInt::Handle      mWritingInterval;     //!< Milestone's writing interval (in generation).
 	Bool::Handle      mPerDemeMilestone;    //!< True: write a milestone for every deme.
 	UIntArray::Handle mPopSize;             //!< Population size for the evolution.
+	String::Handle    mSortingAlgo;         //!< Non-dominated sorting algorithm used.
 
 };
 
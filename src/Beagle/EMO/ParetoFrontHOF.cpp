@@ -64,6 +64,281 @@ const std::string& EMO::ParetoFrontHOF::getType() const
 }
 
 
+/*!
+ *  \brief Remove from the archive index the members whose individual was cleared.
+ */
+void EMO::ParetoFrontHOF::compactArchive()
+{
+	Beagle_StackTraceBeginM();
+	std::vector<unsigned int> lNewIds(mEntries.size(), 0);
+	unsigned int lKept = 0;
+	for(unsigned int i=0; i<mEntries.size(); ++i) {
+		if(mEntries[i].mIndividual == NULL) continue;
+		lNewIds[i] = lKept;
+		if(lKept != i) {
+			mEntries[lKept] = mEntries[i];
+			mArchived[lKept] = mArchived[i];
+		}
+		++lKept;
+	}
+	if(lKept == mEntries.size()) return;
+	mEntries.resize(lKept);
+	mArchived.resize(lKept);
+	mArchive.renumber(lNewIds);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Make a copy of an individual to add to the hall-of-fame.
+ *  \param inIndividual Individual to copy.
+ *  \param ioContext Evolution context.
+ *  \return Copy of the individual.
+ *  \throw Beagle::RunTimeException If the type of the individual is not in the factory.
+ */
+Individual::Handle EMO::ParetoFrontHOF::copyIndividual(const Individual& inIndividual, Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	const Factory& lFactory = ioContext.getSystem().getFactory();
+	const std::string& lIndividualType = inIndividual.getType();
+	Individual::Alloc::Handle lIndividualAlloc =
+		castHandleT<Individual::Alloc>(lFactory.getAllocator(lIndividualType));
+	if(lIndividualAlloc == NULL) {
+		std::ostringstream lOSS;
+		lOSS << "Type '" << lIndividualType << "' associated to individual to add to hall-of-fame ";
+		lOSS << "is not valid!";
+		throw Beagle_RunTimeExceptionM(lOSS.str());
+	}
+	Individual::Handle lIndivCopy = castHandleT<Individual>(lIndividualAlloc->allocate());
+	lIndivCopy->copy(inIndividual, ioContext.getSystem());
+	return lIndivCopy;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Insert an individual into the Pareto front, using the archive index.
+ *  \param inIndividual Individual to insert.
+ *  \param inObjectives Objectives of the individual, as given by
+ *    NondominatedSorting::extractObjectives.
+ *  \param ioContext Evolution context.
+ *  \param ioNbAdded Number of individuals added, incremented if the individual is added.
+ *  \param ioNbRemoved Number of individuals removed, incremented for each member dominated.
+ *
+ *  The individual of the members removed is cleared, the entries being removed afterward
+ *  with method compactArchive.
+ */
+void EMO::ParetoFrontHOF::insertArchived(const Individual& inIndividual,
+        const double* inObjectives,
+        Context& ioContext,
+        unsigned int& ioNbAdded,
+        unsigned int& ioNbRemoved)
+{
+	Beagle_StackTraceBeginM();
+	if(mArchive.isDominated(inObjectives)) return;
+
+	// Identical individuals have equal fitness, only these members are tested.
+	std::vector<unsigned int> lIds;
+	mArchive.findEqual(lIds, inObjectives);
+	for(unsigned int i=0; i<lIds.size(); ++i) {
+		if(inIndividual.isIdentical(*mEntries[lIds[i]].mIndividual)) return;
+	}
+
+	mArchive.insert(lIds, inObjectives, mEntries.size());
+	for(unsigned int i=0; i<lIds.size(); ++i) {
+		Beagle_LogDebugM(ioContext.getSystem().getLogger(), *mEntries[lIds[i]].mIndividual);
+		mEntries[lIds[i]].mIndividual = NULL;
+		++ioNbRemoved;
+	}
+	HallOfFame::Entry lEntry(copyIndividual(inIndividual, ioContext),
+	                         ioContext.getGeneration(),
+	                         ioContext.getDemeIndex());
+	mEntries.push_back(lEntry);
+	mArchived.push_back(lEntry.mIndividual.getPointer());
+	Beagle_LogDebugM(ioContext.getSystem().getLogger(), inIndividual);
+	++ioNbAdded;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Insert an individual into the Pareto front, comparing it to every member.
+ *  \param inIndividual Individual to insert.
+ *  \param ioContext Evolution context.
+ *  \param ioNbAdded Number of individuals added, incremented if the individual is added.
+ *  \param ioNbRemoved Number of individuals removed, incremented for each member dominated.
+ */
+void EMO::ParetoFrontHOF::insertPairwise(const Individual& inIndividual,
+        Context& ioContext,
+        unsigned int& ioNbAdded,
+        unsigned int& ioNbRemoved)
+{
+	Beagle_StackTraceBeginM();
+	Fitness::Handle lIndivFitness = inIndividual.getFitness();
+	for(unsigned int i=0; i<mEntries.size(); ++i) {
+		Fitness::Handle lEntryFitness = mEntries[i].mIndividual->getFitness();
+		if(lIndivFitness->isDominated(*lEntryFitness)) return;
+		else if(lEntryFitness->isDominated(*lIndivFitness)) {
+			Beagle_LogDebugM(ioContext.getSystem().getLogger(), *mEntries[i].mIndividual);
+			mEntries.erase(mEntries.begin()+i);
+			--i;
+			++ioNbRemoved;
+		}
+	}
+
+	// Test if the individual is unique, and if so add it to the Pareto front.
+	for(unsigned int j=0; j<mEntries.size(); ++j) {
+		if(inIndividual.isIdentical(*mEntries[j].mIndividual)) return;
+	}
+	HallOfFame::Entry lEntry(copyIndividual(inIndividual, ioContext),
+	                         ioContext.getGeneration(),
+	                         ioContext.getDemeIndex());
+	mEntries.push_back(lEntry);
+	Beagle_LogDebugM(ioContext.getSystem().getLogger(), inIndividual);
+	++ioNbAdded;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Register the parameters bounding the size of the Pareto front hall-of-fames.
+ *  \param ioSystem System of the evolution.
+ *
+ *  The hall-of-fames are not components of the system, the parameters are thus registered by
+ *  the multiobjective selection operators.
+ */
+void EMO::ParetoFrontHOF::registerParams(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	{
+		std::ostringstream lOSS;
+		lOSS << "Maximum number of individuals in the Pareto front hall-of-fames. Value of 0 ";
+		lOSS << "means that the size of the Pareto fronts is not bounded. The size is only ";
+		lOSS << "bounded for fitness of type FitnessMultiObj and FitnessMultiObjMin.";
+		Register::Description lDescription(
+		    "Pareto front maximum size",
+		    "UInt",
+		    "0",
+		    lOSS.str()
+		);
+		ioSystem.getRegister().insertEntry("ec.hof.paretomax", new UInt(0), lDescription);
+	}
+	{
+		std::ostringstream lOSS;
+		lOSS << "Method used to remove the individuals in excess of the maximum size of the ";
+		lOSS << "Pareto front hall-of-fames. Value 'crowding' removes the individual of ";
+		lOSS << "smallest crowding distance, while 'hypervolume' removes the individual of ";
+		lOSS << "smallest exclusive hypervolume contribution (crowding distance being used ";
+		lOSS << "with more than two objectives).";
+		Register::Description lDescription(
+		    "Pareto front truncation method",
+		    "String",
+		    "crowding",
+		    lOSS.str()
+		);
+		ioSystem.getRegister().insertEntry("ec.hof.paretotrunc", new String("crowding"), lDescription);
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Make sure that the archive indexes the actual members of the Pareto front.
+ *  \param inNbObjectives Number of objectives of the individuals to insert.
+ *  \param ioContext Evolution context.
+ *  \return True if the archive can be used, false if the members must be compared pairwise.
+ *
+ *  The archive is built again when the members were changed by other means than the updates
+ *  of the hall-of-fame (reading a milestone, sorting or copying the hall-of-fame). Members
+ *  dominated by other members are then removed from the hall-of-fame.
+ */
+bool EMO::ParetoFrontHOF::synchronizeArchive(unsigned int inNbObjectives, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	bool lSynchronized = (mArchive.getNbObjectives() == inNbObjectives) &&
+	                     (mArchive.size() == mEntries.size()) &&
+	                     (mArchived.size() == mEntries.size());
+	for(unsigned int i=0; lSynchronized && (i<mEntries.size()); ++i) {
+		lSynchronized = (mArchived[i] == mEntries[i].mIndividual.getPointer());
+	}
+	if(lSynchronized) return true;
+
+	Beagle_LogDebugM(
+	    ioContext.getSystem().getLogger(),
+	    "Indexing the " << mEntries.size() << " members of the Pareto front into an archive"
+	);
+	mArchive.clear(inNbObjectives);
+	mArchived.resize(mEntries.size());
+	std::vector<double> lObjectives;
+	std::vector<unsigned int> lRemovedIds;
+	for(unsigned int i=0; i<mEntries.size(); ++i) {
+		unsigned int lNbObjectives = 0;
+		if((mEntries[i].mIndividual == NULL) ||
+		        (NondominatedSorting::extractObjectives(lObjectives, lNbObjectives, *mEntries[i].mIndividual) == false) ||
+		        (lNbObjectives != inNbObjectives)) {
+			mArchive.clear(0);
+			mArchived.clear();
+			return false;
+		}
+		mArchived[i] = mEntries[i].mIndividual.getPointer();
+		if(mArchive.isDominated(&lObjectives[0])) {
+			mEntries[i].mIndividual = NULL;
+			continue;
+		}
+		mArchive.insert(lRemovedIds, &lObjectives[0], i);
+		for(unsigned int j=0; j<lRemovedIds.size(); ++j) mEntries[lRemovedIds[j]].mIndividual = NULL;
+	}
+	compactArchive();
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Remove the members in excess of the maximum size of the Pareto front.
+ *  \param ioContext Evolution context.
+ *  \return Number of members removed.
+ *
+ *  The maximum size is given by parameter "ec.hof.paretomax", a value of 0 meaning that the
+ *  size is not bounded, and the truncation method by parameter "ec.hof.paretotrunc".
+ */
+unsigned int EMO::ParetoFrontHOF::truncateArchive(Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	compactArchive();
+	Register& lRegister = ioContext.getSystem().getRegister();
+	if(lRegister.isRegistered("ec.hof.paretomax") == false) return 0;
+	const unsigned int lMaxSize = castHandleT<UInt>(lRegister["ec.hof.paretomax"])->getWrappedValue();
+	if((lMaxSize == 0) || (mEntries.size() <= lMaxSize)) return 0;
+	ParetoArchive::Truncation lTruncation = ParetoArchive::eCrowding;
+	if(lRegister.isRegistered("ec.hof.paretotrunc")) {
+		lTruncation = ParetoArchive::parseTruncation(
+		                  castHandleT<String>(lRegister["ec.hof.paretotrunc"])->getWrappedValue());
+	}
+
+	std::vector<double> lPoints;
+	std::vector<unsigned int> lIds;
+	mArchive.getPoints(lPoints, lIds);
+	std::vector<unsigned int> lRemoved;
+	ParetoArchive::truncate(lRemoved, lPoints, mArchive.getNbObjectives(), lMaxSize, lTruncation);
+	std::vector<unsigned int> lRemovedIds(lRemoved.size());
+	for(unsigned int i=0; i<lRemoved.size(); ++i) {
+		lRemovedIds[i] = lIds[lRemoved[i]];
+		Beagle_LogDebugM(ioContext.getSystem().getLogger(), *mEntries[lRemovedIds[i]].mIndividual);
+		mEntries[lRemovedIds[i]].mIndividual = NULL;
+	}
+	mArchive.erase(lRemovedIds);
+	compactArchive();
+	Beagle_LogVerboseM(
+	    ioContext.getSystem().getLogger(),
+	    "There are " << lRemoved.size() << " individuals removed to bound the Pareto front to " <<
+	    lMaxSize << " individuals"
+	);
+	return lRemoved.size();
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Update the Pareto front hall-of-fame with the current deme's individuals.
  *  \param inSizeHOF Value of 0 mean no Pareto front hall-of-fame, otherwize ignored.
@@ -80,53 +355,23 @@ bool EMO::ParetoFrontHOF::updateWithDeme(unsigned int inSizeHOF, const Deme& inD
 		mEntries.clear();
 		return true;
 	}
+	if(inDeme.empty()) return false;
 
 	unsigned int lIndividualsAdded=0;
 	unsigned int lIndividualsRemoved=0;
 
-	for(unsigned int i=0; i<inDeme.size(); ++i) {
-		bool lIsDominated=false;
-		Fitness::Handle lIndivFitness = inDeme[i]->getFitness();
-		for(unsigned int j=0; j<mEntries.size(); ++j) {
-			Fitness::Handle lEntryFitness = mEntries[j].mIndividual->getFitness();
-			if(lIndivFitness->isDominated(*lEntryFitness)) {
-				lIsDominated=true;
-				break;
-			} else if(lEntryFitness->isDominated(*lIndivFitness)) {
-				Beagle_LogDebugM(ioContext.getSystem().getLogger(), *mEntries[j].mIndividual);
-				mEntries.erase(mEntries.begin()+j);
-				--j;
-				++lIndividualsRemoved;
-			}
+	std::vector<double> lObjectives;
+	unsigned int lNbObjectives = 0;
+	if(NondominatedSorting::extractObjectives(lObjectives, lNbObjectives, inDeme) &&
+	        (lNbObjectives != 0) && synchronizeArchive(lNbObjectives, ioContext)) {
+		for(unsigned int i=0; i<inDeme.size(); ++i) {
+			insertArchived(*inDeme[i], &lObjectives[i*lNbObjectives], ioContext,
+			               lIndividualsAdded, lIndividualsRemoved);
 		}
-
-		if(lIsDominated==false) {
-			// Test if the individual is unique, and if so add it to the Pareto front.
-			bool lIsIdentical = false;
-			for(unsigned int k=0; k<mEntries.size(); ++k) {
-				if(inDeme[i]->isIdentical(*mEntries[k].mIndividual)) {
-					lIsIdentical = true;
-					break;
-				}
-			}
-			if(lIsIdentical == false) {
-				const Factory& lFactory = ioContext.getSystem().getFactory();
-				const std::string& lIndividualType = inDeme[i]->getType();
-				Individual::Alloc::Handle lIndividualAlloc =
-					castHandleT<Individual::Alloc>(lFactory.getAllocator(lIndividualType));
-				if(lIndividualAlloc == NULL) {
-					std::ostringstream lOSS;
-					lOSS << "Type '" << lIndividualType << "' associated to individual to add to hall-of-fame ";
-					lOSS << "is not valid!";
-					throw Beagle_RunTimeExceptionM(lOSS.str());
-				}
-				Individual::Handle lIndivCopy = castHandleT<Individual>(lIndividualAlloc->allocate());
-				lIndivCopy->copy(*inDeme[i], ioContext.getSystem());
-				HallOfFame::Entry lEntry(lIndivCopy, ioContext.getGeneration(), ioContext.getDemeIndex());
-				mEntries.push_back(lEntry);
-				Beagle_LogDebugM(ioContext.getSystem().getLogger(), *inDeme[i]);
-				++lIndividualsAdded;
-			}
+		lIndividualsRemoved += truncateArchive(ioContext);
+	} else {
+		for(unsigned int i=0; i<inDeme.size(); ++i) {
+			insertPairwise(*inDeme[i], ioContext, lIndividualsAdded, lIndividualsRemoved);
 		}
 	}
 
@@ -145,7 +390,7 @@ bool EMO::ParetoFrontHOF::updateWithDeme(unsigned int inSizeHOF, const Deme& inD
 	}
 
 	// Return if Pareto front has changed.
-	return (lIndividualsAdded == 0) && (lIndividualsRemoved == 0);
+	return (lIndividualsAdded != 0) || (lIndividualsRemoved != 0);
 
 	Beagle_StackTraceEndM();
 }
@@ -171,52 +416,20 @@ bool EMO::ParetoFrontHOF::updateWithIndividual(unsigned int inSizeHOF,
 		return true;
 	}
 
-	bool lParetoFrontModified=false;
-	bool lIsDominated=false;
-	Fitness::Handle lIndivFitness = inIndividual.getFitness();
-	for(unsigned int i=0; i<mEntries.size(); ++i) {
-		Fitness::Handle lEntryFitness = mEntries[i].mIndividual->getFitness();
-		if(lIndivFitness->isDominated(*lEntryFitness)) {
-			lIsDominated=true;
-			break;
-		} else if(lEntryFitness->isDominated(*lIndivFitness)) {
-			Beagle_LogDebugM(ioContext.getSystem().getLogger(), *mEntries[i].mIndividual);
-			mEntries.erase(mEntries.begin()+i);
-			--i;
-			lParetoFrontModified = true;
-		}
-	}
-	if(lIsDominated==false) {
-		// Test if the individual is unique, and if so add it to the Pareto front.
-		bool lIsIdentical = false;
-		for(unsigned int j=0; j<mEntries.size(); ++j) {
-			if(inIndividual.isIdentical(*mEntries[j].mIndividual)) {
-				lIsIdentical = true;
-				break;
-			}
-		}
-		if(lIsIdentical == false) {
-			const Factory& lFactory = ioContext.getSystem().getFactory();
-			std::string lIndividualType = inIndividual.getType();
-			Individual::Alloc::Handle lIndividualAlloc =
-				castHandleT<Individual::Alloc>(lFactory.getAllocator(lIndividualType));
-			if(lIndividualAlloc == NULL) {
-				std::ostringstream lOSS;
-				lOSS << "Type '" << lIndividualType << "' associated to individual to add to hall-of-fame ";
-				lOSS << "is not valid!";
-				throw Beagle_RunTimeExceptionM(lOSS.str());
-			}
-			Individual::Handle lIndivCopy = castHandleT<Individual>(lIndividualAlloc->allocate());
-			lIndivCopy->copy(inIndividual, ioContext.getSystem());
-			HallOfFame::Entry lEntry(lIndivCopy, ioContext.getGeneration(), ioContext.getDemeIndex());
-			mEntries.push_back(lEntry);
-			Beagle_LogDebugM(ioContext.getSystem().getLogger(), inIndividual);
-			lParetoFrontModified = true;
-		}
+	unsigned int lIndividualsAdded=0;
+	unsigned int lIndividualsRemoved=0;
+	std::vector<double> lObjectives;
+	unsigned int lNbObjectives = 0;
+	if(NondominatedSorting::extractObjectives(lObjectives, lNbObjectives, inIndividual) &&
+	        (lNbObjectives != 0) && synchronizeArchive(lNbObjectives, ioContext)) {
+		insertArchived(inIndividual, &lObjectives[0], ioContext, lIndividualsAdded, lIndividualsRemoved);
+		lIndividualsRemoved += truncateArchive(ioContext);
+	} else {
+		insertPairwise(inIndividual, ioContext, lIndividualsAdded, lIndividualsRemoved);
 	}
 
 	// Return if Pareto front has been modified.
-	return lParetoFrontModified;
+	return (lIndividualsAdded != 0) || (lIndividualsRemoved != 0);
 
 	Beagle_StackTraceEndM();
 }
@@ -49,6 +49,7 @@
 #include "Beagle/Core/Logger.hpp"
 #include "Beagle/Core/HallOfFame.hpp"
 #include "Beagle/Core/Deme.hpp"
+#include "Beagle/EMO/ParetoArchive.hpp"
 
 namespace Beagle
 {
@@ -59,9 +60,16 @@ namespace EMO
 /*!
  *  \class ParetoFrontHOF beagle/ParetoFrontHOF.hpp "beagle/ParetoFrontHOF.hpp"
  *  \brief A Pareto front hall-of-fame for multiobjective optimization.
- *  \warning It may be costfull to use this hall-of-fame during an evolution. 
- *    It may be preferable to evaluate the Pareto front at the end of an evolution,
- *    with operator ParetoFrontCalculateOp.
+ *
+ *  When the fitness of the individuals are of type FitnessMultiObj or FitnessMultiObjMin,
+ *  the objectives of the members are indexed in a ParetoArchive (an ND-tree), so that the
+ *  dominance tests of an update only visit the members near the tested individual. Other
+ *  fitness types are compared pairwise with method Fitness::isDominated.
+ *
+ *  The size of the Pareto front is bounded by parameter "ec.hof.paretomax", when it is
+ *  registered (see method registerParams) and non-zero. The members in excess are removed one at a time, using the method
+ *  given by parameter "ec.hof.paretotrunc". Bounding the size requires fitness of type
+ *  FitnessMultiObj or FitnessMultiObjMin.
  *  \ingroup ECF
  *  \ingroup Pop
  *  \ingroup MultiObj
@@ -86,6 +94,27 @@ public:
 	virtual bool                updateWithDeme(unsigned int inSizeHOF, const Deme& inDeme, Context& ioContext);
 	virtual bool                updateWithIndividual(unsigned int inSizeHOF, const Individual& inIndividual, Context& ioContext);
 
+	static void                 registerParams(System& ioSystem);
+
+protected:
+
+	void               compactArchive();
+	Individual::Handle copyIndividual(const Individual& inIndividual, Context& ioContext) const;
+	void               insertArchived(const Individual& inIndividual,
+	                                  const double* inObjectives,
+	                                  Context& ioContext,
+	                                  unsigned int& ioNbAdded,
+	                                  unsigned int& ioNbRemoved);
+	void               insertPairwise(const Individual& inIndividual,
+	                                  Context& ioContext,
+	                                  unsigned int& ioNbAdded,
+	                                  unsigned int& ioNbRemoved);
+	bool               synchronizeArchive(unsigned int inNbObjectives, Context& ioContext);
+	unsigned int       truncateArchive(Context& ioContext);
+
+	ParetoArchive                    mArchive;    //!< Objectives of the members, as an ND-tree.
+	std::vector<const Individual*>   mArchived;   //!< Members indexed in the archive.
+
 };
 
 }
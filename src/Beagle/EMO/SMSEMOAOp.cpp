@@ -0,0 +1,147 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/EMO/SMSEMOAOp.cpp
+ *  \brief  Source code of class EMO::SMSEMOAOp.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/EMO.hpp"
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Build SMS-EMOA replacement strategy operator.
+ *  \param inLMRatioName Lamda over Mu parameter name used in the register.
+ *  \param inName Name of the SMS-EMOA operator.
+ */
+EMO::SMSEMOAOp::SMSEMOAOp(std::string inLMRatioName, std::string inName) :
+		NSGA2Op(inLMRatioName, inName)
+{ }
+
+
+/*!
+ *  \brief Reduce the last Pareto front inserted in the population, using hypervolume contributions.
+ *  \param ioLastFront Individuals of the last Pareto front, reduced to the kept individuals.
+ *  \param inNbKept Number of individuals to keep.
+ *  \param ioContext Evolutionary context.
+ */
+void EMO::SMSEMOAOp::reduceLastFront(Individual::Bag& ioLastFront,
+                                     unsigned int inNbKept,
+                                     Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	if(inNbKept >= ioLastFront.size()) return;
+	std::vector<double> lObjectives;
+	unsigned int lNbObjectives = 0;
+	if((NondominatedSorting::extractObjectives(lObjectives, lNbObjectives, ioLastFront) == false) ||
+	        (lNbObjectives == 0)) {
+		Beagle_LogVerboseM(
+		    ioContext.getSystem().getLogger(),
+		    "Fitness type is not supported by the hypervolume, reducing the last front using crowding distance"
+		);
+		NSGA2Op::reduceLastFront(ioLastFront, inNbKept, ioContext);
+		return;
+	}
+
+	const bool lMinimize = (ioLastFront[0]->getFitness()->getType() == "FitnessMultiObjMin");
+	std::vector<double> lReference;
+	Hypervolume::setReference(lReference, lObjectives, lNbObjectives, *mReference, lMinimize);
+	const bool lExact = (lNbObjectives <= mExactMax->getWrappedValue());
+	RandomStream lStream =
+	    ioContext.getSystem().getRandomizer().getStream(ioContext.getGeneration(),
+	            ioContext.getDemeIndex(),
+	            0,
+	            getName());
+
+	// Remove the individuals of smallest contribution one by one.
+	const unsigned int lNbRemoved = ioLastFront.size() - inNbKept;
+	Beagle_LogVerboseM(
+	    ioContext.getSystem().getLogger(),
+	    "Removing " << lNbRemoved << " individuals of smallest " <<
+	    (lExact ? "exact" : "estimated") << " hypervolume contribution"
+	);
+	std::vector<double> lContributions;
+	std::vector<bool> lRemoved(ioLastFront.size(), false);
+	if(lExact) {
+		Hypervolume::computeContributions(lContributions, lObjectives, lNbObjectives, lReference);
+	}
+	for(unsigned int i=0; i<lNbRemoved; ++i) {
+		if(lExact == false) {
+			// Estimates are computed again on the remaining individuals.
+			std::vector<double> lRemaining;
+			std::vector<double> lEstimates;
+			for(unsigned int j=0; j<ioLastFront.size(); ++j) {
+				if(lRemoved[j] == false) {
+					lRemaining.insert(lRemaining.end(),
+					                  lObjectives.begin()+j*lNbObjectives,
+					                  lObjectives.begin()+(j+1)*lNbObjectives);
+				}
+			}
+			Hypervolume::estimateContributions(lEstimates, lRemaining, lNbObjectives, lReference,
+			                                   mNbSamples->getWrappedValue(), lStream);
+			lContributions.assign(ioLastFront.size(), 0.0);
+			for(unsigned int j=0, k=0; j<ioLastFront.size(); ++j) {
+				if(lRemoved[j] == false) lContributions[j] = lEstimates[k++];
+			}
+		}
+		unsigned int lWorst = ioLastFront.size();
+		for(unsigned int j=0; j<ioLastFront.size(); ++j) {
+			if(lRemoved[j]) continue;
+			if((lWorst == ioLastFront.size()) || (lContributions[j] < lContributions[lWorst])) lWorst = j;
+		}
+		lRemoved[lWorst] = true;
+		if(lExact) {
+			Hypervolume::updateContributions(lContributions, lObjectives, lNbObjectives, lReference,
+			                                 lRemoved, lWorst);
+		}
+	}
+
+	Individual::Bag lKept;
+	for(unsigned int j=0; j<ioLastFront.size(); ++j) {
+		if(lRemoved[j] == false) lKept.push_back(ioLastFront[j]);
+	}
+	ioLastFront = lKept;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Register the parameters of this operator.
+ *  \param ioSystem Reference to the system to use for the initialization.
+ */
+void EMO::SMSEMOAOp::registerParams(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+
+	NSGA2Op::registerParams(ioSystem);
+	EMO::Hypervolume::registerParams(ioSystem, mReference, mExactMax, mNbSamples);
+
+	Beagle_StackTraceEndM();
+}
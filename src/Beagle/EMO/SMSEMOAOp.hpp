@@ -0,0 +1,112 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/EMO/SMSEMOAOp.hpp
+ *  \brief  Definition of the class EMO::SMSEMOAOp.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_EMO_SMSEMOAOp_hpp
+#define Beagle_EMO_SMSEMOAOp_hpp
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+#include "Beagle/Core/Object.hpp"
+#include "Beagle/Core/Pointer.hpp"
+#include "Beagle/Core/PointerT.hpp"
+#include "Beagle/Core/Allocator.hpp"
+#include "Beagle/Core/AllocatorT.hpp"
+#include "Beagle/Core/Container.hpp"
+#include "Beagle/Core/ContainerT.hpp"
+#include "Beagle/EMO/NSGA2Op.hpp"
+
+
+namespace Beagle
+{
+namespace EMO
+{
+
+/*!
+ *  \class SMSEMOAOp Beagle/EMO/SMSEMOAOp.hpp "Beagle/EMO/SMSEMOAOp.hpp"
+ *  \brief SMS-EMOA multiobjective replacement strategy operator class.
+ *  \ingroup ECF
+ *  \ingroup Op
+ *  \ingroup MultiObj
+ *
+ *  The SMS-EMOA replacement strategy of Beume, Naujoks, and Emmerich selects the individuals
+ *  of the union of parents and offsprings by non-dominated sorting, as NSGA2Op does, but
+ *  reduces the last Pareto front by removing one by one the individual of smallest exclusive
+ *  hypervolume contribution. The contributions are updated after each removal (see
+ *  Hypervolume::updateContributions). With more objectives than parameter "ec.hv.exactmax",
+ *  the contributions are estimated by Monte-Carlo sampling.
+ *
+ *  The original steady-state algorithm, breeding a single offspring at each generation, is
+ *  obtained with a (Lambda / Mu) ratio of at most 1/Mu.
+ *
+ *  The hypervolume requires fitness of type FitnessMultiObj or FitnessMultiObjMin; with other
+ *  fitness types, the last front is reduced using crowding distance.
+ *  \par Reference
+ *  N. Beume, B. Naujoks, and M. Emmerich, "SMS-EMOA: Multiobjective selection based on
+ *  dominated hypervolume", European Journal of Operational Research, vol. 181, no. 3, 2007.
+ */
+class SMSEMOAOp : public NSGA2Op
+{
+
+public:
+
+	//! SMSEMOAOp allocator type.
+	typedef AllocatorT<SMSEMOAOp,NSGA2Op::Alloc>
+	Alloc;
+	//! SMSEMOAOp handle type.
+	typedef PointerT<SMSEMOAOp,NSGA2Op::Handle>
+	Handle;
+	//! SMSEMOAOp bag type.
+	typedef ContainerT<SMSEMOAOp,NSGA2Op::Bag>
+	Bag;
+
+	SMSEMOAOp(std::string inLMRatioName="ec.mulambda.ratio",
+	          std::string inName="SMSEMOAOp");
+	virtual ~SMSEMOAOp()
+	{ }
+
+	virtual void registerParams(System& ioSystem);
+
+protected:
+
+	virtual void reduceLastFront(Individual::Bag& ioLastFront, unsigned int inNbKept, Context& ioContext) const;
+
+	DoubleArray::Handle mReference;    //!< Reference point of the hypervolume.
+	UInt::Handle        mExactMax;     //!< Maximum number of objectives for exact hypervolumes.
+	UInt::Handle        mNbSamples;    //!< Number of samples of hypervolume estimates.
+
+};
+
+}
+}
+
+#endif // Beagle_EMO_SMSEMOAOp_hpp
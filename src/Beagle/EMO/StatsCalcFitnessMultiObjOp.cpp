@@ -125,5 +125,97 @@ void EMO::StatsCalcFitnessMultiObjOp::calculateStatsDeme(Stats& outStats,
 			                           lAverage, lStdError, lMax, lMin));
 		}
 	}
+
+	double lHypervolume = 0.0;
+	if(computeHypervolume(lHypervolume, ioDeme, ioContext.getDemeIndex(), ioContext)) {
+		outStats.push_back(Measure("hypervolume", lHypervolume, 0.0, lHypervolume, lHypervolume));
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Calculate statistics of the vivarium.
+ *  \param outStats Evaluated statistics.
+ *  \param ioVivarium Vivarium to evalute the statistics.
+ *  \param ioContext Context of the evolution.
+ *
+ *  The hypervolume of the vivarium is the one of the union of the demes, instead of the
+ *  average hypervolume of the demes.
+ */
+void EMO::StatsCalcFitnessMultiObjOp::calculateStatsVivarium(Stats& outStats,
+        Vivarium& ioVivarium,
+        Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	EC::StatsCalculateOp::calculateStatsVivarium(outStats, ioVivarium, ioContext);
+	for(unsigned int i=0; i<outStats.size(); ++i) {
+		if(outStats[i].mID != "hypervolume") continue;
+		Individual::Bag lIndividuals;
+		for(unsigned int j=0; j<ioVivarium.size(); ++j) {
+			lIndividuals.insert(lIndividuals.end(), ioVivarium[j]->begin(), ioVivarium[j]->end());
+		}
+		double lHypervolume = 0.0;
+		if(computeHypervolume(lHypervolume, lIndividuals, ioVivarium.size(), ioContext)) {
+			outStats[i] = Measure("hypervolume", lHypervolume, 0.0, lHypervolume, lHypervolume);
+		}
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Compute the hypervolume of a pool of individuals.
+ *  \param outHypervolume Hypervolume of the individuals.
+ *  \param inIndividualPool Individuals to measure.
+ *  \param inStreamIndex Index of the random stream used by Monte-Carlo estimates.
+ *  \param ioContext Context of the evolution.
+ *  \return True if the hypervolume is computed, false if the fitness type is not supported.
+ *
+ *  Estimates draw their samples from a random stream of the system randomizer, so that the
+ *  random numbers of the evolution are not changed by the statistics.
+ */
+bool EMO::StatsCalcFitnessMultiObjOp::computeHypervolume(double& outHypervolume,
+        const Individual::Bag& inIndividualPool,
+        unsigned int inStreamIndex,
+        Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	outHypervolume = 0.0;
+	std::vector<double> lObjectives;
+	unsigned int lNbObjectives = 0;
+	if(inIndividualPool.empty() ||
+	        (NondominatedSorting::extractObjectives(lObjectives, lNbObjectives, inIndividualPool) == false) ||
+	        (lNbObjectives == 0)) return false;
+	const bool lMinimize = (inIndividualPool[0]->getFitness()->getType() == "FitnessMultiObjMin");
+	std::vector<double> lReference;
+	Hypervolume::setReference(lReference, lObjectives, lNbObjectives, *mReference, lMinimize);
+	if(lNbObjectives <= mExactMax->getWrappedValue()) {
+		outHypervolume = Hypervolume::compute(lObjectives, lNbObjectives, lReference);
+	} else {
+		RandomStream lStream =
+		    ioContext.getSystem().getRandomizer().getStream(ioContext.getGeneration(),
+		            inStreamIndex,
+		            0,
+		            getName());
+		outHypervolume = Hypervolume::estimate(lObjectives, lNbObjectives, lReference,
+		                                       mNbSamples->getWrappedValue(), lStream);
+	}
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Register the parameters of this operator.
+ *  \param ioSystem Reference to the system to use for the initialization.
+ */
+void EMO::StatsCalcFitnessMultiObjOp::registerParams(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+
+	EC::StatsCalculateOp::registerParams(ioSystem);
+	EMO::Hypervolume::registerParams(ioSystem, mReference, mExactMax, mNbSamples);
+
 	Beagle_StackTraceEndM();
 }
@@ -50,6 +50,8 @@
 #include "Beagle/Core/Stats.hpp"
 #include "Beagle/Core/Vivarium.hpp"
 #include "Beagle/Core/Context.hpp"
+#include "Beagle/Core/Double.hpp"
+#include "Beagle/Core/UInt.hpp"
 #include "Beagle/EC/StatsCalculateOp.hpp"
 
 namespace Beagle
@@ -63,6 +65,12 @@ namespace EMO
  *     "beagle/StatsCalcFitnessMultiObjOp.hpp"
  *  \brief Calculate statistics of a deme operator class for individual fitness is of the
  *     type FitnessMultiObj.
+ *
+ *  Besides the statistics of each objective, the hypervolume of the individuals is measured
+ *  (see class Hypervolume), for each deme and for the whole vivarium. It is computed exactly
+ *  up to parameter "ec.hv.exactmax" objectives, and estimated by Monte-Carlo sampling beyond.
+ *  Parameter "ec.hv.ref" should be set to get hypervolumes that can be compared between
+ *  generations.
  *  \ingroup ECF
  *  \ingroup Op
  *  \ingroup FitStats
@@ -85,6 +93,19 @@ public:
 	{ }
 
 	virtual void calculateStatsDeme(Stats& outStats, Deme& ioDeme, Context& ioContext) const;
+	virtual void calculateStatsVivarium(Stats& outStats, Vivarium& ioVivarium, Context& ioContext) const;
+	virtual void registerParams(System& ioSystem);
+
+protected:
+
+	bool computeHypervolume(double& outHypervolume,
+	                        const Individual::Bag& inIndividualPool,
+	                        unsigned int inStreamIndex,
+	                        Context& ioContext) const;
+
+	DoubleArray::Handle mReference;    //!< Reference point of the hypervolume.
+	UInt::Handle        mExactMax;     //!< Maximum number of objectives for exact hypervolumes.
+	UInt::Handle        mNbSamples;    //!< Number of samples of hypervolume estimates.
 
 };
 
@@ -37,6 +37,7 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <cstring>
 #include <float.h>    // To get FLT_MAX on Borland C++ Builder
 
 using namespace Beagle;
@@ -106,6 +107,25 @@ void FltVec::FloatVector::swap(unsigned int inI, unsigned int inJ)
 }
 
 
+/*!
+ *  \brief Compute a hash value of the float vector.
+ *  \return Hash value, equal for float vectors that are equal.
+ */
+unsigned long FltVec::FloatVector::computeHash() const
+{
+	Beagle_StackTraceBeginM();
+	unsigned long lHash = size();
+	for(unsigned int i=0; i<size(); ++i) {
+		const double lValue = ((*this)[i] == 0.0) ? 0.0 : (*this)[i];  // -0.0 is equal to 0.0
+		unsigned long lBits[(sizeof(double)+sizeof(unsigned long)-1)/sizeof(unsigned long)] = { 0 };
+		std::memcpy(lBits, &lValue, sizeof(double));
+		for(unsigned int j=0; j<(sizeof(lBits)/sizeof(unsigned long)); ++j) lHash = combineHash(lHash, lBits[j]);
+	}
+	return lHash;
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief  Test if two float vectors are equals.
  *  \param  inRightObj Second float vector used for the comparison.
@@ -140,6 +160,22 @@ bool FltVec::FloatVector::isLess(const Object& inRightObj) const
 }
 
 
+/*!
+ *  \brief Read a float vector from a binary archive.
+ *  \param ioArchive Binary archive from which the float vector is read.
+ *  \param ioContext Evolutionary context.
+ */
+void FltVec::FloatVector::readBinary(BinaryInArchive& ioArchive, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	clear();
+	const unsigned int lSize = ioArchive.readUInt();
+	reserve(lSize);
+	for(unsigned int i=0; i<lSize; ++i) push_back(ioArchive.readDouble());
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Read a float vector from a XML subtree.
  *  \param inIter XML iterator from which the float vector is read.
@@ -179,6 +215,19 @@ void FltVec::FloatVector::readWithContext(PACC::XML::ConstIterator inIter, Conte
 }
 
 
+/*!
+ *  \brief Write a float vector into a binary archive.
+ *  \param ioArchive Binary archive into which the float vector is written.
+ */
+void FltVec::FloatVector::writeBinary(BinaryOutArchive& ioArchive) const
+{
+	Beagle_StackTraceBeginM();
+	ioArchive.writeUInt(size());
+	for(unsigned int i=0; i<size(); ++i) ioArchive.writeDouble((*this)[i]);
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Write a float vector into a XML streamer.
  *  \param ioStreamer XML streamer into which the float vector is written.
@@ -187,6 +187,9 @@ void FltVec::MutationGaussianOp::registerParams(System& ioSystem)
  *  \param ioIndividual Real-valued GA individual to mutate.
  *  \param ioContext Context of the evolution.
  *  \return True if the individual is effectively mutated, false if not.
+ *
+ *  The gap between two mutated values is drawn from a geometric distribution, and the
+ *  Gaussian deviates are then drawn in a block, for the mutated values only.
  */
 bool FltVec::MutationGaussianOp::mutate(Beagle::Individual& ioIndividual, Context& ioContext)
 {
@@ -200,6 +203,11 @@ bool FltVec::MutationGaussianOp::mutate(Beagle::Individual& ioIndividual, Contex
 	    mMutateGaussSigma->serialize()
 	);
 
+	Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+	const double lMutateFloatPb = mMutateFloatPb->getWrappedValue();
+	std::vector<unsigned int> lMutatedIndices;
+	std::vector<double> lGaussians;
+	std::vector<unsigned long> lSkips;
 	for(unsigned int i=0; i<ioIndividual.size(); i++) {
 		FltVec::FloatVector::Handle lVector = castHandleT<FltVec::FloatVector>(ioIndividual[i]);
 		Beagle_LogVerboseM(
@@ -207,34 +215,52 @@ bool FltVec::MutationGaussianOp::mutate(Beagle::Individual& ioIndividual, Contex
 		    string("Gaussian mutation the ")+uint2ordinal(i+1)+" float vector"
 		);
 		Beagle_LogDebugM(ioContext.getSystem().getLogger(), *lVector);
-		for(unsigned int j=0; j<lVector->size(); j++) {
-			const float lRolledPb = ioContext.getSystem().getRandomizer().rollUniform();
-			if(lRolledPb <= mMutateFloatPb->getWrappedValue()) {
-				const double lMaxVal = j<mMaxValue->size() ? (*mMaxValue)[j] : mMaxValue->back();
-				const double lMinVal = j<mMinValue->size() ? (*mMinValue)[j] : mMinValue->back();
-				const double lIncVal = j<mIncValue->size() ? (*mIncValue)[j] : mIncValue->back();
-				const double lMu =
-				    j<mMutateGaussMu->size() ? (*mMutateGaussMu)[j] : mMutateGaussMu->back();
-				const double lSigma =
-				    j<mMutateGaussSigma->size() ? (*mMutateGaussSigma)[j] : mMutateGaussSigma->back();
-				Beagle_AssertM(lSigma>=0.0);
-				const double lMValue = ioContext.getSystem().getRandomizer().rollGaussian(lMu,lSigma);
-				(*lVector)[j] += lMValue;
-				if((*lVector)[j] > lMaxVal) (*lVector)[j] = lMaxVal;
-				if((*lVector)[j] < lMinVal) (*lVector)[j] = lMinVal;
-				if(std::fabs(lIncVal)>1e-12) {
-					(*lVector)[j] = lIncVal * round((*lVector)[j] / lIncVal);
-					if((*lVector)[j] > lMaxVal) (*lVector)[j] -= lIncVal;
-					if((*lVector)[j] < lMinVal) (*lVector)[j] += lIncVal;
-				}
-				lMutated = true;
-				Beagle_LogDebugM(
-				    ioContext.getSystem().getLogger(),
-				    string("Gaussian mutating by adding ")+dbl2str(lMValue)+
-				    string(" to the value at the index ")+uint2str(j)+
-				    string(" of the float vector")
-				);
+		// Select the values to mutate, skipping directly from one to the next.
+		const unsigned long lSize = lVector->size();
+		lMutatedIndices.clear();
+		lSkips.resize((unsigned int)(lSize*std::min(lMutateFloatPb, 1.0)) + 1);
+		lRandomizer.fillGeometric(&lSkips[0], lSkips.size(), lMutateFloatPb);
+		unsigned int lNextSkip = 0;
+		unsigned long lIndex = lSkips[lNextSkip++];
+		while(lIndex < lSize) {
+			lMutatedIndices.push_back(lIndex);
+			if(lNextSkip == lSkips.size()) {
+				lRandomizer.fillGeometric(&lSkips[0], lSkips.size(), lMutateFloatPb);
+				lNextSkip = 0;
+			}
+			const unsigned long lSkip = lSkips[lNextSkip++];
+			if(lSkip >= lSize) break;
+			lIndex += lSkip + 1;
+		}
+		// Draw the standard Gaussian deviates of the mutations as a block.
+		lGaussians.resize(lMutatedIndices.size());
+		if(lGaussians.empty() == false) lRandomizer.fillGaussian(&lGaussians[0], lGaussians.size());
+		for(unsigned int k=0; k<lMutatedIndices.size(); ++k) {
+			const unsigned int j = lMutatedIndices[k];
+			const double lMaxVal = j<mMaxValue->size() ? (*mMaxValue)[j] : mMaxValue->back();
+			const double lMinVal = j<mMinValue->size() ? (*mMinValue)[j] : mMinValue->back();
+			const double lIncVal = j<mIncValue->size() ? (*mIncValue)[j] : mIncValue->back();
+			const double lMu =
+			    j<mMutateGaussMu->size() ? (*mMutateGaussMu)[j] : mMutateGaussMu->back();
+			const double lSigma =
+			    j<mMutateGaussSigma->size() ? (*mMutateGaussSigma)[j] : mMutateGaussSigma->back();
+			Beagle_AssertM(lSigma>=0.0);
+			const double lMValue = lMu + (lSigma * lGaussians[k]);
+			(*lVector)[j] += lMValue;
+			if((*lVector)[j] > lMaxVal) (*lVector)[j] = lMaxVal;
+			if((*lVector)[j] < lMinVal) (*lVector)[j] = lMinVal;
+			if(std::fabs(lIncVal)>1e-12) {
+				(*lVector)[j] = lIncVal * round((*lVector)[j] / lIncVal);
+				if((*lVector)[j] > lMaxVal) (*lVector)[j] -= lIncVal;
+				if((*lVector)[j] < lMinVal) (*lVector)[j] += lIncVal;
 			}
+			lMutated = true;
+			Beagle_LogDebugM(
+			    ioContext.getSystem().getLogger(),
+			    string("Gaussian mutating by adding ")+dbl2str(lMValue)+
+			    string(" to the value at the index ")+uint2str(j)+
+			    string(" of the float vector")
+			);
 		}
 		if(lMutated) {
 			Beagle_LogVerboseM(
@@ -67,6 +67,9 @@
 #include "Beagle/GP/PrimitiveSet.hpp"
 #include "Beagle/GP/PrimitiveSuperSet.hpp"
 #include "Beagle/GP/Tree.hpp"
+#include "Beagle/GP/CompiledTree.hpp"
+#include "Beagle/GP/FitnessCases.hpp"
+#include "Beagle/GP/ArgumentBindings.hpp"
 #include "Beagle/GP/PrimitiveInline.hpp"
 #include "Beagle/GP/FitnessKoza.hpp"
 #include "Beagle/GP/StatsCalcFitnessSimpleOp.hpp"
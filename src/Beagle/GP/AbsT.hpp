@@ -49,6 +49,7 @@
 #include "Beagle/GP/Primitive.hpp"
 #include "Beagle/GP/PrimitiveInline.hpp"
 #include "Beagle/GP/Context.hpp"
+#include "Beagle/GP/CompiledTree.hpp"
 #include "Beagle/GP/Datum.hpp"
 
 #ifdef BEAGLE_HAVE_RTTI
@@ -95,6 +96,7 @@ public:
 
 	virtual std::string deparse(std::vector<std::string>& lSubTrees) const;
 	virtual void        execute(GP::Datum& outResult, GP::Context& ioContext);
+	virtual bool        getInstruction(GP::Instruction& outInstruction) const;
 
 };
 
@@ -174,4 +176,48 @@ void Beagle::GP::AbsT<T>::execute(Beagle::GP::Datum& outResult, Beagle::GP::Cont
 }
 
 
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the absolute value primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return False, as there is no equivalent instruction for the generic type T.
+ */
+template <class T>
+bool Beagle::GP::AbsT<T>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	return false;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the absolute value primitive for Double.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+template <>
+inline bool Beagle::GP::AbsT<Beagle::Double>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = Beagle::GP::Instruction::eAbsDouble;
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the absolute value primitive for Int.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+template <>
+inline bool Beagle::GP::AbsT<Beagle::Int>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = Beagle::GP::Instruction::eAbsInt;
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
 #endif // Beagle_GP_AbsT_hpp
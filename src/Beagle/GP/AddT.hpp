@@ -54,6 +54,7 @@
 #include "Beagle/GP/Primitive.hpp"
 #include "Beagle/GP/PrimitiveInline.hpp"
 #include "Beagle/GP/Context.hpp"
+#include "Beagle/GP/CompiledTree.hpp"
 #include "Beagle/GP/Datum.hpp"
 
 #ifdef BEAGLE_HAVE_RTTI
@@ -101,6 +102,7 @@ public:
 
 	virtual std::string deparse(std::vector<std::string>& lSubTrees) const;
 	virtual void        execute(GP::Datum& outResult, GP::Context& ioContext);
+	virtual bool        getInstruction(GP::Instruction& outInstruction) const;
 
 };
 
@@ -194,4 +196,48 @@ void Beagle::GP::AddT<T>::execute(Beagle::GP::Datum& outResult, Beagle::GP::Cont
 }
 
 
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the addition primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return False, as there is no equivalent instruction for the generic type T.
+ */
+template <class T>
+bool Beagle::GP::AddT<T>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	return false;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the addition primitive for Double.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+template <>
+inline bool Beagle::GP::AddT<Beagle::Double>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = Beagle::GP::Instruction::eAddDouble;
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the addition primitive for Int.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+template <>
+inline bool Beagle::GP::AddT<Beagle::Int>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = Beagle::GP::Instruction::eAddInt;
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
 #endif // Beagle_GP_AddT_hpp
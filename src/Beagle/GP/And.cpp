@@ -98,3 +98,16 @@ void GP::And::execute(GP::Datum& outResult, GP::Context& ioContext)
 	Beagle_StackTraceEndM();
 }
 
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the boolean and primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool GP::And::getInstruction(GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = GP::Instruction::eAnd;
+	return true;
+	Beagle_StackTraceEndM();
+}
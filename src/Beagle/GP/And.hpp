@@ -99,6 +99,7 @@ public:
 #endif // BEAGLE_HAVE_RTTI
 
 	virtual void execute(GP::Datum& outResult, GP::Context& ioContext);
+	virtual bool getInstruction(GP::Instruction& outInstruction) const;
 
 };
 
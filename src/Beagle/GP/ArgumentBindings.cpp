@@ -0,0 +1,185 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/GP/ArgumentBindings.cpp
+ *  \brief  Source code of class GP::ArgumentBindings.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/GP.hpp"
+
+#include <sstream>
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Bind the arguments of the given names to the terminals of the primitive sets.
+ *  \param inNames Names of the arguments, in the order of their indices.
+ *  \param ioSystem Evolutionary system.
+ *  \throw Beagle::RunTimeException If a named primitive is not found in any sets.
+ */
+void GP::ArgumentBindings::bind(const std::vector<std::string>& inNames, System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	GP::PrimitiveSuperSet::Handle lSuperSet =
+	    castHandleT<GP::PrimitiveSuperSet>(ioSystem.getComponent("GP-PrimitiveSuperSet"));
+	if(lSuperSet == NULL) {
+		throw Beagle_RunTimeExceptionM("There should be a GP::PrimitiveSuperSet component in the system");
+	}
+	clear();
+	mNames = inNames;
+	mOffsets.push_back(0);
+	for(unsigned int i=0; i<inNames.size(); ++i) {
+		bool lFound = false;
+		for(unsigned int j=0; j<lSuperSet->size(); ++j) {
+			Primitive::Handle lPrimitive = (*lSuperSet)[j]->getPrimitiveByName(inNames[i]);
+			if(!lPrimitive) continue;
+			lFound = true;
+			Target lTarget;
+			lTarget.mPrimitive = lPrimitive;
+			lTarget.mFrameIndex = lPrimitive->getFrameIndex();
+			lTarget.mType = eObjectTarget;
+			if(lTarget.mFrameIndex != UINT_MAX) {
+				// Terminals of the same name share a frame index, set it once
+				bool lAlreadyBound = false;
+				for(unsigned int k=mOffsets.back(); k<mTargets.size(); ++k) {
+					if(mTargets[k].mFrameIndex == lTarget.mFrameIndex) lAlreadyBound = true;
+				}
+				if(lAlreadyBound) continue;
+				GP::Instruction lInstruction;
+				lInstruction.mFrameIndex = UINT_MAX;
+				if(lPrimitive->getInstruction(lInstruction) && (lInstruction.mFrameIndex == lTarget.mFrameIndex)) {
+					switch(lInstruction.mOpcode) {
+						case GP::Instruction::eLoadDouble: lTarget.mType = eDoubleTarget; break;
+						case GP::Instruction::eLoadBool:   lTarget.mType = eBoolTarget; break;
+						case GP::Instruction::eLoadInt:    lTarget.mType = eIntTarget; break;
+						default: break;
+					}
+				}
+			}
+			mTargets.push_back(lTarget);
+		}
+		if(lFound == false) {
+			std::string lMessage = "The primitive named '";
+			lMessage += inNames[i];
+			lMessage += "' was not found in any ";
+			lMessage += "of the primitive sets. Maybe the primitive was not properly inserted ";
+			lMessage += "or the name is mispelled.";
+			throw Beagle_RunTimeExceptionM(lMessage);
+		}
+		mOffsets.push_back(mTargets.size());
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Bind the arguments named with a prefix followed by their index.
+ *  \param inPrefix Prefix of the argument names (e.g. "IN" for "IN0", "IN1", ...).
+ *  \param inNumberArguments Number of arguments.
+ *  \param ioSystem Evolutionary system.
+ *  \throw Beagle::RunTimeException If a named primitive is not found in any sets.
+ */
+void GP::ArgumentBindings::bind(const std::string& inPrefix, unsigned int inNumberArguments, System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	std::vector<std::string> lNames(inNumberArguments);
+	for(unsigned int i=0; i<inNumberArguments; ++i) {
+		std::ostringstream lOSS;
+		lOSS << inPrefix << i;
+		lNames[i] = lOSS.str();
+	}
+	bind(lNames, ioSystem);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Remove all the bindings.
+ */
+void GP::ArgumentBindings::clear()
+{
+	Beagle_StackTraceBeginM();
+	mNames.clear();
+	mTargets.clear();
+	mOffsets.clear();
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Set an argument with a value object.
+ *  \param inIndex Index of the argument.
+ *  \param inValue Value given to the argument terminals.
+ *  \param ioContext Evolutionary context in which the value is set.
+ *
+ *  The value is given to the virtual GP::Primitive::setContextValue method of the terminals,
+ *  as is done by GP::EvaluationOp::setValue, but without looking them up by name.
+ */
+void GP::ArgumentBindings::setValue(unsigned int inIndex, const Object& inValue, GP::Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_UpperBoundCheckAssertM(inIndex,mNames.size()-1);
+	for(unsigned int i=mOffsets[inIndex]; i<mOffsets[inIndex+1]; ++i) {
+		mTargets[i].mPrimitive->setContextValue(inValue, ioContext);
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Set all the arguments from an array of values.
+ *  \param inValues Values of the arguments, one per argument in index order.
+ *  \param ioContext Evolutionary context in which the values are set.
+ */
+void GP::ArgumentBindings::setValues(const double* inValues, GP::Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	for(unsigned int i=0; i<mNames.size(); ++i) {
+		for(unsigned int j=mOffsets[i]; j<mOffsets[i+1]; ++j) setTarget(mTargets[j], inValues[i], ioContext);
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Set all the arguments from the features of a data set sample.
+ *  \param inRow View of the sample, argument i taking the value of feature i.
+ *  \param ioContext Evolutionary context in which the values are set.
+ */
+void GP::ArgumentBindings::setValues(const DataSet::Row& inRow, GP::Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(inRow.size() >= mNames.size());
+	for(unsigned int i=0; i<mNames.size(); ++i) {
+		const double lValue = inRow[i];
+		for(unsigned int j=mOffsets[i]; j<mOffsets[i+1]; ++j) setTarget(mTargets[j], lValue, ioContext);
+	}
+	Beagle_StackTraceEndM();
+}
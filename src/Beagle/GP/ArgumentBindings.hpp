@@ -0,0 +1,245 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/GP/ArgumentBindings.hpp
+ *  \brief  Definition of the type GP::ArgumentBindings.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_GP_ArgumentBindings_hpp
+#define Beagle_GP_ArgumentBindings_hpp
+
+#include <string>
+#include <vector>
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+#include "Beagle/Core/Object.hpp"
+#include "Beagle/Core/AllocatorT.hpp"
+#include "Beagle/Core/PointerT.hpp"
+#include "Beagle/Core/ContainerT.hpp"
+#include "Beagle/Core/Bool.hpp"
+#include "Beagle/Core/Double.hpp"
+#include "Beagle/Core/Int.hpp"
+#include "Beagle/Core/DataSet.hpp"
+#include "Beagle/Core/System.hpp"
+#include "Beagle/GP/Primitive.hpp"
+#include "Beagle/GP/Context.hpp"
+
+
+namespace Beagle
+{
+namespace GP
+{
+
+/*!
+ *  \class ArgumentBindings Beagle/GP/ArgumentBindings.hpp "Beagle/GP/ArgumentBindings.hpp"
+ *  \brief Argument terminals of the primitive sets, resolved once and set by index.
+ *  \ingroup GPF
+ *
+ *  GP::EvaluationOp::setValue looks up the primitive super set and the named primitive of
+ *  each primitive set every time it is called. Argument bindings do that lookup once, usually
+ *  in the init method of the evaluation operator, and keep for each argument the argument
+ *  frame index of the matching terminals. Setting the arguments of a fitness case is then a
+ *  simple store per argument in the frame of the context (see GP::ArgumentFrame), given by
+ *  argument index or from a row of a data set. As values are stored in the context, one
+ *  binding object can be used by several threads, each with its own context.
+ *
+ *  Terminals that do not use the argument frame, or whose value is not a Double, Bool or Int,
+ *  are set through the virtual GP::Primitive::setContextValue method.
+ */
+class ArgumentBindings : public Object
+{
+
+public:
+
+	//! GP::ArgumentBindings allocator type.
+	typedef AllocatorT<ArgumentBindings,Object::Alloc>
+	Alloc;
+	//! GP::ArgumentBindings handle type.
+	typedef PointerT<ArgumentBindings,Object::Handle>
+	Handle;
+	//! GP::ArgumentBindings bag type.
+	typedef ContainerT<ArgumentBindings,Object::Bag>
+	Bag;
+
+	ArgumentBindings()
+	{ }
+	virtual ~ArgumentBindings()
+	{ }
+
+	void bind(const std::vector<std::string>& inNames, System& ioSystem);
+	void bind(const std::string& inPrefix, unsigned int inNumberArguments, System& ioSystem);
+	void clear();
+	void setValue(unsigned int inIndex, const Object& inValue, GP::Context& ioContext);
+	void setValues(const double* inValues, GP::Context& ioContext);
+	void setValues(const DataSet::Row& inRow, GP::Context& ioContext);
+
+	/*!
+	 *  \return Number of arguments bound.
+	 */
+	inline unsigned int size() const
+	{
+		Beagle_StackTraceBeginM();
+		return mNames.size();
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Get the name of a bound argument.
+	 *  \param inIndex Index of the argument.
+	 *  \return Name of the argument terminals.
+	 */
+	inline const std::string& getName(unsigned int inIndex) const
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inIndex,mNames.size()-1);
+		return mNames[inIndex];
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Set a Double argument.
+	 *  \param inIndex Index of the argument.
+	 *  \param inValue Value given to the argument terminals.
+	 *  \param ioContext Evolutionary context in which the value is set.
+	 */
+	inline void setValue(unsigned int inIndex, double inValue, GP::Context& ioContext)
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inIndex,mNames.size()-1);
+		for(unsigned int i=mOffsets[inIndex]; i<mOffsets[inIndex+1]; ++i) {
+			setTarget(mTargets[i], inValue, ioContext);
+		}
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Set a Bool argument.
+	 *  \param inIndex Index of the argument.
+	 *  \param inValue Value given to the argument terminals.
+	 *  \param ioContext Evolutionary context in which the value is set.
+	 */
+	inline void setValue(unsigned int inIndex, bool inValue, GP::Context& ioContext)
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inIndex,mNames.size()-1);
+		for(unsigned int i=mOffsets[inIndex]; i<mOffsets[inIndex+1]; ++i) {
+			Target& lTarget = mTargets[i];
+			if(lTarget.mType == eBoolTarget) getFrameValue<Bool>(lTarget, ioContext).getWrappedValue() = inValue;
+			else setTarget(lTarget, inValue ? 1.0 : 0.0, ioContext);
+		}
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Set a Int argument.
+	 *  \param inIndex Index of the argument.
+	 *  \param inValue Value given to the argument terminals.
+	 *  \param ioContext Evolutionary context in which the value is set.
+	 */
+	inline void setValue(unsigned int inIndex, int inValue, GP::Context& ioContext)
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inIndex,mNames.size()-1);
+		for(unsigned int i=mOffsets[inIndex]; i<mOffsets[inIndex+1]; ++i) {
+			Target& lTarget = mTargets[i];
+			if(lTarget.mType == eIntTarget) getFrameValue<Int>(lTarget, ioContext).getWrappedValue() = inValue;
+			else setTarget(lTarget, double(inValue), ioContext);
+		}
+		Beagle_StackTraceEndM();
+	}
+
+protected:
+
+	//! Types of values of the bound terminals.
+	enum TargetType {eDoubleTarget=0, eBoolTarget, eIntTarget, eObjectTarget};
+
+	//! Terminal bound to an argument.
+	struct Target
+	{
+		Primitive::Handle mPrimitive;   //!< Bound terminal.
+		unsigned int      mFrameIndex;  //!< Argument frame index of the terminal value.
+		unsigned int      mType;        //!< Type of the terminal value.
+	};
+
+	/*!
+	 *  \brief Get the value of a bound terminal in the argument frame of a context.
+	 *  \param inTarget Bound terminal.
+	 *  \param ioContext Evolutionary context.
+	 *  \return Reference to the value, created in the frame if needed.
+	 */
+	template <class T>
+	inline T& getFrameValue(const Target& inTarget, GP::Context& ioContext)
+	{
+		Beagle_StackTraceBeginM();
+		GP::ArgumentFrame& lFrame = ioContext.getArgumentFrame();
+		Object* lValue = lFrame.getValue(inTarget.mFrameIndex);
+		if(lValue == NULL) lValue = lFrame.setValue(inTarget.mFrameIndex, new T);
+		return castObjectT<T&>(*lValue);
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Set the value of a bound terminal, converted to the terminal type.
+	 *  \param ioTarget Bound terminal.
+	 *  \param inValue Value given to the terminal.
+	 *  \param ioContext Evolutionary context in which the value is set.
+	 */
+	inline void setTarget(Target& ioTarget, double inValue, GP::Context& ioContext)
+	{
+		Beagle_StackTraceBeginM();
+		switch(ioTarget.mType) {
+			case eDoubleTarget:
+				getFrameValue<Double>(ioTarget, ioContext).getWrappedValue() = inValue;
+				break;
+			case eBoolTarget:
+				getFrameValue<Bool>(ioTarget, ioContext).getWrappedValue() = (inValue != 0.0);
+				break;
+			case eIntTarget:
+				getFrameValue<Int>(ioTarget, ioContext).getWrappedValue() = int(inValue);
+				break;
+			default: {
+				Double lValue(inValue);
+				ioTarget.mPrimitive->setContextValue(lValue, ioContext);
+				break;
+			}
+		}
+		Beagle_StackTraceEndM();
+	}
+
+	std::vector<std::string>  mNames;    //!< Names of the arguments.
+	std::vector<Target>       mTargets;  //!< Terminals bound, grouped by argument.
+	std::vector<unsigned int> mOffsets;  //!< Index of the first terminal of each argument, plus the end.
+
+};
+
+}
+}
+
+#endif // Beagle_GP_ArgumentBindings_hpp
@@ -0,0 +1,147 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/GP/ArgumentFrame.hpp
+ *  \brief  Definition of the type GP::ArgumentFrame.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_GP_ArgumentFrame_hpp
+#define Beagle_GP_ArgumentFrame_hpp
+
+#include <vector>
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+#include "Beagle/Core/Object.hpp"
+#include "Beagle/Core/Pointer.hpp"
+
+
+namespace Beagle
+{
+namespace GP
+{
+
+/*!
+ *  \class ArgumentFrame Beagle/GP/ArgumentFrame.hpp "Beagle/GP/ArgumentFrame.hpp"
+ *  \brief Values of the argument terminals, local to an evolutionary context.
+ *  \ingroup GPF
+ *
+ *  Argument terminals such as GP::TokenT are shared by all the trees through the primitive
+ *  sets. The primitive super set gives each of them a frame index (see
+ *  GP::Primitive::setFrameIndex), and the values set during an evaluation are stored at that
+ *  index in the frame of the GP context, instead of in the shared primitive. Contexts cloned
+ *  for parallel evaluation thus each have their own argument values. A terminal with no value
+ *  in the frame falls back to the value held by the primitive.
+ *
+ *  Copying a frame gives an empty one, so that cloned contexts never share value objects.
+ */
+class ArgumentFrame
+{
+
+public:
+
+	ArgumentFrame()
+	{ }
+
+	ArgumentFrame(const ArgumentFrame&)
+	{ }
+
+	~ArgumentFrame()
+	{ }
+
+	/*!
+	 *  \brief Assign a frame, which empties it as frames are never shared.
+	 *  \return Reference to the frame.
+	 */
+	ArgumentFrame& operator=(const ArgumentFrame&)
+	{
+		Beagle_StackTraceBeginM();
+		mValues.clear();
+		return *this;
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Remove all the values of the frame.
+	 */
+	inline void clear()
+	{
+		Beagle_StackTraceBeginM();
+		mValues.clear();
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Get the value of an argument.
+	 *  \param inIndex Frame index of the argument.
+	 *  \return Pointer to the value, NULL if the argument has no value in the frame.
+	 */
+	inline Object* getValue(unsigned int inIndex) const
+	{
+		Beagle_StackTraceBeginM();
+		if(inIndex >= mValues.size()) return NULL;
+		return const_cast<Object*>(mValues[inIndex].getPointer());
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Set the object holding the value of an argument.
+	 *  \param inIndex Frame index of the argument.
+	 *  \param inValue Value object, owned by the frame from now on.
+	 *  \return Pointer to the value object.
+	 */
+	inline Object* setValue(unsigned int inIndex, Object* inValue)
+	{
+		Beagle_StackTraceBeginM();
+		if(inIndex >= mValues.size()) mValues.resize(inIndex+1);
+		mValues[inIndex] = inValue;
+		return inValue;
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \return Number of frame indices with storage.
+	 */
+	inline unsigned int size() const
+	{
+		Beagle_StackTraceBeginM();
+		return mValues.size();
+		Beagle_StackTraceEndM();
+	}
+
+protected:
+
+	std::vector<Pointer> mValues;  //!< Value of the arguments, by frame index.
+
+};
+
+}
+}
+
+#endif // Beagle_GP_ArgumentFrame_hpp
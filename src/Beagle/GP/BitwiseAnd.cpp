@@ -99,3 +99,16 @@ void GP::BitwiseAnd::execute(GP::Datum& outResult, GP::Context& ioContext)
 	Beagle_StackTraceEndM();
 }
 
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the bitwise and primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool GP::BitwiseAnd::getInstruction(GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = GP::Instruction::eBitwiseAnd;
+	return true;
+	Beagle_StackTraceEndM();
+}
@@ -100,3 +100,17 @@ void GP::BitwiseNand::execute(GP::Datum& outResult, GP::Context& ioContext)
 	lResult = ~(lResult.getWrappedValue() & lArg2.getWrappedValue());
 	Beagle_StackTraceEndM();
 }
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the bitwise nand primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool GP::BitwiseNand::getInstruction(GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = GP::Instruction::eBitwiseNand;
+	return true;
+	Beagle_StackTraceEndM();
+}
@@ -100,3 +100,17 @@ void GP::BitwiseNor::execute(GP::Datum& outResult, GP::Context& ioContext)
 	lResult = ~(lResult.getWrappedValue() | lArg2.getWrappedValue());
 	Beagle_StackTraceEndM();
 }
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the bitwise nor primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool GP::BitwiseNor::getInstruction(GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = GP::Instruction::eBitwiseNor;
+	return true;
+	Beagle_StackTraceEndM();
+}
@@ -98,3 +98,17 @@ void GP::BitwiseNot::execute(GP::Datum& outResult, GP::Context& ioContext)
 	lResult = ~(lResult.getWrappedValue());
 	Beagle_StackTraceEndM();
 }
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the bitwise not primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool GP::BitwiseNot::getInstruction(GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = GP::Instruction::eBitwiseNot;
+	return true;
+	Beagle_StackTraceEndM();
+}
@@ -100,3 +100,17 @@ void GP::BitwiseOr::execute(GP::Datum& outResult, GP::Context& ioContext)
 	lResult = lResult.getWrappedValue() | lArg2.getWrappedValue();
 	Beagle_StackTraceEndM();
 }
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the bitwise or primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool GP::BitwiseOr::getInstruction(GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = GP::Instruction::eBitwiseOr;
+	return true;
+	Beagle_StackTraceEndM();
+}
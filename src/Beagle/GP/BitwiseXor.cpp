@@ -100,3 +100,17 @@ void GP::BitwiseXor::execute(GP::Datum& outResult, GP::Context& ioContext)
 	lResult = lResult.getWrappedValue() ^ lArg2.getWrappedValue();
 	Beagle_StackTraceEndM();
 }
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the bitwise xor primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool GP::BitwiseXor::getInstruction(GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = GP::Instruction::eBitwiseXor;
+	return true;
+	Beagle_StackTraceEndM();
+}
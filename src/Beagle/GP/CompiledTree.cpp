@@ -0,0 +1,846 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/GP/CompiledTree.cpp
+ *  \brief  Implementation of the type GP::CompiledTree.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/GP.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Beagle;
+
+
+namespace
+{
+
+/*!
+ *  \brief Signature of an instruction opcode.
+ */
+struct OpcodeSignature
+{
+	unsigned int mNumberArguments;  //!< Number of arguments popped from the stack.
+	unsigned int mArgTypes[3];      //!< Slot types of the arguments, in the order they are pushed.
+	unsigned int mReturnType;       //!< Slot type of the result pushed on the stack.
+};
+
+typedef GP::CompiledTree CT;
+
+/*!
+ *  \brief Signatures of the opcodes, indexed by GP::Instruction::Opcode.
+ */
+const OpcodeSignature gOpcodeSignatures[GP::Instruction::eNumberOpcodes] = {
+	{0, {0,               0,               0              }, CT::eDoubleSlot}, // eCallDouble
+	{0, {0,               0,               0              }, CT::eBoolSlot  }, // eCallBool
+	{0, {0,               0,               0              }, CT::eIntSlot   }, // eCallInt
+	{0, {0,               0,               0              }, CT::eDoubleSlot}, // eLoadDouble
+	{0, {0,               0,               0              }, CT::eBoolSlot  }, // eLoadBool
+	{0, {0,               0,               0              }, CT::eIntSlot   }, // eLoadInt
+	{2, {CT::eDoubleSlot, CT::eDoubleSlot, 0              }, CT::eDoubleSlot}, // eAddDouble
+	{2, {CT::eDoubleSlot, CT::eDoubleSlot, 0              }, CT::eDoubleSlot}, // eSubtractDouble
+	{2, {CT::eDoubleSlot, CT::eDoubleSlot, 0              }, CT::eDoubleSlot}, // eMultiplyDouble
+	{2, {CT::eDoubleSlot, CT::eDoubleSlot, 0              }, CT::eDoubleSlot}, // eDivideDouble
+	{1, {CT::eDoubleSlot, 0,               0              }, CT::eDoubleSlot}, // eAbsDouble
+	{1, {CT::eDoubleSlot, 0,               0              }, CT::eDoubleSlot}, // eSin
+	{1, {CT::eDoubleSlot, 0,               0              }, CT::eDoubleSlot}, // eCos
+	{1, {CT::eDoubleSlot, 0,               0              }, CT::eDoubleSlot}, // eExp
+	{1, {CT::eDoubleSlot, 0,               0              }, CT::eDoubleSlot}, // eLog
+	{2, {CT::eIntSlot,    CT::eIntSlot,    0              }, CT::eIntSlot   }, // eAddInt
+	{2, {CT::eIntSlot,    CT::eIntSlot,    0              }, CT::eIntSlot   }, // eSubtractInt
+	{2, {CT::eIntSlot,    CT::eIntSlot,    0              }, CT::eIntSlot   }, // eMultiplyInt
+	{1, {CT::eIntSlot,    0,               0              }, CT::eIntSlot   }, // eAbsInt
+	{2, {CT::eIntSlot,    CT::eIntSlot,    0              }, CT::eIntSlot   }, // eBitwiseAnd
+	{2, {CT::eIntSlot,    CT::eIntSlot,    0              }, CT::eIntSlot   }, // eBitwiseOr
+	{2, {CT::eIntSlot,    CT::eIntSlot,    0              }, CT::eIntSlot   }, // eBitwiseXor
+	{2, {CT::eIntSlot,    CT::eIntSlot,    0              }, CT::eIntSlot   }, // eBitwiseNand
+	{2, {CT::eIntSlot,    CT::eIntSlot,    0              }, CT::eIntSlot   }, // eBitwiseNor
+	{1, {CT::eIntSlot,    0,               0              }, CT::eIntSlot   }, // eBitwiseNot
+	{2, {CT::eBoolSlot,   CT::eBoolSlot,   0              }, CT::eBoolSlot  }, // eAnd
+	{2, {CT::eBoolSlot,   CT::eBoolSlot,   0              }, CT::eBoolSlot  }, // eOr
+	{2, {CT::eBoolSlot,   CT::eBoolSlot,   0              }, CT::eBoolSlot  }, // eXor
+	{2, {CT::eBoolSlot,   CT::eBoolSlot,   0              }, CT::eBoolSlot  }, // eNand
+	{2, {CT::eBoolSlot,   CT::eBoolSlot,   0              }, CT::eBoolSlot  }, // eNor
+	{1, {CT::eBoolSlot,   0,               0              }, CT::eBoolSlot  }, // eNot
+	{2, {CT::eDoubleSlot, CT::eDoubleSlot, 0              }, CT::eBoolSlot  }, // eLessDouble
+	{2, {CT::eDoubleSlot, CT::eDoubleSlot, 0              }, CT::eBoolSlot  }, // eEqualDouble
+	{3, {CT::eBoolSlot,   CT::eBoolSlot,   CT::eBoolSlot  }, CT::eBoolSlot  }, // eIfBool
+	{3, {CT::eBoolSlot,   CT::eDoubleSlot, CT::eDoubleSlot}, CT::eDoubleSlot}  // eIfDouble
+};
+
+}
+
+
+/*!
+ *  \brief Construct an empty compiled tree.
+ */
+GP::CompiledTree::CompiledTree() :
+		mRootType(eDoubleSlot)
+{ }
+
+
+/*!
+ *  \brief Copy-construct a compiled tree, which gives an empty compiled tree.
+ *  \param inOriginal Compiled tree copied.
+ */
+GP::CompiledTree::CompiledTree(const GP::CompiledTree& inOriginal) :
+		mRootType(eDoubleSlot)
+{ }
+
+
+/*!
+ *  \brief Assign a compiled tree, which empties the actual compiled tree.
+ *  \param inOriginal Compiled tree assigned.
+ *  \return Reference to the actual compiled tree.
+ */
+GP::CompiledTree& GP::CompiledTree::operator=(const GP::CompiledTree& inOriginal)
+{
+	Beagle_StackTraceBeginM();
+	if(this != &inOriginal) clear();
+	return *this;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Remove the compiled code and release the primitives of the source tree.
+ */
+void GP::CompiledTree::clear()
+{
+	Beagle_StackTraceBeginM();
+	mInstructions.clear();
+	mPrimitives.clear();
+	mStack.clear();
+	mLoadColumns.clear();
+	mBindings.clear();
+	mRootType = eDoubleSlot;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Compile a GP tree into a postfix program.
+ *  \param inTree GP tree to compile.
+ *  \return True if the tree has been compiled, false if its root primitive has no instruction.
+ *
+ *  When the root primitive of the tree has no instruction, nothing would be gained from the
+ *  compiled tree and the compiled code is left empty; the tree should then be executed
+ *  through the virtual path.
+ */
+bool GP::CompiledTree::compile(const GP::Tree& inTree)
+{
+	Beagle_StackTraceBeginM();
+	clear();
+	mPrimitives.reserve(inTree.size());
+	for(unsigned int i=0; i<inTree.size(); ++i) mPrimitives.push_back(inTree[i].mPrimitive);
+	if(inTree.empty()) return false;
+
+	Instruction lRootInstruction;
+	lRootInstruction.mFrameIndex = UINT_MAX;
+	if(inTree[0].mPrimitive->getInstruction(lRootInstruction) == false) return false;
+	Beagle_AssertM(lRootInstruction.mOpcode < Instruction::eNumberOpcodes);
+	mRootType = gOpcodeSignatures[lRootInstruction.mOpcode].mReturnType;
+
+	unsigned int lStackSize = 0;
+	mInstructions.reserve(inTree.size());
+	compileSubTree(inTree, 0, mRootType, lStackSize);
+	Beagle_AssertM(lStackSize == 1);
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Compile a sub-tree of a GP tree, appending its instructions to the program.
+ *  \param inTree GP tree compiled.
+ *  \param inNodeIndex Index of the sub-tree root node.
+ *  \param inSlotType Slot type the sub-tree must return.
+ *  \param ioStackSize Stack size before the sub-tree, updated to the size after it.
+ *  \return Index of the node following the sub-tree.
+ */
+unsigned int GP::CompiledTree::compileSubTree(const GP::Tree& inTree,
+        unsigned int inNodeIndex,
+        unsigned int inSlotType,
+        unsigned int& ioStackSize)
+{
+	Beagle_StackTraceBeginM();
+	const GP::Primitive& lPrimitive = *inTree[inNodeIndex].mPrimitive;
+	Instruction lInstruction;
+	lInstruction.mOperand.mDouble = NULL;
+	lInstruction.mFrameIndex = UINT_MAX;
+	bool lCompiled = lPrimitive.getInstruction(lInstruction);
+	if(lCompiled) {
+		Beagle_AssertM(lInstruction.mOpcode < Instruction::eNumberOpcodes);
+		const OpcodeSignature& lSignature = gOpcodeSignatures[lInstruction.mOpcode];
+		lCompiled = (lSignature.mReturnType == inSlotType) &&
+		            (lSignature.mNumberArguments == lPrimitive.getNumberArguments());
+	}
+
+	unsigned int lNextIndex = inNodeIndex + inTree[inNodeIndex].mSubTreeSize;
+	if(lCompiled) {
+		const OpcodeSignature& lSignature = gOpcodeSignatures[lInstruction.mOpcode];
+		const unsigned int lFirstInstruction = mInstructions.size();
+		const unsigned int lStackSize = ioStackSize;
+		unsigned int lChildIndex = inNodeIndex + 1;
+		for(unsigned int i=0; i<lSignature.mNumberArguments; ++i) {
+			lChildIndex = compileSubTree(inTree, lChildIndex, lSignature.mArgTypes[i], ioStackSize);
+		}
+		Beagle_AssertM(lChildIndex == lNextIndex);
+		ioStackSize -= lSignature.mNumberArguments;
+		if((lInstruction.mOpcode == Instruction::eIfBool) || (lInstruction.mOpcode == Instruction::eIfDouble)) {
+			// All the arguments of a compiled conditional are evaluated, which is only valid when
+			// they have no side effect, that is when no virtual call was needed to compile them.
+			for(unsigned int i=lFirstInstruction; i<mInstructions.size(); ++i) {
+				if(mInstructions[i].mOpcode <= Instruction::eCallInt) {
+					mInstructions.resize(lFirstInstruction);
+					ioStackSize = lStackSize;
+					lCompiled = false;
+					break;
+				}
+			}
+		}
+	}
+	if(lCompiled == false) {
+		// Primitive without instruction, the sub-tree is executed with the virtual path.
+		switch(inSlotType) {
+			case eBoolSlot: lInstruction.mOpcode = Instruction::eCallBool; break;
+			case eIntSlot:  lInstruction.mOpcode = Instruction::eCallInt; break;
+			default:        lInstruction.mOpcode = Instruction::eCallDouble; break;
+		}
+	}
+	lInstruction.mNodeIndex = inNodeIndex;
+	mInstructions.push_back(lInstruction);
+	if((++ioStackSize) > mStack.size()) mStack.resize(ioStackSize);
+	return lNextIndex;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Execute the compiled tree.
+ *  \param outResult Datum containing the result of the execution.
+ *  \param ioContext GP evolutionary context, with the source tree as actual genotype.
+ *  \throw Beagle::GP::MaxNodesExecutionException If number of nodes execution is more than allowed.
+ *
+ *  Every instruction accounts for one node executed, counted all at once before execution.
+ *  Sub-trees executed with the virtual path count their own nodes, as usual.
+ */
+void GP::CompiledTree::execute(GP::Datum& outResult, GP::Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(isExecutable());
+	ioContext.incrementNodesExecuted(mInstructions.size());
+
+	const GP::ArgumentFrame& lFrame = ioContext.getArgumentFrame();
+	Slot* lTop = &mStack[0];
+	const Instruction* lEnd = &mInstructions[0] + mInstructions.size();
+	for(const Instruction* lIP = &mInstructions[0]; lIP != lEnd; ++lIP) {
+		switch(lIP->mOpcode) {
+			case Instruction::eCallDouble:
+				executeNode(lIP->mNodeIndex, mScratchDouble, ioContext);
+				(lTop++)->mDouble = mScratchDouble.getWrappedValue();
+				break;
+			case Instruction::eCallBool:
+				executeNode(lIP->mNodeIndex, mScratchBool, ioContext);
+				(lTop++)->mBool = mScratchBool.getWrappedValue();
+				break;
+			case Instruction::eCallInt:
+				executeNode(lIP->mNodeIndex, mScratchInt, ioContext);
+				(lTop++)->mInt = mScratchInt.getWrappedValue();
+				break;
+			case Instruction::eLoadDouble: {
+				const Object* lFrameValue = lFrame.getValue(lIP->mFrameIndex);
+				if(lFrameValue == NULL) (lTop++)->mDouble = *lIP->mOperand.mDouble;
+				else (lTop++)->mDouble = castObjectT<const Double&>(*lFrameValue).getWrappedValue();
+				break;
+			}
+			case Instruction::eLoadBool: {
+				const Object* lFrameValue = lFrame.getValue(lIP->mFrameIndex);
+				if(lFrameValue == NULL) (lTop++)->mBool = *lIP->mOperand.mBool;
+				else (lTop++)->mBool = castObjectT<const Bool&>(*lFrameValue).getWrappedValue();
+				break;
+			}
+			case Instruction::eLoadInt: {
+				const Object* lFrameValue = lFrame.getValue(lIP->mFrameIndex);
+				if(lFrameValue == NULL) (lTop++)->mInt = *lIP->mOperand.mInt;
+				else (lTop++)->mInt = castObjectT<const Int&>(*lFrameValue).getWrappedValue();
+				break;
+			}
+			case Instruction::eAddDouble:
+				--lTop;
+				lTop[-1].mDouble += lTop[0].mDouble;
+				break;
+			case Instruction::eSubtractDouble:
+				--lTop;
+				lTop[-1].mDouble -= lTop[0].mDouble;
+				break;
+			case Instruction::eMultiplyDouble:
+				--lTop;
+				lTop[-1].mDouble *= lTop[0].mDouble;
+				break;
+			case Instruction::eDivideDouble:
+				--lTop;
+				if((lTop[0].mDouble < 0.001) && (-0.001 < lTop[0].mDouble)) lTop[-1].mDouble = 1.0;
+				else lTop[-1].mDouble /= lTop[0].mDouble;
+				break;
+			case Instruction::eAbsDouble:
+				lTop[-1].mDouble = std::fabs(lTop[-1].mDouble);
+				break;
+			case Instruction::eSin:
+				lTop[-1].mDouble = std::sin(lTop[-1].mDouble);
+				break;
+			case Instruction::eCos:
+				lTop[-1].mDouble = std::cos(lTop[-1].mDouble);
+				break;
+			case Instruction::eExp:
+				if(lTop[-1].mDouble < 80.) lTop[-1].mDouble = std::exp(lTop[-1].mDouble);
+				else lTop[-1].mDouble = 1.;
+				break;
+			case Instruction::eLog:
+				if(std::fabs(lTop[-1].mDouble) > 0.000001) lTop[-1].mDouble = std::log(std::fabs(lTop[-1].mDouble));
+				else lTop[-1].mDouble = 1.;
+				break;
+			case Instruction::eAddInt:
+				--lTop;
+				lTop[-1].mInt += lTop[0].mInt;
+				break;
+			case Instruction::eSubtractInt:
+				--lTop;
+				lTop[-1].mInt -= lTop[0].mInt;
+				break;
+			case Instruction::eMultiplyInt:
+				--lTop;
+				lTop[-1].mInt *= lTop[0].mInt;
+				break;
+			case Instruction::eAbsInt:
+				if(lTop[-1].mInt < 0) lTop[-1].mInt = -lTop[-1].mInt;
+				break;
+			case Instruction::eBitwiseAnd:
+				--lTop;
+				lTop[-1].mInt &= lTop[0].mInt;
+				break;
+			case Instruction::eBitwiseOr:
+				--lTop;
+				lTop[-1].mInt |= lTop[0].mInt;
+				break;
+			case Instruction::eBitwiseXor:
+				--lTop;
+				lTop[-1].mInt ^= lTop[0].mInt;
+				break;
+			case Instruction::eBitwiseNand:
+				--lTop;
+				lTop[-1].mInt = ~(lTop[-1].mInt & lTop[0].mInt);
+				break;
+			case Instruction::eBitwiseNor:
+				--lTop;
+				lTop[-1].mInt = ~(lTop[-1].mInt | lTop[0].mInt);
+				break;
+			case Instruction::eBitwiseNot:
+				lTop[-1].mInt = ~lTop[-1].mInt;
+				break;
+			case Instruction::eAnd:
+				--lTop;
+				lTop[-1].mBool = lTop[-1].mBool && lTop[0].mBool;
+				break;
+			case Instruction::eOr:
+				--lTop;
+				lTop[-1].mBool = lTop[-1].mBool || lTop[0].mBool;
+				break;
+			case Instruction::eXor:
+				--lTop;
+				lTop[-1].mBool = (lTop[-1].mBool != lTop[0].mBool);
+				break;
+			case Instruction::eNand:
+				--lTop;
+				lTop[-1].mBool = !(lTop[-1].mBool && lTop[0].mBool);
+				break;
+			case Instruction::eNor:
+				--lTop;
+				lTop[-1].mBool = !(lTop[-1].mBool || lTop[0].mBool);
+				break;
+			case Instruction::eNot:
+				lTop[-1].mBool = !lTop[-1].mBool;
+				break;
+			case Instruction::eLessDouble: {
+				--lTop;
+				const bool lLess = (lTop[-1].mDouble < lTop[0].mDouble);
+				lTop[-1].mBool = lLess;
+				break;
+			}
+			case Instruction::eEqualDouble: {
+				--lTop;
+				const bool lEqual = (lTop[-1].mDouble == lTop[0].mDouble);
+				lTop[-1].mBool = lEqual;
+				break;
+			}
+			case Instruction::eIfBool:
+				lTop -= 2;
+				lTop[-1].mBool = lTop[-1].mBool ? lTop[0].mBool : lTop[1].mBool;
+				break;
+			case Instruction::eIfDouble: {
+				lTop -= 2;
+				const double lValue = lTop[-1].mBool ? lTop[0].mDouble : lTop[1].mDouble;
+				lTop[-1].mDouble = lValue;
+				break;
+			}
+			default:
+				throw Beagle_InternalExceptionM(std::string("Invalid opcode ")+
+				                                uint2str(lIP->mOpcode)+" in compiled GP tree");
+		}
+	}
+
+	switch(mRootType) {
+		case eBoolSlot:
+			castObjectT<Bool&>(outResult).getWrappedValue() = mStack[0].mBool;
+			break;
+		case eIntSlot:
+			castObjectT<Int&>(outResult).getWrappedValue() = mStack[0].mInt;
+			break;
+		default:
+			castObjectT<Double&>(outResult).getWrappedValue() = mStack[0].mDouble;
+			break;
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Execute the compiled tree on a batch of fitness cases.
+ *  \param outResults Results of the execution, one per fitness case.
+ *  \param inResultType Slot type of the results.
+ *  \param ioContext GP evolutionary context, with the source tree as actual genotype.
+ *  \param inCases Fitness cases, as columns of values of named terminals.
+ *  \throw Beagle::RunTimeException If the tree does not return the requested type.
+ *  \throw Beagle::GP::MaxNodesExecutionException If number of nodes execution is more than allowed.
+ *  \throw Beagle::GP::MaxTimeExecutionException If elapsed execution time is more than allowed.
+ *
+ *  Every instruction processes a whole column of values, one per fitness case, so that the
+ *  tree is traversed once for all the cases and each node runs a tight loop over the cases.
+ *  Terminals with a column in the fitness cases load it, other terminals are broadcasted.
+ *  Sub-trees that are executed with the virtual path are run once per fitness case, after
+ *  setting the terminals of all the primitive sets to the values of the case. When there is
+ *  no compiled code, the whole tree is executed that way. Limits on the number of nodes
+ *  executed and on the execution time apply to the execution of a single case.
+ */
+void GP::CompiledTree::executeBatch(std::vector<Slot>& outResults,
+                                    unsigned int inResultType,
+                                    GP::Context& ioContext,
+                                    const GP::FitnessCases& inCases)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lNbCases = inCases.size();
+	outResults.resize(lNbCases);
+	if(lNbCases == 0) return;
+
+	// Bind terminals of all primitive sets to columns, if some sub-trees need a virtual call.
+	bool lVirtualCalls = (isExecutable() == false);
+	for(unsigned int i=0; (i<mInstructions.size()) && (lVirtualCalls == false); ++i) {
+		lVirtualCalls = (mInstructions[i].mOpcode <= Instruction::eCallInt);
+	}
+	mBindings.clear();
+	if(lVirtualCalls) {
+		GP::PrimitiveSuperSet::Handle lSuperSet =
+		    castHandleT<GP::PrimitiveSuperSet>(ioContext.getSystem().getComponent("GP-PrimitiveSuperSet"));
+		if(lSuperSet == NULL) {
+			throw Beagle_RunTimeExceptionM("There should be a GP::PrimitiveSuperSet component in the system");
+		}
+		const std::map<std::string,FitnessCases::Column>& lColumns = inCases.getColumns();
+		for(std::map<std::string,FitnessCases::Column>::const_iterator lIter=lColumns.begin();
+		        lIter!=lColumns.end(); ++lIter) {
+			for(unsigned int i=0; i<lSuperSet->size(); ++i) {
+				Primitive::Handle lPrimitive = (*lSuperSet)[i]->getPrimitiveByName(lIter->first);
+				if(lPrimitive == NULL) continue;
+				Binding lBinding;
+				lBinding.mPrimitive = lPrimitive;
+				lBinding.mValues = &lIter->second.mValues[0];
+				lBinding.mType = lIter->second.mType;
+				mBindings.push_back(lBinding);
+			}
+		}
+	}
+
+	if(isExecutable() == false) {
+		executeNodeBatch(0, inResultType, &outResults[0], ioContext, inCases);
+		return;
+	}
+	if(mRootType != inResultType) {
+		throw Beagle_RunTimeExceptionM("Could not execute compiled GP tree on fitness cases, the tree does not return the type of the results!");
+	}
+
+	// Resolve the columns loaded by the terminals of the tree.
+	mLoadColumns.resize(mInstructions.size());
+	for(unsigned int i=0; i<mInstructions.size(); ++i) {
+		mLoadColumns[i] = NULL;
+		const unsigned int lOpcode = mInstructions[i].mOpcode;
+		if((lOpcode < Instruction::eLoadDouble) || (lOpcode > Instruction::eLoadInt)) continue;
+		const FitnessCases::Column* lColumn =
+		    inCases.getColumn(mPrimitives[mInstructions[i].mNodeIndex]->getName());
+		if((lColumn != NULL) && (lColumn->mType == gOpcodeSignatures[lOpcode].mReturnType)) {
+			mLoadColumns[i] = &lColumn->mValues[0];
+		}
+	}
+
+	ioContext.setNodesExecutionCount(0);
+	ioContext.incrementNodesExecuted(mInstructions.size());
+	mColumns.resize(mStack.size() * lNbCases);
+	const GP::ArgumentFrame& lFrame = ioContext.getArgumentFrame();
+	Slot* lTop = &mColumns[0];
+	for(unsigned int i=0; i<mInstructions.size(); ++i) {
+		const Instruction& lInstruction = mInstructions[i];
+		switch(lInstruction.mOpcode) {
+			case Instruction::eCallDouble:
+				executeNodeBatch(lInstruction.mNodeIndex, eDoubleSlot, lTop, ioContext, inCases);
+				lTop += lNbCases;
+				break;
+			case Instruction::eCallBool:
+				executeNodeBatch(lInstruction.mNodeIndex, eBoolSlot, lTop, ioContext, inCases);
+				lTop += lNbCases;
+				break;
+			case Instruction::eCallInt:
+				executeNodeBatch(lInstruction.mNodeIndex, eIntSlot, lTop, ioContext, inCases);
+				lTop += lNbCases;
+				break;
+			case Instruction::eLoadDouble:
+				if(mLoadColumns[i] != NULL) std::copy(mLoadColumns[i], mLoadColumns[i]+lNbCases, lTop);
+				else {
+					const Object* lFrameValue = lFrame.getValue(lInstruction.mFrameIndex);
+					const double lValue = (lFrameValue == NULL) ?
+					    *lInstruction.mOperand.mDouble : castObjectT<const Double&>(*lFrameValue).getWrappedValue();
+					for(unsigned int k=0; k<lNbCases; ++k) lTop[k].mDouble = lValue;
+				}
+				lTop += lNbCases;
+				break;
+			case Instruction::eLoadBool:
+				if(mLoadColumns[i] != NULL) std::copy(mLoadColumns[i], mLoadColumns[i]+lNbCases, lTop);
+				else {
+					const Object* lFrameValue = lFrame.getValue(lInstruction.mFrameIndex);
+					const bool lValue = (lFrameValue == NULL) ?
+					    *lInstruction.mOperand.mBool : castObjectT<const Bool&>(*lFrameValue).getWrappedValue();
+					for(unsigned int k=0; k<lNbCases; ++k) lTop[k].mBool = lValue;
+				}
+				lTop += lNbCases;
+				break;
+			case Instruction::eLoadInt:
+				if(mLoadColumns[i] != NULL) std::copy(mLoadColumns[i], mLoadColumns[i]+lNbCases, lTop);
+				else {
+					const Object* lFrameValue = lFrame.getValue(lInstruction.mFrameIndex);
+					const int lValue = (lFrameValue == NULL) ?
+					    *lInstruction.mOperand.mInt : castObjectT<const Int&>(*lFrameValue).getWrappedValue();
+					for(unsigned int k=0; k<lNbCases; ++k) lTop[k].mInt = lValue;
+				}
+				lTop += lNbCases;
+				break;
+			case Instruction::eAddDouble: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mDouble += lTop[k].mDouble;
+				break;
+			}
+			case Instruction::eSubtractDouble: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mDouble -= lTop[k].mDouble;
+				break;
+			}
+			case Instruction::eMultiplyDouble: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mDouble *= lTop[k].mDouble;
+				break;
+			}
+			case Instruction::eDivideDouble: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) {
+					const double lDenominator = lTop[k].mDouble;
+					const bool lProtected = (lDenominator < 0.001) && (-0.001 < lDenominator);
+					lLeft[k].mDouble = lProtected ? 1.0 : (lLeft[k].mDouble / lDenominator);
+				}
+				break;
+			}
+			case Instruction::eAbsDouble: {
+				Slot* lArg = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lArg[k].mDouble = std::fabs(lArg[k].mDouble);
+				break;
+			}
+			case Instruction::eSin: {
+				Slot* lArg = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lArg[k].mDouble = std::sin(lArg[k].mDouble);
+				break;
+			}
+			case Instruction::eCos: {
+				Slot* lArg = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lArg[k].mDouble = std::cos(lArg[k].mDouble);
+				break;
+			}
+			case Instruction::eExp: {
+				Slot* lArg = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) {
+					if(lArg[k].mDouble < 80.) lArg[k].mDouble = std::exp(lArg[k].mDouble);
+					else lArg[k].mDouble = 1.;
+				}
+				break;
+			}
+			case Instruction::eLog: {
+				Slot* lArg = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) {
+					const double lAbs = std::fabs(lArg[k].mDouble);
+					lArg[k].mDouble = (lAbs > 0.000001) ? std::log(lAbs) : 1.;
+				}
+				break;
+			}
+			case Instruction::eAddInt: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mInt += lTop[k].mInt;
+				break;
+			}
+			case Instruction::eSubtractInt: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mInt -= lTop[k].mInt;
+				break;
+			}
+			case Instruction::eMultiplyInt: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mInt *= lTop[k].mInt;
+				break;
+			}
+			case Instruction::eAbsInt: {
+				Slot* lArg = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) if(lArg[k].mInt < 0) lArg[k].mInt = -lArg[k].mInt;
+				break;
+			}
+			case Instruction::eBitwiseAnd: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mInt &= lTop[k].mInt;
+				break;
+			}
+			case Instruction::eBitwiseOr: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mInt |= lTop[k].mInt;
+				break;
+			}
+			case Instruction::eBitwiseXor: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mInt ^= lTop[k].mInt;
+				break;
+			}
+			case Instruction::eBitwiseNand: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mInt = ~(lLeft[k].mInt & lTop[k].mInt);
+				break;
+			}
+			case Instruction::eBitwiseNor: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mInt = ~(lLeft[k].mInt | lTop[k].mInt);
+				break;
+			}
+			case Instruction::eBitwiseNot: {
+				Slot* lArg = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lArg[k].mInt = ~lArg[k].mInt;
+				break;
+			}
+			case Instruction::eAnd: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mBool = lLeft[k].mBool && lTop[k].mBool;
+				break;
+			}
+			case Instruction::eOr: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mBool = lLeft[k].mBool || lTop[k].mBool;
+				break;
+			}
+			case Instruction::eXor: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mBool = (lLeft[k].mBool != lTop[k].mBool);
+				break;
+			}
+			case Instruction::eNand: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mBool = !(lLeft[k].mBool && lTop[k].mBool);
+				break;
+			}
+			case Instruction::eNor: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lLeft[k].mBool = !(lLeft[k].mBool || lTop[k].mBool);
+				break;
+			}
+			case Instruction::eNot: {
+				Slot* lArg = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) lArg[k].mBool = !lArg[k].mBool;
+				break;
+			}
+			case Instruction::eLessDouble: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) {
+					const bool lLess = (lLeft[k].mDouble < lTop[k].mDouble);
+					lLeft[k].mBool = lLess;
+				}
+				break;
+			}
+			case Instruction::eEqualDouble: {
+				lTop -= lNbCases;
+				Slot* lLeft = lTop - lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) {
+					const bool lEqual = (lLeft[k].mDouble == lTop[k].mDouble);
+					lLeft[k].mBool = lEqual;
+				}
+				break;
+			}
+			case Instruction::eIfBool: {
+				lTop -= 2*lNbCases;
+				Slot* lCondition = lTop - lNbCases;
+				const Slot* lElse = lTop + lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) {
+					lCondition[k].mBool = lCondition[k].mBool ? lTop[k].mBool : lElse[k].mBool;
+				}
+				break;
+			}
+			case Instruction::eIfDouble: {
+				lTop -= 2*lNbCases;
+				Slot* lCondition = lTop - lNbCases;
+				const Slot* lElse = lTop + lNbCases;
+				for(unsigned int k=0; k<lNbCases; ++k) {
+					const double lValue = lCondition[k].mBool ? lTop[k].mDouble : lElse[k].mDouble;
+					lCondition[k].mDouble = lValue;
+				}
+				break;
+			}
+			default:
+				throw Beagle_InternalExceptionM(std::string("Invalid opcode ")+
+				                                uint2str(lInstruction.mOpcode)+" in compiled GP tree");
+		}
+	}
+	std::copy(mColumns.begin(), mColumns.begin()+lNbCases, outResults.begin());
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Execute a tree node with the virtual path.
+ *  \param inNodeIndex Index of the node to execute in the actual genotype of the context.
+ *  \param outResult Result of the node execution.
+ *  \param ioContext GP evolutionary context.
+ */
+void GP::CompiledTree::executeNode(unsigned int inNodeIndex,
+                                   GP::Datum& outResult,
+                                   GP::Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	ioContext.pushCallStack(inNodeIndex);
+	ioContext.getGenotype()[inNodeIndex].mPrimitive->execute(outResult, ioContext);
+	ioContext.popCallStack();
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Execute a tree node with the virtual path, once per fitness case.
+ *  \param inNodeIndex Index of the node to execute in the actual genotype of the context.
+ *  \param inSlotType Slot type of the results.
+ *  \param outValues Column receiving the results, one per fitness case.
+ *  \param ioContext GP evolutionary context.
+ *  \param inCases Fitness cases, whose values are set to the bound terminals before execution.
+ */
+void GP::CompiledTree::executeNodeBatch(unsigned int inNodeIndex,
+                                        unsigned int inSlotType,
+                                        Slot* outValues,
+                                        GP::Context& ioContext,
+                                        const GP::FitnessCases& inCases)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lNodesExecuted = mInstructions.empty() ? 1 : mInstructions.size();
+	for(unsigned int k=0; k<inCases.size(); ++k) {
+		for(unsigned int i=0; i<mBindings.size(); ++i) {
+			switch(mBindings[i].mType) {
+				case eBoolSlot:
+					mScratchBool.getWrappedValue() = mBindings[i].mValues[k].mBool;
+					mBindings[i].mPrimitive->setContextValue(mScratchBool, ioContext);
+					break;
+				case eIntSlot:
+					mScratchInt.getWrappedValue() = mBindings[i].mValues[k].mInt;
+					mBindings[i].mPrimitive->setContextValue(mScratchInt, ioContext);
+					break;
+				default:
+					mScratchDouble.getWrappedValue() = mBindings[i].mValues[k].mDouble;
+					mBindings[i].mPrimitive->setContextValue(mScratchDouble, ioContext);
+					break;
+			}
+		}
+		ioContext.setNodesExecutionCount(lNodesExecuted);
+		ioContext.getExecutionTimer().reset();
+		switch(inSlotType) {
+			case eBoolSlot:
+				executeNode(inNodeIndex, mScratchBool, ioContext);
+				outValues[k].mBool = mScratchBool.getWrappedValue();
+				break;
+			case eIntSlot:
+				executeNode(inNodeIndex, mScratchInt, ioContext);
+				outValues[k].mInt = mScratchInt.getWrappedValue();
+				break;
+			default:
+				executeNode(inNodeIndex, mScratchDouble, ioContext);
+				outValues[k].mDouble = mScratchDouble.getWrappedValue();
+				break;
+		}
+		ioContext.checkExecutionTime();
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Test whether the actual compiled code has been compiled from given tree.
+ *  \param inTree GP tree to test.
+ *  \return True if the compiled code is up-to-date with the tree, false if not.
+ */
+bool GP::CompiledTree::isCompiledFrom(const GP::Tree& inTree) const
+{
+	Beagle_StackTraceBeginM();
+	if(mPrimitives.size() != inTree.size()) return false;
+	for(unsigned int i=0; i<inTree.size(); ++i) {
+		if(mPrimitives[i] != inTree[i].mPrimitive) return false;
+	}
+	return true;
+	Beagle_StackTraceEndM();
+}
@@ -0,0 +1,231 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/GP/CompiledTree.hpp
+ *  \brief  Definition of the types GP::Instruction and GP::CompiledTree.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_GP_CompiledTree_hpp
+#define Beagle_GP_CompiledTree_hpp
+
+#include <vector>
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+#include "Beagle/Core/Bool.hpp"
+#include "Beagle/Core/Double.hpp"
+#include "Beagle/Core/Int.hpp"
+#include "Beagle/GP/Datum.hpp"
+#include "Beagle/GP/Primitive.hpp"
+
+
+namespace Beagle
+{
+namespace GP
+{
+
+class Tree;          // Forward declaration.
+class Context;       // Forward declaration.
+class FitnessCases;  // Forward declaration.
+
+/*!
+ *  \struct Instruction Beagle/GP/CompiledTree.hpp "Beagle/GP/CompiledTree.hpp"
+ *  \brief Postfix instruction of a compiled GP tree.
+ *  \ingroup GPF
+ *
+ *  A GP primitive that can be lowered into a compiled tree fills an instruction in its
+ *  GP::Primitive::getInstruction method. Terminals set an operand pointing to their value,
+ *  so that values changed with setValue are seen by compiled trees without recompilation.
+ *  Terminals using the argument frame also give their frame index, the value set in the
+ *  frame of the executing context taking precedence over the operand.
+ */
+struct Instruction
+{
+
+	//! Opcodes of the compiled tree interpreter.
+	enum Opcode {
+	    eCallDouble=0,     //!< Execute the sub-tree with the virtual path, Double result.
+	    eCallBool,         //!< Execute the sub-tree with the virtual path, Bool result.
+	    eCallInt,          //!< Execute the sub-tree with the virtual path, Int result.
+	    eLoadDouble,       //!< Push the Double value pointed by the operand.
+	    eLoadBool,         //!< Push the Bool value pointed by the operand.
+	    eLoadInt,          //!< Push the Int value pointed by the operand.
+	    eAddDouble,        //!< Double addition.
+	    eSubtractDouble,   //!< Double subtraction.
+	    eMultiplyDouble,   //!< Double multiplication.
+	    eDivideDouble,     //!< Double protected division.
+	    eAbsDouble,        //!< Double absolute value.
+	    eSin,              //!< Sinus.
+	    eCos,              //!< Cosinus.
+	    eExp,              //!< Protected exponential.
+	    eLog,              //!< Protected logarithm.
+	    eAddInt,           //!< Int addition.
+	    eSubtractInt,      //!< Int subtraction.
+	    eMultiplyInt,      //!< Int multiplication.
+	    eAbsInt,           //!< Int absolute value.
+	    eBitwiseAnd,       //!< Bitwise and.
+	    eBitwiseOr,        //!< Bitwise or.
+	    eBitwiseXor,       //!< Bitwise xor.
+	    eBitwiseNand,      //!< Bitwise nand.
+	    eBitwiseNor,       //!< Bitwise nor.
+	    eBitwiseNot,       //!< Bitwise not.
+	    eAnd,              //!< Boolean and.
+	    eOr,               //!< Boolean or.
+	    eXor,              //!< Boolean xor.
+	    eNand,             //!< Boolean nand.
+	    eNor,              //!< Boolean nor.
+	    eNot,              //!< Boolean not.
+	    eLessDouble,       //!< Double less than comparison, Bool result.
+	    eEqualDouble,      //!< Double equality comparison, Bool result.
+	    eIfBool,           //!< Bool condition selecting between two Bool values.
+	    eIfDouble,         //!< Bool condition selecting between two Double values.
+	    eNumberOpcodes     //!< Number of opcodes, not a valid opcode.
+	};
+
+	//! Operand of an instruction.
+	union Operand {
+		const double* mDouble;  //!< Address of a Double value.
+		const bool*   mBool;    //!< Address of a Bool value.
+		const int*    mInt;     //!< Address of a Int value.
+	};
+
+	unsigned int mOpcode;     //!< Opcode of the instruction.
+	unsigned int mNodeIndex;   //!< Index of the tree node the instruction was compiled from.
+	Operand      mOperand;     //!< Operand of the instruction, for load opcodes.
+	unsigned int mFrameIndex;  //!< Argument frame index of the loaded value, UINT_MAX if none.
+
+};
+
+
+/*!
+ *  \class CompiledTree Beagle/GP/CompiledTree.hpp "Beagle/GP/CompiledTree.hpp"
+ *  \brief GP tree lowered into a linear postfix program, executed by a stack interpreter.
+ *  \ingroup GPF
+ *
+ *  Nodes whose primitive provides an instruction (see GP::Primitive::getInstruction) are
+ *  executed by a switch-dispatched interpreter working on typed slots, without any virtual
+ *  call. Sub-trees rooted at other primitives are executed through the usual virtual
+ *  GP::Primitive::execute path. A compiled tree keeps handles to the primitives it was
+ *  compiled from, and is recompiled when the source tree does not match them anymore.
+ *
+ *  The compiled tree can also be executed on a batch of fitness cases (see executeBatch),
+ *  where every instruction processes a whole column of values instead of a single one.
+ *
+ *  Copying a compiled tree gives an empty one, so that evolutionary contexts cloned for
+ *  different threads never share their compiled code nor their scratch data.
+ */
+class CompiledTree
+{
+
+public:
+
+	//! Types of the interpreter slots.
+	enum SlotType {eDoubleSlot=0, eBoolSlot=1, eIntSlot=2};
+
+	//! Typed slot of the interpreter stack.
+	union Slot {
+		double mDouble;  //!< Double value.
+		bool   mBool;    //!< Bool value.
+		int    mInt;     //!< Int value.
+	};
+
+	CompiledTree();
+	CompiledTree(const CompiledTree& inOriginal);
+	~CompiledTree()
+	{ }
+
+	CompiledTree& operator=(const CompiledTree& inOriginal);
+
+	void clear();
+	bool compile(const GP::Tree& inTree);
+	void execute(GP::Datum& outResult, GP::Context& ioContext);
+	void executeBatch(std::vector<Slot>& outResults,
+	                  unsigned int inResultType,
+	                  GP::Context& ioContext,
+	                  const GP::FitnessCases& inCases);
+	bool isCompiledFrom(const GP::Tree& inTree) const;
+
+	/*!
+	 *  \return True if the compiled tree contains executable code.
+	 */
+	inline bool isExecutable() const
+	{
+		Beagle_StackTraceBeginM();
+		return mInstructions.empty() == false;
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \return Number of instructions of the compiled tree.
+	 */
+	inline unsigned int size() const
+	{
+		Beagle_StackTraceBeginM();
+		return mInstructions.size();
+		Beagle_StackTraceEndM();
+	}
+
+protected:
+
+	//! Terminal primitive bound to a column of fitness cases.
+	struct Binding
+	{
+		Primitive::Handle mPrimitive;  //!< Terminal primitive.
+		const Slot*       mValues;     //!< Values of the terminal, one per fitness case.
+		unsigned int      mType;       //!< Slot type of the values.
+	};
+
+	unsigned int compileSubTree(const GP::Tree& inTree,
+	                            unsigned int inNodeIndex,
+	                            unsigned int inSlotType,
+	                            unsigned int& ioStackSize);
+	void         executeNode(unsigned int inNodeIndex, GP::Datum& outResult, GP::Context& ioContext);
+	void         executeNodeBatch(unsigned int inNodeIndex,
+	                              unsigned int inSlotType,
+	                              Slot* outValues,
+	                              GP::Context& ioContext,
+	                              const GP::FitnessCases& inCases);
+
+	std::vector<Instruction>       mInstructions;  //!< Postfix program.
+	std::vector<Primitive::Handle> mPrimitives;    //!< Primitives of the source tree.
+	std::vector<Slot>              mStack;         //!< Interpreter stack.
+	unsigned int                   mRootType;      //!< Slot type of the result.
+	Double                         mScratchDouble; //!< Double result of virtual sub-tree calls.
+	Bool                           mScratchBool;   //!< Bool result of virtual sub-tree calls.
+	Int                            mScratchInt;    //!< Int result of virtual sub-tree calls.
+	std::vector<Slot>              mColumns;       //!< Interpreter stack of columns, batch mode.
+	std::vector<const Slot*>       mLoadColumns;   //!< Column loaded by each instruction, batch mode.
+	std::vector<Binding>           mBindings;      //!< Terminals bound to columns, batch mode.
+
+};
+
+}
+}
+
+#endif // Beagle_GP_CompiledTree_hpp
@@ -45,6 +45,7 @@ using namespace Beagle;
 GP::Context::Context() :
 		mAllowedExecutionTime(0.0),
 		mNodesExecutionCount(0),
-		mAllowedNodesExecution(UINT_MAX)
+		mAllowedNodesExecution(UINT_MAX),
+		mCompiledExecution(false)
 { }
 
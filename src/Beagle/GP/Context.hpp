@@ -48,6 +48,8 @@
 #include "Beagle/Core/Context.hpp"
 #include "Beagle/GP/Individual.hpp"
 #include "Beagle/GP/Tree.hpp"
+#include "Beagle/GP/CompiledTree.hpp"
+#include "Beagle/GP/ArgumentFrame.hpp"
 #include "Beagle/GP/MaxNodesExecutionException.hpp"
 #include "Beagle/GP/MaxTimeExecutionException.hpp"
 
@@ -150,6 +152,39 @@ public:
 		Beagle_StackTraceEndM();
 	}
 
+	/*!
+	 *  \brief Return the values of the argument terminals local to the context.
+	 *  \return Constant reference to the argument frame.
+	 */
+	inline const GP::ArgumentFrame& getArgumentFrame() const
+	{
+		Beagle_StackTraceBeginM();
+		return mArgumentFrame;
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Return the values of the argument terminals local to the context.
+	 *  \return Reference to the argument frame.
+	 */
+	inline GP::ArgumentFrame& getArgumentFrame()
+	{
+		Beagle_StackTraceBeginM();
+		return mArgumentFrame;
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Return the compiled tree cache used by compiled execution.
+	 *  \return Reference to the compiled tree cache.
+	 */
+	inline GP::CompiledTree& getCompiledTree()
+	{
+		Beagle_StackTraceBeginM();
+		return mCompiledTree;
+		Beagle_StackTraceEndM();
+	}
+
 	/*!
 	 *  \brief Return the call stack.
 	 *  \return Cosntant reference to the call stack.
@@ -332,6 +367,35 @@ public:
 		Beagle_StackTraceEndM();
 	}
 
+	/*!
+	 *  \brief Increment executed nodes counter by a given number of nodes.
+	 *  \param inNumberNodes Number of nodes executed.
+	 *  \throw GP::MaxNodesExecutionException If the maximum number of nodes execution is exceeded.
+	 */
+	inline void incrementNodesExecuted(unsigned int inNumberNodes)
+	{
+		Beagle_StackTraceBeginM();
+		if((mNodesExecutionCount += inNumberNodes) > mAllowedNodesExecution) {
+			throw Beagle::GP::MaxNodesExecutionException(
+			    std::string("Number of GP nodes executed exceeded maximum allowed"),
+			    mNodesExecutionCount,
+			    mAllowedNodesExecution
+			);
+		}
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \brief Return whether GP trees are executed through their compiled form.
+	 *  \return True if compiled execution is enabled, false if not.
+	 */
+	inline bool isCompiledExecution() const
+	{
+		Beagle_StackTraceBeginM();
+		return mCompiledExecution;
+		Beagle_StackTraceEndM();
+	}
+
 	/*!
 	 *  \brief Pop the call stack.
 	 *  \throw Beagle::AssertException If the call stack is empty.
@@ -378,6 +442,17 @@ public:
 		Beagle_StackTraceEndM();
 	}
 
+	/*!
+	 *  \brief Enable or disable execution of GP trees through their compiled form.
+	 *  \param inCompiledExecution True to enable compiled execution, false to disable it.
+	 */
+	inline void setCompiledExecution(bool inCompiledExecution)
+	{
+		Beagle_StackTraceBeginM();
+		mCompiledExecution = inCompiledExecution;
+		Beagle_StackTraceEndM();
+	}
+
 	/*!
 	 *  \brief Set an handle to the actual GP tree.
 	 *  \param inTreeHandle Actual GP tree handle.
@@ -418,6 +493,9 @@ protected:
 	double                    mAllowedExecutionTime;  //!< Allowed execution time for ind. execution.
 	unsigned int              mNodesExecutionCount;   //!< Count the number of GP nodes executed.
 	unsigned int              mAllowedNodesExecution; //!< Maximum allowed of GP nodes execution.
+	GP::CompiledTree          mCompiledTree;          //!< Compiled form of the last executed tree.
+	GP::ArgumentFrame         mArgumentFrame;         //!< Values of the argument terminals for this context.
+	bool                      mCompiledExecution;     //!< Whether trees are executed in compiled form.
 
 };
 
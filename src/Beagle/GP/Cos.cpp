@@ -98,3 +98,16 @@ void GP::Cos::execute(GP::Datum& outResult, GP::Context& ioContext)
 	Beagle_StackTraceEndM();
 }
 
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the cosinus primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool GP::Cos::getInstruction(GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = GP::Instruction::eCos;
+	return true;
+	Beagle_StackTraceEndM();
+}
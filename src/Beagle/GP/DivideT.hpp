@@ -49,6 +49,7 @@
 #include "Beagle/GP/Primitive.hpp"
 #include "Beagle/GP/PrimitiveInline.hpp"
 #include "Beagle/GP/Context.hpp"
+#include "Beagle/GP/CompiledTree.hpp"
 #include "Beagle/GP/Datum.hpp"
 
 #ifdef BEAGLE_HAVE_RTTI
@@ -96,6 +97,7 @@ public:
 
 	virtual std::string deparse(std::vector<std::string>& lSubTrees) const;
 	virtual void        execute(GP::Datum& outResult, GP::Context& ioContext);
+	virtual bool        getInstruction(GP::Instruction& outInstruction) const;
 
 };
 
@@ -192,4 +194,33 @@ void Beagle::GP::DivideT<T>::execute(Beagle::GP::Datum& outResult, Beagle::GP::C
 }
 
 
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the division primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return False, as there is no equivalent instruction for the generic type T.
+ */
+template <class T>
+bool Beagle::GP::DivideT<T>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	return false;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the division primitive for Double.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+template <>
+inline bool Beagle::GP::DivideT<Beagle::Double>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = Beagle::GP::Instruction::eDivideDouble;
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
 #endif // Beagle_GP_DivideT_hpp
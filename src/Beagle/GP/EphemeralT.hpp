@@ -50,6 +50,7 @@
 #include "Beagle/GP/Primitive.hpp"
 #include "Beagle/GP/PrimitiveInline.hpp"
 #include "Beagle/GP/Context.hpp"
+#include "Beagle/GP/CompiledTree.hpp"
 #include "Beagle/GP/Datum.hpp"
 
 #ifdef BEAGLE_HAVE_RTTI
@@ -103,6 +104,7 @@ public:
 #endif // BEAGLE_HAVE_RTTI
 
 	virtual void                  getValue(Object& outValue);
+	virtual bool                  getInstruction(GP::Instruction& outInstruction) const;
 	virtual bool                  haveValue() const;
 	virtual GP::Primitive::Handle giveReference(unsigned int inNumberArguments, GP::Context& ioContext);
 	virtual void                  execute(GP::Datum& outDatum, GP::Context& ioContext);
@@ -292,6 +294,71 @@ void Beagle::GP::EphemeralT<T>::writeContent(PACC::XML::Streamer& ioStreamer, bo
 	Beagle_StackTraceEndM();
 }
 
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the ephemeral constant.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return False, as there is no equivalent instruction for the generic type T.
+ */
+template <class T>
+bool Beagle::GP::EphemeralT<T>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	return false;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the Double ephemeral constant.
+ *  \param outInstruction Instruction loading the constant value.
+ *  \return True if the constant has a value, false if it is an ephemeral generator.
+ */
+template <>
+inline bool Beagle::GP::EphemeralT<Beagle::Double>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	if(!mValue) return false;
+	outInstruction.mOpcode = Beagle::GP::Instruction::eLoadDouble;
+	outInstruction.mOperand.mDouble = &mValue->getWrappedValue();
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the Bool ephemeral constant.
+ *  \param outInstruction Instruction loading the constant value.
+ *  \return True if the constant has a value, false if it is an ephemeral generator.
+ */
+template <>
+inline bool Beagle::GP::EphemeralT<Beagle::Bool>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	if(!mValue) return false;
+	outInstruction.mOpcode = Beagle::GP::Instruction::eLoadBool;
+	outInstruction.mOperand.mBool = &mValue->getWrappedValue();
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the Int ephemeral constant.
+ *  \param outInstruction Instruction loading the constant value.
+ *  \return True if the constant has a value, false if it is an ephemeral generator.
+ */
+template <>
+inline bool Beagle::GP::EphemeralT<Beagle::Int>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	if(!mValue) return false;
+	outInstruction.mOpcode = Beagle::GP::Instruction::eLoadInt;
+	outInstruction.mOperand.mInt = &mValue->getWrappedValue();
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
 
 #endif // Beagle_GP_EphemeralT_hpp
 
@@ -36,6 +36,7 @@
 #include "Beagle/GP.hpp"
 
 #include <string>
+#include <sstream>
 
 using namespace Beagle;
 
@@ -59,7 +60,140 @@ Fitness::Handle GP::EvaluationOp::evaluate(Beagle::Individual& inIndividual,
         Beagle::Context& ioContext)
 {
 	Beagle_StackTraceBeginM();
-	return evaluate(castObjectT<GP::Individual&>(inIndividual), castObjectT<GP::Context&>(ioContext));
+	GP::Context& lContext = castObjectT<GP::Context&>(ioContext);
+	if(mCompiledExecution != NULL) lContext.setCompiledExecution(mCompiledExecution->getWrappedValue());
+	return evaluate(castObjectT<GP::Individual&>(inIndividual), lContext);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Register the parameters of the GP evaluation operator.
+ *  \param ioSystem System of the evolution.
+ */
+void GP::EvaluationOp::registerParams(Beagle::System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	Beagle::EvaluationOp::registerParams(ioSystem);
+	{
+		std::ostringstream lOSS;
+		lOSS << "Execute GP trees through a compiled postfix form instead of the recursive ";
+		lOSS << "virtual calls of the primitives. Trees are compiled once per individual, ";
+		lOSS << "and then executed as a flat loop of instructions for every fitness case. ";
+		lOSS << "Primitives without an equivalent instruction are executed with their ";
+		lOSS << "usual virtual method, so results are the same in both modes.";
+		Register::Description lDescription(
+		    "Compiled GP trees execution",
+		    "Bool",
+		    "0",
+		    lOSS.str()
+		);
+		mCompiledExecution = castHandleT<Bool>(
+		                         ioSystem.getRegister().insertEntry("gp.eval.compiled", new Bool(false), lDescription));
+	}
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Run a GP individual on a batch of fitness cases, with Double results.
+ *  \param outResults Results of the individual, one per fitness case.
+ *  \param inIndividual GP individual to run.
+ *  \param ioContext Evolutionary context.
+ *  \param inCases Fitness cases, as columns of values of named terminals.
+ */
+void GP::EvaluationOp::runBatch(std::vector<double>& outResults,
+                                GP::Individual& inIndividual,
+                                GP::Context& ioContext,
+                                const GP::FitnessCases& inCases) const
+{
+	Beagle_StackTraceBeginM();
+	std::vector<GP::CompiledTree::Slot> lResults;
+	runBatch(lResults, GP::CompiledTree::eDoubleSlot, inIndividual, ioContext, inCases);
+	outResults.resize(lResults.size());
+	for(unsigned int i=0; i<lResults.size(); ++i) outResults[i] = lResults[i].mDouble;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Run a GP individual on a batch of fitness cases, with Bool results.
+ *  \param outResults Results of the individual, one per fitness case.
+ *  \param inIndividual GP individual to run.
+ *  \param ioContext Evolutionary context.
+ *  \param inCases Fitness cases, as columns of values of named terminals.
+ */
+void GP::EvaluationOp::runBatch(std::vector<bool>& outResults,
+                                GP::Individual& inIndividual,
+                                GP::Context& ioContext,
+                                const GP::FitnessCases& inCases) const
+{
+	Beagle_StackTraceBeginM();
+	std::vector<GP::CompiledTree::Slot> lResults;
+	runBatch(lResults, GP::CompiledTree::eBoolSlot, inIndividual, ioContext, inCases);
+	outResults.resize(lResults.size());
+	for(unsigned int i=0; i<lResults.size(); ++i) outResults[i] = lResults[i].mBool;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Run a GP individual on a batch of fitness cases, with Int results.
+ *  \param outResults Results of the individual, one per fitness case.
+ *  \param inIndividual GP individual to run.
+ *  \param ioContext Evolutionary context.
+ *  \param inCases Fitness cases, as columns of values of named terminals.
+ */
+void GP::EvaluationOp::runBatch(std::vector<int>& outResults,
+                                GP::Individual& inIndividual,
+                                GP::Context& ioContext,
+                                const GP::FitnessCases& inCases) const
+{
+	Beagle_StackTraceBeginM();
+	std::vector<GP::CompiledTree::Slot> lResults;
+	runBatch(lResults, GP::CompiledTree::eIntSlot, inIndividual, ioContext, inCases);
+	outResults.resize(lResults.size());
+	for(unsigned int i=0; i<lResults.size(); ++i) outResults[i] = lResults[i].mInt;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Run a GP individual on a batch of fitness cases.
+ *  \param outResults Results of the individual, one per fitness case.
+ *  \param inResultType Slot type of the results.
+ *  \param inIndividual GP individual to run.
+ *  \param ioContext Evolutionary context.
+ *  \param inCases Fitness cases, as columns of values of named terminals.
+ *  \throw Beagle::ObjectException When individual or tree are empty.
+ *  \throw Beagle::RunTimeException When the context individual is not the individual run.
+ *
+ *  The first tree of the individual is compiled, if needed, and then executed once over all
+ *  the fitness cases, each instruction processing a column of values (see
+ *  GP::CompiledTree::executeBatch). Terminals whose name has a column in the fitness cases take
+ *  their values from it, replacing the calls to setValue and run for every case.
+ */
+void GP::EvaluationOp::runBatch(std::vector<GP::CompiledTree::Slot>& outResults,
+                                unsigned int inResultType,
+                                GP::Individual& inIndividual,
+                                GP::Context& ioContext,
+                                const GP::FitnessCases& inCases) const
+{
+	Beagle_StackTraceBeginM();
+	if(&ioContext.getIndividual() != &inIndividual) {
+		throw Beagle_RunTimeExceptionM("In GP::EvaluationOp::runBatch(): the context individual is not the individual to run.");
+	}
+	if(inIndividual.empty()) throw Beagle_ObjectExceptionM("Could not interpret, individual has no trees!");
+	if(inIndividual[0]->empty()) throw Beagle_ObjectExceptionM("Could not interpret, 1st tree is empty!");
+	GP::Tree::Handle lOldTreeHandle = ioContext.getGenotypeHandle();
+	const unsigned int lOldTreeIndex = ioContext.getGenotypeIndex();
+	ioContext.setGenotypeIndex(0);
+	ioContext.setGenotypeHandle(inIndividual[0]);
+	GP::CompiledTree& lCompiledTree = ioContext.getCompiledTree();
+	if(lCompiledTree.isCompiledFrom(*inIndividual[0]) == false) lCompiledTree.compile(*inIndividual[0]);
+	lCompiledTree.executeBatch(outResults, inResultType, ioContext, inCases);
+	ioContext.setGenotypeIndex(lOldTreeIndex);
+	ioContext.setGenotypeHandle(lOldTreeHandle);
 	Beagle_StackTraceEndM();
 }
 
@@ -70,6 +204,9 @@ Fitness::Handle GP::EvaluationOp::evaluate(Beagle::Individual& inIndividual,
  *  \param inValue Value of the primitive.
  *  \param ioContext Context of the evaluation.
  *  \throw Beagle::RunTimeException If the named primitive is not found in any sets.
+ *
+ *  The primitive is looked up by name at every call. When arguments are set for many fitness
+ *  cases, resolve them once with a GP::ArgumentBindings and set them by index instead.
  */
 void GP::EvaluationOp::setValue(std::string inName,
                                 const Object& inValue,
@@ -91,7 +228,7 @@ void GP::EvaluationOp::setValue(std::string inName,
 		Primitive::Handle lPrimitive = (*lSuperSet)[i]->getPrimitiveByName(inName);
 		if(!lPrimitive) continue;
 		lValueFound = true;
-		lPrimitive->setValue(inValue);
+		lPrimitive->setContextValue(inValue, ioContext);
 	}
 	if(lValueFound == false) {
 		std::string lMessage = "The primitive named '";
@@ -37,6 +37,7 @@
 #define Beagle_GP_EvaluationOp_hpp
 
 #include <string>
+#include <vector>
 
 #include "Beagle/config.hpp"
 #include "Beagle/macros.hpp"
@@ -45,9 +46,12 @@
 #include "Beagle/Core/PointerT.hpp"
 #include "Beagle/Core/ContainerT.hpp"
 #include "Beagle/Core/EvaluationOp.hpp"
+#include "Beagle/Core/Bool.hpp"
 #include "Beagle/GP/Individual.hpp"
 #include "Beagle/GP/Context.hpp"
 #include "Beagle/GP/Datum.hpp"
+#include "Beagle/GP/CompiledTree.hpp"
+#include "Beagle/GP/FitnessCases.hpp"
 
 
 namespace Beagle
@@ -80,7 +84,20 @@ public:
 	virtual ~EvaluationOp()
 	{ }
 
+	virtual void            registerParams(Beagle::System& ioSystem);
 	virtual Fitness::Handle evaluate(Beagle::Individual& inIndividual, Beagle::Context& ioContext);
+	void runBatch(std::vector<double>& outResults,
+	              GP::Individual& inIndividual,
+	              GP::Context& ioContext,
+	              const GP::FitnessCases& inCases) const;
+	void runBatch(std::vector<bool>& outResults,
+	              GP::Individual& inIndividual,
+	              GP::Context& ioContext,
+	              const GP::FitnessCases& inCases) const;
+	void runBatch(std::vector<int>& outResults,
+	              GP::Individual& inIndividual,
+	              GP::Context& ioContext,
+	              const GP::FitnessCases& inCases) const;
 	void setValue(std::string inName, const Object& inValue, GP::Context& ioContext) const;
 
 	/*!
@@ -91,6 +108,16 @@ public:
 	 */
 	virtual Fitness::Handle evaluate(GP::Individual& inIndividual, GP::Context& ioContext) =0;
 
+protected:
+
+	void runBatch(std::vector<GP::CompiledTree::Slot>& outResults,
+	              unsigned int inResultType,
+	              GP::Individual& inIndividual,
+	              GP::Context& ioContext,
+	              const GP::FitnessCases& inCases) const;
+
+	Bool::Handle mCompiledExecution;  //!< Whether GP trees are executed in compiled form.
+
 };
 
 }
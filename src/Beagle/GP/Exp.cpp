@@ -99,3 +99,16 @@ void GP::Exp::execute(GP::Datum& outResult, GP::Context& ioContext)
 	Beagle_StackTraceEndM();
 }
 
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the exponential primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool GP::Exp::getInstruction(GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = GP::Instruction::eExp;
+	return true;
+	Beagle_StackTraceEndM();
+}
@@ -0,0 +1,171 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/GP/FitnessCases.cpp
+ *  \brief  Source code of class GP::FitnessCases.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/GP.hpp"
+
+#include <sstream>
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Construct a set of fitness cases.
+ *  \param inSize Number of fitness cases.
+ */
+GP::FitnessCases::FitnessCases(unsigned int inSize) :
+		mSize(inSize)
+{ }
+
+
+/*!
+ *  \brief Remove all the columns of the fitness cases.
+ */
+void GP::FitnessCases::clear()
+{
+	Beagle_StackTraceBeginM();
+	mColumns.clear();
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the column of values of a terminal.
+ *  \param inName Name of the terminal.
+ *  \return Pointer to the column, or NULL if there is no column for the terminal.
+ */
+const GP::FitnessCases::Column* GP::FitnessCases::getColumn(const std::string& inName) const
+{
+	Beagle_StackTraceBeginM();
+	std::map<std::string,Column>::const_iterator lIter = mColumns.find(inName);
+	if(lIter == mColumns.end()) return NULL;
+	return &lIter->second;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Insert a column for a terminal, replacing any existing one.
+ *  \param inName Name of the terminal.
+ *  \param inType Slot type of the values.
+ *  \param inSize Number of values given for the column.
+ *  \return Reference to the inserted column, sized to the number of fitness cases.
+ *  \throw Beagle::RunTimeException If the number of values is not the number of fitness cases.
+ */
+GP::FitnessCases::Column& GP::FitnessCases::insertColumn(const std::string& inName,
+        unsigned int inType,
+        unsigned int inSize)
+{
+	Beagle_StackTraceBeginM();
+	if(inSize != mSize) {
+		std::ostringstream lOSS;
+		lOSS << "Could not set the column of fitness cases of terminal '" << inName << "': ";
+		lOSS << inSize << " values given, while there is " << mSize << " fitness cases!";
+		throw Beagle_RunTimeExceptionM(lOSS.str());
+	}
+	Column& lColumn = mColumns[inName];
+	lColumn.mType = inType;
+	lColumn.mValues.resize(mSize);
+	return lColumn;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Change the number of fitness cases, removing all the columns.
+ *  \param inSize New number of fitness cases.
+ */
+void GP::FitnessCases::resize(unsigned int inSize)
+{
+	Beagle_StackTraceBeginM();
+	mColumns.clear();
+	mSize = inSize;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Set the column of values of a Double terminal.
+ *  \param inName Name of the terminal.
+ *  \param inValues Values of the terminal, one per fitness case.
+ */
+void GP::FitnessCases::setColumn(const std::string& inName, const std::vector<double>& inValues)
+{
+	Beagle_StackTraceBeginM();
+	setColumn(inName, inValues.empty() ? NULL : &inValues[0], inValues.size());
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Set the column of values of a Double terminal from contiguous values.
+ *  \param inName Name of the terminal.
+ *  \param inValues Pointer to the values of the terminal, one per fitness case.
+ *  \param inSize Number of values given.
+ *
+ *  Useful to take the values from a column of a DataSet without an intermediate copy.
+ */
+void GP::FitnessCases::setColumn(const std::string& inName, const double* inValues, unsigned int inSize)
+{
+	Beagle_StackTraceBeginM();
+	Column& lColumn = insertColumn(inName, CompiledTree::eDoubleSlot, inSize);
+	for(unsigned int i=0; i<mSize; ++i) lColumn.mValues[i].mDouble = inValues[i];
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Set the column of values of a Bool terminal.
+ *  \param inName Name of the terminal.
+ *  \param inValues Values of the terminal, one per fitness case.
+ */
+void GP::FitnessCases::setColumn(const std::string& inName, const std::vector<bool>& inValues)
+{
+	Beagle_StackTraceBeginM();
+	Column& lColumn = insertColumn(inName, CompiledTree::eBoolSlot, inValues.size());
+	for(unsigned int i=0; i<mSize; ++i) lColumn.mValues[i].mBool = inValues[i];
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Set the column of values of a Int terminal.
+ *  \param inName Name of the terminal.
+ *  \param inValues Values of the terminal, one per fitness case.
+ */
+void GP::FitnessCases::setColumn(const std::string& inName, const std::vector<int>& inValues)
+{
+	Beagle_StackTraceBeginM();
+	Column& lColumn = insertColumn(inName, CompiledTree::eIntSlot, inValues.size());
+	for(unsigned int i=0; i<mSize; ++i) lColumn.mValues[i].mInt = inValues[i];
+	Beagle_StackTraceEndM();
+}
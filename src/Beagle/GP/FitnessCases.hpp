@@ -0,0 +1,131 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   Beagle/GP/FitnessCases.hpp
+ *  \brief  Definition of the type GP::FitnessCases.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_GP_FitnessCases_hpp
+#define Beagle_GP_FitnessCases_hpp
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+#include "Beagle/Core/Object.hpp"
+#include "Beagle/Core/AllocatorT.hpp"
+#include "Beagle/Core/PointerT.hpp"
+#include "Beagle/Core/ContainerT.hpp"
+#include "Beagle/GP/CompiledTree.hpp"
+
+
+namespace Beagle
+{
+namespace GP
+{
+
+/*!
+ *  \class FitnessCases Beagle/GP/FitnessCases.hpp "Beagle/GP/FitnessCases.hpp"
+ *  \brief Set of fitness cases stored column-wise, one column of values per named terminal.
+ *  \ingroup GPF
+ *
+ *  Fitness cases are given to GP::EvaluationOp::runBatch, which executes a GP individual on
+ *  all the cases at once. Each column holds the values taken by the terminals of the given
+ *  name (usually GP::TokenT) over the cases, stored contiguously so that compiled trees
+ *  process a whole column per instruction.
+ */
+class FitnessCases : public Object
+{
+
+public:
+
+	//! GP::FitnessCases allocator type.
+	typedef AllocatorT<FitnessCases,Object::Alloc>
+	Alloc;
+	//! GP::FitnessCases handle type.
+	typedef PointerT<FitnessCases,Object::Handle>
+	Handle;
+	//! GP::FitnessCases bag type.
+	typedef ContainerT<FitnessCases,Object::Bag>
+	Bag;
+
+	//! Column of values of a named terminal.
+	struct Column
+	{
+		unsigned int                     mType;    //!< Slot type of the values.
+		std::vector<CompiledTree::Slot>  mValues;  //!< Values of the terminal, one per case.
+	};
+
+	explicit FitnessCases(unsigned int inSize=0);
+	virtual ~FitnessCases()
+	{ }
+
+	void          clear();
+	const Column* getColumn(const std::string& inName) const;
+	void          resize(unsigned int inSize);
+	void          setColumn(const std::string& inName, const std::vector<double>& inValues);
+	void          setColumn(const std::string& inName, const double* inValues, unsigned int inSize);
+	void          setColumn(const std::string& inName, const std::vector<bool>& inValues);
+	void          setColumn(const std::string& inName, const std::vector<int>& inValues);
+
+	/*!
+	 *  \return Columns of the fitness cases, by terminal name.
+	 */
+	inline const std::map<std::string,Column>& getColumns() const
+	{
+		Beagle_StackTraceBeginM();
+		return mColumns;
+		Beagle_StackTraceEndM();
+	}
+
+	/*!
+	 *  \return Number of fitness cases.
+	 */
+	inline unsigned int size() const
+	{
+		Beagle_StackTraceBeginM();
+		return mSize;
+		Beagle_StackTraceEndM();
+	}
+
+protected:
+
+	Column& insertColumn(const std::string& inName, unsigned int inType, unsigned int inSize);
+
+	std::map<std::string,Column> mColumns;  //!< Columns of the fitness cases, by terminal name.
+	unsigned int                 mSize;     //!< Number of fitness cases.
+
+};
+
+}
+}
+
+#endif // Beagle_GP_FitnessCases_hpp
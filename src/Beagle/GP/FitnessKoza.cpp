@@ -91,6 +91,25 @@ const std::string& GP::FitnessKoza::getType() const
 }
 
 
+/*!
+ *  \brief Read a Koza's fitness from a binary archive.
+ *  \param ioArchive Binary archive from which the fitness is read.
+ *  \param ioContext Evolutionary context.
+ */
+void GP::FitnessKoza::readBinary(BinaryInArchive& ioArchive, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	EC::FitnessSimple::readBinary(ioArchive, ioContext);
+	if(isValid()) {
+		mAdjustedFitness = ioArchive.readFloat();
+		mStandardizedFitness = ioArchive.readFloat();
+		mRawFitness = ioArchive.readFloat();
+		mHits = ioArchive.readUInt();
+	}
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Read a Koza's fitness from a XML subtree.
  *  \param inIter XML iterator to use to read the fitness values.
@@ -191,6 +210,24 @@ void GP::FitnessKoza::setFitness(float inNormalizedFitness,
 }
 
 
+/*!
+ *  \brief Write a Koza's fitness into a binary archive.
+ *  \param ioArchive Binary archive into which the fitness is written.
+ */
+void GP::FitnessKoza::writeBinary(BinaryOutArchive& ioArchive) const
+{
+	Beagle_StackTraceBeginM();
+	EC::FitnessSimple::writeBinary(ioArchive);
+	if(isValid()) {
+		ioArchive.writeFloat(mAdjustedFitness);
+		ioArchive.writeFloat(mStandardizedFitness);
+		ioArchive.writeFloat(mRawFitness);
+		ioArchive.writeUInt(mHits);
+	}
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Write a Koza's fitness into a Beagle XML streamer.
  *  \param ioStreamer XML streamer to use to write the fitness values.
@@ -90,12 +90,14 @@ public:
 	                     unsigned int inHits);
 
 	virtual const std::string&  getType() const;
+	virtual void                readBinary(BinaryInArchive& ioArchive, Context& ioContext);
 	virtual void                read(PACC::XML::ConstIterator inIter);
 	virtual void                setFitness(float inNormalizedFitness,
 	                                       float inAdjustedFitness,
 	                                       float inStandardizedFitness,
 	                                       float inRawFitness,
 	                                       unsigned int inHits);
+	virtual void                writeBinary(BinaryOutArchive& ioArchive) const;
 	virtual void                writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
 	/*!
@@ -239,12 +239,20 @@ void GP::Individual::run(GP::Datum& outResult, GP::Context& ioContext)
 	    std::string("Executing the first tree root node '")+
 	    (*(*this)[0])[0].mPrimitive->getName()+"'"
 	);
+	GP::CompiledTree& lCompiledTree = ioContext.getCompiledTree();
+	if(ioContext.isCompiledExecution() && (lCompiledTree.isCompiledFrom(*(*this)[0]) == false)) {
+		lCompiledTree.compile(*(*this)[0]);
+	}
 	ioContext.setNodesExecutionCount(0);
-	ioContext.incrementNodesExecuted();
 	ioContext.getExecutionTimer().reset();
-	ioContext.pushCallStack(0);
-	(*(*this)[0])[0].mPrimitive->execute(outResult, ioContext);
-	ioContext.popCallStack();
+	if(ioContext.isCompiledExecution() && lCompiledTree.isExecutable()) {
+		lCompiledTree.execute(outResult, ioContext);
+	} else {
+		ioContext.incrementNodesExecuted();
+		ioContext.pushCallStack(0);
+		(*(*this)[0])[0].mPrimitive->execute(outResult, ioContext);
+		ioContext.popCallStack();
+	}
 	ioContext.checkExecutionTime();
 	Beagle_LogDebugM(
 	    ioContext.getSystem().getLogger(),
@@ -104,3 +104,16 @@ void GP::Log::execute(GP::Datum& outResult, GP::Context& ioContext)
 	Beagle_StackTraceEndM();
 }
 
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the logarithm primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool GP::Log::getInstruction(GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = GP::Instruction::eLog;
+	return true;
+	Beagle_StackTraceEndM();
+}
@@ -48,6 +48,7 @@
 #include "Beagle/GP/Primitive.hpp"
 #include "Beagle/GP/PrimitiveInline.hpp"
 #include "Beagle/GP/Context.hpp"
+#include "Beagle/GP/CompiledTree.hpp"
 #include "Beagle/GP/Datum.hpp"
 
 #ifdef BEAGLE_HAVE_RTTI
@@ -95,6 +96,7 @@ public:
 
 	virtual std::string deparse(std::vector<std::string>& lSubTrees) const;
 	virtual void        execute(Beagle::GP::Datum& outResult, Beagle::GP::Context& ioContext);
+	virtual bool        getInstruction(GP::Instruction& outInstruction) const;
 
 };
 
@@ -189,4 +191,48 @@ void Beagle::GP::MultiplyT<T>::execute(Beagle::GP::Datum& outResult, Beagle::GP:
 }
 
 
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the multiplication primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return False, as there is no equivalent instruction for the generic type T.
+ */
+template <class T>
+bool Beagle::GP::MultiplyT<T>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	return false;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the multiplication primitive for Double.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+template <>
+inline bool Beagle::GP::MultiplyT<Beagle::Double>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = Beagle::GP::Instruction::eMultiplyDouble;
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the multiplication primitive for Int.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+template <>
+inline bool Beagle::GP::MultiplyT<Beagle::Int>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = Beagle::GP::Instruction::eMultiplyInt;
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
 #endif // Beagle_GP_MultiplyT_hpp
@@ -99,3 +99,17 @@ void GP::Nor::execute(GP::Datum& outResult, GP::Context& ioContext)
 	lResult = !(lResult || lArg2);
 	Beagle_StackTraceEndM();
 }
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the boolean nor primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool GP::Nor::getInstruction(GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = GP::Instruction::eNor;
+	return true;
+	Beagle_StackTraceEndM();
+}
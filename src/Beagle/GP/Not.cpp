@@ -97,3 +97,17 @@ void GP::Not::execute(GP::Datum& outResult, GP::Context& ioContext)
 	lResult = !lResult;
 	Beagle_StackTraceEndM();
 }
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the boolean not primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool GP::Not::getInstruction(GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = GP::Instruction::eNot;
+	return true;
+	Beagle_StackTraceEndM();
+}
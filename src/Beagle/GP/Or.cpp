@@ -99,3 +99,17 @@ void GP::Or::execute(GP::Datum& outResult, GP::Context& ioContext)
 	lResult = lResult || lArg2;
 	Beagle_StackTraceEndM();
 }
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the boolean or primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+bool GP::Or::getInstruction(GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = GP::Instruction::eOr;
+	return true;
+	Beagle_StackTraceEndM();
+}
@@ -128,6 +128,34 @@ unsigned int GP::Primitive::getChildrenNodeIndex(unsigned int inN, GP::Context&
 }
 
 
+/*!
+ *  \brief Get the index of the primitive value in the argument frame of the contexts.
+ *  \return Frame index, UINT_MAX if the primitive does not use the argument frame.
+ */
+unsigned int GP::Primitive::getFrameIndex() const
+{
+	Beagle_StackTraceBeginM();
+	return UINT_MAX;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the primitive.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return True if the primitive has an equivalent instruction, false if not.
+ *
+ *  Primitives without an equivalent instruction, which is the default, are executed through
+ *  the virtual execute method when a compiled tree is run (see GP::CompiledTree).
+ */
+bool GP::Primitive::getInstruction(GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	return false;
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Get the selection weight multiplier for the primitive.
  *  \param inNumberArguments Number of arguments for the selection weight.
@@ -248,6 +276,39 @@ void GP::Primitive::readWithContext(PACC::XML::ConstIterator inIter, GP::Context
 }
 
 
+/*!
+ *  \brief Set the value of a primitive for the evaluations made with the given context.
+ *  \param inValue Value of the primitive.
+ *  \param ioContext Evolutionary context.
+ *
+ *  Primitives using the argument frame store the value in the frame of the context, so that
+ *  contexts evaluating in parallel do not interfere. By default, the value is set in the
+ *  primitive itself with setValue, which is shared by all the contexts.
+ */
+void GP::Primitive::setContextValue(const Object& inValue, GP::Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	setValue(inValue);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Make the primitive take its value from the argument frame of the contexts.
+ *  \param inIndex Index of the primitive value in the argument frame.
+ *  \return True if the primitive uses the argument frame, false if it does not support it.
+ *
+ *  Called by the primitive super set for the primitives of its sets. Primitives with the same
+ *  name are given the same frame index. By default, the argument frame is not supported.
+ */
+bool GP::Primitive::setFrameIndex(unsigned int inIndex)
+{
+	Beagle_StackTraceBeginM();
+	return false;
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Set the value of a primitive.
  *  \param inValue Value of the primitive.
@@ -64,8 +64,9 @@ namespace Beagle
 namespace GP
 {
 
-// Forward declaration.
+// Forward declarations.
 class Context;
+struct Instruction;
 
 /*!
  *  \class Primitive beagle/GP/Primitive.hpp "beagle/GP/Primitive.hpp"
@@ -110,6 +111,8 @@ public:
 
 	virtual std::string  deparse(std::vector<std::string>& lSubTrees) const;
 	unsigned int         getChildrenNodeIndex(unsigned int inN, GP::Context& ioContext) const;
+	virtual unsigned int getFrameIndex() const;
+	virtual bool         getInstruction(GP::Instruction& outInstruction) const;
 	inline  unsigned int getNumberArguments() const;
 	virtual double       getSelectionWeight(unsigned int inNumberArguments,
 	                                        GP::Context& ioContext) const;
@@ -120,6 +123,8 @@ public:
 	virtual bool         isSelectionWeightStable(unsigned int inNumberArguments) const;
 	virtual void         registerParams(System& ioSystem);
 	virtual void         readWithContext(PACC::XML::ConstIterator inIter, GP::Context& ioContext);
+	virtual void         setContextValue(const Object& inValue, GP::Context& ioContext);
+	virtual bool         setFrameIndex(unsigned int inIndex);
 	inline  void         setNumberArguments(unsigned int inNumberArguments);
 	virtual void         setValue(const Object& inValue);
 	virtual bool         validate(GP::Context& ioContext) const;
@@ -98,6 +98,38 @@ void GP::PrimitiveSuperSet::addBasicPrimitives()
 }
 
 
+/*!
+ *  \brief Initialize the primitive super set.
+ *  \param ioSystem Evolutionary system.
+ *
+ *  Give an argument frame index to the primitives of the sets supporting it (see
+ *  GP::Primitive::setFrameIndex), primitives of the same name sharing the same index. The values
+ *  of these primitives are then set in the context (see GP::Context::getArgumentFrame), which
+ *  makes evaluation with one context per thread safe.
+ */
+void GP::PrimitiveSuperSet::init(Beagle::System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	Component::init(ioSystem);
+	std::map<std::string,unsigned int> lFrameIndices;
+	for(unsigned int i=0; i<mPrimitSets.size(); ++i) {
+		GP::PrimitiveSet& lPrimitSet = *mPrimitSets[i];
+		for(unsigned int j=0; j<lPrimitSet.size(); ++j) {
+			const std::string& lName = lPrimitSet[j]->getName();
+			std::map<std::string,unsigned int>::const_iterator lIter = lFrameIndices.find(lName);
+			const unsigned int lIndex = (lIter == lFrameIndices.end()) ? lFrameIndices.size() : lIter->second;
+			if(lPrimitSet[j]->setFrameIndex(lIndex)) lFrameIndices[lName] = lIndex;
+		}
+	}
+	Beagle_LogDetailedM(
+	    ioSystem.getLogger(),
+	    std::string("Using an argument frame of ")+uint2str(lFrameIndices.size())+
+	    std::string(" values for the primitives of the super set")
+	);
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Register the parameters of this primitive superset.
  *  \param ioSystem Evolutionary system used for initialization.
@@ -54,6 +54,7 @@
 #include "Beagle/GP/Primitive.hpp"
 #include "Beagle/GP/PrimitiveInline.hpp"
 #include "Beagle/GP/Context.hpp"
+#include "Beagle/GP/CompiledTree.hpp"
 #include "Beagle/GP/Datum.hpp"
 
 #ifdef BEAGLE_HAVE_RTTI
@@ -99,11 +100,15 @@ public:
 	virtual const std::type_info* getReturnType(GP::Context& ioContext) const;
 #endif // BEAGLE_HAVE_RTTI
 
-	virtual std::string deparse(std::vector<std::string>& lSubTrees) const;
-	virtual void        getValue(Object& outValue);
-	virtual void        execute(GP::Datum& outResult, GP::Context& ioContext);
-	virtual bool        haveValue() const;
-	virtual void        setValue(const Object& inValue);
+	virtual std::string  deparse(std::vector<std::string>& lSubTrees) const;
+	virtual void         getValue(Object& outValue);
+	virtual void         execute(GP::Datum& outResult, GP::Context& ioContext);
+	virtual unsigned int getFrameIndex() const;
+	virtual bool         getInstruction(GP::Instruction& outInstruction) const;
+	virtual bool         haveValue() const;
+	virtual void         setContextValue(const Object& inValue, GP::Context& ioContext);
+	virtual bool         setFrameIndex(unsigned int inIndex);
+	virtual void         setValue(const Object& inValue);
 
 	/*!
 	 *  \brief Get the value of the token (const version).
@@ -140,7 +145,8 @@ public:
 
 protected:
 
-	T mToken;  //!< Value of the token.
+	T            mToken;       //!< Value of the token.
+	unsigned int mFrameIndex;  //!< Index of the token value in the context argument frames.
 
 };
 
@@ -154,7 +160,8 @@ protected:
  */
 template <class T>
 Beagle::GP::TokenT<T>::TokenT(std::string inName) :
-		Beagle::GP::Primitive(0, inName)
+		Beagle::GP::Primitive(0, inName),
+		mFrameIndex(UINT_MAX)
 { }
 
 
@@ -166,7 +173,8 @@ Beagle::GP::TokenT<T>::TokenT(std::string inName) :
 template <class T>
 Beagle::GP::TokenT<T>::TokenT(std::string inName, const T& inToken) :
 		Beagle::GP::Primitive(0, inName),
-		mToken(inToken)
+		mToken(inToken),
+		mFrameIndex(UINT_MAX)
 { }
 
 
@@ -216,13 +224,31 @@ void Beagle::GP::TokenT<T>::getValue(Beagle::Object& outValue)
  *  \brief Execute the characteristic operation of the token terminal.
  *  \param outResult Result of the operation (copy of the token).
  *  \param ioContext Evolutionary context.
+ *
+ *  The value set in the argument frame of the context is used when there is one, otherwise
+ *  the value held by the primitive is returned.
  */
 template <class T>
 void Beagle::GP::TokenT<T>::execute(Beagle::GP::Datum& outResult, Beagle::GP::Context& ioContext)
 {
 	Beagle_StackTraceBeginM();
 	T& lResult = castObjectT<T&>(outResult);
-	lResult = mToken;
+	const Beagle::Object* lFrameValue = ioContext.getArgumentFrame().getValue(mFrameIndex);
+	if(lFrameValue == NULL) lResult = mToken;
+	else lResult = castObjectT<const T&>(*lFrameValue);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the index of the token value in the argument frame of the contexts.
+ *  \return Frame index, UINT_MAX if none was given.
+ */
+template <class T>
+unsigned int Beagle::GP::TokenT<T>::getFrameIndex() const
+{
+	Beagle_StackTraceBeginM();
+	return mFrameIndex;
 	Beagle_StackTraceEndM();
 }
 
@@ -254,4 +280,105 @@ void Beagle::GP::TokenT<T>::setValue(const Beagle::Object& inValue)
 }
 
 
+/*!
+ *  \brief Set the value of the token for the evaluations made with the given context.
+ *  \param inValue Value of the token.
+ *  \param ioContext Evolutionary context, in the argument frame of which the value is stored.
+ */
+template <class T>
+void Beagle::GP::TokenT<T>::setContextValue(const Beagle::Object& inValue, Beagle::GP::Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	if(mFrameIndex == UINT_MAX) {
+		setValue(inValue);
+		return;
+	}
+	const T& lValueT = castObjectT<const T&>(inValue);
+	Beagle::Object* lFrameValue = ioContext.getArgumentFrame().getValue(mFrameIndex);
+	if(lFrameValue == NULL) ioContext.getArgumentFrame().setValue(mFrameIndex, new T(lValueT));
+	else castObjectT<T&>(*lFrameValue) = lValueT;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Make the token take its value from the argument frame of the contexts.
+ *  \param inIndex Index of the token value in the argument frame.
+ *  \return True, as tokens support the argument frame.
+ */
+template <class T>
+bool Beagle::GP::TokenT<T>::setFrameIndex(unsigned int inIndex)
+{
+	Beagle_StackTraceBeginM();
+	mFrameIndex = inIndex;
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the token terminal.
+ *  \param outInstruction Instruction equivalent to the primitive.
+ *  \return False, as there is no equivalent instruction for the generic type T.
+ */
+template <class T>
+bool Beagle::GP::TokenT<T>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	return false;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the Double token terminal.
+ *  \param outInstruction Instruction loading the token value.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+template <>
+inline bool Beagle::GP::TokenT<Beagle::Double>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = Beagle::GP::Instruction::eLoadDouble;
+	outInstruction.mOperand.mDouble = &mToken.getWrappedValue();
+	outInstruction.mFrameIndex = mFrameIndex;
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the Bool token terminal.
+ *  \param outInstruction Instruction loading the token value.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+template <>
+inline bool Beagle::GP::TokenT<Beagle::Bool>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = Beagle::GP::Instruction::eLoadBool;
+	outInstruction.mOperand.mBool = &mToken.getWrappedValue();
+	outInstruction.mFrameIndex = mFrameIndex;
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the compiled tree instruction equivalent to the Int token terminal.
+ *  \param outInstruction Instruction loading the token value.
+ *  \return True, as the primitive has an equivalent instruction.
+ */
+template <>
+inline bool Beagle::GP::TokenT<Beagle::Int>::getInstruction(Beagle::GP::Instruction& outInstruction) const
+{
+	Beagle_StackTraceBeginM();
+	outInstruction.mOpcode = Beagle::GP::Instruction::eLoadInt;
+	outInstruction.mOperand.mInt = &mToken.getWrappedValue();
+	outInstruction.mFrameIndex = mFrameIndex;
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
+
 #endif // Beagle_GP_TokenT_hpp
@@ -36,6 +36,7 @@
 #include "Beagle/GP.hpp"
 
 #include <algorithm>
+#include <map>
 
 using namespace Beagle;
 
@@ -353,6 +354,23 @@ void GP::Tree::interpret(GP::Datum& outResult, GP::Context& ioContext)
 }
 
 
+/*!
+ *  \brief Compute a hash value of the GP tree, from the primitives and sub-tree sizes of its nodes.
+ *  \return Hash value, equal for GP trees that are equal.
+ */
+unsigned long GP::Tree::computeHash() const
+{
+	Beagle_StackTraceBeginM();
+	unsigned long lHash = size();
+	for(unsigned int i=0; i<size(); ++i) {
+		lHash = combineHash(lHash, (unsigned long)(*this)[i].mPrimitive.getPointer());
+		lHash = combineHash(lHash, (*this)[i].mSubTreeSize);
+	}
+	return lHash;
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Compare the equality of two GP trees.
  *  \param inRightObj Right tree to be compare to tha actual one.
@@ -368,6 +386,82 @@ bool GP::Tree::isEqual(const Object& inRightObj) const
 }
 
 
+/*!
+ *  \brief Read a GP tree from a binary archive.
+ *  \param ioArchive Binary archive from which the GP tree is read.
+ *  \param ioContext Evolutionary context.
+ *  \throw Beagle::IOException If a reading error occured (generally bad format)!
+ *
+ *  Primitives are looked up by name once per entry of the primitive table written
+ *  by writeBinary, and then referenced by index for each node of the tree.
+ */
+void GP::Tree::readBinary(Beagle::BinaryInArchive& ioArchive, Beagle::Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	GP::Context& lGPContext = castObjectT<GP::Context&>(ioContext);
+	GP::PrimitiveSuperSet::Handle lSuperSet =
+	    castHandleT<GP::PrimitiveSuperSet>(ioContext.getSystem().getComponent("GP-PrimitiveSuperSet"));
+	if(lSuperSet == NULL) {
+		throw Beagle_RunTimeExceptionM("There should be a GP::PrimitiveSuperSet component in the system");
+	}
+	const unsigned int lPrimitiveSetIndex = ioArchive.readUInt();
+	if(lPrimitiveSetIndex >= lSuperSet->size()) {
+		std::ostringstream lOSS;
+		lOSS << "primitive set index " << lPrimitiveSetIndex << " read for GP tree ";
+		lOSS << "is larger than the number of primitive sets in the system!";
+		throw Beagle_IOExceptionMessageM(lOSS.str());
+	}
+	setPrimitiveSetIndex(lPrimitiveSetIndex);
+	setNumberArguments(ioArchive.readUInt());
+	GP::PrimitiveSet::Handle lPrimitiveSet = (*lSuperSet)[lPrimitiveSetIndex];
+
+	// Read table of primitives used in the tree
+	const unsigned int lNbEntries = ioArchive.readUInt();
+	std::vector<GP::Primitive::Handle> lPrimitives(lNbEntries);
+	std::vector<unsigned int> lNbArgs(lNbEntries);
+	std::vector<std::string> lContents(lNbEntries);
+	for(unsigned int i=0; i<lNbEntries; ++i) {
+		const std::string lName = ioArchive.readString();
+		lPrimitives[i] = lPrimitiveSet->getPrimitiveByName(lName);
+		if(lPrimitives[i] == NULL) {
+			std::ostringstream lOSS;
+			lOSS << "no primitive named '" << lName << "' found in the primitive set";
+			throw Beagle_IOExceptionMessageM(lOSS.str());
+		}
+		lNbArgs[i] = ioArchive.readUInt();
+		lContents[i] = ioArchive.readString();
+	}
+
+	// Read nodes
+	clear();
+	const unsigned int lSize = ioArchive.readUInt();
+	reserve(lSize);
+	for(unsigned int i=0; i<lSize; ++i) {
+		const unsigned int lEntry = ioArchive.readUInt();
+		if(lEntry >= lNbEntries) throw Beagle_IOExceptionMessageM("bad primitive index read for GP tree node!");
+		GP::Primitive::Handle lNewReference = lPrimitives[lEntry]->giveReference(lNbArgs[lEntry], lGPContext);
+		if(lNewReference == NULL) {
+			std::ostringstream lOSS;
+			lOSS << "While reading a tree, a primitive (named '";
+			lOSS << lPrimitives[lEntry]->getName() << "') gave an unexpected NULL reference.";
+			throw Beagle_RunTimeExceptionM(lOSS.str());
+		}
+		if(lContents[lEntry].empty() == false) {
+			std::istringstream lISS(lContents[lEntry]);
+			PACC::XML::Document lDocument(lISS);
+			lNewReference->readWithContext(lDocument.getFirstRoot(), lGPContext);
+			// The content has no child nodes, from which invokers would take their number of arguments.
+			lNewReference->setNumberArguments(lNbArgs[lEntry]);
+		}
+		push_back(GP::Node(lNewReference, 0));
+	}
+	if(empty() == false) {
+		if(fixSubTreeSize(0) != size()) throw Beagle_IOExceptionMessageM("GP tree read is not well formed!");
+	}
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Read a GP tree from an XML subtree.
  *  \param inIter XML iterator to use to read the tree from.
@@ -615,6 +709,56 @@ bool GP::Tree::validateSubTree(unsigned int inNodeIndex, GP::Context& ioContext)
 }
 
 
+/*!
+ *  \brief Write a GP tree into a binary archive.
+ *  \param ioArchive Binary archive into which the GP tree is written.
+ *
+ *  A table of the distinct primitive instances of the tree is first written, each
+ *  one with its name, its number of arguments and its XML content if any (for
+ *  ephemeral constants and the like). The nodes are then written as indices in
+ *  this table, in prefix order.
+ */
+void GP::Tree::writeBinary(Beagle::BinaryOutArchive& ioArchive) const
+{
+	Beagle_StackTraceBeginM();
+	ioArchive.writeUInt(getPrimitiveSetIndex());
+	ioArchive.writeUInt(getNumberArguments());
+
+	std::map<const GP::Primitive*,unsigned int> lEntryMap;
+	std::vector<unsigned int> lNodeEntries(size());
+	std::vector<const GP::Primitive*> lEntries;
+	for(unsigned int i=0; i<size(); ++i) {
+		const GP::Primitive* lPrimitive = (*this)[i].mPrimitive.getPointer();
+		std::map<const GP::Primitive*,unsigned int>::const_iterator lIter = lEntryMap.find(lPrimitive);
+		if(lIter == lEntryMap.end()) {
+			lNodeEntries[i] = lEntries.size();
+			lEntryMap[lPrimitive] = lEntries.size();
+			lEntries.push_back(lPrimitive);
+		} else lNodeEntries[i] = lIter->second;
+	}
+
+	ioArchive.writeUInt(lEntries.size());
+	for(unsigned int i=0; i<lEntries.size(); ++i) {
+		ioArchive.writeString(lEntries[i]->getName());
+		ioArchive.writeUInt(lEntries[i]->getNumberArguments());
+		std::ostringstream lEmptyOSS;
+		PACC::XML::Streamer lEmptyStreamer(lEmptyOSS);
+		lEmptyStreamer.openTag(lEntries[i]->getName(), false);
+		lEmptyStreamer.closeTag();
+		std::ostringstream lOSS;
+		PACC::XML::Streamer lStreamer(lOSS);
+		lStreamer.openTag(lEntries[i]->getName(), false);
+		lEntries[i]->writeContent(lStreamer, false);
+		lStreamer.closeTag();
+		ioArchive.writeString((lOSS.str() == lEmptyOSS.str()) ? std::string("") : lOSS.str());
+	}
+
+	ioArchive.writeUInt(size());
+	for(unsigned int i=0; i<size(); ++i) ioArchive.writeUInt(lNodeEntries[i]);
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Write a GP tree into a XML streamer.
  *  \param ioStreamer XML streamer to write the tree into.
@@ -98,6 +98,7 @@ public:
 	              unsigned int inPrimitiveSetIndex=UINT_MAX,
 	              unsigned int inNumberArguments=0);
 
+	virtual unsigned long computeHash() const;
 	virtual void         copy(const Member& inOriginal, System& ioSystem);
 	virtual unsigned int fixSubTreeSize(unsigned int inNodeIndex=0);
 	GP::PrimitiveSet&    getPrimitiveSet(GP::Context& ioContext) const;
@@ -113,9 +114,11 @@ public:
 	void                        interpret(GP::Datum& outResult, GP::Context& ioContext);
 	virtual bool                isEqual(const Object& inRightObj) const;
 	virtual std::string         deparse() const;
+	virtual void                readBinary(Beagle::BinaryInArchive& ioArchive, Beagle::Context& ioContext);
 	virtual void                readWithContext(PACC::XML::ConstIterator inIter, Beagle::Context& ioContext);
 	void                        setContextToNode(unsigned int inNodeIndex, GP::Context& ioContext) const;
 	bool                        validateSubTree(unsigned int inNodeIndex, GP::Context& ioContext) const;
+	virtual void                writeBinary(Beagle::BinaryOutArchive& ioArchive) const;
 	virtual void                writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
 	/*!
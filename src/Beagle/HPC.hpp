@@ -63,6 +63,7 @@
 #include "Beagle/HPC/Randomizer.hpp"
 #include "Beagle/HPC/AlgoSequential.hpp"
 #include "Beagle/HPC/AlgoNSGA2.hpp"
+#include "Beagle/HPC/AlgoAsynchronous.hpp"
 #include "Beagle/HPC/SwitchTypeOp.hpp"
 #include "Beagle/HPC/EvaluationOp.hpp"
 #include "Beagle/HPC/DistributeDemeToEvaluatorsOp.hpp"
@@ -76,6 +77,7 @@
 #include "Beagle/HPC/SendProcessedToSupervisorOp.hpp"
 #include "Beagle/HPC/SendFitnessToEvolverOp.hpp"
 #include "Beagle/HPC/ProcessingBuffer.hpp"
+#include "Beagle/HPC/AsyncSteadyStateOp.hpp"
 #include "Beagle/HPC/MPIException.hpp"
 
 //#include "Beagle/HPC/MigrationSyncOp.hpp"
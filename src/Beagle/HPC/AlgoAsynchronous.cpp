@@ -0,0 +1,264 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/HPC/AlgoAsynchronous.cpp
+ *  \brief  Source code of class AlgoAsynchronous.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/HPC.hpp"
+#include "Beagle/EC.hpp"
+
+using namespace Beagle;
+
+typedef HPC::SendDemeToEvolverOp SD2EOp;
+typedef HPC::RecvProcessedFromEvolverOp RPfEOp;
+typedef HPC::RecvDemeFromSupervisorOp RDfSOp;
+typedef HPC::DistributeDemeToEvaluatorsOp DD2EOp;
+typedef HPC::RecvFitnessFromEvaluatorOp RFfEOp;
+typedef HPC::SendProcessedToSupervisorOp SP2SOp;
+typedef HPC::RecvIndividualsFromEvolverOp RIfEOp;
+typedef HPC::SendFitnessToEvolverOp SF2EOp;
+typedef HPC::AsyncSteadyStateOp ASSOp;
+
+/*!
+ *  \brief Construct asynchronous steady-state evolutionary algorithm.
+ */
+HPC::AlgoAsynchronous::AlgoAsynchronous(void) :
+		Algorithm("HPC-AlgoAsynchronous")
+{ }
+
+
+/*!
+ *  \brief Configure asynchronous steady-state evolutionary algorithm in evolver using a master-slave topology.
+ *  \param ioEvolver Evolver modified by setting the algorithm.
+ *  \param ioSystem Evolutionary system.
+ *
+ *  The supervisor and evaluator nodes are configured as with HPC::AlgoSequential. After
+ *  the evaluation of their initial deme, the evolvers breed with an HPC::AsyncSteadyStateOp
+ *  which keeps all their evaluators busy. The evaluators pull their individuals by chunks,
+ *  thus parameter hpc.distribute.chunksize must be greater than 0.
+ */
+void HPC::AlgoAsynchronous::configure(Evolver& ioEvolver, System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+
+	// Get reference to the factory
+	const Factory& lFactory = ioSystem.getFactory();
+
+	// Get name and allocator of used operators
+	std::string lEvalOpName = lFactory.getConceptTypeName("EvaluationOp");
+	Beagle::EvaluationOp::Alloc::Handle lEvalOpAlloc = castHandleT<Beagle::EvaluationOp::Alloc>(lFactory.getAllocator(lEvalOpName));
+
+	std::string lSelectOpName = lFactory.getConceptTypeName("SelectionOp");
+	EC::SelectionOp::Alloc::Handle lSelectOpAlloc = castHandleT<EC::SelectionOp::Alloc>(lFactory.getAllocator(lSelectOpName));
+
+	std::string lInitOpName = lFactory.getConceptTypeName("InitializationOp");
+	EC::InitializationOp::Alloc::Handle lInitOpAlloc = castHandleT<EC::InitializationOp::Alloc>(lFactory.getAllocator(lInitOpName));
+
+	std::string lCxOpName = lFactory.getConceptTypeName("CrossoverOp");
+	EC::CrossoverOp::Alloc::Handle lCxOpAlloc = castHandleT<EC::CrossoverOp::Alloc>(lFactory.getAllocator(lCxOpName));
+
+	std::string lMutOpName = lFactory.getConceptTypeName("MutationOp");
+	EC::MutationOp::Alloc::Handle lMutOpAlloc = castHandleT<EC::MutationOp::Alloc>(lFactory.getAllocator(lMutOpName));
+
+	std::string lStatsCalcOpName = lFactory.getConceptTypeName("StatsCalculateOp");
+	EC::StatsCalculateOp::Alloc::Handle lStatsCalcOpAlloc = castHandleT<EC::StatsCalculateOp::Alloc>(lFactory.getAllocator(lStatsCalcOpName));
+
+	std::string lTermOpName = lFactory.getConceptTypeName("TerminationOp");
+	EC::TerminationOp::Alloc::Handle lTermOpAlloc = castHandleT<EC::TerminationOp::Alloc>(lFactory.getAllocator(lTermOpName));
+
+	std::string lMsWriteOpName = "MilestoneWriteOp";
+	EC::MilestoneWriteOp::Alloc::Handle lMsWriteOpAlloc = castHandleT<EC::MilestoneWriteOp::Alloc>(lFactory.getAllocator(lMsWriteOpName));
+
+	// Clear bootstrap and mainloop sets
+	ioEvolver.getBootStrapSet().clear();
+	ioEvolver.getMainLoopSet().clear();
+
+	Operator::Bag& lBootStrapSet = ioEvolver.getBootStrapSet();
+	Operator::Bag& lMainLoopSet = ioEvolver.getMainLoopSet();
+
+	// Set the bootstrap operator set
+	SwitchTypeOp::Alloc::Handle lSwitchTypeOpAlloc = castHandleT<SwitchTypeOp::Alloc>(lFactory.getAllocator("SwitchTypeOp"));
+	SwitchTypeOp::Handle lNodeTypeSwitch = castHandleT<SwitchTypeOp>(lSwitchTypeOpAlloc->allocate());
+	lBootStrapSet.push_back( lNodeTypeSwitch );
+
+	//Set the supervisor bootstrap set
+	{
+		EC::InitializationOp::Handle lInitOpBS = castHandleT<EC::InitializationOp>(lInitOpAlloc->allocate());
+		lInitOpBS->setName(lInitOpName);
+		lNodeTypeSwitch->insertOp("Supervisor", lInitOpBS );
+
+		SD2EOp::Alloc::Handle lSD2EOpAlloc = castHandleT<SD2EOp::Alloc>(lFactory.getAllocator("HPC-SendDemeToEvolverOp"));
+		SD2EOp::Handle lSD2EOpBS = castHandleT<SD2EOp>(lSD2EOpAlloc->allocate());
+		lNodeTypeSwitch->insertOp("Supervisor", lSD2EOpBS );
+
+		RPfEOp::Alloc::Handle lRPfEOpAlloc = castHandleT<RPfEOp::Alloc>(lFactory.getAllocator("HPC-RecvProcessedFromEvolverOp"));
+		RPfEOp::Handle lRPfEOpBS = castHandleT<RPfEOp>(lRPfEOpAlloc->allocate());
+		lNodeTypeSwitch->insertOp("Supervisor", lRPfEOpBS );
+
+		EC::StatsCalculateOp::Handle lStatsCalcOpBS = castHandleT<EC::StatsCalculateOp>(lStatsCalcOpAlloc->allocate());
+		lStatsCalcOpBS->setName(lStatsCalcOpName);
+		lNodeTypeSwitch->insertOp("Supervisor", lStatsCalcOpBS);
+
+		EC::TerminationOp::Handle lTermOpBS = castHandleT<EC::TerminationOp>(lTermOpAlloc->allocate());
+		lTermOpBS->setName(lTermOpName);
+		lNodeTypeSwitch->insertOp("Supervisor", lTermOpBS );
+
+		EC::MilestoneWriteOp::Handle lMsWriteOpBS = castHandleT<EC::MilestoneWriteOp>(lMsWriteOpAlloc->allocate());
+		lMsWriteOpBS->setName(lMsWriteOpName);
+		lNodeTypeSwitch->insertOp("Supervisor", lMsWriteOpBS );
+	}
+	//Set the evolver bootstrap set, the initial deme is evaluated as a whole
+	{
+		RDfSOp::Alloc::Handle lRDfSOpAlloc = castHandleT<RDfSOp::Alloc>(lFactory.getAllocator("HPC-RecvDemeFromSupervisorOp"));
+		RDfSOp::Handle lRDfSOpBS = castHandleT<RDfSOp>(lRDfSOpAlloc->allocate());
+		lNodeTypeSwitch->insertOp("Evolver", lRDfSOpBS );
+
+		DD2EOp::Alloc::Handle lDD2EOpAlloc = castHandleT<DD2EOp::Alloc>(lFactory.getAllocator("HPC-DistributeDemeToEvaluatorsOp"));
+		DD2EOp::Handle lDD2EOpBS = castHandleT<DD2EOp>(lDD2EOpAlloc->allocate());
+		lNodeTypeSwitch->insertOp("Evolver", lDD2EOpBS );
+
+		RFfEOp::Alloc::Handle lRFfEOpAlloc = castHandleT<RFfEOp::Alloc>(lFactory.getAllocator("HPC-RecvFitnessFromEvaluatorOp"));
+		RFfEOp::Handle lRFfEOpBS = castHandleT<RFfEOp>(lRFfEOpAlloc->allocate());
+		lNodeTypeSwitch->insertOp("Evolver", lRFfEOpBS );
+
+		SP2SOp::Alloc::Handle lSP2SOpAlloc = castHandleT<SP2SOp::Alloc>(lFactory.getAllocator("HPC-SendProcessedToSupervisorOp"));
+		SP2SOp::Handle lSP2SOpBS = castHandleT<SP2SOp>(lSP2SOpAlloc->allocate());
+		lNodeTypeSwitch->insertOp("Evolver", lSP2SOpBS );
+
+		EC::TerminationOp::Handle lTermOpBS = castHandleT<EC::TerminationOp>(lTermOpAlloc->allocate());
+		lTermOpBS->setName(lTermOpName);
+		lNodeTypeSwitch->insertOp("Evolver", lTermOpBS );
+	}
+	//Set the evaluator bootstrap set
+	{
+		RIfEOp::Alloc::Handle lRIfEOpAlloc = castHandleT<RIfEOp::Alloc>(lFactory.getAllocator("HPC-RecvIndividualsFromEvolverOp"));
+		RIfEOp::Handle lRIfEOpBS = castHandleT<RIfEOp>(lRIfEOpAlloc->allocate());
+		lNodeTypeSwitch->insertOp("Evaluator", lRIfEOpBS );
+
+		Beagle::EvaluationOp::Handle lEvalOpBS = castHandleT<Beagle::EvaluationOp>(lEvalOpAlloc->allocate());
+		lEvalOpBS->setName(lEvalOpName);
+		lNodeTypeSwitch->insertOp("Evaluator", lEvalOpBS );
+
+		SF2EOp::Alloc::Handle lSF2EOpAlloc = castHandleT<SF2EOp::Alloc>(lFactory.getAllocator("HPC-SendFitnessToEvolverOp"));
+		SF2EOp::Handle lSF2EOpBS = castHandleT<SF2EOp>(lSF2EOpAlloc->allocate());
+		lNodeTypeSwitch->insertOp("Evaluator", lSF2EOpBS );
+
+		EC::TerminationOp::Handle lTermOpBS = castHandleT<EC::TerminationOp>(lTermOpAlloc->allocate());
+		lTermOpBS->setName(lTermOpName);
+		lNodeTypeSwitch->insertOp("Evaluator", lTermOpBS );
+	}
+	//Set the main loop set
+	SwitchTypeOp::Handle lNodeTypeSwitchML = castHandleT<SwitchTypeOp>(lSwitchTypeOpAlloc->allocate());
+	lMainLoopSet.push_back( lNodeTypeSwitchML );
+
+	//Set the supervisor mainloop set
+	{
+		RPfEOp::Alloc::Handle lRPfEOpAlloc = castHandleT<RPfEOp::Alloc>(lFactory.getAllocator("HPC-RecvProcessedFromEvolverOp"));
+		RPfEOp::Handle lRPfEOpML = castHandleT<RPfEOp>(lRPfEOpAlloc->allocate());
+		lNodeTypeSwitchML->insertOp("Supervisor",  lRPfEOpML );
+
+		EC::StatsCalculateOp::Handle lStatsCalcOpML = castHandleT<EC::StatsCalculateOp>(lStatsCalcOpAlloc->allocate());
+		lStatsCalcOpML->setName(lStatsCalcOpName);
+		lNodeTypeSwitchML->insertOp("Supervisor",  lStatsCalcOpML);
+
+		EC::TerminationOp::Handle lTermOpML = castHandleT<EC::TerminationOp>(lTermOpAlloc->allocate());
+		lTermOpML->setName(lTermOpName);
+		lNodeTypeSwitchML->insertOp("Supervisor",  lTermOpML );
+
+		EC::MilestoneWriteOp::Handle lMsWriteOpML = castHandleT<EC::MilestoneWriteOp>(lMsWriteOpAlloc->allocate());
+		lMsWriteOpML->setName(lMsWriteOpName);
+		lNodeTypeSwitchML->insertOp("Supervisor",  lMsWriteOpML );
+	}
+	//Set the evolver mainloop set, breeding through an asynchronous steady-state replacement strategy
+	{
+		ASSOp::Alloc::Handle lASSOpAlloc = castHandleT<ASSOp::Alloc>(lFactory.getAllocator("HPC-AsyncSteadyStateOp"));
+		ASSOp::Handle lASSOpML = castHandleT<ASSOp>(lASSOpAlloc->allocate());
+
+		// Set crossover branch
+		BreederNode::Handle lCxNode = new BreederNode;
+		lASSOpML->setRootNode(lCxNode);
+		lCxNode->setBreederOp(castHandleT<EC::CrossoverOp>(lCxOpAlloc->allocate()));
+		lCxNode->getBreederOp()->setName(lCxOpName);
+		BreederNode::Handle lSelectCxNode1 = new BreederNode;
+		lCxNode->setFirstChild(lSelectCxNode1);
+		lSelectCxNode1->setBreederOp(castHandleT<EC::SelectionOp>(lSelectOpAlloc->allocate()));
+		lSelectCxNode1->getBreederOp()->setName(lSelectOpName);
+		BreederNode::Handle lSelectCxNode2 = new BreederNode;
+		lSelectCxNode1->setNextSibling(lSelectCxNode2);
+		lSelectCxNode2->setBreederOp(castHandleT<EC::SelectionOp>(lSelectOpAlloc->allocate()));
+		lSelectCxNode2->getBreederOp()->setName(lSelectOpName);
+
+		// Set mutation branch
+		BreederNode::Handle lMutNode = new BreederNode;
+		lCxNode->setNextSibling(lMutNode);
+		lMutNode->setBreederOp(castHandleT<EC::MutationOp>(lMutOpAlloc->allocate()));
+		lMutNode->getBreederOp()->setName(lMutOpName);
+		BreederNode::Handle lSelectMutNode = new BreederNode;
+		lMutNode->setFirstChild(lSelectMutNode);
+		lSelectMutNode->setBreederOp(castHandleT<EC::SelectionOp>(lSelectOpAlloc->allocate()));
+		lSelectMutNode->getBreederOp()->setName(lSelectOpName);
+
+		// Set reproduction branch
+		BreederNode::Handle lReproNode = new BreederNode;
+		lMutNode->setNextSibling(lReproNode);
+		lReproNode->setBreederOp(castHandleT<EC::SelectionOp>(lSelectOpAlloc->allocate()));
+		lReproNode->getBreederOp()->setName(lSelectOpName);
+
+		lNodeTypeSwitchML->insertOp("Evolver", lASSOpML );
+
+		SP2SOp::Alloc::Handle lSP2SOpAlloc = castHandleT<SP2SOp::Alloc>(lFactory.getAllocator("HPC-SendProcessedToSupervisorOp"));
+		SP2SOp::Handle lSP2SOpML = castHandleT<SP2SOp>(lSP2SOpAlloc->allocate());
+		lNodeTypeSwitchML->insertOp("Evolver", lSP2SOpML );
+
+		EC::TerminationOp::Handle lTermOpML = castHandleT<EC::TerminationOp>(lTermOpAlloc->allocate());
+		lTermOpML->setName(lTermOpName);
+		lNodeTypeSwitchML->insertOp("Evolver", lTermOpML );
+	}
+	//Set the evaluator mainloop set, the chunks being pulled until the generation ends
+	{
+		RIfEOp::Alloc::Handle lRIfEOpAlloc = castHandleT<RIfEOp::Alloc>(lFactory.getAllocator("HPC-RecvIndividualsFromEvolverOp"));
+		RIfEOp::Handle lRIfEOpML = castHandleT<RIfEOp>(lRIfEOpAlloc->allocate());
+		lNodeTypeSwitchML->insertOp("Evaluator", lRIfEOpML );
+
+		Beagle::EvaluationOp::Handle lEvalOpML = castHandleT<Beagle::EvaluationOp>(lEvalOpAlloc->allocate());
+		lEvalOpML->setName(lEvalOpName);
+		lNodeTypeSwitchML->insertOp("Evaluator", lEvalOpML );
+
+		SF2EOp::Alloc::Handle lSF2EOpAlloc = castHandleT<SF2EOp::Alloc>(lFactory.getAllocator("HPC-SendFitnessToEvolverOp"));
+		SF2EOp::Handle lSF2EOpML = castHandleT<SF2EOp>(lSF2EOpAlloc->allocate());
+		lNodeTypeSwitchML->insertOp("Evaluator", lSF2EOpML );
+
+		EC::TerminationOp::Handle lTermOpML = castHandleT<EC::TerminationOp>(lTermOpAlloc->allocate());
+		lTermOpML->setName(lTermOpName);
+		lNodeTypeSwitchML->insertOp("Evaluator", lTermOpML );
+	}
+
+	Beagle_StackTraceEndM();
+}
@@ -0,0 +1,73 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/HPC/AlgoAsynchronous.hpp
+ *  \brief  Definition of the class AlgoAsynchronous.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_HPC_AlgoAsynchronous_hpp
+#define Beagle_HPC_AlgoAsynchronous_hpp
+
+#include "Beagle/config.hpp"
+#include "Beagle/macros.hpp"
+#include "Beagle/Core/Algorithm.hpp"
+
+
+namespace Beagle
+{
+namespace HPC
+{
+/*!
+ *  \class AlgoAsynchronous beagle/HPC/AlgoAsynchronous.hpp "beagle/HPC/AlgoAsynchronous.hpp"
+ *  \brief Asynchronous steady-state algorithm, evolvers breeding offsprings as soon as an evaluator is free.
+ *  \ingroup ECF
+ */
+class AlgoAsynchronous : public Algorithm
+{
+
+public:
+
+	//! AlgoAsynchronous allocator type.
+	typedef AllocatorT< AlgoAsynchronous, Algorithm::Alloc > Alloc;
+	//! AlgoAsynchronous handle type.
+	typedef PointerT< AlgoAsynchronous, Algorithm::Handle > Handle;
+	//! AlgoAsynchronous bag type.
+	typedef ContainerT< AlgoAsynchronous, Algorithm::Bag > Bag;
+
+	AlgoAsynchronous(void);
+	virtual ~AlgoAsynchronous()
+	{ }
+
+	virtual void configure(Evolver& ioEvolver, System& ioSystem);
+
+};
+}
+}
+
+#endif // Beagle_HPC_AlgoAsynchronous_hpp
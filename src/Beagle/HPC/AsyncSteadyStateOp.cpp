@@ -0,0 +1,334 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/HPC/AsyncSteadyStateOp.cpp
+ *  \brief  Source code of class HPC::AsyncSteadyStateOp.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "Beagle/HPC.hpp"
+
+#include <algorithm>
+
+using namespace Beagle;
+
+namespace
+{
+
+/*!
+ *  \brief Order the indices of the individuals of a deme from the worst to the best,
+ *    so that a heap of indices built with it has the worst individual on top.
+ */
+class IsBetterIndexPredicate
+{
+public:
+	explicit IsBetterIndexPredicate(const Deme& inDeme) :
+		mDeme(inDeme)
+	{ }
+	~IsBetterIndexPredicate()
+	{ }
+
+	/*!
+	 *  \brief Test whether the left individual is better than the right one.
+	 *  \param inLeft Index of the left individual in the deme.
+	 *  \param inRight Index of the right individual in the deme.
+	 */
+	inline bool operator()(unsigned int inLeft, unsigned int inRight) const {
+		Beagle_StackTraceBeginM();
+		return mDeme[inRight]->isLess(*mDeme[inLeft]);
+		Beagle_StackTraceEndM();
+	}
+
+private:
+	const Deme& mDeme;   //!< Deme of the individuals indexed.
+};
+
+}
+
+
+/*!
+ *  \brief Construct the asynchronous steady-state operator.
+ *  \param inName Name of the operator.
+ */
+HPC::AsyncSteadyStateOp::AsyncSteadyStateOp(std::string inName) :
+	ReplacementStrategyOp(inName),
+	mNbBred(0),
+	mNbInserted(0),
+	mNbStale(0),
+	mBusyTime(0.0)
+{ }
+
+
+/*!
+ *  \brief Register the parameters of the operator.
+ *  \param ioSystem Current system.
+ */
+void HPC::AsyncSteadyStateOp::registerParams(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	ReplacementStrategyOp::registerParams(ioSystem);
+	Register::Description lDescription(
+		"Maximum staleness of offsprings",
+		"UInt",
+		"0",
+		"Maximum number of insertions in the deme between the breeding of an offspring and the return of its fitness. Staler offsprings are discarded. Value of 0 means no limit."
+	);
+	mStaleness = castHandleT<UInt>(
+		ioSystem.getRegister().insertEntry("hpc.async.staleness", new UInt(0), lDescription));
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Initialize the operator
+ *  \param ioSystem Current system
+ */
+void HPC::AsyncSteadyStateOp::init(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	ReplacementStrategyOp::init(ioSystem);
+	mComm = castHandleT<HPC::MPICommunication>(ioSystem.getComponent("MPICommunication"));
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Insert an evaluated offspring in the deme, in place of its worst individual.
+ *  \param inOffspring Offspring to insert.
+ *  \param ioDeme Deme in which the offspring is inserted.
+ *  \param ioBuffer Processing buffer in which the individuals modified are recorded.
+ *
+ *  The offspring is dropped if it is worse than the worst individual of the deme. The worst
+ *  individual is found on top of the heap of indices built at the start of the generation,
+ *  which is restored in logarithmic time after the replacement.
+ */
+void HPC::AsyncSteadyStateOp::insertOffspring(Individual::Handle inOffspring, Deme& ioDeme, ProcessingBuffer& ioBuffer)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(mWorstHeap.size() == ioDeme.size());
+	const unsigned int lWorst = mWorstHeap.front();
+	if(inOffspring->isLess(*ioDeme[lWorst])) {
+		mDropped.push_back(inOffspring);
+		return;
+	}
+	std::pop_heap(mWorstHeap.begin(), mWorstHeap.end(), IsBetterIndexPredicate(ioDeme));
+	mDropped.push_back(ioDeme[lWorst]);
+	ioDeme[lWorst] = inOffspring;
+	std::push_heap(mWorstHeap.begin(), mWorstHeap.end(), IsBetterIndexPredicate(ioDeme));
+	ioBuffer.push_back(inOffspring, lWorst);
+	++mNbInserted;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Read the fitness of a chunk of offsprings sent by an evaluator.
+ *  \param inMessage Message received from the evaluator.
+ *  \param ioChunk Offsprings of the chunk.
+ *  \param ioContext Current context of the evolution.
+ */
+void HPC::AsyncSteadyStateOp::readFitness(const std::string& inMessage,
+                                          std::deque<Individual::Handle>& ioChunk,
+                                          Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	const Factory& lFactory = ioContext.getSystem().getFactory();
+	Fitness::Alloc::Handle lFitnessAlloc =
+			castHandleT<Fitness::Alloc>(lFactory.getConceptAllocator("Fitness"));
+	unsigned int lNbFitness = 0;
+	if(mComm->isBinaryTransport()) {
+		BinaryInArchive lArchive(inMessage);
+		lArchive.readHeader();
+		lNbFitness = lArchive.readUInt();
+		for(unsigned int i = 0; i < lNbFitness; ++i){
+			const unsigned int lIndex = lArchive.readUInt();
+			if(lIndex >= ioChunk.size())
+				throw Beagle_IOExceptionMessageM("index of fitness received is out of the chunk sent!");
+			ioContext.setIndividualHandle(ioChunk[lIndex]);
+			if(ioChunk[lIndex]->getFitness() == 0)
+				ioChunk[lIndex]->setFitness( castHandleT<Fitness>(lFitnessAlloc->allocate()) );
+			ioChunk[lIndex]->getFitness()->readBinary(lArchive, ioContext);
+		}
+	} else {
+		std::istringstream lInStream(inMessage);
+		PACC::XML::Document lDocument(lInStream);
+		for(PACC::XML::ConstIterator lIter = lDocument.getFirstRoot()->getFirstChild(); lIter; ++lIter){
+			if(lNbFitness >= ioChunk.size())
+				throw Beagle_IOExceptionMessageM("more fitness received than individuals in the chunk sent!");
+			ioContext.setIndividualHandle(ioChunk[lNbFitness]);
+			if(ioChunk[lNbFitness]->getFitness() == 0)
+				ioChunk[lNbFitness]->setFitness( castHandleT<Fitness>(lFitnessAlloc->allocate()) );
+			ioChunk[lNbFitness]->getFitness()->read(lIter);
+			++lNbFitness;
+		}
+	}
+	ioContext.setProcessedDeme(ioContext.getProcessedDeme()+lNbFitness);
+	ioContext.setTotalProcessedDeme(ioContext.getTotalProcessedDeme()+lNbFitness);
+	ioContext.setProcessedVivarium(ioContext.getProcessedVivarium()+lNbFitness);
+	ioContext.setTotalProcessedVivarium(ioContext.getTotalProcessedVivarium()+lNbFitness);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Breed a chunk of offsprings and send it to an evaluator.
+ *  \param inEvaluator Index of the evaluator.
+ *  \param ioDeme Deme from which the offsprings are bred.
+ *  \param ioBuffer Processing buffer in which the individuals modified are recorded.
+ *  \param inRoulette Roulette of the breeder operators.
+ *  \param ioContext Current context of the evolution.
+ *  \return True if a chunk was sent, false if an empty chunk was sent to end the generation.
+ *
+ *  Offsprings whose fitness is still valid, such as reproduced individuals, are directly
+ *  inserted in the deme instead of being sent. Once less than a chunk per evaluator is left
+ *  to breed, the chunks are shrunk to a fair share of the offsprings left.
+ */
+bool HPC::AsyncSteadyStateOp::sendChunk(unsigned int inEvaluator,
+                                        Deme& ioDeme,
+                                        ProcessingBuffer& ioBuffer,
+                                        const RouletteT<unsigned int>& inRoulette,
+                                        Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	std::deque<Individual::Handle>& lChunk = mChunks[inEvaluator];
+	lChunk.clear();
+	while(lChunk.empty() && (mNbBred < ioDeme.size())) {
+		const unsigned int lSize =
+			ProcessingBuffer::capChunkSize(mComm->getChunkSize(), ioDeme.size()-mNbBred, mChunks.size());
+		for(unsigned int i = 0; i < lSize; ++i) {
+			Individual::Handle lOffspring = breedOneOffspring(ioDeme, inRoulette, ioContext);
+			++mNbBred;
+			if((lOffspring->getFitness() == NULL) || (lOffspring->getFitness()->isValid() == false)) {
+				lChunk.push_back(lOffspring);
+			} else insertOffspring(lOffspring, ioDeme, ioBuffer);
+		}
+	}
+	mChunkStamp[inEvaluator] = mNbInserted;
+	mChunkStart[inEvaluator] = mTimer.getValue();
+	DistributeDemeToEvaluatorsOp::writeIndividuals(lChunk, 0, lChunk.size(), mComm->isBinaryTransport(), mMessage);
+	mComm->send(mMessage, "Individuals", "Child", inEvaluator);
+	if(lChunk.empty()) return false;
+	mComm->receiveNonBlocking(mRequests[inEvaluator], "Fitness", "Child", inEvaluator);
+	return true;
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Apply the asynchronous steady-state replacement strategy on a deme.
+ *  \param ioDeme Deme on which the operation takes place.
+ *  \param ioContext Current context of the evolution.
+ *
+ *  The generation ends when as many offsprings as individuals in the deme have been bred
+ *  and evaluated. Each evaluator is then sent an empty chunk, as it is done with the
+ *  individuals pulled by \ref RecvFitnessFromEvaluatorOp, and stays idle until the next
+ *  generation starts. The utilisation of the evaluators, that is the ratio of the time they
+ *  spent with a chunk to the duration of the generation, is logged at the end of the
+ *  generation. The async-utilisation example logs this utilisation for evaluators of
+ *  different speeds.
+ */
+void HPC::AsyncSteadyStateOp::operate(Deme& ioDeme, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_NonNullPointerAssertM(getRootNode());
+	Beagle_ValidateParameterM(mComm->getChunkSize() > 0,
+	                          "hpc.distribute.chunksize",
+	                          "The asynchronous steady-state evolution needs evaluators pulling their individuals by chunks!");
+	Beagle_LogTraceM(
+		ioContext.getSystem().getLogger(),
+		"Processing using asynchronous steady-state replacement strategy the " <<
+		uint2ordinal(ioContext.getDemeIndex()+1) << " deme"
+	);
+	Beagle_LogTraceM(ioContext.getSystem().getLogger(), (*this));
+
+	ProcessingBuffer::Handle lBuffer = castHandleT<ProcessingBuffer>(ioDeme.getMember("ProcessingBuffer"));
+	if(lBuffer==0){
+		lBuffer = new ProcessingBuffer;
+		ioDeme.addMember(lBuffer);
+	}
+	lBuffer->clear();
+
+	RouletteT<unsigned int> lRoulette;
+	buildRoulette(lRoulette, ioContext);
+
+	const unsigned int lNbEvaluators = mComm->getNbrOfRelation("Child");
+	if(mRequests.size() != lNbEvaluators) {
+		mRequests.resize(lNbEvaluators);
+		for(unsigned int i = 0; i < lNbEvaluators; ++i) mRequests[i] = new MPICommunication::Request;
+		mChunks.resize(lNbEvaluators);
+		mChunkStamp.resize(lNbEvaluators, 0);
+		mChunkStart.resize(lNbEvaluators, 0.0);
+	}
+	ioContext.setProcessedDeme(0);
+	mNbBred = 0;
+	mNbInserted = 0;
+	mNbStale = 0;
+	mBusyTime = 0.0;
+	mWorstHeap.resize(ioDeme.size());
+	for(unsigned int i = 0; i < ioDeme.size(); ++i) mWorstHeap[i] = i;
+	std::make_heap(mWorstHeap.begin(), mWorstHeap.end(), IsBetterIndexPredicate(ioDeme));
+	mTimer.reset();
+
+	unsigned int lNbActive = 0;
+	for(unsigned int i = 0; i < lNbEvaluators; ++i) {
+		if(sendChunk(i, ioDeme, *lBuffer, lRoulette, ioContext)) ++lNbActive;
+	}
+	while(lNbActive > 0) {
+		int lIndex = mComm->waitAny(mRequests);
+		if(lIndex < 0) throw Beagle_RunTimeExceptionM("Reception of fitness from an evaluator was cancelled!");
+		mBusyTime += mTimer.getValue() - mChunkStart[lIndex];
+		std::deque<Individual::Handle>& lChunk = mChunks[lIndex];
+		readFitness(mRequests[lIndex]->getMessage()->getWrappedValue(), lChunk, ioContext);
+
+		const unsigned int lStaleness = mNbInserted - mChunkStamp[lIndex];
+		if((mStaleness->getWrappedValue() > 0) && (lStaleness > mStaleness->getWrappedValue())) {
+			Beagle_LogDetailedM(
+				ioContext.getSystem().getLogger(),
+				std::string("Evolver discards a chunk of ")+uint2str(lChunk.size())+
+				std::string(" stale offsprings from his ")+uint2ordinal(lIndex+1)+" evaluator"
+			);
+			mNbStale += lChunk.size();
+			mDropped.insert(mDropped.end(), lChunk.begin(), lChunk.end());
+		} else {
+			for(unsigned int i = 0; i < lChunk.size(); ++i) insertOffspring(lChunk[i], ioDeme, *lBuffer);
+		}
+		if(sendChunk(lIndex, ioDeme, *lBuffer, lRoulette, ioContext) == false) --lNbActive;
+	}
+
+	const double lDuration = mTimer.getValue();
+	Beagle_LogInfoM(
+		ioContext.getSystem().getLogger(),
+		std::string("Evolver inserted ")+uint2str(mNbInserted)+std::string(" of ")+uint2str(mNbBred)+
+		std::string(" offsprings (")+uint2str(mNbStale)+std::string(" stale), evaluators utilisation of ")+
+		dbl2str((lDuration > 0.0) ? (100.0 * mBusyTime / (lDuration * lNbEvaluators)) : 0.0)+"%"
+	);
+
+	recycleIndividuals(mDropped, ioContext);
+	mDropped.clear();
+	Beagle_StackTraceEndM();
+}
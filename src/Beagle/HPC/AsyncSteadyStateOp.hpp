@@ -0,0 +1,109 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/HPC/AsyncSteadyStateOp.hpp
+ *  \brief  Definition of the class HPC::AsyncSteadyStateOp.
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_HPC_AsyncSteadyStateOp_hpp
+#define Beagle_HPC_AsyncSteadyStateOp_hpp
+
+#include "Beagle/HPC.hpp"
+
+namespace Beagle {
+
+namespace HPC {
+
+	/*!
+	 *  \class AsyncSteadyStateOp beagle/HPC/AsyncSteadyStateOp.hpp "beagle/HPC/AsyncSteadyStateOp.hpp"
+	 *  \brief Asynchronous steady-state replacement strategy of an evolver node.
+	 *	The operator keeps every evaluator busy: as soon as the fitness of a chunk of offsprings
+	 *	comes back from an evaluator, the offsprings are inserted into the deme and a new chunk
+	 *	is bred from the updated deme and sent to that evaluator. A generation is made of as many
+	 *	offsprings as there are individuals in the deme.
+	 *
+	 *	The offsprings replace the worst individual of the deme, unless they are worse than it.
+	 *	Offsprings bred more than hpc.async.staleness insertions before their fitness came back
+	 *	are discarded. The evaluators must pull their individuals by chunks, that is parameter
+	 *	hpc.distribute.chunksize must be greater than 0.
+	 *
+	 *	The generations remain a barrier for the evaluators, which run their own operators,
+	 *	termination criterion included, once their generation is ended by an empty chunk. At the
+	 *	end of a generation, the evaluators done wait for the last chunks to come back, and all
+	 *	the evaluators wait while the evolver sends its deme to the supervisor. The last chunks
+	 *	of a generation are thus shrunk to a fair share of the offsprings left to breed, which
+	 *	bounds the first wait to about the evaluation time of one such chunk by the slowest
+	 *	evaluator. The utilisation logged at each generation includes the cost of the barrier.
+	 */
+	class AsyncSteadyStateOp : public Beagle::ReplacementStrategyOp {
+
+	public:
+
+		//! AsyncSteadyStateOp allocator type.
+		typedef Beagle::AllocatorT<AsyncSteadyStateOp,Beagle::ReplacementStrategyOp::Alloc> Alloc;
+		//!< AsyncSteadyStateOp handle type.
+		typedef Beagle::PointerT<AsyncSteadyStateOp,Beagle::ReplacementStrategyOp::Handle> Handle;
+		//!< AsyncSteadyStateOp bag type.
+		typedef Beagle::ContainerT<AsyncSteadyStateOp,Beagle::ReplacementStrategyOp::Bag> Bag;
+
+		explicit AsyncSteadyStateOp(std::string inName="HPC-AsyncSteadyStateOp");
+		virtual ~AsyncSteadyStateOp() { }
+
+		virtual void registerParams(System& ioSystem);
+		virtual void init(System& ioSystem);
+		virtual void operate(Deme& ioDeme, Context& ioContext);
+
+	protected:
+		void insertOffspring(Individual::Handle inOffspring, Deme& ioDeme, ProcessingBuffer& ioBuffer);
+		void readFitness(const std::string& inMessage, std::deque<Individual::Handle>& ioChunk, Context& ioContext);
+		bool sendChunk(unsigned int inEvaluator,
+		               Deme& ioDeme,
+		               ProcessingBuffer& ioBuffer,
+		               const RouletteT<unsigned int>& inRoulette,
+		               Context& ioContext);
+
+		HPC::MPICommunication::Handle                 mComm;
+		UInt::Handle                                  mStaleness;  //!< Maximum staleness of the offsprings inserted.
+		MPICommunication::Request::Bag                mRequests;   //!< Reception requests of the fitness.
+		std::vector< std::deque<Individual::Handle> > mChunks;     //!< Offsprings in evaluation by each evaluator.
+		std::vector<unsigned int>                     mChunkStamp; //!< Number of insertions when each chunk was bred.
+		std::vector<double>                           mChunkStart; //!< Time at which each chunk was sent.
+		std::vector<unsigned int>                     mWorstHeap;  //!< Indices of the deme, in a heap with the worst individual on top.
+		Individual::Bag                               mDropped;    //!< Individuals dropped, recycled at the end of the generation.
+		unsigned int                                  mNbBred;     //!< Number of offsprings bred in the generation.
+		unsigned int                                  mNbInserted; //!< Number of offsprings inserted in the generation.
+		unsigned int                                  mNbStale;    //!< Number of stale offsprings discarded in the generation.
+		double                                        mBusyTime;   //!< Evaluation time of the chunks of the generation.
+		PACC::Timer                                   mTimer;      //!< Timer used to measure the evaluation times.
+		std::string                                   mMessage;    //!< Buffer reused for the messages.
+	};
+}
+}
+
+#endif //Beagle_HPC_AsyncSteadyStateOp_hpp
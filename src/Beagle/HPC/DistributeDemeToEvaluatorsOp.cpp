@@ -36,6 +36,49 @@
 
 using namespace Beagle;
 
+
+/*!
+ *  \class HPC::DistributeDemeToEvaluatorsOp::ChunkTransport
+ *  \brief MPI transport of the first chunks sent to the evaluators, used by ProcessingBuffer::sendFirstChunks.
+ */
+class HPC::DistributeDemeToEvaluatorsOp::ChunkTransport {
+public:
+	ChunkTransport(MPICommunication& ioComm, ProcessingBuffer& ioBuffer, Context& ioContext, unsigned int inNbEvaluators) :
+		mComm(ioComm),
+		mBuffer(ioBuffer),
+		mContext(ioContext),
+		mStreams(inNbEvaluators),
+		mRequests(inNbEvaluators)
+	{ }
+
+	//! Send, without blocking, a chunk of individuals to an evaluator.
+	void sendChunk(unsigned int inEvaluator, unsigned int inFirst, unsigned int inCount)
+	{
+		writeIndividuals(mBuffer, inFirst, inCount, mComm.isBinaryTransport(), mStreams[inEvaluator]);
+		mRequests[inEvaluator] = new MPICommunication::Request;
+		mComm.sendNonBlocking(mStreams[inEvaluator], mRequests[inEvaluator], "Individuals", "Child", inEvaluator);
+
+		Beagle_LogDetailedM(
+			mContext.getSystem().getLogger(),
+			std::string("Evolver send first chunk of ")+uint2str(inCount)+
+			std::string(" individuals to his ")+uint2ordinal(inEvaluator+1)+" evaluator"
+		);
+	}
+
+	//! Wait for the completion of all the chunks sent.
+	void waitAll()
+	{
+		mComm.waitAll(mRequests);
+	}
+
+private:
+	MPICommunication&              mComm;
+	ProcessingBuffer&              mBuffer;
+	Context&                       mContext;
+	std::vector<std::string>       mStreams;
+	MPICommunication::Request::Bag mRequests;
+};
+
 /*!
  *  \brief Construct the DistributeDemeToEvaluators operator.
  *  \param inName Name of the operator.
@@ -77,12 +120,19 @@ void HPC::DistributeDemeToEvaluatorsOp::init(System& ioSystem)
  *
  *  The function write the individuals in a streamer. The streamer opening
  *  tag is <Population> so the evaluator can directly read the string at
- *  its reception as a deme.
+ *  its reception as a deme. When parameter hpc.comm.binary is set, the
+ *  individuals are rather written in a binary archive.
  *
  *  The string are sent using a non-blocking send function, so the function
  *  doesn't have to wait for the transaction to be completed before starting
  *  to build another packet of individuals. The function ends when all
  *  packets have been sent.
+ *
+ *  When parameter hpc.distribute.chunksize is greater than 0, the individuals
+ *  are rather pulled by the evaluators. Only a first chunk is sent here to
+ *  each evaluator, the following chunks are sent by
+ *  \ref RecvFitnessFromEvaluatorOp as the fitness of the previous chunks
+ *  come back.
  */
 void HPC::DistributeDemeToEvaluatorsOp::operate(Deme& ioDeme, Context& ioContext)
 {
@@ -103,6 +153,13 @@ void HPC::DistributeDemeToEvaluatorsOp::operate(Deme& ioDeme, Context& ioContext
 		}
 	}
 
+	if(mComm->getChunkSize() > 0) {
+		ChunkTransport lTransport(*mComm, *lBuffer, ioContext, lNbEvaluators);
+		lBuffer->sendFirstChunks(lTransport, mComm->getChunkSize(), mComm->getChunkTime(), lNbEvaluators);
+		lTransport.waitAll();
+		return;
+	}
+
 	unsigned int lNbIndividualInt = lBuffer->size() / lNbEvaluators;
 	unsigned int lNbIndividualFrac = lBuffer->size() % lNbEvaluators;
 
@@ -117,15 +174,7 @@ void HPC::DistributeDemeToEvaluatorsOp::operate(Deme& ioDeme, Context& ioContext
 		if(i < lNbIndividualFrac)
 			lNbIndividual++;
 
-		std::ostringstream lOutStream;
-		PACC::XML::Streamer lStreamer(lOutStream);
-
-		lStreamer.openTag("Population");
-		for(int j = 0; j < lNbIndividual; ++j){
-			(*lBuffer)[j+lNbIndividualTotal]->write(lStreamer, false);
-		}
-		lStreamer.closeTag();
-		lStreams[i] = lOutStream.str();
+		writeIndividuals(*lBuffer, lNbIndividualTotal, lNbIndividual, mComm->isBinaryTransport(), lStreams[i]);
 		lRequests[i] = new MPICommunication::Request;
 		mComm->sendNonBlocking(lStreams[i], lRequests[i], "Individuals", "Child", i);
 
@@ -140,3 +189,40 @@ void HPC::DistributeDemeToEvaluatorsOp::operate(Deme& ioDeme, Context& ioContext
 	Beagle_StackTraceEndM();
 }
 
+
+/*!
+ *  \brief Write a group of individuals into a message for an evaluator.
+ *  \param inIndividuals Individuals to write from.
+ *  \param inFirst Index of the first individual to write.
+ *  \param inCount Number of individuals to write.
+ *  \param inBinary Whether the binary archive format is used instead of XML.
+ *  \param outMessage Message written.
+ */
+void HPC::DistributeDemeToEvaluatorsOp::writeIndividuals(const std::deque<Individual::Handle>& inIndividuals,
+                                                         unsigned int inFirst,
+                                                         unsigned int inCount,
+                                                         bool inBinary,
+                                                         std::string& outMessage)
+{
+	Beagle_StackTraceBeginM();
+	if(inBinary) {
+		BinaryOutArchive lArchive;
+		lArchive.writeHeader();
+		lArchive.writeUInt(inCount);
+		for(unsigned int j = 0; j < inCount; ++j){
+			lArchive.writeString(inIndividuals[j+inFirst]->getType());
+			inIndividuals[j+inFirst]->writeBinary(lArchive);
+		}
+		outMessage = lArchive.getBuffer();
+	} else {
+		std::ostringstream lOutStream;
+		PACC::XML::Streamer lStreamer(lOutStream);
+		lStreamer.openTag("Population");
+		for(unsigned int j = 0; j < inCount; ++j){
+			inIndividuals[j+inFirst]->write(lStreamer, false);
+		}
+		lStreamer.closeTag();
+		outMessage = lOutStream.str();
+	}
+	Beagle_StackTraceEndM();
+}
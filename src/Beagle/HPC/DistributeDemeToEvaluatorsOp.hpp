@@ -40,6 +40,8 @@
 
 #include "Beagle/HPC.hpp"
 
+#include <deque>
+
 namespace Beagle{
 
 namespace HPC{
@@ -69,7 +71,15 @@ namespace HPC{
 
 		virtual void operate(Deme& ioDeme, Context& ioContext);
 		virtual void init(System& ioSystem);
+
+		static void writeIndividuals(const std::deque<Individual::Handle>& inIndividuals,
+		                             unsigned int inFirst,
+		                             unsigned int inCount,
+		                             bool inBinary,
+		                             std::string& outMessage);
 	protected:
+		class ChunkTransport;
+
 		//! Handle to the MPICommunication component.
 		HPC::MPICommunication::Handle mComm;
 
@@ -46,6 +46,16 @@ HPC::EvaluationOp::EvaluationOp(std::string inName) :
 		Beagle::EvaluationOp(inName)
 { }
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return False, communications with the other nodes are not thread-safe.
+ */
+bool HPC::EvaluationOp::isDemeLocal(void) const
+{
+	return false;
+}
+
+
 /*!
  *  \brief Apply the evaluation process on the invalid individuals of the deme.
  *  \param ioDeme Deme to process.
@@ -63,6 +63,7 @@ public:
 	explicit EvaluationOp(std::string inName="HPC-EvaluationOp");
 	virtual ~EvaluationOp()
 	{ }
+	virtual bool isDemeLocal(void) const;
 	virtual void operate(Deme& ioDeme, Context& ioContext);
 };
 }
@@ -217,12 +217,13 @@ int HPC::MPICommunication::hashTag(const std::string& inTag) const
 /*!
  * \brief Cancel a non-blocking communication request.
  * \param inRequest The communication receipt of the communication to cancel.
+ * A pending request that is cancelled still completes, once, at the next
+ * wait on it. With waitAny, the completion of a cancelled request returns -1.
  */
 void HPC::MPICommunication::cancel(Request::Handle inRequest) const
 {
 	Beagle_StackTraceBeginM();
-	inRequest->mSizeRequest.Cancel();
-	inRequest->mMsgRequest.Cancel();
+	if((inRequest->mType == Request::SENDING) && inRequest->mPending) inRequest->mMsgRequest.Cancel();
 	inRequest->mCancel = true;
 	Beagle_HPC_StackTraceEndM("void HPC::MPICommunication::cancel(Request& inReceipt) const");
 }
@@ -233,8 +234,8 @@ void HPC::MPICommunication::cancel(Request::Handle inRequest) const
  * \param inTag Tag associated to the message.
  * \param inRank Node rank to send message.
  * The function compress the message if the user asked to. It then
- * sends the message size with a MPI blocking Send. Once the size
- * is sent, it sends the message string with a MPI blocking send.
+ * sends the message string with a MPI blocking send. The size of the
+ * message is not sent, the receiver gets it by probing the message.
  */
 void HPC::MPICommunication::send(const std::string& inMessage, const std::string& inTag, int inRank) const
 {
@@ -243,18 +244,12 @@ void HPC::MPICommunication::send(const std::string& inMessage, const std::string
 	if(mCompressionLevel->getWrappedValue() > 0){
 		std::string lCompressMsg;
 		compressString(inMessage, lCompressMsg, mCompressionLevel->getWrappedValue());
-		const int& lSize = lCompressMsg.size();
-		MPI::COMM_WORLD.Send(&lSize, 1, MPI::INT, inRank, hashTag(inTag+"_size"));
-		MPI::COMM_WORLD.Send(&lCompressMsg[0], lSize, MPI::CHAR, inRank, hashTag(inTag+"_str"));
+		MPI::COMM_WORLD.Send(lCompressMsg.data(), (int)lCompressMsg.size(), MPI::CHAR, inRank, hashTag(inTag));
 	} else{
-		const int& lSize = inMessage.size();
-		MPI::COMM_WORLD.Send(&lSize, 1, MPI::INT, inRank, hashTag(inTag+"_size"));
-		MPI::COMM_WORLD.Send(&inMessage[0], lSize, MPI::CHAR, inRank, hashTag(inTag+"_str"));
+		MPI::COMM_WORLD.Send(inMessage.data(), (int)inMessage.size(), MPI::CHAR, inRank, hashTag(inTag));
 	}
 #else
-	const int& lSize = inMessage.size();
-	MPI::COMM_WORLD.Send(&lSize, 1, MPI::INT, inRank, hashTag(inTag+"_size"));
-	MPI::COMM_WORLD.Send(&inMessage[0], lSize, MPI::CHAR, inRank, hashTag(inTag+"_str"));
+	MPI::COMM_WORLD.Send(inMessage.data(), (int)inMessage.size(), MPI::CHAR, inRank, hashTag(inTag));
 #endif // BEAGLE_HAVE_LIBZ
 	Beagle_HPC_StackTraceEndM("void HPC::MPICommunication::send(const std::string&, int, int) const");
 }
@@ -264,27 +259,43 @@ void HPC::MPICommunication::send(const std::string& inMessage, const std::string
  * \param outMessage Message receive.
  * \param inTag Tag associated to the message to be received.
  * \param inRank Node rank of the sending node.
+ * The message is probed to get its size before being received, and
+ * is written in \c outMessage, reusing its storage when possible.
  */
 void HPC::MPICommunication::receive(std::string& outMessage, const std::string& inTag, int inRank) const
 {
 	Beagle_StackTraceBeginM();
 	MPI::Status lStatus;
+	MPI::COMM_WORLD.Probe(inRank,hashTag(inTag),lStatus);
+	receiveProbed(outMessage, lStatus);
+	Beagle_HPC_StackTraceEndM("void HPC::MPICommunication::receive(std::string&, const std::string&, int) const");
+}
 
-	int lSize = 0;
-	MPI::COMM_WORLD.Recv(&lSize, 1, MPI::INT, inRank, hashTag(inTag+"_size"));
-	MPI::COMM_WORLD.Probe(inRank,hashTag(inTag+"_str"),lStatus);
-	Beagle_AssertM(lStatus.Get_count(MPI::CHAR) == lSize);
-	outMessage.resize(lSize);
-	MPI::COMM_WORLD.Recv(&outMessage[0], lSize, MPI::CHAR, lStatus.Get_source(), hashTag(inTag+"_str"));
-
+/*!
+ * \brief Receive a message that has been probed.
+ * \param outMessage Message receive.
+ * \param inStatus Status of the probed message.
+ * Compressed messages are received in a buffer kept from one message to the
+ * next. This saves an allocation per message, but no speedup over a fresh
+ * buffer has been measured: decompression dominates the reception time.
+ */
+void HPC::MPICommunication::receiveProbed(std::string& outMessage, const MPI::Status& inStatus) const
+{
+	Beagle_StackTraceBeginM();
+	const int lSize = inStatus.Get_count(MPI::CHAR);
 #ifdef BEAGLE_HAVE_LIBZ
 	if(mCompressionLevel->getWrappedValue() > 0){
-		std::string lString;
-		decompressString(outMessage, lString);
-		outMessage = lString;
+		mCompressMutex.lock();
+		mCompressBuffer.resize(lSize);
+		MPI::COMM_WORLD.Recv(&mCompressBuffer[0], lSize, MPI::CHAR, inStatus.Get_source(), inStatus.Get_tag());
+		decompressString(mCompressBuffer, outMessage);
+		mCompressMutex.unlock();
+		return;
 	}
 #endif
-	Beagle_HPC_StackTraceEndM("void HPC::MPICommunication::receive(std::string&, const std::string&, int) const");
+	outMessage.resize(lSize);
+	MPI::COMM_WORLD.Recv(&outMessage[0], lSize, MPI::CHAR, inStatus.Get_source(), inStatus.Get_tag());
+	Beagle_HPC_StackTraceEndM("void HPC::MPICommunication::receiveProbed(std::string&, const MPI::Status&) const");
 }
 
 /*!
@@ -292,16 +303,18 @@ void HPC::MPICommunication::receive(std::string& outMessage, const std::string&
  * \param outReq Request corresponding to the non-blocking reception.
  * \param inTag Tag associated to the message.
  * \param inRank Node rank from which message will be received.
+ * No MPI call is made here, the message is probed and received by
+ * the wait functions.
  */
 void HPC::MPICommunication::receiveNonBlocking(Request::Handle outReq, const std::string& inTag, int inRank) const
 {
 	Beagle_StackTraceBeginM();
 	Beagle_NonNullPointerAssertM(outReq);
-	outReq->mSize = 0;
 	outReq->mTag = inTag;
+	outReq->mRank = inRank;
 	outReq->mType = Request::RECEPTION;
-	std::string lSizeTag = inTag + "_size";
-	outReq->mSizeRequest =  MPI::COMM_WORLD.Irecv(&(outReq->mSize), 1, MPI::INT, inRank, hashTag(lSizeTag));
+	outReq->mCancel = false;
+	outReq->mPending = true;
 	Beagle_HPC_StackTraceEndM("void HPC::MPICommunication::receiveNonBlocking(Request::Handle, const std::string&, int) const");
 }
 
@@ -312,11 +325,10 @@ void HPC::MPICommunication::receiveNonBlocking(Request::Handle outReq, const std
  * \param inTag Tag associated to the message.
  * \param inRank Node rank to which message will be sent.
  * The function compress the message \c inMessage if the user asked for compression.
- * It then sends the message size and the message using MPI non blocking send
- * function. The communication Request \c outReq contains both MPI::Request associated
- * to each of the non-blocking send. It also contains the tag, the message and the rank.
- * The request \c outReq can then be used with a wait function to wait until the
- * communication is completed.
+ * It then sends the message using MPI non blocking send function. The communication
+ * Request \c outReq contains the MPI::Request associated to the send. It also contains
+ * the tag, the message and the rank. The request \c outReq can then be used with a
+ * wait function to wait until the communication is completed.
  */
 void HPC::MPICommunication::sendNonBlocking(const std::string& inMessage, Request::Handle outReq, const std::string& inTag, int inRank) const
 {
@@ -324,24 +336,21 @@ void HPC::MPICommunication::sendNonBlocking(const std::string& inMessage, Reques
 	Beagle_NonNullPointerAssertM(outReq);
 #ifdef BEAGLE_HAVE_LIBZ
 	if(mCompressionLevel->getWrappedValue() > 0){
-		outReq->mMessage = new Beagle::String(inMessage);
+		outReq->mMessage = new Beagle::String;
 		compressString(inMessage, outReq->mMessage->getWrappedValue(), mCompressionLevel->getWrappedValue());
-		outReq->mSize = (int)outReq->mMessage->getWrappedValue().size();
 	} else {
-		outReq->mSize = (int)inMessage.size();
 		outReq->mMessage =  new Beagle::String(inMessage);
 	}
 #else
-	outReq->mSize = (int)inMessage.size();
 	outReq->mMessage =  new Beagle::String(inMessage);
 #endif
 	outReq->mTag = inTag;
+	outReq->mRank = inRank;
 	outReq->mType = Request::SENDING;
-	std::string lSizeTag = inTag + "_size";
-	std::string lStringTag = inTag + "_str";
-	outReq->mSizeRequest = MPI::COMM_WORLD.Isend(&(outReq->mSize), 1, MPI::INT, inRank, hashTag(lSizeTag));
+	outReq->mCancel = false;
+	outReq->mPending = true;
 	const std::string& lMsgRef = outReq->mMessage->getWrappedValue();
-	outReq->mMsgRequest = MPI::COMM_WORLD.Isend(&lMsgRef[0], outReq->mSize, MPI::CHAR, inRank, hashTag(lStringTag));
+	outReq->mMsgRequest = MPI::COMM_WORLD.Isend(lMsgRef.data(), (int)lMsgRef.size(), MPI::CHAR, inRank, hashTag(inTag));
 	Beagle_HPC_StackTraceEndM("void HPC::MPICommunication::sendNonBlocking(std::string&, Request::Handle, const std::string&, int) const");
 }
 
@@ -384,75 +393,125 @@ void HPC::MPICommunication::waitAll(Request::Bag& ioRequests) const
 	Beagle_HPC_StackTraceEndM("void HPC::MPICommunication::waitAll(Request::Bag&) const");
 }
 
+/*!
+ * \brief Wait for the completion of any of the pending requests.
+ * \param ioRequests Requests to wait for.
+ * \return Index of the completed request, -1 if a cancelled request completed or if no request is pending.
+ * The pending requests are first tested in turn. If none can complete, the
+ * function blocks in MPI: on a probe of the tag when the pending requests are
+ * all receptions of the same tag, or on MPI::Request::Waitany when they are
+ * all sendings. Other mixes of requests, or a probed message that matches none
+ * of the receptions, are tested again after a pause that grows up to a
+ * millisecond, so that the waiting thread does not spin on a core.
+ * Blocking is meant to leave the core of the waiting node to other work. No
+ * wall-time gain over polling with Iprobe has been demonstrated: on a single
+ * oversubscribed core, Open MPI already yields inside Iprobe and its blocking
+ * Probe polls as well, so both take the same time.
+ */
 int HPC::MPICommunication::waitAny(Request::Bag& ioRequests) const
 {
 	Beagle_StackTraceBeginM();
-	unsigned int lSize = ioRequests.size();
-	std::vector<MPI::Request> lRequests;
-	lRequests.reserve(lSize);
-	for(unsigned int i = 0; i < lSize; ++i){
-		lRequests.push_back(ioRequests[i]->mSizeRequest);
-	}
 	MPI::Status lStatus;
-	int lIndex = MPI::Request::Waitany(lSize, &lRequests[0], lStatus);
-	ioRequests[lIndex]->mSizeRequest = lRequests[lIndex];
-	if(lStatus.Is_cancelled()) return -1;
-
-	if(ioRequests[lIndex]->mType == Request::RECEPTION){
-		int lRank = lStatus.Get_source();
-		std::string lStringTag = ioRequests[lIndex]->mTag + "_str";
-		int lMsgSize = ioRequests[lIndex]->mSize;
-		MPI::COMM_WORLD.Probe(lRank,hashTag(lStringTag),lStatus);
-		Beagle_AssertM(lStatus.Get_count(MPI::CHAR) == lMsgSize);
-
-		//constructing a string of the right size.
-		std::string lMsg(lMsgSize,' ');
-		MPI::COMM_WORLD.Recv(&lMsg[0], lMsgSize, MPI::CHAR, lRank, hashTag(lStringTag));
-#ifdef BEAGLE_HAVE_LIBZ
-		if(mCompressionLevel->getWrappedValue() > 0){
-			ioRequests[lIndex]->mMessage = new Beagle::String;
-			decompressString(lMsg, ioRequests[lIndex]->mMessage->getWrappedValue());
-		} else {
-			ioRequests[lIndex]->mMessage = new Beagle::String(lMsg);
+	double lPause = 1e-5;
+	while(true) {
+		int lTag = 0;
+		int lRank = MPI::ANY_SOURCE;
+		unsigned int lNbReceptions = 0;
+		unsigned int lNbSendings = 0;
+		bool lSameTag = true;
+		for(unsigned int i = 0; i < ioRequests.size(); ++i){
+			Beagle_NonNullPointerAssertM(ioRequests[i]);
+			if(ioRequests[i]->mPending == false) continue;
+			if(ioRequests[i]->mCancel) {
+				if(ioRequests[i]->mType == Request::SENDING) ioRequests[i]->mMsgRequest.Wait();
+				ioRequests[i]->mPending = false;
+				return -1;
+			}
+			if(ioRequests[i]->mType == Request::RECEPTION){
+				const int lRequestTag = hashTag(ioRequests[i]->mTag);
+				if(MPI::COMM_WORLD.Iprobe(ioRequests[i]->mRank, lRequestTag, lStatus)) {
+					receiveRequest(ioRequests[i], lStatus);
+					return i;
+				}
+				if(lNbReceptions == 0) {
+					lTag = lRequestTag;
+					lRank = ioRequests[i]->mRank;
+				} else {
+					if(lRequestTag != lTag) lSameTag = false;
+					if(ioRequests[i]->mRank != lRank) lRank = MPI::ANY_SOURCE;
+				}
+				++lNbReceptions;
+			} else if(ioRequests[i]->mType == Request::SENDING){
+				if(ioRequests[i]->mMsgRequest.Test()) {
+					ioRequests[i]->mPending = false;
+					return i;
+				}
+				++lNbSendings;
+			} else {
+				throw RunTimeException("MPI::Communication::waitAny(Request&) the request"+uint2str(i)+
+						       " is invalid",__FILE__,__LINE__);
+			}
 		}
-#else
-		ioRequests[lIndex]->mMessage = new Beagle::String(lMsg);
-#endif
-	} else if(ioRequests[lIndex]->mType == Request::SENDING){
-		ioRequests[lIndex]->mMsgRequest.Wait();
-	} else {
-		throw RunTimeException("MPI::Communication::waitAll(Request&) the request"+uint2str(lIndex)+
-				       " is invalid",__FILE__,__LINE__);
+		if((lNbReceptions == 0) && (lNbSendings == 0)) return -1;
+
+		if(lNbReceptions == 0) {
+			// Only sendings, block on them
+			std::vector<MPI::Request> lRequests;
+			std::vector<unsigned int> lIndices;
+			for(unsigned int i = 0; i < ioRequests.size(); ++i){
+				if(ioRequests[i]->mPending == false) continue;
+				lRequests.push_back(ioRequests[i]->mMsgRequest);
+				lIndices.push_back(i);
+			}
+			const int lIndex = MPI::Request::Waitany(lRequests.size(), &lRequests[0]);
+			ioRequests[lIndices[lIndex]]->mMsgRequest = lRequests[lIndex];
+			ioRequests[lIndices[lIndex]]->mPending = false;
+			return lIndices[lIndex];
+		}
+
+		if((lNbSendings == 0) && lSameTag) {
+			// Only receptions of one tag, block on a probe and find the request of the message
+			MPI::COMM_WORLD.Probe(lRank, lTag, lStatus);
+			for(unsigned int i = 0; i < ioRequests.size(); ++i){
+				if((ioRequests[i]->mPending == false) || ioRequests[i]->mCancel) continue;
+				if((ioRequests[i]->mRank != MPI::ANY_SOURCE) && (ioRequests[i]->mRank != lStatus.Get_source())) continue;
+				receiveRequest(ioRequests[i], lStatus);
+				return i;
+			}
+		}
+
+		PACC::Threading::Thread::sleep(lPause);
+		if(lPause < 1e-3) lPause *= 2.0;
 	}
-	return lIndex;
 	Beagle_HPC_StackTraceEndM("int HPC::MPICommunication::waitAny(Request::Bag&) const");
 }
 
+/*!
+ * \brief Receive the probed message of a pending reception request.
+ * \param ioRequest Reception request completed.
+ * \param inStatus Status of the probed message.
+ */
+void HPC::MPICommunication::receiveRequest(Request::Handle ioRequest, const MPI::Status& inStatus) const
+{
+	Beagle_StackTraceBeginM();
+	if(ioRequest->mMessage == NULL) ioRequest->mMessage = new Beagle::String;
+	receiveProbed(ioRequest->mMessage->getWrappedValue(), inStatus);
+	ioRequest->mPending = false;
+	Beagle_HPC_StackTraceEndM("void HPC::MPICommunication::receiveRequest(Request::Handle, const MPI::Status&) const");
+}
+
 void HPC::MPICommunication::waitReception(Request::Handle ioRequest) const
 {
 	Beagle_StackTraceBeginM();
 	Beagle_NonNullPointerAssertM(ioRequest);
-	MPI::Status lStatus;
-	ioRequest->mSizeRequest.Wait(lStatus);
-	if(lStatus.Is_cancelled()) return;
-	int lRank = lStatus.Get_source();
-	int lMsgSize = ioRequest->mSize;
-	std::string lStringTag = ioRequest->mTag + "_str";
-	MPI::COMM_WORLD.Probe(lRank,hashTag(lStringTag),lStatus);
-	Beagle_AssertM(lStatus.Get_count(MPI::CHAR) == lMsgSize);
-	//constructing a string of the right size.
-	std::string lMsg(lMsgSize, ' ');
-	MPI::COMM_WORLD.Recv(&lMsg[0], lMsgSize, MPI::CHAR, lRank, hashTag(lStringTag));
-#ifdef BEAGLE_HAVE_LIBZ
-	if(mCompressionLevel->getWrappedValue() > 0){
-		ioRequest->mMessage = new Beagle::String;
-		decompressString(lMsg, ioRequest->mMessage->getWrappedValue());
-	} else {
-		ioRequest->mMessage = new Beagle::String(lMsg);
+	if(ioRequest->mPending == false) return;
+	if(ioRequest->mCancel) {
+		ioRequest->mPending = false;
+		return;
 	}
-#else
-	ioRequest->mMessage = new Beagle::String(lMsg);
-#endif
+	MPI::Status lStatus;
+	MPI::COMM_WORLD.Probe(ioRequest->mRank,hashTag(ioRequest->mTag),lStatus);
+	receiveRequest(ioRequest, lStatus);
 	Beagle_HPC_StackTraceEndM("void HPC::MPICommunication::waitReception(Request::Handle) const");
 }
 
@@ -460,11 +519,10 @@ void HPC::MPICommunication::waitSending(Request::Handle ioRequest) const
 {
 	Beagle_StackTraceBeginM();
 	Beagle_NonNullPointerAssertM(ioRequest);
-	MPI::Status lStatus;
-	ioRequest->mSizeRequest.Wait(lStatus);
-	if(lStatus.Is_cancelled()) return;
+	if(ioRequest->mPending == false) return;
 	ioRequest->mMsgRequest.Wait();
-	Beagle_HPC_StackTraceEndM("void HPC::MPICommunication::waitReception(Request::Handle) const");
+	ioRequest->mPending = false;
+	Beagle_HPC_StackTraceEndM("void HPC::MPICommunication::waitSending(Request::Handle) const");
 }
 
 /*!
@@ -473,6 +531,9 @@ void HPC::MPICommunication::waitSending(Request::Handle ioRequest) const
  *
  *  This method registers the following parameter:
  *   - hpc.node.nbevolver
+ *   - hpc.comm.binary
+ *   - hpc.distribute.chunksize
+ *   - hpc.distribute.chunktime
  */
 void HPC::MPICommunication::registerParams(Beagle::System& ioSystem)
 {
@@ -487,6 +548,36 @@ void HPC::MPICommunication::registerParams(Beagle::System& ioSystem)
 		mNbEvolvers = castHandleT<UInt>(
 		ioSystem.getRegister().insertEntry("hpc.evolver.nb", new UInt(1), lDescription));
 	}
+	{
+		Register::Description lDescription(
+		"Binary transport of individuals.",
+		"Bool",
+		"1",
+		"If true, individuals and fitness sent between evolvers and evaluators are serialized using the compact binary archive format. Otherwise, they are sent as XML."
+		);
+		mBinaryTransport = castHandleT<Bool>(
+		ioSystem.getRegister().insertEntry("hpc.comm.binary", new Bool(true), lDescription));
+	}
+	{
+		Register::Description lDescription(
+		"Chunk size of pulled individuals.",
+		"UInt",
+		"0",
+		"Number of individuals sent at once to an evaluator node that asks for work. If 0, the individuals to evaluate are rather split statically in equal parts between the evaluators."
+		);
+		mChunkSize = castHandleT<UInt>(
+		ioSystem.getRegister().insertEntry("hpc.distribute.chunksize", new UInt(0), lDescription));
+	}
+	{
+		Register::Description lDescription(
+		"Targeted evaluation time of a chunk.",
+		"Double",
+		"0",
+		"Targeted evaluation time, in seconds, of a chunk of individuals pulled by an evaluator. If greater than 0, the chunk size is adapted to the measured evaluation latency of the individuals, starting from hpc.distribute.chunksize individuals. Used only when hpc.distribute.chunksize is greater than 0."
+		);
+		mChunkTime = castHandleT<Double>(
+		ioSystem.getRegister().insertEntry("hpc.distribute.chunktime", new Double(0.0), lDescription));
+	}
 #ifdef BEAGLE_HAVE_LIBZ
 	{
 		std::ostringstream lOSS;
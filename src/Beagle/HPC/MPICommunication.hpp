@@ -66,16 +66,16 @@ public:
 			typedef AllocatorT< Request, Object::Alloc > Alloc;
 			typedef PointerT< Request, Object::Handle > Handle;
 			typedef ContainerT< Request, Object::Bag > Bag;
-			Request(void) : mSize(0),mCancel(false) {}
+			Request(void) : mRank(0),mCancel(false),mPending(false),mType(RECEPTION) {}
 			~Request(void) {}
 			inline bool isCancelled(){ return mCancel; }
 			inline const Beagle::String::Handle getMessage() const { return mMessage; }
 		protected:
-			MPI::Request mSizeRequest;
 			MPI::Request mMsgRequest;
 			std::string mTag;
-			int mSize;
+			int mRank;
 			bool mCancel;
+			bool mPending;
 			Beagle::String::Handle mMessage;
 			enum eCommType {RECEPTION, SENDING};
 			eCommType mType;
@@ -111,6 +111,27 @@ public:
 		MPI::COMM_WORLD.Barrier();
 	}
 
+	//! Return the number of individuals per chunk pulled by evaluators, 0 for static distribution.
+	inline unsigned int getChunkSize() const {
+		Beagle_StackTraceBeginM();
+		return (mChunkSize == NULL) ? 0 : mChunkSize->getWrappedValue();
+		Beagle_StackTraceEndM();
+	}
+
+	//! Return the targeted evaluation time of a chunk, in seconds, 0 for fixed-size chunks.
+	inline double getChunkTime() const {
+		Beagle_StackTraceBeginM();
+		return (mChunkTime == NULL) ? 0.0 : mChunkTime->getWrappedValue();
+		Beagle_StackTraceEndM();
+	}
+
+	//! Return whether individuals and fitness are exchanged using the binary archive format.
+	inline bool isBinaryTransport() const {
+		Beagle_StackTraceBeginM();
+		return (mBinaryTransport != NULL) && mBinaryTransport->getWrappedValue();
+		Beagle_StackTraceEndM();
+	}
+
 	//! Return the number nodes with the relation type \c inRelationType.
 	inline unsigned int getNbrOfRelation(const std::string& inRelationType) const {
 		Beagle_StackTraceBeginM();
@@ -231,6 +252,8 @@ protected:
 
 	void waitReception(Request::Handle) const;
 	void waitSending(Request::Handle) const;
+	void receiveProbed(std::string& outMessage, const MPI::Status& inStatus) const;
+	void receiveRequest(Request::Handle ioRequest, const MPI::Status& inStatus) const;
 
 	//! Produce an integer tag from an string tag.
 	int hashTag(const std::string& inTag) const;
@@ -253,6 +276,9 @@ protected:
 	std::string mNodeType;
 	UInt::Handle mNodeRank;
 	UInt::Handle mNbEvolvers;
+	Bool::Handle mBinaryTransport;
+	UInt::Handle mChunkSize;
+	Double::Handle mChunkTime;
 
 	int mTagUpperBound;
 	bool mMultipleThreads;
@@ -261,6 +287,8 @@ protected:
 	void compressString(const std::string& inString, std::string& outCompress, int inLevel = Z_BEST_COMPRESSION) const;
 	void decompressString(const std::string& inCompress, std::string& outString) const;
 	UInt::Handle mCompressionLevel;
+	mutable std::string mCompressBuffer;           //!< Buffer reused for the compressed messages received.
+	mutable PACC::Threading::Mutex mCompressMutex; //!< Mutex of the compressed messages buffer.
 #endif //BEAGLE_HAVE_LIBZ
 
 private:
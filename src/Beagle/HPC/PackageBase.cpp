@@ -70,6 +70,8 @@ void HPC::PackageBase::configure(System& ioSystem)
 	lFactory.insertAllocator("Beagle::HPC::LoggerXMLD", new HPC::LoggerXMLD::Alloc);
 	lFactory.insertAllocator("Beagle::HPC::Randomizer", new HPC::Randomizer::Alloc);
 	lFactory.insertAllocator("Beagle::HPC::AlgoSequential", new HPC::AlgoSequential::Alloc);
+	lFactory.insertAllocator("Beagle::HPC::AlgoAsynchronous", new HPC::AlgoAsynchronous::Alloc);
+	lFactory.insertAllocator("Beagle::HPC::AsyncSteadyStateOp", new HPC::AsyncSteadyStateOp::Alloc);
 
 	// Aliases to short name of operators
 	lFactory.aliasAllocator("Beagle::HPC::DistributeDemeToEvaluatorsOp", "HPC-DistributeDemeToEvaluatorsOp");
@@ -85,6 +87,8 @@ void HPC::PackageBase::configure(System& ioSystem)
  	lFactory.aliasAllocator("Beagle::HPC::LoggerXMLD", "HPC-LoggerXMLD");
 	lFactory.aliasAllocator("Beagle::HPC::Randomizer", "HPC-Randomizer");
 	lFactory.aliasAllocator("Beagle::HPC::AlgoSequential", "HPC-AlgoSequential");
+	lFactory.aliasAllocator("Beagle::HPC::AlgoAsynchronous", "HPC-AlgoAsynchronous");
+	lFactory.aliasAllocator("Beagle::HPC::AsyncSteadyStateOp", "HPC-AsyncSteadyStateOp");
 	lFactory.aliasAllocator("Beagle::HPC::SwitchTypeOp", "SwitchTypeOp");
 
 	// Set some basic concept-type associations in factory
@@ -64,7 +64,9 @@ public:
 	typedef ContainerT<ProcessingBuffer,Member::Bag> Bag;
 
 	//! Construct migration buffer
-	ProcessingBuffer()
+	ProcessingBuffer() :
+		mNextIndex(0),
+		mLatency(0.0)
 	{ }
 	virtual ~ProcessingBuffer()
 	{ }
@@ -77,9 +79,158 @@ public:
 	inline void clear()
 	{
 		mIndividualIndex.clear();
+		mNextIndex = 0;
+		mChunkFirst.clear();
+		mChunkCount.clear();
+		mChunkStart.clear();
 		std::deque<Individual::Handle>::clear();
 	}
 
+	/*!
+	 *  \brief Assign the next individuals of the buffer to an evaluator.
+	 *  \param inEvaluator Index of the evaluator.
+	 *  \param inMaxSize Maximum number of individuals assigned.
+	 *  \return Number of individuals assigned, 0 if all individuals were already assigned.
+	 */
+	inline unsigned int assignChunk(unsigned int inEvaluator, unsigned int inMaxSize)
+	{
+		if(inEvaluator >= mChunkFirst.size()) {
+			mChunkFirst.resize(inEvaluator+1, 0);
+			mChunkCount.resize(inEvaluator+1, 0);
+			mChunkStart.resize(inEvaluator+1, 0.0);
+		}
+		const unsigned int lCount = (inMaxSize < getNbRemaining()) ? inMaxSize : getNbRemaining();
+		mChunkFirst[inEvaluator] = mNextIndex;
+		mChunkCount[inEvaluator] = lCount;
+		mChunkStart[inEvaluator] = getTime();
+		mNextIndex += lCount;
+		return lCount;
+	}
+
+	/*!
+	 *  \brief Compute the size of the next chunk to assign.
+	 *  \param inChunkSize Fixed chunk size, used as initial size for adaptive chunks.
+	 *  \param inChunkTime Targeted evaluation time of a chunk, 0 for fixed-size chunks.
+	 *  \param inNbEvaluators Number of evaluators.
+	 *
+	 *  Adaptive chunks are sized from the measured latency per individual, and never exceed
+	 *  a fair share of the remaining individuals, so that the chunks get smaller at the end
+	 *  of the generation.
+	 */
+	inline unsigned int computeChunkSize(unsigned int inChunkSize, double inChunkTime, unsigned int inNbEvaluators) const
+	{
+		if(inChunkTime <= 0.0) return inChunkSize;
+		unsigned int lSize = inChunkSize;
+		if(mLatency > 0.0) lSize = (unsigned int)(inChunkTime / mLatency + 0.5);
+		return capChunkSize(lSize, getNbRemaining(), inNbEvaluators);
+	}
+
+	/*!
+	 *  \brief Cap a chunk size to a fair share of the individuals left.
+	 *  \param inChunkSize Chunk size to cap.
+	 *  \param inNbRemaining Number of individuals left to assign.
+	 *  \param inNbEvaluators Number of evaluators.
+	 *  \return Chunk size capped, at least 1.
+	 *
+	 *  Sharing the last individuals between all the evaluators shortens the time during
+	 *  which the evaluators done with the generation wait for the last chunk to come back.
+	 */
+	static inline unsigned int capChunkSize(unsigned int inChunkSize, unsigned int inNbRemaining, unsigned int inNbEvaluators)
+	{
+		const unsigned int lFairShare = (inNbRemaining + inNbEvaluators - 1) / inNbEvaluators;
+		if(inChunkSize > lFairShare) inChunkSize = lFairShare;
+		return (inChunkSize == 0) ? 1 : inChunkSize;
+	}
+
+	//! Return the index of the first individual of the chunk assigned to an evaluator.
+	inline unsigned int getChunkFirst(unsigned int inEvaluator) const
+	{
+		return (inEvaluator < mChunkFirst.size()) ? mChunkFirst[inEvaluator] : 0;
+	}
+
+	//! Return the number of individuals of the chunk assigned to an evaluator.
+	inline unsigned int getChunkCount(unsigned int inEvaluator) const
+	{
+		return (inEvaluator < mChunkCount.size()) ? mChunkCount[inEvaluator] : 0;
+	}
+
+	//! Return the moving average of the latency per individual, 0 if not measured yet.
+	inline double getLatency() const
+	{
+		return mLatency;
+	}
+
+	//! Return the number of individuals not yet assigned to an evaluator.
+	inline unsigned int getNbRemaining() const
+	{
+		return size() - mNextIndex;
+	}
+
+	/*!
+	 *  \brief Update the latency per individual with the chunk completed by an evaluator.
+	 *  \param inEvaluator Index of the evaluator that completed its chunk.
+	 */
+	inline void updateLatency(unsigned int inEvaluator)
+	{
+		if(getChunkCount(inEvaluator) == 0) return;
+		const double lLatency = (getTime() - mChunkStart[inEvaluator]) / mChunkCount[inEvaluator];
+		mLatency = (mLatency > 0.0) ? (0.75*mLatency + 0.25*lLatency) : lLatency;
+	}
+
+	/*!
+	 *  \brief Assign and send a first chunk to each evaluator.
+	 *  \param ioTransport Transport of the chunks to the evaluators.
+	 *  \param inChunkSize Fixed chunk size, used as initial size for adaptive chunks.
+	 *  \param inChunkTime Targeted evaluation time of a chunk, 0 for fixed-size chunks.
+	 *  \param inNbEvaluators Number of evaluators.
+	 *
+	 *  The transport must provide a method sendChunk(evaluator, first, count). Evaluators
+	 *  left without individuals are sent an empty chunk, which ends their generation.
+	 */
+	template <class TransportT>
+	void sendFirstChunks(TransportT& ioTransport, unsigned int inChunkSize, double inChunkTime, unsigned int inNbEvaluators)
+	{
+		for(unsigned int i=0; i<inNbEvaluators; ++i) {
+			const unsigned int lCount = assignChunk(i, computeChunkSize(inChunkSize, inChunkTime, inNbEvaluators));
+			ioTransport.sendChunk(i, getChunkFirst(i), lCount);
+		}
+	}
+
+	/*!
+	 *  \brief Collect the results of the chunks sent, answering each of them with the next chunk.
+	 *  \param ioTransport Transport of the chunks to the evaluators.
+	 *  \param inChunkSize Fixed chunk size, used as initial size for adaptive chunks.
+	 *  \param inChunkTime Targeted evaluation time of a chunk, 0 for fixed-size chunks.
+	 *  \param inNbEvaluators Number of evaluators.
+	 *
+	 *  Besides sendChunk, the transport must provide the methods receiveChunk(evaluator), to
+	 *  start the reception of the results of the chunk of an evaluator, waitChunk(), to wait
+	 *  for any started reception and return the index of its evaluator, and readChunk(evaluator),
+	 *  to read the results received. The method returns once every evaluator was sent an
+	 *  empty chunk.
+	 */
+	template <class TransportT>
+	void pullChunks(TransportT& ioTransport, unsigned int inChunkSize, double inChunkTime, unsigned int inNbEvaluators)
+	{
+		unsigned int lNbActive = 0;
+		for(unsigned int i=0; i<inNbEvaluators; ++i) {
+			if(getChunkCount(i) > 0) {
+				ioTransport.receiveChunk(i);
+				++lNbActive;
+			}
+		}
+		while(lNbActive > 0) {
+			const unsigned int lEvaluator = ioTransport.waitChunk();
+			updateLatency(lEvaluator);
+			ioTransport.readChunk(lEvaluator);
+			const unsigned int lCount =
+				assignChunk(lEvaluator, computeChunkSize(inChunkSize, inChunkTime, inNbEvaluators));
+			ioTransport.sendChunk(lEvaluator, getChunkFirst(lEvaluator), lCount);
+			if(lCount > 0) ioTransport.receiveChunk(lEvaluator);
+			else --lNbActive;
+		}
+	}
+
 	inline void push_back(Individual::Handle inIndiv, unsigned int inIndex)
 	{
 		std::deque<Individual::Handle>::push_back(inIndiv);
@@ -115,8 +266,20 @@ public:
 	}
 
 protected:
+	//! Return the current time, in seconds, used to measure the latencies.
+	virtual double getTime() const
+	{
+		return mTimer.getValue();
+	}
+
 	void push_back(Individual::Handle) ;
 	UIntArray mIndividualIndex;
+	unsigned int              mNextIndex;   //!< Index of the first individual not assigned.
+	std::vector<unsigned int> mChunkFirst;  //!< First individual of the chunk of each evaluator.
+	std::vector<unsigned int> mChunkCount;  //!< Size of the chunk of each evaluator.
+	std::vector<double>       mChunkStart;  //!< Time at which the chunk of each evaluator was sent.
+	double                    mLatency;     //!< Moving average of the latency per individual.
+	PACC::Timer               mTimer;       //!< Timer used to measure the latencies.
 
 };
 }
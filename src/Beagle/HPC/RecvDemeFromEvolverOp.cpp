@@ -67,6 +67,16 @@ void HPC::RecvDemeFromEvolverOp::init(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return False, communications with the other nodes are not thread-safe.
+ */
+bool HPC::RecvDemeFromEvolverOp::isDemeLocal(void) const
+{
+	return false;
+}
+
+
 /*!
  *  \brief Receive a deme content from an evolver node.
  *  \param ioDeme Deme to update by the receive deme.
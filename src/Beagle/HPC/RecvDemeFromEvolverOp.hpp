@@ -63,6 +63,7 @@ public:
 	virtual ~RecvDemeFromEvolverOp() {}
 
 	Beagle::Fitness::Handle evaluate(Individual& inIndividual, Context& ioContext);
+	virtual bool isDemeLocal(void) const;
 	virtual void operate(Deme& ioDeme, Context& ioContext);
 
 	virtual void init(System& ioSystem);
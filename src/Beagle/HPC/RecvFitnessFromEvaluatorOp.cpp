@@ -39,6 +39,60 @@
 
 using namespace Beagle;
 
+
+/*!
+ *  \class HPC::RecvFitnessFromEvaluatorOp::ChunkTransport
+ *  \brief MPI transport of the chunks pulled by the evaluators, used by ProcessingBuffer::pullChunks.
+ */
+class HPC::RecvFitnessFromEvaluatorOp::ChunkTransport {
+public:
+	ChunkTransport(RecvFitnessFromEvaluatorOp& ioOp, ProcessingBuffer& ioBuffer, Context& ioContext) :
+		mOp(ioOp),
+		mBuffer(ioBuffer),
+		mContext(ioContext)
+	{ }
+
+	//! Send a chunk of individuals to an evaluator, an empty chunk ends its generation.
+	void sendChunk(unsigned int inEvaluator, unsigned int inFirst, unsigned int inCount)
+	{
+		DistributeDemeToEvaluatorsOp::writeIndividuals(mBuffer, inFirst, inCount,
+		                                               mOp.mComm->isBinaryTransport(), mOp.mMessage);
+		mOp.mComm->send(mOp.mMessage, "Individuals", "Child", inEvaluator);
+	}
+
+	//! Start the reception of the fitness of the chunk of an evaluator.
+	void receiveChunk(unsigned int inEvaluator)
+	{
+		mOp.mComm->receiveNonBlocking(mOp.mRequests[inEvaluator], "Fitness", "Child", inEvaluator);
+	}
+
+	//! Wait for the fitness of any chunk, and return the index of its evaluator.
+	unsigned int waitChunk()
+	{
+		int lIndex = mOp.mComm->waitAny(mOp.mRequests);
+		if(lIndex < 0) throw Beagle_RunTimeExceptionM("Reception of fitness from an evaluator was cancelled!");
+		return lIndex;
+	}
+
+	//! Read the fitness of the chunk of an evaluator.
+	void readChunk(unsigned int inEvaluator)
+	{
+		mOp.readFitness(mOp.mRequests[inEvaluator]->getMessage()->getWrappedValue(),
+		                mBuffer.getChunkFirst(inEvaluator), mBuffer, mContext);
+		Beagle_LogDetailedM(
+			mContext.getSystem().getLogger(),
+			std::string("Evolver receive fitness of a chunk from his ")+uint2ordinal(inEvaluator+1)+
+			std::string(" evaluator") + std::string(" of ") + uint2str(mOp.mRequests.size())
+		);
+	}
+
+private:
+	RecvFitnessFromEvaluatorOp& mOp;
+	ProcessingBuffer&           mBuffer;
+	Context&                    mContext;
+};
+
+
 /*!
  *  \brief Construct the RecvFitnessFromEvaluatorOp evaluation operator.
  *  \param inName Name of the operator.
@@ -67,6 +121,16 @@ Fitness::Handle HPC::RecvFitnessFromEvaluatorOp::evaluate(Individual& inIndividu
 	Beagle_StackTraceEndM();
 }
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return False, communications with the other nodes are not thread-safe.
+ */
+bool HPC::RecvFitnessFromEvaluatorOp::isDemeLocal(void) const
+{
+	return false;
+}
+
+
 /*!
  *  \brief Receive the fitness of an individuals group from evaluator node.
  *  \param ioDeme Deme to update by the receive fitness.
@@ -86,39 +150,27 @@ void HPC::RecvFitnessFromEvaluatorOp::operate(Deme& ioDeme, Context& ioContext)
 
 	unsigned int lNbEvaluators = mComm->getNbrOfRelation("Child");
 
-	unsigned int lNbIndividualInt = lBuffer->size() / lNbEvaluators;
-	unsigned int lNbIndividualFrac = lBuffer->size() % lNbEvaluators;
-
-	unsigned int lNbIndividualTotal = 0;
-
-	for(int i = 0; i < lNbEvaluators; ++i ){
-		int lNbIndividual = lNbIndividualInt;
-		if(i < lNbIndividualFrac)
-			++lNbIndividual;
-		std::string lFitnessString;
-
-		mComm->receive(lFitnessString, "Fitness", "Child", i);
+	if(mComm->getChunkSize() > 0) {
+		// Pull mode, each fitness message is answered by the next chunk of individuals
+		if(mRequests.size() != lNbEvaluators) {
+			mRequests.resize(lNbEvaluators);
+			for(unsigned int i = 0; i < lNbEvaluators; ++i) mRequests[i] = new MPICommunication::Request;
+		}
+		ChunkTransport lTransport(*this, *lBuffer, ioContext);
+		lBuffer->pullChunks(lTransport, mComm->getChunkSize(), mComm->getChunkTime(), lNbEvaluators);
+	} else {
+		unsigned int lNbIndividualTotal = 0;
 
-		Beagle_LogDetailedM(
-			ioContext.getSystem().getLogger(),
-			std::string("Evolver receive fitness from his ")+uint2ordinal(i+1)+
-			std::string(" evaluator") + std::string(" of ") + uint2str(lNbEvaluators)
-		);
+		for(unsigned int i = 0; i < lNbEvaluators; ++i){
+			mComm->receive(mMessage, "Fitness", "Child", i);
 
-		std::istringstream lInStream(lFitnessString);
-		PACC::XML::Document lDocument(lInStream);
+			Beagle_LogDetailedM(
+				ioContext.getSystem().getLogger(),
+				std::string("Evolver receive fitness from his ")+uint2ordinal(i+1)+
+				std::string(" evaluator") + std::string(" of ") + uint2str(lNbEvaluators)
+			);
 
-		const Factory& lFactory = ioContext.getSystem().getFactory();
-		Fitness::Alloc::Handle lFitnessAlloc =
-				castHandleT<Fitness::Alloc>(lFactory.getConceptAllocator("Fitness"));
-		for(PACC::XML::ConstIterator lIter = lDocument.getFirstRoot()->getFirstChild(); lIter; ++lIter){
-			ioContext.setIndividualIndex(lNbIndividualTotal);
-			ioContext.setIndividualHandle(ioDeme[lNbIndividualTotal]);
-			if((*lBuffer)[lNbIndividualTotal]->getFitness() == 0)
-				(*lBuffer)[lNbIndividualTotal]->setFitness( castHandleT<Fitness>(lFitnessAlloc->allocate()) );
-			(*lBuffer)[lNbIndividualTotal]->getFitness()->read(lIter);
-			++lNbIndividualTotal;
-			updateStats(1,ioContext);
+			lNbIndividualTotal += readFitness(mMessage, lNbIndividualTotal, *lBuffer, ioContext);
 		}
 	}
 	Beagle_LogDetailedM(
@@ -131,3 +183,54 @@ void HPC::RecvFitnessFromEvaluatorOp::operate(Deme& ioDeme, Context& ioContext)
 	Beagle_StackTraceEndM();
 }
 
+
+/*!
+ *  \brief Read the fitness of a group of individuals sent by an evaluator.
+ *  \param inMessage Message received from the evaluator.
+ *  \param inFirst Index in the processing buffer of the first individual of the group.
+ *  \param ioBuffer Processing buffer of the individuals sent to the evaluators.
+ *  \param ioContext Current context of the evolution.
+ *  \return Number of fitness read.
+ */
+unsigned int HPC::RecvFitnessFromEvaluatorOp::readFitness(const std::string& inMessage,
+                                                          unsigned int inFirst,
+                                                          ProcessingBuffer& ioBuffer,
+                                                          Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	const Factory& lFactory = ioContext.getSystem().getFactory();
+	Fitness::Alloc::Handle lFitnessAlloc =
+			castHandleT<Fitness::Alloc>(lFactory.getConceptAllocator("Fitness"));
+	unsigned int lNbIndividualTotal = inFirst;
+	if(mComm->isBinaryTransport()) {
+		BinaryInArchive lArchive(inMessage);
+		lArchive.readHeader();
+		const unsigned int lNbFitness = lArchive.readUInt();
+		for(unsigned int j = 0; j < lNbFitness; ++j){
+			const unsigned int lIndex = inFirst + lArchive.readUInt();
+			if(lIndex >= ioBuffer.size())
+				throw Beagle_IOExceptionMessageM("index of fitness received is out of the processing buffer!");
+			ioContext.setIndividualIndex(ioBuffer.getIndex()[lIndex]);
+			ioContext.setIndividualHandle(ioBuffer[lIndex]);
+			if(ioBuffer[lIndex]->getFitness() == 0)
+				ioBuffer[lIndex]->setFitness( castHandleT<Fitness>(lFitnessAlloc->allocate()) );
+			ioBuffer[lIndex]->getFitness()->readBinary(lArchive, ioContext);
+			++lNbIndividualTotal;
+			updateStats(1,ioContext);
+		}
+	} else {
+		std::istringstream lInStream(inMessage);
+		PACC::XML::Document lDocument(lInStream);
+		for(PACC::XML::ConstIterator lIter = lDocument.getFirstRoot()->getFirstChild(); lIter; ++lIter){
+			ioContext.setIndividualIndex(ioBuffer.getIndex()[lNbIndividualTotal]);
+			ioContext.setIndividualHandle(ioBuffer[lNbIndividualTotal]);
+			if(ioBuffer[lNbIndividualTotal]->getFitness() == 0)
+				ioBuffer[lNbIndividualTotal]->setFitness( castHandleT<Fitness>(lFitnessAlloc->allocate()) );
+			ioBuffer[lNbIndividualTotal]->getFitness()->read(lIter);
+			++lNbIndividualTotal;
+			updateStats(1,ioContext);
+		}
+	}
+	return lNbIndividualTotal - inFirst;
+	Beagle_StackTraceEndM();
+}
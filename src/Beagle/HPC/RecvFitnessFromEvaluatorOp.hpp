@@ -41,6 +41,9 @@ namespace Beagle {
 
 namespace HPC {
 
+	// Forward declaration
+	class ProcessingBuffer;
+
 	/*!
 	 *  \class RecvFitnessFromEvaluatorOp beagle/HPC/RecvFitnessFromEvaluatorOp.hpp "beagle/HPC/RecvFitnessFromEvaluatorOp.hpp"
 	 *  \brief Reception of groups of individuals fitness from evaluators childs.
@@ -62,11 +65,21 @@ namespace HPC {
 		virtual ~RecvFitnessFromEvaluatorOp() { }
 		
 		virtual Beagle::Fitness::Handle evaluate(Individual& inIndividual, Context& ioContext);
+		virtual bool isDemeLocal(void) const;
 		virtual void operate(Deme& ioDeme, Context& ioContext);
 		
 		virtual void init(System& ioSystem);
 	protected:
+		class ChunkTransport;
+
+		unsigned int readFitness(const std::string& inMessage,
+		                         unsigned int inFirst,
+		                         ProcessingBuffer& ioBuffer,
+		                         Context& ioContext);
+
 		HPC::MPICommunication::Handle mComm;
+		MPICommunication::Request::Bag mRequests;  //!< Reception requests reused for pulled chunks.
+		std::string mMessage;                      //!< Buffer reused for the messages.
 	};
 }
 }
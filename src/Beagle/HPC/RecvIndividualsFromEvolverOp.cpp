@@ -67,19 +67,41 @@ void HPC::RecvIndividualsFromEvolverOp::operate(Deme& ioDeme, Context& ioContext
 {
 	Beagle_StackTraceBeginM();
 
-	std::string lPopulationString;
-
-	mComm->receive(lPopulationString, "Individuals", "Parent");
+	mComm->receive(mMessage, "Individuals", "Parent");
 
 	Beagle_LogDetailedM(
 		ioContext.getSystem().getLogger(),
 		std::string("Evaluator receive individuals from his parent evolver")
 	);
 
-	std::istringstream lInStream(lPopulationString);
-	PACC::XML::Document lDocument(lInStream);
-	ioDeme.readPopulation(lDocument.getFirstRoot(),ioContext);
+	readIndividuals(mMessage, mComm->isBinaryTransport(), ioDeme, ioContext);
+
+	Beagle_StackTraceEndM();
+}
+
 
+/*!
+ *  \brief Read a group of individuals received from the evolver into a deme.
+ *  \param inMessage Message received.
+ *  \param inBinary Whether the message uses the binary archive format instead of XML.
+ *  \param ioDeme Deme into which the individuals are read.
+ *  \param ioContext Current context of the evolution.
+ */
+void HPC::RecvIndividualsFromEvolverOp::readIndividuals(const std::string& inMessage,
+                                                        bool inBinary,
+                                                        Deme& ioDeme,
+                                                        Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	if(inBinary) {
+		BinaryInArchive lArchive(inMessage);
+		lArchive.readHeader();
+		ioDeme.readPopulationBinary(lArchive, ioContext);
+	} else {
+		std::istringstream lInStream(inMessage);
+		PACC::XML::Document lDocument(lInStream);
+		ioDeme.readPopulation(lDocument.getFirstRoot(),ioContext);
+	}
 	Beagle_StackTraceEndM();
 }
 
@@ -66,8 +66,11 @@ namespace HPC {
 
 		virtual void operate(Deme& ioDeme, Context& ioContext);
 		virtual void init(System& ioSystem);
+
+		static void readIndividuals(const std::string& inMessage, bool inBinary, Deme& ioDeme, Context& ioContext);
 	protected:
 		HPC::MPICommunication::Handle mComm;
+		std::string mMessage;  //!< Buffer reused for the messages received.
 	};
 }
 }
@@ -64,6 +64,16 @@ void HPC::RecvProcessedFromEvolverOp::init(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return False, communications with the other nodes are not thread-safe.
+ */
+bool HPC::RecvProcessedFromEvolverOp::isDemeLocal(void) const
+{
+	return false;
+}
+
+
 /*!
  *  \brief Receive a deme content from an evolver node.
  *  \param ioDeme Deme to update by the receive deme.
@@ -64,6 +64,7 @@ namespace HPC{
 		virtual ~RecvProcessedFromEvolverOp() {}
 
 		Beagle::Fitness::Handle evaluate(Individual& inIndividual, Context& ioContext);
+		virtual bool isDemeLocal(void) const;
 		virtual void operate(Deme& ioDeme, Context& ioContext);
 		
 		virtual void init(System& ioSystem);
@@ -44,7 +44,10 @@ using namespace Beagle;
  *  \brief Construct the SendFitnessToEvolverOp operator.
  *  \param inName Name of the operator.
  */
-HPC::SendFitnessToEvolverOp::SendFitnessToEvolverOp(std::string inName) : Operator(inName) {}
+HPC::SendFitnessToEvolverOp::SendFitnessToEvolverOp(std::string inName) :
+	Operator(inName),
+	mChunkOperatorsSet(false)
+{ }
 
 
 /*!
@@ -59,24 +62,112 @@ void HPC::SendFitnessToEvolverOp::init(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Look up the operators to apply on each chunk of individuals pulled from the evolver.
+ *  \param ioContext Current context of the evolution.
+ *  \throw Beagle::RunTimeException If the operator is not preceded by a RecvIndividualsFromEvolverOp.
+ *
+ *  The chunk operators are those located between the last RecvIndividualsFromEvolverOp
+ *  and this operator, in the evaluator operator set of the evolver.
+ */
+void HPC::SendFitnessToEvolverOp::findChunkOperators(Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	mChunkOperators.clear();
+	const Evolver& lEvolver = ioContext.getEvolver();
+	const Operator::Bag* lSets[2] = { &lEvolver.getBootStrapSet(), &lEvolver.getMainLoopSet() };
+	for(unsigned int i=0; i<2; ++i) {
+		for(unsigned int j=0; j<lSets[i]->size(); ++j) {
+			const SwitchTypeOp* lSwitch = dynamic_cast<const SwitchTypeOp*>((*lSets[i])[j].getPointer());
+			if((lSwitch == NULL) || (lSwitch->hasSet(mComm->getNodeType()) == false)) continue;
+			const Operator::Bag& lOperators = lSwitch->getSet(mComm->getNodeType());
+			int lRecvIndex = -1;
+			for(unsigned int k=0; k<lOperators.size(); ++k) {
+				if(dynamic_cast<const RecvIndividualsFromEvolverOp*>(lOperators[k].getPointer()) != NULL) {
+					lRecvIndex = k;
+				} else if(lOperators[k].getPointer() == this) {
+					if(lRecvIndex < 0) break;
+					for(unsigned int l=lRecvIndex+1; l<k; ++l) mChunkOperators.push_back(lOperators[l]);
+					mChunkOperatorsSet = true;
+					return;
+				}
+			}
+		}
+	}
+	std::ostringstream lOSS;
+	lOSS << "Operator '" << getName() << "' must be preceded by a RecvIndividualsFromEvolverOp ";
+	lOSS << "in the evaluator operator set when individuals are pulled by chunks!";
+	throw Beagle_RunTimeExceptionM(lOSS.str());
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Send fitness of an individuals group to evolver node.
  *  \param ioDeme Current deme to execute the operator.
  *  \param ioContext Current context to execute the operator.
  */
 void HPC::SendFitnessToEvolverOp::operate(Deme& ioDeme, Context& ioContext)
-{	
-	std::ostringstream lOutStream;
-	PACC::XML::Streamer lStreamer(lOutStream);
-	lStreamer.openTag("Bag",false);
-	for(unsigned int i = 0; i < ioDeme.size(); ++i){
-		ioDeme[i]->getFitness()->write(lStreamer,false);
+{
+	Beagle_StackTraceBeginM();
+	if(mComm->getChunkSize() == 0) {
+		mComm->send(writeFitness(ioDeme), "Fitness", "Parent");
+		Beagle_LogDetailedM(
+			ioContext.getSystem().getLogger(),
+			std::string("Evaluator send fitness to his evolver")
+		);
+		return;
 	}
-	lStreamer.closeTag();
-	mComm->send(lOutStream.str(), "Fitness", "Parent");
-	Beagle_LogDetailedM(
-		ioContext.getSystem().getLogger(),
-		std::string("Evaluator send fitness to his evolver")
-	);
+
+	if(mChunkOperatorsSet == false) findChunkOperators(ioContext);
+	while(ioDeme.size() > 0) {
+		mComm->send(writeFitness(ioDeme), "Fitness", "Parent");
+		Beagle_LogDetailedM(
+			ioContext.getSystem().getLogger(),
+			std::string("Evaluator send fitness of a chunk of ")+uint2str(ioDeme.size())+
+			std::string(" individuals to his evolver")
+		);
+
+		mComm->receive(mMessage, "Individuals", "Parent");
+		RecvIndividualsFromEvolverOp::readIndividuals(mMessage, mComm->isBinaryTransport(), ioDeme, ioContext);
+		for(unsigned int i=0; (i<mChunkOperators.size()) && (ioDeme.size()>0); ++i) {
+			mChunkOperators[i]->operate(ioDeme, ioContext);
+		}
+	}
+	Beagle_StackTraceEndM();
 }
 
+
+/*!
+ *  \brief Write the fitness of the individuals of a deme into a message for the evolver.
+ *  \param inDeme Deme of the individuals.
+ *  \return Message written, valid until the next call.
+ *
+ *  With the binary transport, the message is made of (index, fitness) records packed
+ *  in an archive whose storage is reused from one call to the other.
+ */
+const std::string& HPC::SendFitnessToEvolverOp::writeFitness(const Deme& inDeme)
+{
+	Beagle_StackTraceBeginM();
+	if(mComm->isBinaryTransport()) {
+		mArchive.clear();
+		mArchive.writeHeader();
+		mArchive.writeUInt(inDeme.size());
+		for(unsigned int i = 0; i < inDeme.size(); ++i){
+			mArchive.writeUInt(i);
+			inDeme[i]->getFitness()->writeBinary(mArchive);
+		}
+		return mArchive.getBuffer();
+	} else {
+		std::ostringstream lOutStream;
+		PACC::XML::Streamer lStreamer(lOutStream);
+		lStreamer.openTag("Bag",false);
+		for(unsigned int i = 0; i < inDeme.size(); ++i){
+			inDeme[i]->getFitness()->write(lStreamer,false);
+		}
+		lStreamer.closeTag();
+		mMessage = lOutStream.str();
+		return mMessage;
+	}
+	Beagle_StackTraceEndM();
+}
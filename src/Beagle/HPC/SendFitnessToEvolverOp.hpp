@@ -68,7 +68,14 @@ namespace HPC{
 		virtual void operate(Deme& ioDeme, Context& ioContext);
 		virtual void init(System& ioSystem);
 	protected:
+		virtual void findChunkOperators(Context& ioContext);
+		const std::string& writeFitness(const Deme& inDeme);
+
 		HPC::MPICommunication::Handle mComm;
+		Operator::Bag                 mChunkOperators;    //!< Operators applied to each chunk pulled.
+		bool                          mChunkOperatorsSet; //!< Whether the chunk operators were looked up.
+		BinaryOutArchive              mArchive;           //!< Archive reused to write the fitness.
+		std::string                   mMessage;           //!< Buffer reused for the messages.
 	};
 }
 }
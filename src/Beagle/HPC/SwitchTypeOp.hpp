@@ -92,6 +92,17 @@ public:
 		Beagle_StackTraceEndM();
 	}
 
+	/*!
+	 *  \brief Return whether an operator set is associated to a node type.
+	 *  \param inType Type of the node.
+	 */
+	inline bool hasSet(const std::string& inType) const
+	{
+		Beagle_StackTraceBeginM();
+		return mOperatorSetMap.find(inType) != mOperatorSetMap.end();
+		Beagle_StackTraceEndM();
+	}
+
 	/*!
 	 *  \brief Insert an operator in the corresponding inType set of the switch case operator.
 	 *  \param inType Node type that will execute the operator \c inOperator.
@@ -104,6 +104,20 @@ void IntVec::IntegerVector::swap(unsigned int inI, unsigned int inJ)
 }
 
 
+/*!
+ *  \brief Compute a hash value of the integer vector.
+ *  \return Hash value, equal for integer vectors that are equal.
+ */
+unsigned long IntVec::IntegerVector::computeHash() const
+{
+	Beagle_StackTraceBeginM();
+	unsigned long lHash = size();
+	for(unsigned int i=0; i<size(); ++i) lHash = combineHash(lHash, (unsigned long)(*this)[i]);
+	return lHash;
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief  Test if two integer vectors are equals.
  *  \param  inRightObj Second integer vector used for the comparison.
@@ -138,6 +152,22 @@ bool IntVec::IntegerVector::isLess(const Object& inRightObj) const
 }
 
 
+/*!
+ *  \brief Read a integer vector from a binary archive.
+ *  \param ioArchive Binary archive from which the integer vector is read.
+ *  \param ioContext Evolutionary context.
+ */
+void IntVec::IntegerVector::readBinary(BinaryInArchive& ioArchive, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	clear();
+	const unsigned int lSize = ioArchive.readUInt();
+	reserve(lSize);
+	for(unsigned int i=0; i<lSize; ++i) push_back(ioArchive.readInt());
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Read a float vector from a XML subtree.
  *  \param inIter XML iterator from which the float vector is read.
@@ -176,6 +206,19 @@ void IntVec::IntegerVector::readWithContext(PACC::XML::ConstIterator inIter, Con
 }
 
 
+/*!
+ *  \brief Write a integer vector into a binary archive.
+ *  \param ioArchive Binary archive into which the integer vector is written.
+ */
+void IntVec::IntegerVector::writeBinary(BinaryOutArchive& ioArchive) const
+{
+	Beagle_StackTraceBeginM();
+	ioArchive.writeUInt(size());
+	for(unsigned int i=0; i<size(); ++i) ioArchive.writeInt((*this)[i]);
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Write a float vector into a XML streamer.
  *  \param ioStreamer XML streamer into which the float vector is written.
@@ -71,13 +71,16 @@ public:
 
 	explicit IntegerVector(unsigned int inSize=0, int inModel=0);
 
+	virtual unsigned long       computeHash() const;
 	virtual void                copy(const Member& inOriginal, System& ioSystem);
 	virtual unsigned int        getSize() const;
 	virtual const std::string&  getType() const;
 	virtual bool                isEqual(const Object& inRightObj) const;
 	virtual bool                isLess(const Object& inRightObj) const;
+	virtual void                readBinary(BinaryInArchive& ioArchive, Context& ioContext);
 	virtual void                readWithContext(PACC::XML::ConstIterator inIter, Context& ioContext);
 	virtual void				swap(unsigned int inI, unsigned inJ);
+	virtual void                writeBinary(BinaryOutArchive& ioArchive) const;
 	virtual void                writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
 };
@@ -58,6 +58,8 @@ IntVec::MutationUniformOp::MutationUniformOp(std::string inMutationPbName,
  *  \param ioIndividual IntVec individual to mutate.
  *  \param ioContext Context of the evolution.
  *  \return True if the individual is effectively mutated, false if not.
+ *
+ *  The gap between two mutated integers is drawn from a geometric distribution.
  */
 bool IntVec::MutationUniformOp::mutate(Beagle::Individual& ioIndividual, Context& ioContext)
 {
@@ -70,6 +72,9 @@ bool IntVec::MutationUniformOp::mutate(Beagle::Individual& ioIndividual, Context
 	    "Integer uniform mutation probability is: " << dbl2str(mIntMutateProba->getWrappedValue())
 	);
 
+	Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+	const double lIntMutateProba = mIntMutateProba->getWrappedValue();
+	std::vector<unsigned long> lSkips;
 	for(unsigned int i=0; i<ioIndividual.size(); i++) {
 		IntVec::IntegerVector::Handle lIV = castHandleT<IntVec::IntegerVector>(ioIndividual[i]);
 		Beagle_LogVerboseM(
@@ -80,16 +85,26 @@ bool IntVec::MutationUniformOp::mutate(Beagle::Individual& ioIndividual, Context
 		    ioContext.getSystem().getLogger(),
 		    *lIV
 		);
-		for(unsigned int j=0; j<lIV->size(); j++) {
-			double lRolledPb = ioContext.getSystem().getRandomizer().rollUniform();
-			if(lRolledPb <= mIntMutateProba->getWrappedValue()) {
-				const int lMaxVal = j<mMaxValue->size() ? (*mMaxValue)[j] : mMaxValue->back();
-				const int lMinVal = j<mMinValue->size() ? (*mMinValue)[j] : mMinValue->back();
-				Beagle_AssertM(lMaxVal >= lMinVal);
-				const int lRandVal = (int)ioContext.getSystem().getRandomizer().rollInteger(0,lMaxVal-lMinVal);
-				(*lIV)[j] = (lRandVal+lMinVal);
-				lMutated = true;
+		// Draw the gaps between mutated integers by blocks sized on the expected number of mutations.
+		const unsigned long lSize = lIV->size();
+		lSkips.resize((unsigned int)(lSize*std::min(lIntMutateProba, 1.0)) + 1);
+		lRandomizer.fillGeometric(&lSkips[0], lSkips.size(), lIntMutateProba);
+		unsigned int lNextSkip = 0;
+		unsigned long j = lSkips[lNextSkip++];
+		while(j < lSize) {
+			const int lMaxVal = j<mMaxValue->size() ? (*mMaxValue)[j] : mMaxValue->back();
+			const int lMinVal = j<mMinValue->size() ? (*mMinValue)[j] : mMinValue->back();
+			Beagle_AssertM(lMaxVal >= lMinVal);
+			const int lRandVal = (int)lRandomizer.rollInteger(0,lMaxVal-lMinVal);
+			(*lIV)[j] = (lRandVal+lMinVal);
+			lMutated = true;
+			if(lNextSkip == lSkips.size()) {
+				lRandomizer.fillGeometric(&lSkips[0], lSkips.size(), lIntMutateProba);
+				lNextSkip = 0;
 			}
+			const unsigned long lSkip = lSkips[lNextSkip++];
+			if(lSkip >= lSize) break;
+			j += lSkip + 1;
 		}
 		if(lMutated) {
 			Beagle_LogVerboseM(
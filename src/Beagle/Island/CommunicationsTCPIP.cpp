@@ -34,10 +34,97 @@
 
 #include "Beagle/Island.hpp"
 
+#ifdef WIN32
+#include <winsock2.h>
+#else // WIN32
+#include <pthread.h>
+#include <signal.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <time.h>
+#endif // WIN32
+
+// There is no SIGPIPE to block on WIN32, nor where sockets have option SO_NOSIGPIPE.
+#if !defined(WIN32) && !defined(SO_NOSIGPIPE)
+#define BEAGLE_BLOCK_SIGPIPE
+#endif
+
 using namespace Beagle;
 using namespace Beagle::Distrib;
 
 
+namespace
+{
+
+/*!
+ *  \brief Test whether a connection was closed by the receiving end.
+ *  \param inDescriptor Descriptor of the connection.
+ *  \return True if the connection was closed or failed, false otherwise.
+ *
+ *  The receiving end never writes on the connections, so a readable connection
+ *  means that it reached end-of-file or failed.
+ */
+bool isClosedByPeer(int inDescriptor)
+{
+	fd_set lReadSet;
+	FD_ZERO(&lReadSet);
+	FD_SET(inDescriptor, &lReadSet);
+	struct timeval lTimeOut = { 0, 0 };
+	return (select(inDescriptor+1, &lReadSet, NULL, NULL, &lTimeOut) != 0);
+}
+
+
+/*!
+ *  \brief Block SIGPIPE in the calling thread for the lifetime of the object.
+ *
+ *  Writing on a connection closed by the receiving end raises SIGPIPE, which terminates
+ *  the program by default.  Where the SO_NOSIGPIPE socket option exists, it is set on
+ *  each connection and this class does nothing, as on WIN32 which has no SIGPIPE.  Otherwise, the signal is blocked in the
+ *  sending thread only, and a SIGPIPE raised by the send is discarded before the signal
+ *  mask is restored.  The disposition of SIGPIPE for the rest of the process is unchanged.
+ */
+class SigPipeBlocker
+{
+public:
+	SigPipeBlocker()
+	{
+#ifdef BEAGLE_BLOCK_SIGPIPE
+		sigemptyset(&mPipeSet);
+		sigaddset(&mPipeSet, SIGPIPE);
+		sigset_t lPending;
+		sigpending(&lPending);
+		mWasPending = (sigismember(&lPending, SIGPIPE) == 1);
+		pthread_sigmask(SIG_BLOCK, &mPipeSet, &mOldMask);
+#endif // BEAGLE_BLOCK_SIGPIPE
+	}
+
+	~SigPipeBlocker()
+	{
+#ifdef BEAGLE_BLOCK_SIGPIPE
+		// A SIGPIPE already pending before the send is left for its owner.
+		if (!mWasPending) {
+			sigset_t lPending;
+			sigpending(&lPending);
+			if (sigismember(&lPending, SIGPIPE) == 1) {
+				struct timespec lZero = { 0, 0 };
+				sigtimedwait(&mPipeSet, NULL, &lZero);
+			}
+		}
+		pthread_sigmask(SIG_SETMASK, &mOldMask, NULL);
+#endif // BEAGLE_BLOCK_SIGPIPE
+	}
+
+private:
+#ifdef BEAGLE_BLOCK_SIGPIPE
+	sigset_t mPipeSet;     //!< Set made of SIGPIPE only.
+	sigset_t mOldMask;     //!< Signal mask of the thread before blocking SIGPIPE.
+	bool     mWasPending;  //!< Whether SIGPIPE was pending before blocking it.
+#endif // BEAGLE_BLOCK_SIGPIPE
+};
+
+}
+
+
 /*!
  *  \brief Construct CommunicationsTCPIP component.
  *  \param inPortNumber Port number on which to listen.  If set to -1,
@@ -55,11 +142,15 @@ Island::CommunicationsTCPIP::CommunicationsTCPIP(unsigned int inPortNumber,
 /*!
  *  \brief CommunicationsTCPIP destructor.
  *
- *  Stops the receiving thread.
+ *  Stops the receiving thread and closes the connections kept open.
  */
 Island::CommunicationsTCPIP::~CommunicationsTCPIP()
 {
 	delete mReceiver;
+	for (ConnectionMapType::iterator lItr = mConnections.begin();
+	        lItr != mConnections.end(); ++lItr) {
+		delete lItr->second;
+	}
 }
 
 
@@ -82,6 +173,71 @@ void Island::CommunicationsTCPIP::addAddress(const std::string& inName,
 
 
 
+/*!
+ *  \brief Close the connection kept open to an address, if any.
+ *  \param inAddress Name of the address.
+ */
+void Island::CommunicationsTCPIP::closeConnection(const std::string& inAddress)
+{
+	Beagle_StackTraceBeginM();
+	ConnectionMapType::iterator lItr = mConnections.find(inAddress);
+	if (lItr == mConnections.end()) return;
+	delete lItr->second;
+	mConnections.erase(lItr);
+	Beagle_StackTraceEndM();
+}
+
+
+/*!
+ *  \brief Get the connection to an address, connecting if none is open.
+ *  \param inAddress Name of the address.
+ *  \param inTCPIPAddress TCP/IP address of given name.
+ *  \param ioContext Evolutionary context of the operation.
+ *  \return Connection to the address.
+ *  \throw PACC::Socket::Exception If the connection failed.
+ */
+PACC::Socket::Cafe& Island::CommunicationsTCPIP::getConnection(const std::string& inAddress,
+        const PACC::Socket::Address& inTCPIPAddress,
+        Beagle::Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	ConnectionMapType::iterator lItr = mConnections.find(inAddress);
+	if (lItr != mConnections.end()) {
+		if (!isClosedByPeer(lItr->second->getDescriptor())) return *lItr->second;
+		Beagle_LogDebugM(
+		    ioContext.getSystem().getLogger(),
+		    std::string("Connection to ")+inTCPIPAddress.getIPAddress()+":"+
+		    uint2str(inTCPIPAddress.getPortNumber())+" was closed by the receiving end"
+		);
+		closeConnection(inAddress);
+	}
+
+	// Connect to address
+	Beagle_LogDebugM(
+	    ioContext.getSystem().getLogger(),
+	    std::string("Connecting to ")+inTCPIPAddress.getIPAddress()+":"+uint2str(inTCPIPAddress.getPortNumber())
+	);
+	PACC::Socket::Cafe* lConnection = new PACC::Socket::Cafe;
+	try {
+		lConnection->connect(inTCPIPAddress);
+	} catch (PACC::Socket::Exception&) {
+		delete lConnection;
+		throw;
+	}
+
+	// Set timeout to 30 seconds
+	lConnection->setSockOpt( PACC::Socket::eSendTimeOut, 30.0 );
+#ifdef SO_NOSIGPIPE
+	// Writing on the connection once closed by the receiving end fails instead of raising SIGPIPE
+	int lNoSigPipe = 1;
+	setsockopt(lConnection->getDescriptor(), SOL_SOCKET, SO_NOSIGPIPE, &lNoSigPipe, sizeof(lNoSigPipe));
+#endif // SO_NOSIGPIPE
+	mConnections[inAddress] = lConnection;
+	return *lConnection;
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Get message queue from receiving thread.
  *  \return Message queue.
@@ -327,7 +483,9 @@ void Island::CommunicationsTCPIP::readWithSystem(PACC::XML::ConstIterator inIter
  *  \param inMessage The body of the message.
  *  \param ioContext Evolutionary context of the operation.
  *
- *  The message is sent immediately.
+ *  The message is sent immediately, as one frame on the connection kept open to
+ *  the receiver.  SIGPIPE is suppressed for this connection only (see SigPipeBlocker),
+ *  so a receiver that went away makes the send fail with an exception.
  */
 void Island::CommunicationsTCPIP::sendMessage(const std::string& inAddress,
         const std::string& inRecipient,
@@ -344,45 +502,53 @@ void Island::CommunicationsTCPIP::sendMessage(const std::string& inAddress,
 		 inAddress+std::string("' unknown"));
 	}
 
-	try {
-		// Connect to address
-		Beagle_LogDebugM(
-		    ioContext.getSystem().getLogger(),
-		    std::string("Connecting to ")+lAddress.getIPAddress()+":"+uint2str(lAddress.getPortNumber())
-		);
-		PACC::Socket::Cafe lConnection;
-		lConnection.connect(lAddress);
+	// Frame recipient and body of the message
+	mFrame.clear();
+	mFrame.writeHeader();
+	mFrame.writeString(inRecipient);
+	mFrame.writeString(inMessage);
 
-		// Set timeout to 30 seconds
-		lConnection.setSockOpt( PACC::Socket::eSendTimeOut, 30.0 );
+	// A connection kept open may have failed since the previous message, in which case
+	// the message is sent again on a new connection.
+	for (unsigned int lAttempt=0; lAttempt<2; ++lAttempt) {
+		const bool lReused = (mConnections.find(inAddress) != mConnections.end());
+		try {
+			PACC::Socket::Cafe& lConnection = getConnection(inAddress, lAddress, ioContext);
 
-		// Send message to receiver
-		Beagle_LogDebugM(
-		    ioContext.getSystem().getLogger(),
-		    std::string("Sending message")
-		);
-		lConnection.sendMessage(inRecipient);
-		lConnection.sendMessage(inMessage);
-		Beagle_LogDebugM(
-		    ioContext.getSystem().getLogger(),
-		    std::string("Message sent successfully")
-		);
-	} catch (PACC::Socket::Exception& inException) {
-		if (inException.getErrorCode() == PACC::Socket::eConnectionRefused) {
-			Beagle_LogBasicM(
+			// Send message to receiver
+			Beagle_LogDebugM(
 			    ioContext.getSystem().getLogger(),
-			    std::string("WARNING: failed to send message to '")+inAddress+
-			    "' (recipient '"+inRecipient+"'); couldn't connect to "+lAddress.getIPAddress()+":"+
-			    uint2str(lAddress.getPortNumber())
+			    std::string("Sending message")
 			);
-		} else if (inException.getErrorCode() == PACC::Socket::eConnectionClosed) {
-			Beagle_LogBasicM(
+			{
+				SigPipeBlocker lBlocker;
+				lConnection.sendMessage(mFrame.getBuffer());
+			}
+			Beagle_LogDebugM(
 			    ioContext.getSystem().getLogger(),
-			    std::string("WARNING: failed to send message to '")+inAddress+
-			    "' (recipient '"+inRecipient+"'); connection was closed by the receiving end"
+			    std::string("Message sent successfully")
 			);
-		} else {
-			throw;
+			return;
+		} catch (PACC::Socket::Exception& inException) {
+			closeConnection(inAddress);
+			if (lReused) continue;
+			if (inException.getErrorCode() == PACC::Socket::eConnectionRefused) {
+				Beagle_LogBasicM(
+				    ioContext.getSystem().getLogger(),
+				    std::string("WARNING: failed to send message to '")+inAddress+
+				    "' (recipient '"+inRecipient+"'); couldn't connect to "+lAddress.getIPAddress()+":"+
+				    uint2str(lAddress.getPortNumber())
+				);
+			} else if (inException.getErrorCode() == PACC::Socket::eConnectionClosed) {
+				Beagle_LogBasicM(
+				    ioContext.getSystem().getLogger(),
+				    std::string("WARNING: failed to send message to '")+inAddress+
+				    "' (recipient '"+inRecipient+"'); connection was closed by the receiving end"
+				);
+			} else {
+				throw;
+			}
+			return;
 		}
 	}
 	Beagle_StackTraceEndM();
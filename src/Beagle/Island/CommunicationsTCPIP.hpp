@@ -51,6 +51,9 @@ namespace Island
  *  \class CommunicationsTCPIP beagle/CommunicationsTCPIP.hpp "beagle/CommunicationsTCPIP.hpp"
  *  \brief Concrete class for Communications system-component. Implements TCP/IP communications.
  *  \ingroup DBIM
+ *
+ *  A connection is opened to an address at the first message sent to it, and kept open
+ *  for the following messages.  It is opened again when the receiving end closed it.
  */
 class CommunicationsTCPIP : public Communications
 {
@@ -88,7 +91,13 @@ private:
 
 	//! Typedef for a map that maps names to TCP/IP addresses
 	typedef std::map< std::string, PACC::Socket::Address > AddressToTCPIPMapType;
+	//! Typedef for a map that maps names to open connections
+	typedef std::map< std::string, PACC::Socket::Cafe* > ConnectionMapType;
 
+	void closeConnection(const std::string& inAddress);
+	PACC::Socket::Cafe& getConnection(const std::string& inAddress,
+	                                  const PACC::Socket::Address& inTCPIPAddress,
+	                                  Beagle::Context& ioContext);
 	virtual void getMessageQueue(MessageQueueType& ioQueue);
 	bool getTCPIPAddress(const std::string& inAddress,
 	                     PACC::Socket::Address& outAddress);
@@ -99,6 +108,10 @@ private:
 	unsigned int mPortNumber;
 	//! Pointer to the message-receiving thread
 	CommunicationsTCPIPReceiver* mReceiver;
+	//! Map to map names to the connections kept open
+	ConnectionMapType mConnections;
+	//! Archive reused to frame the messages sent
+	BinaryOutArchive mFrame;
 
 };
 
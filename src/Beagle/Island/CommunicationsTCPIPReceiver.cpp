@@ -34,10 +34,39 @@
 
 #include "Beagle/Island.hpp"
 
+#include <algorithm>
+
+#ifdef WIN32
+#include <winsock2.h>
+#else // WIN32
+#include <errno.h>
+#include <sys/select.h>
+#endif // WIN32
+
 using namespace Beagle;
 using namespace Beagle::Distrib;
 
 
+namespace
+{
+
+/*!
+ *  \brief Test whether a descriptor can still be waited on with select.
+ *  \param inDescriptor Descriptor to test.
+ *  \return True if select accepts the descriptor, false if it fails on it.
+ */
+bool isSelectable(int inDescriptor)
+{
+	fd_set lReadSet;
+	FD_ZERO(&lReadSet);
+	FD_SET(inDescriptor, &lReadSet);
+	struct timeval lTimeOut = { 0, 0 };
+	return (select(inDescriptor+1, &lReadSet, NULL, NULL, &lTimeOut) >= 0);
+}
+
+}
+
+
 const unsigned int Island::CommunicationsTCPIPReceiver::QueueMax = 10;
 
 /*!
@@ -113,52 +142,102 @@ void Island::CommunicationsTCPIPReceiver::getQueue(Island::CommunicationsTCPIPRe
 	mQueueMutex.unlock();
 }
 
+/*!
+ *  \brief Receive a message frame on a connection and store it in the queue.
+ *  \param ioConnection Connection on which a frame is ready to be received.
+ *  \return False if the connection failed and must be dropped, true otherwise.
+ */
+bool Island::CommunicationsTCPIPReceiver::receiveFrame(PACC::Socket::Cafe& ioConnection)
+{
+	try {
+		ioConnection.receiveMessage(mFrame);
+		BinaryInArchive lArchive(mFrame);
+		lArchive.readHeader();
+		MessageType lMessage;
+		lMessage.first = lArchive.readString();
+		lMessage.second = lArchive.readString();
+
+		// Store message
+		mQueueMutex.lock();
+		mQueue.push_back( lMessage );
+		mQueueMutex.unlock();
+		return true;
+	} catch (PACC::Socket::Exception&) {
+		// The connection was closed at the sending end, timed out, or its signature (Cafe)
+		// was invalid.  The sender will connect again for its next message.
+		return false;
+	} catch (Beagle::Exception&) {
+		// The frame is not a valid archive.  Oh well, just ignore the sender.
+		return false;
+	}
+}
+
+
 /*!
  *  \brief The main method of the thread
  *
- *  This method accepts connections; receives messages and stores them in the queue.
+ *  This method accepts connections and keeps them open.  It waits for activity on
+ *  all of them at once; receives messages and stores them in the queue.  When the wait
+ *  fails for another reason than a signal, the connections that select no longer accepts
+ *  are dropped, and the next wait is delayed so that a failing wait does not spin.
  */
 void Island::CommunicationsTCPIPReceiver::main()
 {
 	try {
 		// Wait for activity
 		while (true) {
-			while(!waitForActivity(10)) {
+			fd_set lReadSet;
+			while (true) {
+				FD_ZERO(&lReadSet);
+				FD_SET(getDescriptor(), &lReadSet);
+				int lMaxDescriptor = getDescriptor();
+				for (unsigned int i=0; i<mConnections.size(); ++i) {
+					FD_SET(mConnections[i]->getDescriptor(), &lReadSet);
+					lMaxDescriptor = std::max(lMaxDescriptor, mConnections[i]->getDescriptor());
+				}
+				struct timeval lTimeOut = { 10, 0 };
+				const int lNbReady = select(lMaxDescriptor+1, &lReadSet, NULL, NULL, &lTimeOut);
+				if (lNbReady > 0) break;
 				if (mCancel) break;
+				if (lNbReady < 0) {
+#ifndef WIN32
+					if (errno == EINTR) continue;
+#endif // WIN32
+					for (unsigned int i=0; i<mConnections.size(); ) {
+						if (isSelectable(mConnections[i]->getDescriptor()) == false) {
+							delete mConnections[i];
+							mConnections.erase(mConnections.begin()+i);
+						} else ++i;
+					}
+					PACC::Threading::Thread::sleep(0.1);
+				}
 			}
 			if (mCancel) break;
 
-			try {
-				int lDescriptor = accept();
-				PACC::Socket::Cafe lConnection(lDescriptor);
-
-				// Who's the connection from?
-				PACC::Socket::Address lAddress = lConnection.getPeerAddress();
-
-				// Get message
-				std::string lRecipient;
-				std::string lMessageBody;
-				lConnection.receiveMessage(lRecipient);
-				lConnection.receiveMessage(lMessageBody);
-				MessageType lMessage(lRecipient, lMessageBody);
-
-				// Close connection
-				lConnection.close();
-
-				// Store message
-				mQueueMutex.lock();
-				mQueue.push_back( lMessage );
-				mQueueMutex.unlock();
-			} catch (PACC::Socket::Exception& inException) {
-				if (inException.getErrorCode() == PACC::Socket::eBadMessage) {
-					// The signature (Cafe) was invalid.  Oh well, just ignore the message.
-				} else if (inException.getErrorCode() == PACC::Socket::eConnectionClosed) {
-					// The connection was closed at the sending end.  Oh well, just ignore the message.
-				} else if (inException.getErrorCode() == PACC::Socket::eTimeOut) {
-					// Send or receive timed out.  Oh well, just ignore the message.
-				} else throw; // Rethrow exception
+			// Get messages, dropping the connections that failed
+			for (unsigned int i=0; i<mConnections.size(); ) {
+				if (FD_ISSET(mConnections[i]->getDescriptor(), &lReadSet) &&
+				        (receiveFrame(*mConnections[i]) == false)) {
+					delete mConnections[i];
+					mConnections.erase(mConnections.begin()+i);
+				} else ++i;
+			}
+
+			// Accept new connection
+			if (FD_ISSET(getDescriptor(), &lReadSet)) {
+				try {
+					PACC::Socket::Cafe* lConnection = new PACC::Socket::Cafe(accept());
+					lConnection->setSockOpt( PACC::Socket::eRecvTimeOut, 15.0 );
+					mConnections.push_back(lConnection);
+				} catch (PACC::Socket::Exception& inException) {
+					if (inException.getErrorCode() == PACC::Socket::eTimeOut) {
+						// Accept timed out.  Oh well, the sender will try again.
+					} else throw; // Rethrow exception
+				}
 			}
 		}
+		for (unsigned int i=0; i<mConnections.size(); ++i) delete mConnections[i];
+		mConnections.clear();
 		close(); // Close the receiving port
 	} catch (...) {
 		std::cerr << "\n\nUnknown exception caught in CommunicationsTCPIPReceiver!" << std::endl;
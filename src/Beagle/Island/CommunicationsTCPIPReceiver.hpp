@@ -52,6 +52,9 @@ namespace Island
  *  \class CommunicationsTCPIPReceiver beagle/CommunicationsTCPIPReceiver.hpp "beagle/CommunicationsTCPIPReceiver.hpp"
  *  \brief Thread that receives TCP/IP messages for CommunicationsTCPIP system component.
  *  \ingroup DBIM
+ *
+ *  The connections accepted are kept open, as the senders use them for all their
+ *  messages. Each message is received as one frame holding the recipient and the body.
  */
 class CommunicationsTCPIPReceiver : public PACC::Threading::Thread,
 			private PACC::Socket::TCP
@@ -80,6 +83,7 @@ public:
 protected:
 
 	virtual void main();
+	bool receiveFrame(PACC::Socket::Cafe& ioConnection);
 
 	//! Maximum number of senders that may wait to be recieved.
 	static const unsigned int QueueMax;
@@ -89,6 +93,10 @@ protected:
 	PACC::Threading::Mutex mQueueMutex;
 	//! Port number on which to listen.
 	unsigned int mPortNumber;
+	//! Connections kept open with the senders.
+	std::vector< PACC::Socket::Cafe* > mConnections;
+	//! Buffer reused to receive the frames.
+	std::string mFrame;
 
 };
 
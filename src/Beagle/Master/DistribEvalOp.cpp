@@ -158,6 +158,16 @@ void Master::DistribEvalOp::registerParams(Beagle::System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return False, evaluation is distributed through a shared server connection.
+ */
+bool Master::DistribEvalOp::isDemeLocal(void) const
+{
+	return false;
+}
+
+
 /*!
  *  \brief Apply the distribution of evaluations operation on the deme.
  *  \param ioDeme Current deme of individuals that evaluations will be distributed.
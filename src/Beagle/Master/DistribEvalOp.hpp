@@ -82,6 +82,7 @@ public:
 	{ }
 
 	virtual void init(Beagle::System& ioSystem);
+	virtual bool isDemeLocal(void) const;
 	virtual void operate(Beagle::Deme& ioDeme, Beagle::Context& ioContext);
 	virtual void registerParams(Beagle::System& ioSystem);
 
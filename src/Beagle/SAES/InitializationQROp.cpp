@@ -86,6 +86,16 @@ void SAES::InitializationQROp::init(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return False, the quasi-random sequence generator is shared by all demes.
+ */
+bool SAES::InitializationQROp::isDemeLocal(void) const
+{
+	return false;
+}
+
+
 /*!
  *  \brief Initialize SA-ES individual with initial strategy parameter.
  *  \param outIndividual Individual to initialize.
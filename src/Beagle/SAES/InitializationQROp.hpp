@@ -75,6 +75,7 @@ public:
 	{ }
 
 	virtual void init(System& ioSystem);
+	virtual bool isDemeLocal(void) const;
 	virtual void initIndividual(Individual& outIndividual, Context& ioContext);
 	virtual void registerParams(System& ioSystem);
 	
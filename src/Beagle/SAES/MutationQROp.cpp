@@ -98,6 +98,16 @@ void SAES::MutationQROp::init(System& ioSystem)
 }
 
 
+/*!
+ *  \brief Return whether the operator only modifies the deme it is applied on.
+ *  \return False, the quasi-random sequence generator is shared by all demes.
+ */
+bool SAES::MutationQROp::isDemeLocal(void) const
+{
+	return false;
+}
+
+
 /*!
  *  \brief Mutate an SA-ES individual.
  *  \param ioIndividual SA-ES individual to mutate.
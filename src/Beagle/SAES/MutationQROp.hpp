@@ -76,6 +76,7 @@ public:
 	{ }
 
 	virtual void init(System& ioSystem);
+	virtual bool isDemeLocal(void) const;
 	virtual bool mutate(Individual& ioIndividual, Context& ioContext);
 	virtual void registerParams(System& ioSystem);
 
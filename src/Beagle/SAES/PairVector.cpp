@@ -37,6 +37,7 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <cstring>
 #include <float.h>    // To get FLT_MAX on Borland C++ Builder
 
 using namespace Beagle;
@@ -130,6 +131,28 @@ void SAES::PairVector::swap(unsigned int inI, unsigned int inJ)
 }
 
 
+/*!
+ *  \brief Compute a hash value of the SA-ES vector.
+ *  \return Hash value, equal for SA-ES vectors that are equal.
+ */
+unsigned long SAES::PairVector::computeHash() const
+{
+	Beagle_StackTraceBeginM();
+	unsigned long lHash = size();
+	for(unsigned int i=0; i<size(); ++i) {
+		const double lPair[2] = { (*this)[i].mValue, (*this)[i].mStrategy };
+		for(unsigned int k=0; k<2; ++k) {
+			const double lValue = (lPair[k] == 0.0) ? 0.0 : lPair[k];  // -0.0 is equal to 0.0
+			unsigned long lBits[(sizeof(double)+sizeof(unsigned long)-1)/sizeof(unsigned long)] = { 0 };
+			std::memcpy(lBits, &lValue, sizeof(double));
+			for(unsigned int j=0; j<(sizeof(lBits)/sizeof(unsigned long)); ++j) lHash = combineHash(lHash, lBits[j]);
+		}
+	}
+	return lHash;
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief  Test if two ES vectors are equals.
  *  \param  inRightObj Second ES vector used for the comparison.
@@ -145,6 +168,25 @@ bool SAES::PairVector::isEqual(const Object& inRightObj) const
 }
 
 
+/*!
+ *  \brief Read a ES pair vector from a binary archive.
+ *  \param ioArchive Binary archive from which the ES pair vector is read.
+ *  \param ioContext Evolutionary context.
+ */
+void SAES::PairVector::readBinary(BinaryInArchive& ioArchive, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	clear();
+	const unsigned int lSize = ioArchive.readUInt();
+	resize(lSize);
+	for(unsigned int i=0; i<lSize; ++i) {
+		(*this)[i].mValue = ioArchive.readDouble();
+		(*this)[i].mStrategy = ioArchive.readDouble();
+	}
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Read a SA-ES vector from a XML subtree.
  *  \param inIter XML iterator from which the SA-ES vector is read.
@@ -186,6 +228,22 @@ void SAES::PairVector::readWithContext(PACC::XML::ConstIterator inIter, Context&
 }
 
 
+/*!
+ *  \brief Write a ES pair vector into a binary archive.
+ *  \param ioArchive Binary archive into which the ES pair vector is written.
+ */
+void SAES::PairVector::writeBinary(BinaryOutArchive& ioArchive) const
+{
+	Beagle_StackTraceBeginM();
+	ioArchive.writeUInt(size());
+	for(unsigned int i=0; i<size(); ++i) {
+		ioArchive.writeDouble((*this)[i].mValue);
+		ioArchive.writeDouble((*this)[i].mStrategy);
+	}
+	Beagle_StackTraceEndM();
+}
+
+
 /*!
  *  \brief Write an SA-ES vector into a XML streamer.
  *  \param ioStreamer XML streamer into which the ES vector is written.
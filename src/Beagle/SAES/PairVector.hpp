@@ -83,12 +83,15 @@ public:
 
 	explicit PairVector(unsigned int inSize=0, Pair inModel=Pair(0.f,1.f));
 
+	virtual unsigned long       computeHash() const;
 	virtual void                copy(const Member& inOriginal, System& ioSystem);
 	virtual unsigned int        getSize() const;
 	virtual const std::string&  getType() const;
 	virtual void				swap(unsigned int inI, unsigned inJ);
 	virtual bool                isEqual(const Object& inRightObj) const;
+	virtual void                readBinary(BinaryInArchive& ioArchive, Context& ioContext);
 	virtual void                readWithContext(PACC::XML::ConstIterator inIter, Context& ioContext);
+	virtual void                writeBinary(BinaryOutArchive& ioArchive) const;
 	virtual void                writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
 };